@@ -6,60 +6,2103 @@
 //  Copyright © 2019 Zenny Chen. All rights reserved.
 //
 
+// Multi-threaded contention benchmark of the atomic operations.
+//
+// Usage: main [suite ...] [--threads N] [--ops N] [--json] [--pin]
+//
+// Every case runs with 1, 2, 4, ... up to N threads (the number of online processors by default),
+// and reports throughput, percentiles of the per-batch latency and a fairness ratio
+// (earliest over latest thread completion time) in CSV (default) or JSON.
+// --pin binds thread i of every case to processor i (Linux and Windows).
+// Build it once against the library and once with -DZENNY_ATOMICS_HEADER_ONLY
+// to compare the out-of-line and inline builds; the `build` column tells them apart.
+// The exit status is nonzero if a correctness check, such as the stack ownership check, has failed.
+
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include "zenny_atomics.h"
+#include "zenny_atomic_counter.h"
+#include "zenny_spinlock.h"
+#include "zenny_atomic_bitmap.h"
+#include "zenny_spsc_ring.h"
+#include "zenny_mpmc_queue.h"
+#include "zenny_lockfree_stack.h"
+#include "zenny_epoch.h"
+#include "zenny_hazard.h"
+#include "zenny_seqlock.h"
+#include "zenny_rcu.h"
+#include "zenny_rwlock.h"
+#include "zenny_sync.h"
+#include "zenny_mutex.h"
 
-int main(int argc, const char * argv[])
+#ifdef _WIN32
+#include <windows.h>
+#include <process.h>
+#else
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+#ifndef _MSC_VER
+#include <stdatomic.h>
+#endif
+
+// MARK: Benchmark harness
+
+/** Number of operations timed together as one latency sample */
+#define ZENNY_BENCH_BATCH           256
+
+/** Maximum number of benchmark threads */
+#define ZENNY_BENCH_MAX_THREADS     64
+
+#ifdef ZENNY_ATOMICS_HEADER_ONLY
+#define ZENNY_BENCH_BUILD           "inline"
+#else
+#define ZENNY_BENCH_BUILD           "extern"
+#endif
+
+struct ZennyBenchThread
+{
+    /** index of this thread among the threads of the case */
+    int index;
+
+    /** number of threads running the case */
+    int threadCount;
+
+    /** number of latency samples to take; each covers ZENNY_BENCH_BATCH operations */
+    size_t sampleCount;
+
+    /** average nanoseconds per operation of each batch */
+    double *samples;
+
+    /** atomic object operated on: shared by all threads, or private to this one (padded or packed) */
+    volatile struct ZennyAtomicType *target;
+
+    /** suite specific data */
+    void *context;
+
+    /** keeps loaded values alive */
+    int64_t sink;
+
+    /** time from the start of the case until this thread finished */
+    uint64_t elapsedNs;
+};
+
+typedef void (*ZennyBenchWorker)(struct ZennyBenchThread *thread);
+
+struct ZennyBenchOptions
+{
+    int maxThreads;
+    size_t opsPerThread;
+    bool json;
+
+    /** bind each benchmark thread to its own processor */
+    bool pin;
+};
+
+static struct ZennyBenchOptions sOptions;
+static bool sFirstRecord = true;
+
+/** One object per thread, each on its own cache line */
+static struct ZennyAtomicPaddedType *sPrivateObjects;
+
+/** One object per thread, packed next to each other so that neighbours share cache lines */
+static struct ZennyAtomicType sPackedObjects[ZENNY_BENCH_MAX_THREADS];
+
+static struct ZennyAtomicPaddedType sSharedObject;
+
+static struct ZennyAtomicType sStartFlag;
+static uint64_t sStartTime;
+
+/** Set by a correctness check that failed, so that the run exits with a failure status */
+static bool sCheckFailed;
+
+static uint64_t ZennyBenchNow(void)
+{
+#ifdef _WIN32
+    static LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+    if (frequency.QuadPart == 0)
+        QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return (uint64_t)(counter.QuadPart / frequency.QuadPart * 1000000000ULL +
+                      counter.QuadPart % frequency.QuadPart * 1000000000ULL / frequency.QuadPart);
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+static int ZennyBenchProcessorCount(void)
+{
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (int)info.dwNumberOfProcessors;
+#else
+    const long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? (int)count : 1;
+#endif
+}
+
+/** Bind the calling thread to a processor, where the platform allows it */
+static void ZennyBenchPinThread(int index)
+{
+    const int processor = index % ZennyBenchProcessorCount();
+#if defined(_WIN32)
+    SetThreadAffinityMask(GetCurrentThread(), (DWORD_PTR)1 << processor);
+#elif defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(processor, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+    (void)processor;
+#endif
+}
+
+struct ZennyBenchThreadStart
 {
-    // insert code here...
-    
-    struct ZennyAtomicType flag;
-    ZennyAtomicInitFlag(&flag);
-    printf("The init value is: %d\n", ZennyAtomicLoadFlag(&flag));
-    printf("flag alignment is: %zu\n", alignof(flag));
-    
-    printf("flag value is: %d\n", ZennyAtomicTestAndSetFlag(&flag));
-    printf("flag value is: %d\n", ZennyAtomicTestAndSetFlag(&flag));
-    
-    ZennyAtomicClearFlag(&flag);
-    printf("flag value is: %d\n", ZennyAtomicTestAndSetFlag(&flag));
-    
-    puts("----------------");
-    
-    struct ZennyAtomicType atomicPtr;
-    
-    ZennyAtomicInitPtr(&atomicPtr, 100LL);
-    printf("The init value is: %td\n", ZennyAtomicLoadPtr(&atomicPtr));
-    ZennyAtomicStorePtr(&atomicPtr, 10000LL);
-    printf("The stored value is: %td\n", ZennyAtomicLoadPtr(&atomicPtr));
-    
-    intptr_t oldValue = ZennyAtomicAddPtr(&atomicPtr, 5000LL);
-    printf("The old value is: %td, the new value is: %td\n", oldValue, ZennyAtomicLoadPtr(&atomicPtr));
-    
-    puts("----------------");
-    
-    ZennyAtomicStorePtr(&atomicPtr, 0x0055);
-    oldValue = ZennyAtomicXorPtr(&atomicPtr, 0x00aa);
-    printf("The old value is: 0x%.4tX, the new value is: 0x%.4tX\n", oldValue, ZennyAtomicLoadPtr(&atomicPtr));
-
-    puts("----------------");
-
-    intptr_t value = ZennyAtomicExchangePtr(&atomicPtr, 1000);
-    printf("old value is: %td, stored value is: %td\n", value, ZennyAtomicLoadPtr(&atomicPtr));
-
-    puts("----------------");
-    
-    value = ZennyAtomicLoadPtr(&atomicPtr);
-    if(ZennyAtomicCompareExchangePtr(&atomicPtr, &value, 50))
-        puts("CAS succeeded!");
-    
-    value = 0;
-    if(!ZennyAtomicCompareExchangePtr(&atomicPtr, &value, 10))
-        printf("CAS failed! expected value is: %td\n", value);
-    
-    if(ZennyAtomicCompareExchangePtr(&atomicPtr, &value, 10))
-        printf("CAS succeeded! value = %td, new value = %td\n", value, ZennyAtomicLoadPtr(&atomicPtr));
+    struct ZennyBenchThread *thread;
+    ZennyBenchWorker worker;
+};
 
+#ifdef _WIN32
+static unsigned __stdcall ZennyBenchThreadMain(void *arg)
+#else
+static void* ZennyBenchThreadMain(void *arg)
+#endif
+{
+    struct ZennyBenchThreadStart *start = arg;
+
+    if (sOptions.pin)
+        ZennyBenchPinThread(start->thread->index);
+
+    // Wait until every thread of the case has been created
+    while (!ZennyAtomicLoadFlagExplicit(&sStartFlag, ZennyMemoryOrderAcquire));
+
+    start->worker(start->thread);
+    start->thread->elapsedNs = ZennyBenchNow() - sStartTime;
     return 0;
 }
 
+static int ZennyBenchCompareDouble(const void *a, const void *b)
+{
+    const double x = *(const double*)a;
+    const double y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+static void ZennyBenchReport(const char *family, const char *impl, const char *sharing, int threadCount,
+                             uint64_t totalOps, uint64_t elapsedNs, double *samples, size_t sampleCount, double fairness)
+{
+    qsort(samples, sampleCount, sizeof(*samples), ZennyBenchCompareDouble);
+
+    const double seconds = (double)elapsedNs / 1e9;
+    const double opsPerSecond = seconds > 0.0 ? (double)totalOps / seconds : 0.0;
+    const double nsPerOp = totalOps > 0 ? (double)elapsedNs * threadCount / (double)totalOps : 0.0;
+    const double p50 = sampleCount > 0 ? samples[sampleCount * 50 / 100] : 0.0;
+    const double p99 = sampleCount > 0 ? samples[sampleCount * 99 / 100] : 0.0;
+    const double p999 = sampleCount > 0 ? samples[sampleCount * 999 / 1000] : 0.0;
+
+    if (sOptions.json)
+    {
+        printf("%s\n  {\"build\": \"%s\", \"family\": \"%s\", \"impl\": \"%s\", \"sharing\": \"%s\", \"threads\": %d, "
+               "\"ops\": %llu, \"seconds\": %.6f, \"ops_per_sec\": %.0f, \"ns_per_op\": %.3f, "
+               "\"p50_ns\": %.3f, \"p99_ns\": %.3f, \"p999_ns\": %.3f, \"fairness\": %.3f}",
+               sFirstRecord ? "" : ",", ZENNY_BENCH_BUILD, family, impl, sharing, threadCount,
+               (unsigned long long)totalOps, seconds, opsPerSecond, nsPerOp, p50, p99, p999, fairness);
+    }
+    else
+    {
+        printf("%s,%s,%s,%s,%d,%llu,%.6f,%.0f,%.3f,%.3f,%.3f,%.3f,%.3f\n",
+               ZENNY_BENCH_BUILD, family, impl, sharing, threadCount,
+               (unsigned long long)totalOps, seconds, opsPerSecond, nsPerOp, p50, p99, p999, fairness);
+    }
+
+    sFirstRecord = false;
+    fflush(stdout);
+}
+
+/**
+ * Run a worker on `threadCount` threads and report the result.
+ * @param family operation family being measured
+ * @param impl implementation being measured
+ * @param sharing "shared" to let all threads operate on one object, "private" to give each thread its own cache line,
+ * or "packed" to give each thread its own object packed next to the objects of the other threads
+ * @param threadCount number of threads
+ * @param worker function run by each thread
+ * @param context suite specific data handed to each thread
+ */
+static void ZennyBenchRunCase(const char *family, const char *impl, const char *sharing, int threadCount,
+                              ZennyBenchWorker worker, void *context)
+{
+    const size_t sampleCount = (sOptions.opsPerThread + ZENNY_BENCH_BATCH - 1) / ZENNY_BENCH_BATCH;
+    const bool shared = strcmp(sharing, "shared") == 0;
+    const bool packed = strcmp(sharing, "packed") == 0;
+
+    struct ZennyBenchThread threads[ZENNY_BENCH_MAX_THREADS];
+    struct ZennyBenchThreadStart starts[ZENNY_BENCH_MAX_THREADS];
+    double *samples = malloc(sizeof(double) * sampleCount * (size_t)threadCount);
+    if (samples == NULL)
+    {
+        fprintf(stderr, "Out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+
+    ZennyAtomicInitLong(&sSharedObject.atomic, 0);
+    ZennyAtomicInitFlag(&sStartFlag);
+
+    for (int i = 0; i < threadCount; i++)
+    {
+        ZennyAtomicInitLong(&sPrivateObjects[i].atomic, 0);
+        ZennyAtomicInitLong(&sPackedObjects[i], 0);
+        threads[i] = (struct ZennyBenchThread){
+            .index = i,
+            .threadCount = threadCount,
+            .sampleCount = sampleCount,
+            .samples = samples + sampleCount * (size_t)i,
+            .target = shared ? &sSharedObject.atomic : packed ? &sPackedObjects[i] : &sPrivateObjects[i].atomic,
+            .context = context
+        };
+        starts[i] = (struct ZennyBenchThreadStart){ &threads[i], worker };
+    }
+
+#ifdef _WIN32
+    HANDLE handles[ZENNY_BENCH_MAX_THREADS];
+    for (int i = 0; i < threadCount; i++)
+        handles[i] = (HANDLE)_beginthreadex(NULL, 0, ZennyBenchThreadMain, &starts[i], 0, NULL);
+#else
+    pthread_t handles[ZENNY_BENCH_MAX_THREADS];
+    for (int i = 0; i < threadCount; i++)
+        pthread_create(&handles[i], NULL, ZennyBenchThreadMain, &starts[i]);
+#endif
+
+    sStartTime = ZennyBenchNow();
+    ZennyAtomicTestAndSetFlagExplicit(&sStartFlag, ZennyMemoryOrderRelease);
+
+#ifdef _WIN32
+    WaitForMultipleObjects((DWORD)threadCount, handles, TRUE, INFINITE);
+    for (int i = 0; i < threadCount; i++)
+        CloseHandle(handles[i]);
+#else
+    for (int i = 0; i < threadCount; i++)
+        pthread_join(handles[i], NULL);
+#endif
+
+    const uint64_t elapsed = ZennyBenchNow() - sStartTime;
+
+    // Every thread performs the same number of operations, so a fair case has all of them finish together
+    uint64_t earliest = UINT64_MAX;
+    uint64_t latest = 0;
+    for (int i = 0; i < threadCount; i++)
+    {
+        if (threads[i].elapsedNs < earliest)
+            earliest = threads[i].elapsedNs;
+        if (threads[i].elapsedNs > latest)
+            latest = threads[i].elapsedNs;
+    }
+
+    ZennyBenchReport(family, impl, sharing, threadCount, (uint64_t)(sampleCount * ZENNY_BENCH_BATCH) * (uint64_t)threadCount,
+                     elapsed, samples, sampleCount * (size_t)threadCount, latest > 0 ? (double)earliest / (double)latest : 1.0);
+    free(samples);
+}
+
+/** Run a worker with 1, 2, 4, ... up to the maximum number of threads */
+static void ZennyBenchRunThreads(const char *family, const char *impl, const char *sharing, ZennyBenchWorker worker, void *context)
+{
+    for (int threadCount = 1; ; threadCount *= 2)
+    {
+        if (threadCount > sOptions.maxThreads)
+            threadCount = sOptions.maxThreads;
+
+        ZennyBenchRunCase(family, impl, sharing, threadCount, worker, context);
+
+        if (threadCount == sOptions.maxThreads)
+            break;
+    }
+}
+
+/** Run a worker in both the shared-line and private-line variants for every thread count */
+static void ZennyBenchRunScaling(const char *family, const char *impl, ZennyBenchWorker worker, void *context)
+{
+    ZennyBenchRunThreads(family, impl, "shared", worker, context);
+    ZennyBenchRunThreads(family, impl, "private", worker, context);
+}
+
+/**
+ * Define a worker that times the statement given as the variadic arguments in batches of ZENNY_BENCH_BATCH.
+ * Within the statement, `target` is the atomic object and `sink` accumulates loaded values.
+ */
+#define ZENNY_BENCH_WORKER(name, ...)                                                               \
+static void name(struct ZennyBenchThread *thread)                                                   \
+{                                                                                                   \
+    volatile struct ZennyAtomicType *target = thread->target;                                       \
+    int64_t sink = 0;                                                                               \
+    for (size_t batch = 0; batch < thread->sampleCount; batch++)                                    \
+    {                                                                                               \
+        const uint64_t start = ZennyBenchNow();                                                     \
+        for (int i = 0; i < ZENNY_BENCH_BATCH; i++)                                                 \
+        {                                                                                           \
+            __VA_ARGS__;                                                                            \
+        }                                                                                           \
+        thread->samples[batch] = (double)(ZennyBenchNow() - start) / ZENNY_BENCH_BATCH;             \
+    }                                                                                               \
+    thread->sink = sink;                                                                            \
+    (void)target;                                                                                   \
+}
+
+// MARK: Atomic operation families
+
+ZENNY_BENCH_WORKER(BenchZennyLoad, sink += ZennyAtomicLoadLong(target))
+ZENNY_BENCH_WORKER(BenchZennyStore, ZennyAtomicStoreLong(target, i))
+ZENNY_BENCH_WORKER(BenchZennyAdd, sink += ZennyAtomicAddLong(target, 1))
+ZENNY_BENCH_WORKER(BenchZennyXor, sink += ZennyAtomicXorLong(target, i))
+ZENNY_BENCH_WORKER(BenchZennyExchange, sink += ZennyAtomicExchangeLong(target, i))
+ZENNY_BENCH_WORKER(BenchZennyCompareExchange,
+                   int64_t expected = ZennyAtomicLoadLong(target);
+                   while (!ZennyAtomicCompareExchangeLong(target, &expected, expected + 1));
+                   sink += expected)
+ZENNY_BENCH_WORKER(BenchZennyTestAndSetFlag,
+                   if (!ZennyAtomicTestAndSetFlag(target))
+                       ZennyAtomicClearFlag(target);
+                   else
+                       sink++)
+
+#ifndef _MSC_VER
+
+#define BENCH_RAW(target)   ((atomic_llong*)(target))
+
+ZENNY_BENCH_WORKER(BenchStdLoad, sink += atomic_load(BENCH_RAW(target)))
+ZENNY_BENCH_WORKER(BenchStdStore, atomic_store(BENCH_RAW(target), i))
+ZENNY_BENCH_WORKER(BenchStdAdd, sink += atomic_fetch_add(BENCH_RAW(target), 1))
+ZENNY_BENCH_WORKER(BenchStdXor, sink += atomic_fetch_xor(BENCH_RAW(target), i))
+ZENNY_BENCH_WORKER(BenchStdExchange, sink += atomic_exchange(BENCH_RAW(target), i))
+ZENNY_BENCH_WORKER(BenchStdCompareExchange,
+                   long long expected = atomic_load(BENCH_RAW(target));
+                   while (!atomic_compare_exchange_strong(BENCH_RAW(target), &expected, expected + 1));
+                   sink += expected)
+ZENNY_BENCH_WORKER(BenchStdTestAndSetFlag,
+                   if (!atomic_flag_test_and_set((atomic_flag*)target))
+                       atomic_flag_clear((atomic_flag*)target);
+                   else
+                       sink++)
+
+#define BENCH_BUILTIN(target)   ((long long*)(target))
+
+ZENNY_BENCH_WORKER(BenchBuiltinLoad, sink += __atomic_load_n(BENCH_BUILTIN(target), __ATOMIC_SEQ_CST))
+ZENNY_BENCH_WORKER(BenchBuiltinStore, __atomic_store_n(BENCH_BUILTIN(target), i, __ATOMIC_SEQ_CST))
+ZENNY_BENCH_WORKER(BenchBuiltinAdd, sink += __atomic_fetch_add(BENCH_BUILTIN(target), 1, __ATOMIC_SEQ_CST))
+ZENNY_BENCH_WORKER(BenchBuiltinXor, sink += __atomic_fetch_xor(BENCH_BUILTIN(target), i, __ATOMIC_SEQ_CST))
+ZENNY_BENCH_WORKER(BenchBuiltinExchange, sink += __atomic_exchange_n(BENCH_BUILTIN(target), i, __ATOMIC_SEQ_CST))
+ZENNY_BENCH_WORKER(BenchBuiltinCompareExchange,
+                   long long expected = __atomic_load_n(BENCH_BUILTIN(target), __ATOMIC_SEQ_CST);
+                   while (!__atomic_compare_exchange_n(BENCH_BUILTIN(target), &expected, expected + 1, false,
+                                                       __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST));
+                   sink += expected)
+ZENNY_BENCH_WORKER(BenchBuiltinTestAndSetFlag,
+                   if (!__atomic_test_and_set((void*)target, __ATOMIC_SEQ_CST))
+                       __atomic_clear((bool*)target, __ATOMIC_SEQ_CST);
+                   else
+                       sink++)
+
+#endif // !_MSC_VER
+
+struct ZennyBenchFamily
+{
+    const char *name;
+    ZennyBenchWorker zenny;
+    ZennyBenchWorker std;
+    ZennyBenchWorker builtin;
+};
+
+static void BenchSuiteAtomics(void)
+{
+#ifdef _MSC_VER
+#define BENCH_FAMILY(name)  { #name, BenchZenny##name, NULL, NULL }
+#else
+#define BENCH_FAMILY(name)  { #name, BenchZenny##name, BenchStd##name, BenchBuiltin##name }
+#endif
+
+    static const struct ZennyBenchFamily families[] = {
+        BENCH_FAMILY(Load),
+        BENCH_FAMILY(Store),
+        BENCH_FAMILY(Add),
+        BENCH_FAMILY(Xor),
+        BENCH_FAMILY(Exchange),
+        BENCH_FAMILY(CompareExchange),
+        BENCH_FAMILY(TestAndSetFlag)
+    };
+
+#undef BENCH_FAMILY
+
+    for (size_t i = 0; i < sizeof(families) / sizeof(families[0]); i++)
+    {
+        ZennyBenchRunScaling(families[i].name, "zenny", families[i].zenny, NULL);
+        if (families[i].std != NULL)
+            ZennyBenchRunScaling(families[i].name, "stdatomic", families[i].std, NULL);
+        if (families[i].builtin != NULL)
+            ZennyBenchRunScaling(families[i].name, "builtin", families[i].builtin, NULL);
+    }
+}
+
+// MARK: False sharing
+
+ZENNY_BENCH_WORKER(BenchPaddingAdd, sink += ZennyAtomicAddLongExplicit(target, 1, ZennyMemoryOrderRelaxed))
+ZENNY_BENCH_WORKER(BenchPaddingStore, ZennyAtomicStoreLongExplicit(target, i, ZennyMemoryOrderRelease))
+
+/** Per-thread objects packed 16 bytes apart against the same objects padded to their own cache lines */
+static void BenchSuitePadding(void)
+{
+    ZennyBenchRunThreads("Add", "zenny", "packed", BenchPaddingAdd, NULL);
+    ZennyBenchRunThreads("Add", "zenny", "private", BenchPaddingAdd, NULL);
+    ZennyBenchRunThreads("Store", "zenny", "packed", BenchPaddingStore, NULL);
+    ZennyBenchRunThreads("Store", "zenny", "private", BenchPaddingStore, NULL);
+}
+
+// MARK: Scalable counter
+
+ZENNY_BENCH_WORKER(BenchCounterSingleWord, ZennyAtomicAddLong(target, 1))
+ZENNY_BENCH_WORKER(BenchCounterStriped, ZennyAtomicCounterAdd(thread->context, 1))
+
+/** One shared int64_t word against a counter striped over as many cache lines as there are threads */
+static void BenchSuiteCounter(void)
+{
+    struct ZennyAtomicCounter counter;
+    if (!ZennyAtomicCounterInit(&counter, (unsigned)sOptions.maxThreads))
+    {
+        fprintf(stderr, "Out of memory\n");
+        return;
+    }
+
+    ZennyBenchRunThreads("CounterAdd", "single-word", "shared", BenchCounterSingleWord, NULL);
+    ZennyBenchRunThreads("CounterAdd", "striped", "shared", BenchCounterStriped, &counter);
+
+    ZennyAtomicCounterDestroy(&counter);
+}
+
+// MARK: Spin locks
+
+/** Lock under test together with the data it protects */
+struct BenchLockContext
+{
+    struct ZennySpinLock spinLock;
+    struct ZennyTicketLock ticketLock;
+    struct ZennyMCSLock mcsLock;
+#ifndef _WIN32
+    pthread_mutex_t mutex;
+#endif
+    int64_t protectedCount;
+};
+
+#define BENCH_LOCK_CONTEXT(thread)  ((struct BenchLockContext*)(thread)->context)
+
+ZENNY_BENCH_WORKER(BenchLockSpin,
+                   ZennySpinLockLock(&BENCH_LOCK_CONTEXT(thread)->spinLock);
+                   BENCH_LOCK_CONTEXT(thread)->protectedCount++;
+                   ZennySpinLockUnlock(&BENCH_LOCK_CONTEXT(thread)->spinLock))
+ZENNY_BENCH_WORKER(BenchLockTicket,
+                   ZennyTicketLockLock(&BENCH_LOCK_CONTEXT(thread)->ticketLock);
+                   BENCH_LOCK_CONTEXT(thread)->protectedCount++;
+                   ZennyTicketLockUnlock(&BENCH_LOCK_CONTEXT(thread)->ticketLock))
+ZENNY_BENCH_WORKER(BenchLockMCS,
+                   struct ZennyMCSLockNode node;
+                   ZennyMCSLockLock(&BENCH_LOCK_CONTEXT(thread)->mcsLock, &node);
+                   BENCH_LOCK_CONTEXT(thread)->protectedCount++;
+                   ZennyMCSLockUnlock(&BENCH_LOCK_CONTEXT(thread)->mcsLock, &node))
+#ifndef _WIN32
+ZENNY_BENCH_WORKER(BenchLockPthread,
+                   pthread_mutex_lock(&BENCH_LOCK_CONTEXT(thread)->mutex);
+                   BENCH_LOCK_CONTEXT(thread)->protectedCount++;
+                   pthread_mutex_unlock(&BENCH_LOCK_CONTEXT(thread)->mutex))
+#endif
+
+static void BenchRunLock(const char *impl, ZennyBenchWorker worker, struct BenchLockContext *context)
+{
+    for (int threadCount = 1; ; threadCount *= 2)
+    {
+        if (threadCount > sOptions.maxThreads)
+            threadCount = sOptions.maxThreads;
+
+        context->protectedCount = 0;
+        ZennyBenchRunCase("Lock", impl, "shared", threadCount, worker, context);
+
+        const int64_t expected = (int64_t)((sOptions.opsPerThread + ZENNY_BENCH_BATCH - 1) / ZENNY_BENCH_BATCH * ZENNY_BENCH_BATCH) * threadCount;
+        if (context->protectedCount != expected)
+        {
+            fprintf(stderr, "%s lock lost updates: %lld of %lld\n", impl, (long long)context->protectedCount, (long long)expected);
+            sCheckFailed = true;
+        }
+
+        if (threadCount == sOptions.maxThreads)
+            break;
+    }
+}
+
+/** Throughput and fairness of an increment protected by each kind of lock */
+static void BenchSuiteSpinLock(void)
+{
+    static struct BenchLockContext context;
+
+    ZennySpinLockInit(&context.spinLock);
+    ZennyTicketLockInit(&context.ticketLock);
+    ZennyMCSLockInit(&context.mcsLock);
+
+    BenchRunLock("ttas", BenchLockSpin, &context);
+    BenchRunLock("ticket", BenchLockTicket, &context);
+    BenchRunLock("mcs", BenchLockMCS, &context);
+
+#ifndef _WIN32
+    pthread_mutex_init(&context.mutex, NULL);
+    BenchRunLock("pthread", BenchLockPthread, &context);
+    pthread_mutex_destroy(&context.mutex);
+#endif
+}
+
+// MARK: Backoff
+
+/** Increment through a compare-exchange loop that backs off as configured by the context after every failure */
+ZENNY_BENCH_WORKER(BenchBackoffIncrement,
+                   struct ZennyAtomicBackoff backoff = *(const struct ZennyAtomicBackoff*)thread->context;
+                   int64_t comparand = ZennyAtomicLoadLongExplicit(target, ZennyMemoryOrderRelaxed);
+                   while (!ZennyAtomicCompareExchangeWeakLongExplicit(target, &comparand, comparand + 1,
+                                                                      ZennyMemoryOrderAcqRel, ZennyMemoryOrderRelaxed))
+                       ZennyAtomicBackoffSpin(&backoff);
+                   sink += comparand)
+
+/** A contended compare-exchange increment under each backoff policy */
+static void BenchSuiteBackoff(void)
+{
+    static const struct
+    {
+        const char *name;
+        enum ZennyAtomicBackoffPolicy policy;
+        unsigned minSpins;
+        unsigned maxSpins;
+        unsigned yieldAfter;
+    } policies[] = {
+        { "none", ZennyAtomicBackoffNone, 1, 1, 0 },
+        { "constant", ZennyAtomicBackoffConstant, 16, 16, 0 },
+        { "exponential", ZennyAtomicBackoffExponential, 1, ZENNY_ATOMICS_BACKOFF_MAX_SPINS, 0 },
+        { "jitter", ZennyAtomicBackoffJitter, 1, ZENNY_ATOMICS_BACKOFF_MAX_SPINS, 0 },
+        { "exponential-yield", ZennyAtomicBackoffExponential, 1, ZENNY_ATOMICS_BACKOFF_MAX_SPINS, 8 }
+    };
+
+    for (size_t i = 0; i < sizeof(policies) / sizeof(policies[0]); i++)
+    {
+        struct ZennyAtomicBackoff backoff;
+        ZennyAtomicBackoffInit(&backoff, policies[i].policy, policies[i].minSpins, policies[i].maxSpins, policies[i].yieldAfter);
+        ZennyBenchRunThreads("CompareExchangeIncrement", policies[i].name, "shared", BenchBackoffIncrement, &backoff);
+    }
+}
+
+// MARK: Floating point
+
+/** Accumulator of the mutex-protected baseline */
+struct BenchFloatContext
+{
+#ifndef _WIN32
+    pthread_mutex_t mutex;
+#endif
+    double sum;
+};
+
+#define BENCH_FLOAT_CONTEXT(thread)  ((struct BenchFloatContext*)(thread)->context)
+
+ZENNY_BENCH_WORKER(BenchFloatAtomicAdd, ZennyAtomicAddDoubleExplicit(target, 0.5, ZennyMemoryOrderRelaxed))
+#ifndef _WIN32
+ZENNY_BENCH_WORKER(BenchFloatMutexAdd,
+                   pthread_mutex_lock(&BENCH_FLOAT_CONTEXT(thread)->mutex);
+                   BENCH_FLOAT_CONTEXT(thread)->sum += 0.5;
+                   pthread_mutex_unlock(&BENCH_FLOAT_CONTEXT(thread)->mutex))
+#endif
+
+/** A double accumulated through the compare-exchange based atomic add against one guarded by a mutex */
+static void BenchSuiteFloat(void)
+{
+    ZennyBenchRunThreads("AddDouble", "zenny", "shared", BenchFloatAtomicAdd, NULL);
+
+#ifndef _WIN32
+    static struct BenchFloatContext context;
+    pthread_mutex_init(&context.mutex, NULL);
+    ZennyBenchRunThreads("AddDouble", "pthread", "shared", BenchFloatMutexAdd, &context);
+    pthread_mutex_destroy(&context.mutex);
+#endif
+}
+
+// MARK: Bitmap
+
+#define BENCH_BITMAP_BITS   4096
+
+/** Claim a slot with bit-test-and-set and release it */
+ZENNY_BENCH_WORKER(BenchBitmapClaim,
+                   const size_t index = ZennyAtomicBitmapClaimFirstZero(thread->context, (size_t)thread->index * 64);
+                   sink += (int64_t)index;
+                   ZennyAtomicBitmapTestAndReset(thread->context, index))
+
+/** Claim a slot by rescanning the words and setting the bit with a compare-exchange on the whole word, then release it */
+ZENNY_BENCH_WORKER(BenchBitmapScanAndCompareExchange,
+                   struct ZennyAtomicBitmap *bitmap = thread->context;
+                   size_t index = ZENNY_ATOMIC_BITMAP_NOT_FOUND;
+                   while (index == ZENNY_ATOMIC_BITMAP_NOT_FOUND)
+                   {
+                       for (size_t w = 0; w < bitmap->wordCount; w++)
+                       {
+                           uint64_t value = ZennyAtomicULongLoad(&bitmap->words[w]);
+                           if (value == UINT64_MAX)
+                               continue;
+                           unsigned bit = 0;
+                           while (value >> bit & 1)
+                               bit++;
+                           if (ZennyAtomicULongCompareExchange(&bitmap->words[w], &value, value | (uint64_t)1 << bit))
+                           {
+                               index = w * 64 + bit;
+                               break;
+                           }
+                       }
+                   }
+                   sink += (int64_t)index;
+                   ZennyAtomicBitmapTestAndReset(bitmap, index))
+
+/** Slot allocation out of a shared bitmap: word-at-a-time claim against a scan-and-compare-exchange loop */
+static void BenchSuiteBitmap(void)
+{
+    struct ZennyAtomicBitmap bitmap;
+    if (!ZennyAtomicBitmapInit(&bitmap, BENCH_BITMAP_BITS))
+    {
+        fprintf(stderr, "Out of memory\n");
+        return;
+    }
+
+    ZennyBenchRunThreads("BitmapClaim", "bts", "shared", BenchBitmapClaim, &bitmap);
+    ZennyBenchRunThreads("BitmapClaim", "scan-cas", "shared", BenchBitmapScanAndCompareExchange, &bitmap);
+
+    if (ZennyAtomicBitmapCount(&bitmap) != 0)
+    {
+        fprintf(stderr, "Bitmap leaked %zu bits\n", ZennyAtomicBitmapCount(&bitmap));
+        sCheckFailed = true;
+    }
+
+    ZennyAtomicBitmapDestroy(&bitmap);
+}
+
+// MARK: SPSC ring
+
+/** Number of elements moved by one batched push or pop */
+#define BENCH_SPSC_BATCH    32
+
+/** Ring under test, with the mutex of the locked baseline */
+struct BenchSpscContext
+{
+    struct ZennySpscRing ring;
+#ifndef _WIN32
+    pthread_mutex_t mutex;
+#endif
+};
+
+#define BENCH_SPSC_RING(thread)     (&((struct BenchSpscContext*)(thread)->context)->ring)
+
+/** Thread 0 produces and thread 1 consumes; an operation is one message through the ring */
+ZENNY_BENCH_WORKER(BenchSpscSingle,
+                   int64_t message = i;
+                   if (thread->index == 0)
+                   {
+                       while (!ZennySpscRingPush(BENCH_SPSC_RING(thread), &message))
+                           ZennyAtomicPause();
+                   }
+                   else
+                   {
+                       while (!ZennySpscRingPop(BENCH_SPSC_RING(thread), &message))
+                           ZennyAtomicPause();
+                       sink += message;
+                   })
+
+/** Same as BenchSpscSingle, moving BENCH_SPSC_BATCH messages per push or pop */
+ZENNY_BENCH_WORKER(BenchSpscBatch,
+                   if (i % BENCH_SPSC_BATCH != 0)
+                       continue;
+                   int64_t messages[BENCH_SPSC_BATCH];
+                   for (size_t done = 0; done < BENCH_SPSC_BATCH; )
+                   {
+                       size_t moved;
+                       if (thread->index == 0)
+                       {
+                           for (int k = 0; k < BENCH_SPSC_BATCH; k++)
+                               messages[k] = i + k;
+                           moved = ZennySpscRingPushBatch(BENCH_SPSC_RING(thread), messages + done, BENCH_SPSC_BATCH - done);
+                       }
+                       else
+                       {
+                           moved = ZennySpscRingPopBatch(BENCH_SPSC_RING(thread), messages + done, BENCH_SPSC_BATCH - done);
+                           for (size_t k = done; k < done + moved; k++)
+                               sink += messages[k];
+                       }
+                       if (moved == 0)
+                           ZennyAtomicPause();
+                       done += moved;
+                   })
+
+/** Same as BenchSpscSingle, filling and draining the slots in place */
+ZENNY_BENCH_WORKER(BenchSpscZeroCopy,
+                   if (thread->index == 0)
+                   {
+                       void *slot;
+                       while (ZennySpscRingReserve(BENCH_SPSC_RING(thread), 1, &slot) == 0)
+                           ZennyAtomicPause();
+                       *(int64_t*)slot = i;
+                       ZennySpscRingCommit(BENCH_SPSC_RING(thread), 1);
+                   }
+                   else
+                   {
+                       const void *slot;
+                       while (ZennySpscRingPeek(BENCH_SPSC_RING(thread), 1, &slot) == 0)
+                           ZennyAtomicPause();
+                       sink += *(const int64_t*)slot;
+                       ZennySpscRingRelease(BENCH_SPSC_RING(thread), 1);
+                   })
+
+#ifndef _WIN32
+/** Same as BenchSpscSingle, with every push and pop under one mutex */
+ZENNY_BENCH_WORKER(BenchSpscMutex,
+                   struct BenchSpscContext *context = thread->context;
+                   int64_t message = i;
+                   bool moved = false;
+                   while (!moved)
+                   {
+                       pthread_mutex_lock(&context->mutex);
+                       moved = thread->index == 0 ? ZennySpscRingPush(&context->ring, &message) : ZennySpscRingPop(&context->ring, &message);
+                       pthread_mutex_unlock(&context->mutex);
+                   }
+                   if (thread->index != 0)
+                       sink += message)
+#endif
+
+/** Messages per second from one pinned producer to one pinned consumer */
+static void BenchSuiteSpscRing(void)
+{
+    static struct BenchSpscContext context;
+    if (!ZennySpscRingInit(&context.ring, 4096, sizeof(int64_t)))
+    {
+        fprintf(stderr, "Out of memory\n");
+        return;
+    }
+
+    const bool pin = sOptions.pin;
+    sOptions.pin = true;
+
+    ZennyBenchRunCase("SpscRing", "single", "shared", 2, BenchSpscSingle, &context);
+    ZennyBenchRunCase("SpscRing", "batch", "shared", 2, BenchSpscBatch, &context);
+    ZennyBenchRunCase("SpscRing", "zero-copy", "shared", 2, BenchSpscZeroCopy, &context);
+#ifndef _WIN32
+    pthread_mutex_init(&context.mutex, NULL);
+    ZennyBenchRunCase("SpscRing", "pthread", "shared", 2, BenchSpscMutex, &context);
+    pthread_mutex_destroy(&context.mutex);
+#endif
+
+    sOptions.pin = pin;
+
+    if (ZennySpscRingSize(&context.ring) != 0)
+    {
+        fprintf(stderr, "SPSC ring left %zu messages behind\n", ZennySpscRingSize(&context.ring));
+        sCheckFailed = true;
+    }
+
+    ZennySpscRingDestroy(&context.ring);
+}
+
+// MARK: MPMC queue
+
+#define BENCH_MPMC_CAPACITY     1024
+
+/** Queue under test, the bounded mutex+condvar baseline, and the producer/consumer split of the case */
+struct BenchMpmcContext
+{
+    struct ZennyMpmcQueue queue;
+#ifndef _WIN32
+    pthread_mutex_t mutex;
+    pthread_cond_t notEmpty;
+    pthread_cond_t notFull;
+    int64_t items[BENCH_MPMC_CAPACITY];
+    size_t head;
+    size_t count;
+#endif
+    /** threads with a lower index produce, the others consume */
+    int producerCount;
+
+    /** messages moved by one operation of a producer and of a consumer, so that both sides move the same total */
+    int pushesPerOp;
+    int popsPerOp;
+};
+
+#define BENCH_MPMC_CONTEXT(thread)  ((struct BenchMpmcContext*)(thread)->context)
+
+ZENNY_BENCH_WORKER(BenchMpmcBlocking,
+                   struct BenchMpmcContext *context = BENCH_MPMC_CONTEXT(thread);
+                   int64_t message = i;
+                   if (thread->index < context->producerCount)
+                   {
+                       for (int k = 0; k < context->pushesPerOp; k++)
+                           ZennyMpmcQueuePush(&context->queue, &message);
+                   }
+                   else
+                   {
+                       for (int k = 0; k < context->popsPerOp; k++)
+                       {
+                           ZennyMpmcQueuePop(&context->queue, &message);
+                           sink += message;
+                       }
+                   })
+
+#ifndef _WIN32
+ZENNY_BENCH_WORKER(BenchMpmcCondvar,
+                   struct BenchMpmcContext *context = BENCH_MPMC_CONTEXT(thread);
+                   const bool producer = thread->index < context->producerCount;
+                   const int messages = producer ? context->pushesPerOp : context->popsPerOp;
+                   for (int k = 0; k < messages; k++)
+                   {
+                       pthread_mutex_lock(&context->mutex);
+                       if (producer)
+                       {
+                           while (context->count == BENCH_MPMC_CAPACITY)
+                               pthread_cond_wait(&context->notFull, &context->mutex);
+                           context->items[(context->head + context->count++) % BENCH_MPMC_CAPACITY] = i;
+                           pthread_cond_signal(&context->notEmpty);
+                       }
+                       else
+                       {
+                           while (context->count == 0)
+                               pthread_cond_wait(&context->notEmpty, &context->mutex);
+                           sink += context->items[context->head];
+                           context->head = (context->head + 1) % BENCH_MPMC_CAPACITY;
+                           context->count--;
+                           pthread_cond_signal(&context->notFull);
+                       }
+                       pthread_mutex_unlock(&context->mutex);
+                   })
+#endif
+
+static int BenchGreatestCommonDivisor(int a, int b)
+{
+    while (b != 0)
+    {
+        const int r = a % b;
+        a = b;
+        b = r;
+    }
+    return a;
+}
+
+/**
+ * Blocking push/pop through the lock-free queue against a mutex+condvar queue, for several producer/consumer splits of the threads.
+ * Each operation of a producer pushes, and each operation of a consumer pops, as many messages as balance the two sides.
+ */
+static void BenchSuiteMpmcQueue(void)
+{
+    static struct BenchMpmcContext context;
+    if (!ZennyMpmcQueueInit(&context.queue, BENCH_MPMC_CAPACITY, sizeof(int64_t)))
+    {
+        fprintf(stderr, "Out of memory\n");
+        return;
+    }
+
+    const int threadCount = sOptions.maxThreads < 2 ? 2 : sOptions.maxThreads;
+    const int splits[][2] = {
+        { threadCount / 2, threadCount - threadCount / 2 },
+        { 1, threadCount - 1 },
+        { threadCount - 1, 1 }
+    };
+
+    for (size_t s = 0; s < sizeof(splits) / sizeof(splits[0]); s++)
+    {
+        const int producers = splits[s][0];
+        const int consumers = splits[s][1];
+        if (s > 0 && producers == splits[0][0])
+            continue;   // same split as the balanced one when there are only 2 threads
+
+        const int divisor = BenchGreatestCommonDivisor(producers, consumers);
+        context.producerCount = producers;
+        context.pushesPerOp = consumers / divisor;
+        context.popsPerOp = producers / divisor;
+
+        char impl[64];
+        snprintf(impl, sizeof(impl), "lockfree-%dp%dc", producers, consumers);
+        ZennyBenchRunCase("MpmcQueue", impl, "shared", threadCount, BenchMpmcBlocking, &context);
+
+#ifndef _WIN32
+        pthread_mutex_init(&context.mutex, NULL);
+        pthread_cond_init(&context.notEmpty, NULL);
+        pthread_cond_init(&context.notFull, NULL);
+        context.head = 0;
+        context.count = 0;
+
+        snprintf(impl, sizeof(impl), "condvar-%dp%dc", producers, consumers);
+        ZennyBenchRunCase("MpmcQueue", impl, "shared", threadCount, BenchMpmcCondvar, &context);
+
+        pthread_cond_destroy(&context.notFull);
+        pthread_cond_destroy(&context.notEmpty);
+        pthread_mutex_destroy(&context.mutex);
+#endif
+    }
+
+    if (ZennyMpmcQueueSize(&context.queue) != 0)
+    {
+        fprintf(stderr, "MPMC queue left %zu messages behind\n", ZennyMpmcQueueSize(&context.queue));
+        sCheckFailed = true;
+    }
+
+    ZennyMpmcQueueDestroy(&context.queue);
+}
+
+// MARK: Lock-free stack
+
+/** Few objects for many threads, so that a node is popped and pushed back while a stalled pop still holds it: the ABA pattern */
+#define BENCH_STACK_OBJECTS     8
+
+/** Pooled object that records its owner, so that an object handed out twice is detected */
+struct BenchStackObject
+{
+    struct ZennyLockFreeStackNode link;
+    struct ZennyAtomicInt owned;
+    int owner;
+};
+
+/** Free-list under test, the mutex-guarded baseline, and the number of ownership violations seen */
+struct BenchStackContext
+{
+    struct ZennyFreeList freeList;
+#ifndef _WIN32
+    pthread_mutex_t mutex;
+    struct ZennyLockFreeStackNode *lockedTop;
+#endif
+    struct ZennyAtomicULong violations;
+};
+
+#define BENCH_STACK_CONTEXT(thread)     ((struct BenchStackContext*)(thread)->context)
+
+/** Take ownership of an object just popped; a nonzero owned flag means that the stack handed it out twice */
+static void BenchStackAcquire(struct BenchStackContext *context, struct BenchStackObject *object, int owner)
+{
+    if (ZennyAtomicIntExchange(&object->owned, 1) != 0)
+        ZennyAtomicULongAdd(&context->violations, 1);
+    object->owner = owner;
+}
+
+static void BenchStackRelease(struct BenchStackContext *context, struct BenchStackObject *object, int owner)
+{
+    if (object->owner != owner)
+        ZennyAtomicULongAdd(&context->violations, 1);
+    ZennyAtomicIntStore(&object->owned, 0);
+}
+
+/** Allocate an object from the pool, check that nobody else holds it, and free it */
+ZENNY_BENCH_WORKER(BenchStackAllocFree,
+                   struct BenchStackContext *context = BENCH_STACK_CONTEXT(thread);
+                   struct BenchStackObject *object = ZennyFreeListAlloc(&context->freeList);
+                   if (object == NULL)
+                       sink++;     // every object is held by other threads
+                   else
+                   {
+                       BenchStackAcquire(context, object, thread->index);
+                       BenchStackRelease(context, object, thread->index);
+                       ZennyFreeListFree(&context->freeList, object);
+                   })
+
+/** As BenchStackAllocFree, but every eighth operation drains the whole pool and pushes it back as one list */
+ZENNY_BENCH_WORKER(BenchStackBulk,
+                   struct BenchStackContext *context = BENCH_STACK_CONTEXT(thread);
+                   struct ZennyLockFreeStack *stack = &context->freeList.stack;
+                   if ((i & 7) == 0)
+                   {
+                       struct ZennyLockFreeStackNode *first = ZennyLockFreeStackPopAll(stack);
+                       struct ZennyLockFreeStackNode *last = first;
+                       for (struct ZennyLockFreeStackNode *node = first; node != NULL; node = node->next)
+                       {
+                           BenchStackAcquire(context, (struct BenchStackObject*)node, thread->index);
+                           last = node;
+                       }
+                       for (struct ZennyLockFreeStackNode *node = first; node != NULL; node = node->next)
+                           BenchStackRelease(context, (struct BenchStackObject*)node, thread->index);
+                       if (first != NULL)
+                           ZennyLockFreeStackPushList(stack, first, last);
+                   }
+                   else
+                   {
+                       struct BenchStackObject *object = (struct BenchStackObject*)ZennyLockFreeStackPop(stack);
+                       if (object == NULL)
+                           sink++;
+                       else
+                       {
+                           BenchStackAcquire(context, object, thread->index);
+                           BenchStackRelease(context, object, thread->index);
+                           ZennyLockFreeStackPush(stack, &object->link);
+                       }
+                   })
+
+#ifndef _WIN32
+ZENNY_BENCH_WORKER(BenchStackMutex,
+                   struct BenchStackContext *context = BENCH_STACK_CONTEXT(thread);
+                   pthread_mutex_lock(&context->mutex);
+                   struct BenchStackObject *object = (struct BenchStackObject*)context->lockedTop;
+                   if (object != NULL)
+                       context->lockedTop = object->link.next;
+                   pthread_mutex_unlock(&context->mutex);
+                   if (object == NULL)
+                       sink++;
+                   else
+                   {
+                       BenchStackAcquire(context, object, thread->index);
+                       BenchStackRelease(context, object, thread->index);
+                       pthread_mutex_lock(&context->mutex);
+                       object->link.next = context->lockedTop;
+                       context->lockedTop = &object->link;
+                       pthread_mutex_unlock(&context->mutex);
+                   })
+#endif
+
+/** Check that the pool holds every object exactly once, then put them back */
+static void BenchStackVerify(struct BenchStackContext *context, const char *impl)
+{
+    struct ZennyLockFreeStackNode *first = ZennyLockFreeStackPopAll(&context->freeList.stack);
+    struct ZennyLockFreeStackNode *last = first;
+    size_t count = 0;
+    for (struct ZennyLockFreeStackNode *node = first; node != NULL && count <= BENCH_STACK_OBJECTS; node = node->next)
+    {
+        last = node;
+        count++;
+    }
+
+    const uint64_t violations = ZennyAtomicULongLoad(&context->violations);
+    if (count != BENCH_STACK_OBJECTS || violations != 0)
+    {
+        fprintf(stderr, "Stack %s: %zu of %d objects left in the pool, %llu objects handed out twice\n",
+                impl, count, BENCH_STACK_OBJECTS, (unsigned long long)violations);
+        ZennyAtomicULongStore(&context->violations, 0);
+        sCheckFailed = true;
+    }
+
+    if (first != NULL && count <= BENCH_STACK_OBJECTS)
+        ZennyLockFreeStackPushList(&context->freeList.stack, first, last);
+}
+
+/**
+ * ABA stress on a tiny tagged-pointer free-list: every pop checks that no other thread owns the object,
+ * and after each run the pool must hold every object exactly once. Compared against a mutex-guarded stack.
+ */
+static void BenchSuiteLockFreeStack(void)
+{
+    static struct BenchStackContext context;
+    if (!ZennyFreeListInit(&context.freeList, sizeof(struct BenchStackObject), BENCH_STACK_OBJECTS))
+    {
+        fprintf(stderr, "Out of memory\n");
+        return;
+    }
+    ZennyAtomicULongInit(&context.violations, 0);
+
+    ZennyBenchRunThreads("LockFreeStack", "alloc-free", "shared", BenchStackAllocFree, &context);
+    BenchStackVerify(&context, "alloc-free");
+    ZennyBenchRunThreads("LockFreeStack", "bulk", "shared", BenchStackBulk, &context);
+    BenchStackVerify(&context, "bulk");
+
+#ifndef _WIN32
+    // Move the objects over to the locked stack for the baseline
+    pthread_mutex_init(&context.mutex, NULL);
+    context.lockedTop = ZennyLockFreeStackPopAll(&context.freeList.stack);
+    ZennyBenchRunThreads("LockFreeStack", "pthread", "shared", BenchStackMutex, &context);
+    pthread_mutex_destroy(&context.mutex);
+
+    struct ZennyLockFreeStackNode *last = context.lockedTop;
+    while (last != NULL && last->next != NULL)
+        last = last->next;
+    if (last != NULL)
+        ZennyLockFreeStackPushList(&context.freeList.stack, context.lockedTop, last);
+    BenchStackVerify(&context, "pthread");
+#endif
+
+    ZennyFreeListDestroy(&context.freeList);
+}
+
+// MARK: Epoch reclamation
+
+/** Shared object replaced by the writer and read by everybody else */
+struct BenchConfig
+{
+    int64_t value;
+};
+
+/** Published configuration, the epoch domain with one record per benchmark thread, and the rwlock baseline */
+struct BenchEpochContext
+{
+    alignas(ZENNY_ATOMICS_CACHE_LINE_SIZE) struct ZennyAtomicPtr config;
+    struct ZennyEpochDomain domain;
+    struct ZennyEpochThread *threads[ZENNY_BENCH_MAX_THREADS];
+#ifndef _WIN32
+    pthread_rwlock_t rwlock;
+#endif
+    /** whether thread 0 replaces the configuration instead of reading it */
+    bool writer;
+};
+
+#define BENCH_EPOCH_CONTEXT(thread)     ((struct BenchEpochContext*)(thread)->context)
+
+static void BenchFreeConfig(void *config)
+{
+    free(config);
+}
+
+/** Replace the configuration and return the old one */
+static struct BenchConfig* BenchPublishConfig(volatile struct ZennyAtomicPtr *shared, int64_t value)
+{
+    struct BenchConfig *config = malloc(sizeof(*config));
+    config->value = value;
+    return (struct BenchConfig*)ZennyAtomicPtrExchange(shared, (intptr_t)config);
+}
+
+/** Unprotected acquire load: the floor for the read side, only valid while nobody frees the configuration */
+ZENNY_BENCH_WORKER(BenchEpochPlainLoad,
+                   struct BenchEpochContext *context = BENCH_EPOCH_CONTEXT(thread);
+                   sink += ((struct BenchConfig*)ZennyAtomicPtrLoadExplicit(&context->config, ZennyMemoryOrderAcquire))->value)
+
+ZENNY_BENCH_WORKER(BenchEpochRead,
+                   struct BenchEpochContext *context = BENCH_EPOCH_CONTEXT(thread);
+                   struct ZennyEpochThread *record = context->threads[thread->index];
+                   if (context->writer && thread->index == 0)
+                       ZennyEpochRetire(record, BenchPublishConfig(&context->config, i), BenchFreeConfig);
+                   else
+                   {
+                       ZennyEpochEnter(record);
+                       sink += ((struct BenchConfig*)ZennyAtomicPtrLoadExplicit(&context->config, ZennyMemoryOrderAcquire))->value;
+                       ZennyEpochExit(record);
+                   })
+
+#ifndef _WIN32
+ZENNY_BENCH_WORKER(BenchEpochRwlock,
+                   struct BenchEpochContext *context = BENCH_EPOCH_CONTEXT(thread);
+                   if (context->writer && thread->index == 0)
+                   {
+                       pthread_rwlock_wrlock(&context->rwlock);
+                       struct BenchConfig *old = BenchPublishConfig(&context->config, i);
+                       pthread_rwlock_unlock(&context->rwlock);
+                       free(old);
+                   }
+                   else
+                   {
+                       pthread_rwlock_rdlock(&context->rwlock);
+                       sink += ((struct BenchConfig*)ZennyAtomicPtrLoadExplicit(&context->config, ZennyMemoryOrderAcquire))->value;
+                       pthread_rwlock_unlock(&context->rwlock);
+                   })
+#endif
+
+/**
+ * Read-side cost of an epoch critical section against a plain load and a pthread rwlock,
+ * first with readers only, then with thread 0 replacing and retiring the configuration continuously.
+ */
+static void BenchSuiteEpoch(void)
+{
+    static struct BenchEpochContext context;
+    ZennyEpochDomainInit(&context.domain);
+    for (int i = 0; i < sOptions.maxThreads; i++)
+    {
+        context.threads[i] = ZennyEpochRegister(&context.domain);
+        if (context.threads[i] == NULL)
+        {
+            fprintf(stderr, "Out of memory\n");
+            ZennyEpochDomainDestroy(&context.domain);
+            return;
+        }
+    }
+
+    ZennyAtomicPtrInit(&context.config, 0);
+    free(BenchPublishConfig(&context.config, 0));
+#ifndef _WIN32
+    pthread_rwlock_init(&context.rwlock, NULL);
+#endif
+
+    context.writer = false;
+    ZennyBenchRunThreads("EpochRead", "plain-load", "shared", BenchEpochPlainLoad, &context);
+    ZennyBenchRunThreads("EpochRead", "epoch", "shared", BenchEpochRead, &context);
+#ifndef _WIN32
+    ZennyBenchRunThreads("EpochRead", "rwlock", "shared", BenchEpochRwlock, &context);
+#endif
+
+    context.writer = true;
+    ZennyBenchRunThreads("EpochReadRetire", "epoch", "shared", BenchEpochRead, &context);
+#ifndef _WIN32
+    ZennyBenchRunThreads("EpochReadRetire", "rwlock", "shared", BenchEpochRwlock, &context);
+    pthread_rwlock_destroy(&context.rwlock);
+#endif
+
+    for (int i = 0; i < sOptions.maxThreads; i++)
+    {
+        ZennyEpochFlush(context.threads[i]);
+        ZennyEpochUnregister(context.threads[i]);
+    }
+
+    ZennyEpochDomainDestroy(&context.domain);
+    free((void*)ZennyAtomicPtrLoad(&context.config));
+}
+
+// MARK: Hazard pointers
+
+/** Published configuration and the hazard-pointer domain with one record per benchmark thread */
+struct BenchHazardContext
+{
+    alignas(ZENNY_ATOMICS_CACHE_LINE_SIZE) struct ZennyAtomicPtr config;
+    struct ZennyHazardDomain domain;
+    struct ZennyHazardThread *threads[ZENNY_BENCH_MAX_THREADS];
+
+    /** whether thread 0 replaces the configuration instead of reading it */
+    bool writer;
+};
+
+#define BENCH_HAZARD_CONTEXT(thread)    ((struct BenchHazardContext*)(thread)->context)
+
+ZENNY_BENCH_WORKER(BenchHazardPlainLoad,
+                   struct BenchHazardContext *context = BENCH_HAZARD_CONTEXT(thread);
+                   sink += ((struct BenchConfig*)ZennyAtomicPtrLoadExplicit(&context->config, ZennyMemoryOrderAcquire))->value)
+
+ZENNY_BENCH_WORKER(BenchHazardRead,
+                   struct BenchHazardContext *context = BENCH_HAZARD_CONTEXT(thread);
+                   struct ZennyHazardThread *record = context->threads[thread->index];
+                   if (context->writer && thread->index == 0)
+                       ZennyHazardRetire(record, BenchPublishConfig(&context->config, i), BenchFreeConfig);
+                   else
+                   {
+                       sink += ((struct BenchConfig*)ZennyHazardProtect(record, 0, &context->config))->value;
+                       ZennyHazardClear(record, 0);
+                   })
+
+/**
+ * Read-side cost of protect-and-validate against a plain acquire load,
+ * first with readers only, then with thread 0 replacing and retiring the configuration continuously.
+ */
+static void BenchSuiteHazard(void)
+{
+    static struct BenchHazardContext context;
+    ZennyHazardDomainInit(&context.domain);
+    for (int i = 0; i < sOptions.maxThreads; i++)
+    {
+        context.threads[i] = ZennyHazardRegister(&context.domain);
+        if (context.threads[i] == NULL)
+        {
+            fprintf(stderr, "Out of memory\n");
+            ZennyHazardDomainDestroy(&context.domain);
+            return;
+        }
+    }
+
+    ZennyAtomicPtrInit(&context.config, 0);
+    free(BenchPublishConfig(&context.config, 0));
+
+    context.writer = false;
+    ZennyBenchRunThreads("HazardRead", "plain-load", "shared", BenchHazardPlainLoad, &context);
+    ZennyBenchRunThreads("HazardRead", "hazard", "shared", BenchHazardRead, &context);
+
+    context.writer = true;
+    ZennyBenchRunThreads("HazardReadRetire", "hazard", "shared", BenchHazardRead, &context);
+
+    // Nothing is protected any more, so a scan must free every retired configuration
+    for (int i = 0; i < sOptions.maxThreads; i++)
+    {
+        const size_t left = ZennyHazardScan(context.threads[i]);
+        if (left != 0)
+        {
+            fprintf(stderr, "Hazard thread %d kept %zu unprotected objects\n", i, left);
+            sCheckFailed = true;
+        }
+        ZennyHazardUnregister(context.threads[i]);
+    }
+
+    ZennyHazardDomainDestroy(&context.domain);
+    free((void*)ZennyAtomicPtrLoad(&context.config));
+}
+
+// MARK: Seqlock
+
+#define BENCH_SEQLOCK_FIELDS    8
+
+/** Snapshot whose fields always hold the same value, so that a torn read is detected */
+struct BenchSeqlockPayload
+{
+    int64_t fields[BENCH_SEQLOCK_FIELDS];
+};
+
+/** Shared snapshot with its sequence lock and rwlock baseline, and the number of torn snapshots seen by readers */
+struct BenchSeqlockContext
+{
+    struct ZennySeqlock lock;
+    alignas(ZENNY_ATOMICS_CACHE_LINE_SIZE) struct BenchSeqlockPayload payload;
+#ifndef _WIN32
+    pthread_rwlock_t rwlock;
+#endif
+    struct ZennyAtomicULong tornCount;
+};
+
+#define BENCH_SEQLOCK_CONTEXT(thread)   ((struct BenchSeqlockContext*)(thread)->context)
+
+static void BenchSeqlockCheck(struct BenchSeqlockContext *context, const struct BenchSeqlockPayload *snapshot)
+{
+    for (int f = 1; f < BENCH_SEQLOCK_FIELDS; f++)
+    {
+        if (snapshot->fields[f] != snapshot->fields[0])
+        {
+            ZennyAtomicULongAdd(&context->tornCount, 1);
+            return;
+        }
+    }
+}
+
+static void BenchSeqlockFill(struct BenchSeqlockPayload *payload, int64_t value)
+{
+    for (int f = 0; f < BENCH_SEQLOCK_FIELDS; f++)
+        payload->fields[f] = value;
+}
+
+/** Thread 0 rewrites the snapshot; the others take consistent copies */
+ZENNY_BENCH_WORKER(BenchSeqlock,
+                   struct BenchSeqlockContext *context = BENCH_SEQLOCK_CONTEXT(thread);
+                   struct BenchSeqlockPayload snapshot;
+                   if (thread->index == 0)
+                   {
+                       BenchSeqlockFill(&snapshot, i);
+                       ZennySeqlockWrite(&context->lock, &context->payload, &snapshot, sizeof(snapshot));
+                   }
+                   else
+                   {
+                       ZennySeqlockRead(&context->lock, &snapshot, &context->payload, sizeof(snapshot));
+                       BenchSeqlockCheck(context, &snapshot);
+                       sink += snapshot.fields[0];
+                   })
+
+/** Field-by-field relaxed loads without the sequence lock: fast, but the snapshots may be torn */
+ZENNY_BENCH_WORKER(BenchSeqlockPerField,
+                   struct BenchSeqlockContext *context = BENCH_SEQLOCK_CONTEXT(thread);
+                   struct BenchSeqlockPayload snapshot;
+                   if (thread->index == 0)
+                   {
+                       BenchSeqlockFill(&snapshot, i);
+                       ZennySeqlockStorePayload(&context->payload, &snapshot, sizeof(snapshot));
+                   }
+                   else
+                   {
+                       ZennySeqlockLoadPayload(&snapshot, &context->payload, sizeof(snapshot));
+                       BenchSeqlockCheck(context, &snapshot);
+                       sink += snapshot.fields[0];
+                   })
+
+#ifndef _WIN32
+ZENNY_BENCH_WORKER(BenchSeqlockRwlock,
+                   struct BenchSeqlockContext *context = BENCH_SEQLOCK_CONTEXT(thread);
+                   struct BenchSeqlockPayload snapshot;
+                   if (thread->index == 0)
+                   {
+                       BenchSeqlockFill(&snapshot, i);
+                       pthread_rwlock_wrlock(&context->rwlock);
+                       ZennySeqlockStorePayload(&context->payload, &snapshot, sizeof(snapshot));
+                       pthread_rwlock_unlock(&context->rwlock);
+                   }
+                   else
+                   {
+                       pthread_rwlock_rdlock(&context->rwlock);
+                       ZennySeqlockLoadPayload(&snapshot, &context->payload, sizeof(snapshot));
+                       pthread_rwlock_unlock(&context->rwlock);
+                       BenchSeqlockCheck(context, &snapshot);
+                       sink += snapshot.fields[0];
+                   })
+#endif
+
+static void BenchSeqlockReport(struct BenchSeqlockContext *context, const char *impl, bool mayTear)
+{
+    const uint64_t torn = ZennyAtomicULongExchange(&context->tornCount, 0);
+    if (torn != 0 && !mayTear)
+    {
+        fprintf(stderr, "Seqlock %s: %llu torn snapshots\n", impl, (unsigned long long)torn);
+        sCheckFailed = true;
+    }
+    else if (torn != 0)
+        fprintf(stderr, "Seqlock %s: %llu torn snapshots, as expected without a lock\n", impl, (unsigned long long)torn);
+}
+
+/** One writer and N - 1 readers of a multi-word snapshot: sequence lock, unprotected per-field loads and a pthread rwlock */
+static void BenchSuiteSeqlock(void)
+{
+    static struct BenchSeqlockContext context;
+    ZennySeqlockInit(&context.lock);
+    BenchSeqlockFill(&context.payload, 0);
+    ZennyAtomicULongInit(&context.tornCount, 0);
+
+    ZennyBenchRunThreads("SeqlockRead", "seqlock", "shared", BenchSeqlock, &context);
+    BenchSeqlockReport(&context, "seqlock", false);
+    ZennyBenchRunThreads("SeqlockRead", "per-field", "shared", BenchSeqlockPerField, &context);
+    BenchSeqlockReport(&context, "per-field", true);
+#ifndef _WIN32
+    pthread_rwlock_init(&context.rwlock, NULL);
+    ZennyBenchRunThreads("SeqlockRead", "rwlock", "shared", BenchSeqlockRwlock, &context);
+    BenchSeqlockReport(&context, "rwlock", false);
+    pthread_rwlock_destroy(&context.rwlock);
+#endif
+}
+
+// MARK: RCU
+
+/** Configuration reclaimed through RCU callbacks */
+struct BenchRcuConfig
+{
+    struct ZennyRcuHead head;
+    int64_t value;
+};
+
+/** Published configuration and the RCU domain with one record per benchmark thread */
+struct BenchRcuContext
+{
+    alignas(ZENNY_ATOMICS_CACHE_LINE_SIZE) struct ZennyAtomicPtr config;
+    struct ZennyRcuDomain domain;
+    struct ZennyRcuThread *threads[ZENNY_BENCH_MAX_THREADS];
+
+    /** whether thread 0 replaces the configuration, and whether it then waits for a grace period instead of queuing a callback */
+    bool writer;
+    bool synchronous;
+};
+
+#define BENCH_RCU_CONTEXT(thread)   ((struct BenchRcuContext*)(thread)->context)
+
+static void BenchRcuFreeConfig(struct ZennyRcuHead *head)
+{
+    free(head);
+}
+
+static struct BenchRcuConfig* BenchRcuNewConfig(int64_t value)
+{
+    struct BenchRcuConfig *config = malloc(sizeof(*config));
+    config->value = value;
+    return config;
+}
+
+ZENNY_BENCH_WORKER(BenchRcuPlainLoad,
+                   struct BenchRcuContext *context = BENCH_RCU_CONTEXT(thread);
+                   sink += ((struct BenchRcuConfig*)ZennyAtomicPtrLoadExplicit(&context->config, ZennyMemoryOrderAcquire))->value)
+
+ZENNY_BENCH_WORKER(BenchRcuRead,
+                   struct BenchRcuContext *context = BENCH_RCU_CONTEXT(thread);
+                   struct ZennyRcuThread *record = context->threads[thread->index];
+                   if (context->writer && thread->index == 0)
+                   {
+                       struct BenchRcuConfig *old = ZennyRcuDereference(&context->config);
+                       ZennyRcuAssign(&context->config, BenchRcuNewConfig(i));
+                       if (context->synchronous)
+                       {
+                           ZennyRcuSynchronize(&context->domain);
+                           free(old);
+                       }
+                       else
+                           ZennyRcuCall(&context->domain, &old->head, BenchRcuFreeConfig);
+                   }
+                   else
+                   {
+                       ZennyRcuReadLock(record);
+                       sink += ((struct BenchRcuConfig*)ZennyRcuDereference(&context->config))->value;
+                       ZennyRcuReadUnlock(record);
+                   })
+
+/**
+ * Read-side cost of an RCU section against a plain acquire load, first with readers only,
+ * then with thread 0 replacing the configuration and reclaiming the old one through callbacks or synchronously.
+ */
+static void BenchSuiteRcu(void)
+{
+    static struct BenchRcuContext context;
+    if (!ZennyRcuInit(&context.domain))
+    {
+        fprintf(stderr, "Cannot start the RCU reclaimer\n");
+        return;
+    }
+
+    for (int i = 0; i < sOptions.maxThreads; i++)
+    {
+        context.threads[i] = ZennyRcuRegister(&context.domain);
+        if (context.threads[i] == NULL)
+        {
+            fprintf(stderr, "Out of memory\n");
+            ZennyRcuDestroy(&context.domain);
+            return;
+        }
+    }
+
+    ZennyAtomicPtrInit(&context.config, (intptr_t)BenchRcuNewConfig(0));
+
+    context.writer = false;
+    ZennyBenchRunThreads("RcuRead", "plain-load", "shared", BenchRcuPlainLoad, &context);
+    ZennyBenchRunThreads("RcuRead", context.domain.heavyBarrier ? "rcu-membarrier" : "rcu-fence", "shared", BenchRcuRead, &context);
+
+    context.writer = true;
+    context.synchronous = false;
+    ZennyBenchRunThreads("RcuReadUpdate", "call-rcu", "shared", BenchRcuRead, &context);
+    context.synchronous = true;
+    ZennyBenchRunThreads("RcuReadUpdate", "synchronize", "shared", BenchRcuRead, &context);
+
+    ZennyRcuBarrier(&context.domain);
+    if (ZennyAtomicULongLoad(&context.domain.invokedCount) != ZennyAtomicULongLoad(&context.domain.queuedCount))
+    {
+        fprintf(stderr, "RCU barrier returned with callbacks pending\n");
+        sCheckFailed = true;
+    }
+
+    for (int i = 0; i < sOptions.maxThreads; i++)
+        ZennyRcuUnregister(context.threads[i]);
+
+    ZennyRcuDestroy(&context.domain);
+    free((void*)ZennyAtomicPtrLoad(&context.config));
+}
+
+// MARK: Reader-writer locks
+
+#define BENCH_RWLOCK_FIELDS     4
+
+/** Table guarded by each lock in turn, whose fields always hold the same value outside a write */
+struct BenchRWLockContext
+{
+    struct ZennyRWSpinLock spinLock;
+    struct ZennyBigReaderLock bigReaderLock;
+#ifndef _WIN32
+    pthread_rwlock_t rwlock;
+#endif
+    alignas(ZENNY_ATOMICS_CACHE_LINE_SIZE) int64_t table[BENCH_RWLOCK_FIELDS];
+
+    /** one operation in `writeEvery` is a write */
+    int writeEvery;
+
+    /** number of reads that saw a write in progress */
+    struct ZennyAtomicULong tornCount;
+};
+
+#define BENCH_RWLOCK_CONTEXT(thread)    ((struct BenchRWLockContext*)(thread)->context)
+
+/** Whether this operation of this thread is a write; the threads are staggered so that their writes do not line up */
+#define BENCH_RWLOCK_IS_WRITE(context, thread, i)   (((i) + (thread)->index * 7) % (context)->writeEvery == 0)
+
+static void BenchRWLockWrite(struct BenchRWLockContext *context)
+{
+    for (int f = 0; f < BENCH_RWLOCK_FIELDS; f++)
+        context->table[f]++;
+}
+
+static int64_t BenchRWLockRead(struct BenchRWLockContext *context)
+{
+    const volatile int64_t *table = context->table;
+    int64_t sum = table[0];
+    for (int f = 1; f < BENCH_RWLOCK_FIELDS; f++)
+    {
+        if (table[f] != table[0])
+            ZennyAtomicULongAdd(&context->tornCount, 1);
+        sum += table[f];
+    }
+    return sum;
+}
+
+ZENNY_BENCH_WORKER(BenchRWSpinLock,
+                   struct BenchRWLockContext *context = BENCH_RWLOCK_CONTEXT(thread);
+                   if (BENCH_RWLOCK_IS_WRITE(context, thread, i))
+                   {
+                       ZennyRWSpinLockWriteLock(&context->spinLock);
+                       BenchRWLockWrite(context);
+                       ZennyRWSpinLockWriteUnlock(&context->spinLock);
+                   }
+                   else
+                   {
+                       ZennyRWSpinLockReadLock(&context->spinLock);
+                       sink += BenchRWLockRead(context);
+                       ZennyRWSpinLockReadUnlock(&context->spinLock);
+                   })
+
+ZENNY_BENCH_WORKER(BenchBigReaderLock,
+                   struct BenchRWLockContext *context = BENCH_RWLOCK_CONTEXT(thread);
+                   if (BENCH_RWLOCK_IS_WRITE(context, thread, i))
+                   {
+                       ZennyBigReaderLockWriteLock(&context->bigReaderLock);
+                       BenchRWLockWrite(context);
+                       ZennyBigReaderLockWriteUnlock(&context->bigReaderLock);
+                   }
+                   else
+                   {
+                       ZennyBigReaderLockReadLock(&context->bigReaderLock);
+                       sink += BenchRWLockRead(context);
+                       ZennyBigReaderLockReadUnlock(&context->bigReaderLock);
+                   })
+
+#ifndef _WIN32
+ZENNY_BENCH_WORKER(BenchPthreadRWLock,
+                   struct BenchRWLockContext *context = BENCH_RWLOCK_CONTEXT(thread);
+                   if (BENCH_RWLOCK_IS_WRITE(context, thread, i))
+                   {
+                       pthread_rwlock_wrlock(&context->rwlock);
+                       BenchRWLockWrite(context);
+                       pthread_rwlock_unlock(&context->rwlock);
+                   }
+                   else
+                   {
+                       pthread_rwlock_rdlock(&context->rwlock);
+                       sink += BenchRWLockRead(context);
+                       pthread_rwlock_unlock(&context->rwlock);
+                   })
+#endif
+
+/** Single-word RW spin lock, big-reader lock and pthread rwlock at 90%, 99% and 99.9% reads */
+static void BenchSuiteRWLock(void)
+{
+    static struct BenchRWLockContext context;
+    if (!ZennyBigReaderLockInit(&context.bigReaderLock, 0))
+    {
+        fprintf(stderr, "Out of memory\n");
+        return;
+    }
+    ZennyRWSpinLockInit(&context.spinLock);
+#ifndef _WIN32
+    pthread_rwlock_init(&context.rwlock, NULL);
+#endif
+    ZennyAtomicULongInit(&context.tornCount, 0);
+
+    static const struct { int writeEvery; const char *family; } mixes[] = {
+        { 10, "RWLock90" },
+        { 100, "RWLock99" },
+        { 1000, "RWLock99.9" }
+    };
+
+    for (size_t m = 0; m < sizeof(mixes) / sizeof(mixes[0]); m++)
+    {
+        context.writeEvery = mixes[m].writeEvery;
+        ZennyBenchRunThreads(mixes[m].family, "rw-spin", "shared", BenchRWSpinLock, &context);
+        ZennyBenchRunThreads(mixes[m].family, "big-reader", "shared", BenchBigReaderLock, &context);
+#ifndef _WIN32
+        ZennyBenchRunThreads(mixes[m].family, "pthread", "shared", BenchPthreadRWLock, &context);
+#endif
+    }
+
+    if (ZennyAtomicULongLoad(&context.tornCount) != 0)
+    {
+        fprintf(stderr, "RW locks let %llu reads overlap a write\n", (unsigned long long)ZennyAtomicULongLoad(&context.tornCount));
+        sCheckFailed = true;
+    }
+
+#ifndef _WIN32
+    pthread_rwlock_destroy(&context.rwlock);
+#endif
+    ZennyBigReaderLockDestroy(&context.bigReaderLock);
+}
+
+// MARK: Barrier, latch and semaphore
+
+/** Free slots of the bounded producer/consumer hand-off through two semaphores */
+#define BENCH_SEMAPHORE_SLOTS   64
+
+/** Primitives under test, with the pthread baseline where POSIX barriers exist, and the counters of their checks */
+struct BenchSyncContext
+{
+    struct ZennyBarrier barrier;
+#if !defined(_WIN32) && defined(_POSIX_BARRIERS) && _POSIX_BARRIERS > 0
+#define BENCH_PTHREAD_BARRIER   1
+    pthread_barrier_t pthreadBarrier;
+#endif
+    /** latches of alternate rounds; the serial thread of the barrier re-arms the one just used */
+    struct ZennyLatch latches[2];
+
+    /** free and filled slots of the hand-off */
+    struct ZennySemaphore slots;
+    struct ZennySemaphore items;
+
+    int threadCount;
+
+    /** threads with a lower index produce, the others consume, balanced like the MPMC queue suite */
+    int producerCount;
+    int pushesPerOp;
+    int popsPerOp;
+
+    /** arrivals at a barrier or latch since the start of the case; arrivals 1..n belong to the first phase, and so on */
+    struct ZennyAtomicULong arrivals;
+
+    /** threads that left a phase before every thread had arrived at it */
+    struct ZennyAtomicULong earlyExits;
+
+    /** phases completed, counted by the serial thread of each */
+    struct ZennyAtomicULong serialCount;
+
+    /** items released and taken through the hand-off */
+    struct ZennyAtomicULong posted;
+    struct ZennyAtomicULong acquired;
+};
+
+#define BENCH_SYNC_CONTEXT(thread)  ((struct BenchSyncContext*)(thread)->context)
+
+static uint64_t BenchSyncArrive(struct BenchSyncContext *context)
+{
+    return ZennyAtomicULongAddFetch(&context->arrivals, 1);
+}
+
+/** After leaving the phase of `arrival`, check that every thread had arrived at it */
+static void BenchSyncCheckPhase(struct BenchSyncContext *context, uint64_t arrival)
+{
+    const uint64_t threadCount = (uint64_t)context->threadCount;
+    const uint64_t phaseEnd = ((arrival - 1) / threadCount + 1) * threadCount;
+    if (ZennyAtomicULongLoad(&context->arrivals) < phaseEnd)
+        ZennyAtomicULongAdd(&context->earlyExits, 1);
+}
+
+static void BenchSyncReset(struct BenchSyncContext *context, int threadCount)
+{
+    context->threadCount = threadCount;
+    ZennyAtomicULongInit(&context->arrivals, 0);
+    ZennyAtomicULongInit(&context->earlyExits, 0);
+    ZennyAtomicULongInit(&context->serialCount, 0);
+    ZennyAtomicULongInit(&context->posted, 0);
+    ZennyAtomicULongInit(&context->acquired, 0);
+}
+
+/** Number of operations each thread performs in a case */
+static uint64_t BenchSyncOpsPerThread(void)
+{
+    return (uint64_t)((sOptions.opsPerThread + ZENNY_BENCH_BATCH - 1) / ZENNY_BENCH_BATCH * ZENNY_BENCH_BATCH);
+}
+
+/** Check that `phases` phases completed, each once and only after every thread had arrived */
+static void BenchSyncCheckPhases(struct BenchSyncContext *context, const char *family, const char *impl, uint64_t phases)
+{
+    const uint64_t earlyExits = ZennyAtomicULongLoad(&context->earlyExits);
+    const uint64_t serialCount = ZennyAtomicULongLoad(&context->serialCount);
+    if (earlyExits != 0 || serialCount != phases)
+    {
+        fprintf(stderr, "%s %s: %llu early exits, %llu of %llu phases completed\n", family, impl,
+                (unsigned long long)earlyExits, (unsigned long long)serialCount, (unsigned long long)phases);
+        sCheckFailed = true;
+    }
+}
+
+/** One operation is one phase: every thread arrives and waits for the others */
+ZENNY_BENCH_WORKER(BenchBarrierZenny,
+                   struct BenchSyncContext *context = BENCH_SYNC_CONTEXT(thread);
+                   const uint64_t arrival = BenchSyncArrive(context);
+                   if (ZennyBarrierWait(&context->barrier))
+                       ZennyAtomicULongAdd(&context->serialCount, 1);
+                   BenchSyncCheckPhase(context, arrival))
+
+#ifdef BENCH_PTHREAD_BARRIER
+ZENNY_BENCH_WORKER(BenchBarrierPthread,
+                   struct BenchSyncContext *context = BENCH_SYNC_CONTEXT(thread);
+                   const uint64_t arrival = BenchSyncArrive(context);
+                   if (pthread_barrier_wait(&context->pthreadBarrier) == PTHREAD_BARRIER_SERIAL_THREAD)
+                       ZennyAtomicULongAdd(&context->serialCount, 1);
+                   BenchSyncCheckPhase(context, arrival))
+#endif
+
+/**
+ * One operation is one round on a latch counted down by every thread: half of them count down and wait separately.
+ * The barrier that closes the round lets its serial thread re-arm the latch for the round after next.
+ */
+ZENNY_BENCH_WORKER(BenchLatchRound,
+                   struct BenchSyncContext *context = BENCH_SYNC_CONTEXT(thread);
+                   const uint64_t arrival = BenchSyncArrive(context);
+                   struct ZennyLatch *latch = &context->latches[(arrival - 1) / (uint64_t)context->threadCount % 2];
+                   if (thread->index % 2 == 0)
+                       ZennyLatchArriveAndWait(latch);
+                   else
+                   {
+                       ZennyLatchCountDown(latch, 1);
+                       ZennyLatchWait(latch);
+                   }
+                   BenchSyncCheckPhase(context, arrival);
+                   if (ZennyBarrierWait(&context->barrier))
+                   {
+                       ZennyAtomicULongAdd(&context->serialCount, 1);
+                       ZennyLatchInit(latch, context->threadCount);
+                   })
+
+/** Producers take a free slot and release an item; consumers take an item and release its slot */
+ZENNY_BENCH_WORKER(BenchSemaphoreHandOff,
+                   struct BenchSyncContext *context = BENCH_SYNC_CONTEXT(thread);
+                   if (thread->index < context->producerCount)
+                   {
+                       for (int k = 0; k < context->pushesPerOp; k++)
+                       {
+                           ZennySemaphoreWait(&context->slots);
+                           ZennyAtomicULongAdd(&context->posted, 1);
+                           ZennySemaphorePost(&context->items, 1);
+                       }
+                   }
+                   else
+                   {
+                       for (int k = 0; k < context->popsPerOp; k++)
+                       {
+                           ZennySemaphoreWait(&context->items);
+                           ZennyAtomicULongAdd(&context->acquired, 1);
+                           ZennySemaphorePost(&context->slots, 1);
+                       }
+                   })
+
+/** Take every permit left in a semaphore */
+static int BenchSemaphoreDrain(struct ZennySemaphore *semaphore)
+{
+    int count = 0;
+    while (ZennySemaphoreTryWait(semaphore))
+        count++;
+    return count;
+}
+
+static void BenchRunSemaphore(struct BenchSyncContext *context, int threadCount)
+{
+    const int producers = threadCount / 2;
+    const int consumers = threadCount - producers;
+    const int divisor = BenchGreatestCommonDivisor(producers, consumers);
+    context->producerCount = producers;
+    context->pushesPerOp = consumers / divisor;
+    context->popsPerOp = producers / divisor;
+
+    BenchSyncReset(context, threadCount);
+    ZennySemaphoreInit(&context->slots, BENCH_SEMAPHORE_SLOTS);
+    ZennySemaphoreInit(&context->items, 0);
+    ZennyBenchRunCase("SemaphoreHandOff", "spin-park", "shared", threadCount, BenchSemaphoreHandOff, context);
+
+    const uint64_t expected = BenchSyncOpsPerThread() * (uint64_t)producers * (uint64_t)context->pushesPerOp;
+    const uint64_t posted = ZennyAtomicULongLoad(&context->posted);
+    const uint64_t acquired = ZennyAtomicULongLoad(&context->acquired);
+    const int itemsLeft = BenchSemaphoreDrain(&context->items);
+    const int slotsLeft = BenchSemaphoreDrain(&context->slots);
+    if (posted != expected || acquired != posted || itemsLeft != 0 || slotsLeft != BENCH_SEMAPHORE_SLOTS)
+    {
+        fprintf(stderr, "Semaphore: %llu of %llu items posted, %llu acquired, %d items and %d of %d slots left\n",
+                (unsigned long long)posted, (unsigned long long)expected, (unsigned long long)acquired,
+                itemsLeft, slotsLeft, BENCH_SEMAPHORE_SLOTS);
+        sCheckFailed = true;
+    }
+}
+
+/**
+ * Phase-synchronization latency from 2 up to N threads against pthread_barrier_wait, rounds on a latch,
+ * and a bounded producer/consumer hand-off through two semaphores.
+ * Every case checks that no thread leaves a phase early and that no permit is lost.
+ */
+static void BenchSuiteSync(void)
+{
+    static struct BenchSyncContext context;
+    const int maxThreads = sOptions.maxThreads < 2 ? 2 : sOptions.maxThreads;
+
+    for (int threadCount = 2; ; threadCount *= 2)
+    {
+        if (threadCount > maxThreads)
+            threadCount = maxThreads;
+
+        BenchSyncReset(&context, threadCount);
+        ZennyBarrierInit(&context.barrier, threadCount);
+        ZennyBenchRunCase("BarrierPhase", "spin-park", "shared", threadCount, BenchBarrierZenny, &context);
+        BenchSyncCheckPhases(&context, "BarrierPhase", "spin-park", BenchSyncOpsPerThread());
+#ifdef BENCH_PTHREAD_BARRIER
+        BenchSyncReset(&context, threadCount);
+        pthread_barrier_init(&context.pthreadBarrier, NULL, (unsigned)threadCount);
+        ZennyBenchRunCase("BarrierPhase", "pthread", "shared", threadCount, BenchBarrierPthread, &context);
+        pthread_barrier_destroy(&context.pthreadBarrier);
+        BenchSyncCheckPhases(&context, "BarrierPhase", "pthread", BenchSyncOpsPerThread());
+#endif
+
+        if (threadCount == maxThreads)
+            break;
+    }
+
+    BenchSyncReset(&context, maxThreads);
+    ZennyBarrierInit(&context.barrier, maxThreads);
+    ZennyLatchInit(&context.latches[0], maxThreads);
+    ZennyLatchInit(&context.latches[1], maxThreads);
+    ZennyBenchRunCase("LatchRound", "spin-park", "shared", maxThreads, BenchLatchRound, &context);
+    BenchSyncCheckPhases(&context, "LatchRound", "spin-park", BenchSyncOpsPerThread());
+
+    BenchRunSemaphore(&context, maxThreads);
+}
+
+// MARK: Mutex
+
+/** Mutex under test together with the data it protects */
+struct BenchMutexContext
+{
+    struct ZennyMutex mutex;
+#ifndef _WIN32
+    pthread_mutex_t pthreadMutex;
+#endif
+    int64_t protectedCount;
+};
+
+#define BENCH_MUTEX_CONTEXT(thread) ((struct BenchMutexContext*)(thread)->context)
+
+ZENNY_BENCH_WORKER(BenchMutexZenny,
+                   ZennyMutexLock(&BENCH_MUTEX_CONTEXT(thread)->mutex);
+                   BENCH_MUTEX_CONTEXT(thread)->protectedCount++;
+                   ZennyMutexUnlock(&BENCH_MUTEX_CONTEXT(thread)->mutex))
+#ifndef _WIN32
+ZENNY_BENCH_WORKER(BenchMutexPthread,
+                   pthread_mutex_lock(&BENCH_MUTEX_CONTEXT(thread)->pthreadMutex);
+                   BENCH_MUTEX_CONTEXT(thread)->protectedCount++;
+                   pthread_mutex_unlock(&BENCH_MUTEX_CONTEXT(thread)->pthreadMutex))
+#endif
+
+static void BenchRunMutex(const char *family, const char *impl, int threadCount, ZennyBenchWorker worker, struct BenchMutexContext *context)
+{
+    context->protectedCount = 0;
+    ZennyBenchRunCase(family, impl, "shared", threadCount, worker, context);
+
+    const int64_t expected = (int64_t)((sOptions.opsPerThread + ZENNY_BENCH_BATCH - 1) / ZENNY_BENCH_BATCH * ZENNY_BENCH_BATCH) * threadCount;
+    if (context->protectedCount != expected)
+    {
+        fprintf(stderr, "%s %s lost updates: %lld of %lld\n", family, impl, (long long)context->protectedCount, (long long)expected);
+        sCheckFailed = true;
+    }
+}
+
+/** Spin-then-park mutex against pthread_mutex with one and four threads per processor */
+static void BenchSuiteMutex(void)
+{
+    static struct BenchMutexContext context;
+#ifndef _WIN32
+    pthread_mutex_init(&context.pthreadMutex, NULL);
+#endif
+
+    static const struct { int factor; const char *family; } loads[] = {
+        { 1, "Mutex1x" },
+        { 4, "Mutex4x" }
+    };
+
+    for (size_t l = 0; l < sizeof(loads) / sizeof(loads[0]); l++)
+    {
+        int threadCount = sOptions.maxThreads * loads[l].factor;
+        if (threadCount > ZENNY_BENCH_MAX_THREADS)
+            threadCount = ZENNY_BENCH_MAX_THREADS;
+
+        ZennyMutexInit(&context.mutex, true);
+        BenchRunMutex(loads[l].family, "spin-park", threadCount, BenchMutexZenny, &context);
+
+        struct ZennyMutexStatistics statistics;
+        ZennyMutexGetStatistics(&context.mutex, &statistics);
+        fprintf(stderr, "%s spin-park: %llu acquisitions, %llu contended, %.1f ns average contended wait\n",
+                loads[l].family, (unsigned long long)statistics.acquisitions, (unsigned long long)statistics.contendedAcquisitions,
+                statistics.contendedAcquisitions == 0 ? 0.0 : (double)statistics.waitNs / (double)statistics.contendedAcquisitions);
+
+        // Without statistics, to show what collecting them costs
+        ZennyMutexInit(&context.mutex, false);
+        BenchRunMutex(loads[l].family, "spin-park-nostats", threadCount, BenchMutexZenny, &context);
+#ifndef _WIN32
+        BenchRunMutex(loads[l].family, "pthread", threadCount, BenchMutexPthread, &context);
+#endif
+    }
+
+#ifndef _WIN32
+    pthread_mutex_destroy(&context.pthreadMutex);
+#endif
+}
+
+// MARK: Driver
+
+struct ZennyBenchSuite
+{
+    const char *name;
+    void (*run)(void);
+};
+
+static const struct ZennyBenchSuite sSuites[] = {
+    { "atomics", BenchSuiteAtomics },
+    { "padding", BenchSuitePadding },
+    { "counter", BenchSuiteCounter },
+    { "spinlock", BenchSuiteSpinLock },
+    { "backoff", BenchSuiteBackoff },
+    { "float", BenchSuiteFloat },
+    { "bitmap", BenchSuiteBitmap },
+    { "spsc", BenchSuiteSpscRing },
+    { "mpmc", BenchSuiteMpmcQueue },
+    { "stack", BenchSuiteLockFreeStack },
+    { "epoch", BenchSuiteEpoch },
+    { "hazard", BenchSuiteHazard },
+    { "seqlock", BenchSuiteSeqlock },
+    { "rcu", BenchSuiteRcu },
+    { "rwlock", BenchSuiteRWLock },
+    { "sync", BenchSuiteSync },
+    { "mutex", BenchSuiteMutex }
+};
+
+#define ZENNY_BENCH_SUITE_COUNT     (sizeof(sSuites) / sizeof(sSuites[0]))
+
+static void ZennyBenchUsage(const char *program)
+{
+    fprintf(stderr, "Usage: %s [suite ...] [--threads N] [--ops N] [--json] [--pin]\nSuites:", program);
+    for (size_t i = 0; i < ZENNY_BENCH_SUITE_COUNT; i++)
+        fprintf(stderr, " %s", sSuites[i].name);
+    fprintf(stderr, "\n");
+}
+
+int main(int argc, const char * argv[])
+{
+    bool selected[ZENNY_BENCH_SUITE_COUNT] = { false };
+    bool anySelected = false;
+
+    sOptions.maxThreads = ZennyBenchProcessorCount();
+    sOptions.opsPerThread = 1 << 20;
+    sOptions.json = false;
+    sOptions.pin = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc)
+            sOptions.maxThreads = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--ops") == 0 && i + 1 < argc)
+            sOptions.opsPerThread = (size_t)strtoull(argv[++i], NULL, 10);
+        else if (strcmp(argv[i], "--json") == 0)
+            sOptions.json = true;
+        else if (strcmp(argv[i], "--pin") == 0)
+            sOptions.pin = true;
+        else
+        {
+            size_t s = 0;
+            while (s < ZENNY_BENCH_SUITE_COUNT && strcmp(argv[i], sSuites[s].name) != 0)
+                s++;
+
+            if (s == ZENNY_BENCH_SUITE_COUNT)
+            {
+                ZennyBenchUsage(argv[0]);
+                return EXIT_FAILURE;
+            }
+
+            selected[s] = true;
+            anySelected = true;
+        }
+    }
+
+    if (sOptions.maxThreads < 1)
+        sOptions.maxThreads = 1;
+    if (sOptions.maxThreads > ZENNY_BENCH_MAX_THREADS)
+        sOptions.maxThreads = ZENNY_BENCH_MAX_THREADS;
+    if (sOptions.opsPerThread < ZENNY_BENCH_BATCH)
+        sOptions.opsPerThread = ZENNY_BENCH_BATCH;
+
+    sPrivateObjects = ZennyAtomicAllocPaddedArray(ZENNY_BENCH_MAX_THREADS);
+    if (sPrivateObjects == NULL)
+    {
+        fprintf(stderr, "Out of memory\n");
+        return EXIT_FAILURE;
+    }
+
+    if (sOptions.json)
+        printf("[");
+    else
+        puts("build,family,impl,sharing,threads,ops,seconds,ops_per_sec,ns_per_op,p50_ns,p99_ns,p999_ns,fairness");
+
+    for (size_t s = 0; s < ZENNY_BENCH_SUITE_COUNT; s++)
+    {
+        if (!anySelected || selected[s])
+            sSuites[s].run();
+    }
+
+    if (sOptions.json)
+        printf("\n]\n");
+
+    ZennyAtomicFreePaddedArray(sPrivateObjects);
+    return sCheckFailed ? EXIT_FAILURE : 0;
+}
+
@@ -0,0 +1,194 @@
+//
+//  zenny_atomic_bitmap.c
+//  ZennyAtomics
+//
+//  Copyright © 2019 Zenny Chen. All rights reserved.
+//
+
+#include "zenny_atomic_bitmap.h"
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+#define ZENNY_ATOMIC_BITMAP_WORD_BITS   64
+
+// MARK: Word helpers
+
+/** Set a bit of a word with a single locked instruction where there is one */
+static bool ZennyAtomicBitmapWordTestAndSet(volatile struct ZennyAtomicULong *word, unsigned bit)
+{
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+    return _interlockedbittestandset64((volatile __int64*)&word->value, bit);
+#elif defined(_MSC_VER)
+    return _interlockedbittestandset((volatile long*)&word->value + (bit >> 5), bit & 31);
+#elif defined(__GNUC__) && defined(__x86_64__)
+    bool previous;
+    __asm__ __volatile__("lock btsq %2, %0" : "+m"(word->value), "=@ccc"(previous) : "r"((uint64_t)bit) : "memory");
+    return previous;
+#else
+    const uint64_t mask = (uint64_t)1 << bit;
+    return (ZennyAtomicULongOr(word, mask) & mask) != 0;
+#endif
+}
+
+/** Clear a bit of a word with a single locked instruction where there is one */
+static bool ZennyAtomicBitmapWordTestAndReset(volatile struct ZennyAtomicULong *word, unsigned bit)
+{
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+    return _interlockedbittestandreset64((volatile __int64*)&word->value, bit);
+#elif defined(_MSC_VER)
+    return _interlockedbittestandreset((volatile long*)&word->value + (bit >> 5), bit & 31);
+#elif defined(__GNUC__) && defined(__x86_64__)
+    bool previous;
+    __asm__ __volatile__("lock btrq %2, %0" : "+m"(word->value), "=@ccc"(previous) : "r"((uint64_t)bit) : "memory");
+    return previous;
+#else
+    const uint64_t mask = (uint64_t)1 << bit;
+    return (ZennyAtomicULongAnd(word, ~mask) & mask) != 0;
+#endif
+}
+
+/** Flip a bit of a word with a single locked instruction where there is one */
+static bool ZennyAtomicBitmapWordTestAndComplement(volatile struct ZennyAtomicULong *word, unsigned bit)
+{
+#if defined(__GNUC__) && defined(__x86_64__)
+    bool previous;
+    __asm__ __volatile__("lock btcq %2, %0" : "+m"(word->value), "=@ccc"(previous) : "r"((uint64_t)bit) : "memory");
+    return previous;
+#else
+    // MSVC has no interlocked bit-test-and-complement intrinsic
+    const uint64_t mask = (uint64_t)1 << bit;
+    return (ZennyAtomicULongXor(word, mask) & mask) != 0;
+#endif
+}
+
+/** Index of the lowest set bit of a non-zero word */
+static unsigned ZennyAtomicBitmapLowestSetBit(uint64_t value)
+{
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+    unsigned long index;
+    _BitScanForward64(&index, value);
+    return (unsigned)index;
+#elif defined(_MSC_VER)
+    unsigned long index;
+    if (_BitScanForward(&index, (unsigned long)value))
+        return (unsigned)index;
+    _BitScanForward(&index, (unsigned long)(value >> 32));
+    return (unsigned)index + 32;
+#else
+    return (unsigned)__builtin_ctzll(value);
+#endif
+}
+
+/** Number of set bits of a word */
+static unsigned ZennyAtomicBitmapPopCount(uint64_t value)
+{
+#if defined(_MSC_VER)
+    // __popcnt64 requires a processor with POPCNT and is missing on ARM64, so count in parallel instead
+    value = value - ((value >> 1) & 0x5555555555555555ULL);
+    value = (value & 0x3333333333333333ULL) + ((value >> 2) & 0x3333333333333333ULL);
+    value = (value + (value >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return (unsigned)((value * 0x0101010101010101ULL) >> 56);
+#else
+    return (unsigned)__builtin_popcountll(value);
+#endif
+}
+
+// MARK: Bitmap
+
+bool ZennyAtomicBitmapInit(struct ZennyAtomicBitmap *bitmap, size_t bitCount)
+{
+    const size_t wordCount = (bitCount + ZENNY_ATOMIC_BITMAP_WORD_BITS - 1) / ZENNY_ATOMIC_BITMAP_WORD_BITS;
+
+    bitmap->words = ZennyAtomicAllocCacheAligned((wordCount > 0 ? wordCount : 1) * sizeof(*bitmap->words));
+    bitmap->bitCount = bitCount;
+    bitmap->wordCount = wordCount;
+    if (bitmap->words == NULL)
+        return false;
+
+    // Keep the bits past the end set, so that the search never has to mask the last word
+    const unsigned tailBits = (unsigned)(bitCount % ZENNY_ATOMIC_BITMAP_WORD_BITS);
+    if (tailBits != 0)
+        ZennyAtomicULongInit(&bitmap->words[wordCount - 1], ~(uint64_t)0 << tailBits);
+
+    return true;
+}
+
+void ZennyAtomicBitmapDestroy(struct ZennyAtomicBitmap *bitmap)
+{
+    ZennyAtomicFreeCacheAligned(bitmap->words);
+    bitmap->words = NULL;
+}
+
+bool ZennyAtomicBitmapTest(struct ZennyAtomicBitmap *bitmap, size_t index)
+{
+    const uint64_t value = ZennyAtomicULongLoadExplicit(&bitmap->words[index / ZENNY_ATOMIC_BITMAP_WORD_BITS], ZennyMemoryOrderAcquire);
+    return (value >> (index % ZENNY_ATOMIC_BITMAP_WORD_BITS) & 1) != 0;
+}
+
+bool ZennyAtomicBitmapTestAndSet(struct ZennyAtomicBitmap *bitmap, size_t index)
+{
+    return ZennyAtomicBitmapWordTestAndSet(&bitmap->words[index / ZENNY_ATOMIC_BITMAP_WORD_BITS],
+                                           (unsigned)(index % ZENNY_ATOMIC_BITMAP_WORD_BITS));
+}
+
+bool ZennyAtomicBitmapTestAndReset(struct ZennyAtomicBitmap *bitmap, size_t index)
+{
+    return ZennyAtomicBitmapWordTestAndReset(&bitmap->words[index / ZENNY_ATOMIC_BITMAP_WORD_BITS],
+                                             (unsigned)(index % ZENNY_ATOMIC_BITMAP_WORD_BITS));
+}
+
+bool ZennyAtomicBitmapTestAndComplement(struct ZennyAtomicBitmap *bitmap, size_t index)
+{
+    return ZennyAtomicBitmapWordTestAndComplement(&bitmap->words[index / ZENNY_ATOMIC_BITMAP_WORD_BITS],
+                                                  (unsigned)(index % ZENNY_ATOMIC_BITMAP_WORD_BITS));
+}
+
+size_t ZennyAtomicBitmapFindFirstZero(struct ZennyAtomicBitmap *bitmap)
+{
+    for (size_t wordIndex = 0; wordIndex < bitmap->wordCount; wordIndex++)
+    {
+        const uint64_t value = ZennyAtomicULongLoadExplicit(&bitmap->words[wordIndex], ZennyMemoryOrderRelaxed);
+        if (value != UINT64_MAX)
+            return wordIndex * ZENNY_ATOMIC_BITMAP_WORD_BITS + ZennyAtomicBitmapLowestSetBit(~value);
+    }
+
+    return ZENNY_ATOMIC_BITMAP_NOT_FOUND;
+}
+
+size_t ZennyAtomicBitmapClaimFirstZero(struct ZennyAtomicBitmap *bitmap, size_t start)
+{
+    size_t wordIndex = start < bitmap->bitCount ? start / ZENNY_ATOMIC_BITMAP_WORD_BITS : 0;
+
+    for (size_t visited = 0; visited < bitmap->wordCount; visited++)
+    {
+        volatile struct ZennyAtomicULong *word = &bitmap->words[wordIndex];
+        uint64_t value = ZennyAtomicULongLoadExplicit(word, ZennyMemoryOrderRelaxed);
+
+        while (value != UINT64_MAX)
+        {
+            const unsigned bit = ZennyAtomicBitmapLowestSetBit(~value);
+            if (!ZennyAtomicBitmapWordTestAndSet(word, bit))
+                return wordIndex * ZENNY_ATOMIC_BITMAP_WORD_BITS + bit;
+
+            // Another thread took the bit first; look at the word again rather than moving on
+            value = ZennyAtomicULongLoadExplicit(word, ZennyMemoryOrderRelaxed);
+        }
+
+        if (++wordIndex == bitmap->wordCount)
+            wordIndex = 0;
+    }
+
+    return ZENNY_ATOMIC_BITMAP_NOT_FOUND;
+}
+
+size_t ZennyAtomicBitmapCount(struct ZennyAtomicBitmap *bitmap)
+{
+    size_t count = 0;
+    for (size_t wordIndex = 0; wordIndex < bitmap->wordCount; wordIndex++)
+        count += ZennyAtomicBitmapPopCount(ZennyAtomicULongLoadExplicit(&bitmap->words[wordIndex], ZennyMemoryOrderRelaxed));
+
+    // Leave out the padding bits of the last word
+    return count - (bitmap->wordCount * ZENNY_ATOMIC_BITMAP_WORD_BITS - bitmap->bitCount);
+}
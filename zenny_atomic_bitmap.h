@@ -0,0 +1,108 @@
+//
+//  zenny_atomic_bitmap.h
+//  ZennyAtomics
+//
+//  Copyright © 2019 Zenny Chen. All rights reserved.
+//
+
+#ifndef zenny_atomic_bitmap_h
+#define zenny_atomic_bitmap_h
+
+#include "zenny_atomics.h"
+
+/** Returned by the search functions when no bit qualifies */
+#define ZENNY_ATOMIC_BITMAP_NOT_FOUND   SIZE_MAX
+
+/**
+ * Lock-free bitmap, e.g. for slot or ID allocation.
+ * Each bit is changed by a single atomic read-modify-write (lock bts/btr/btc on x86),
+ * and free bits are found a 64-bit word at a time.
+ */
+struct ZennyAtomicBitmap
+{
+    /** bits packed into 64-bit words; bit i lives in word i / 64 at position i % 64 */
+    struct ZennyAtomicULong *words;
+
+    /** number of usable bits */
+    size_t bitCount;
+
+    /** number of words; the bits past `bitCount` in the last word are kept set so that they are never claimed */
+    size_t wordCount;
+};
+
+/**
+ * Initialize a bitmap with all bits clear
+ * @param bitmap pointer to the bitmap object
+ * @param bitCount number of bits
+ * @return true if successful; false if the words cannot be allocated.
+ */
+extern bool ZennyAtomicBitmapInit(struct ZennyAtomicBitmap *bitmap, size_t bitCount);
+
+/**
+ * Release the words of a bitmap
+ * @param bitmap pointer to the bitmap object
+ */
+extern void ZennyAtomicBitmapDestroy(struct ZennyAtomicBitmap *bitmap);
+
+/**
+ * Load a bit with acquire semantics
+ * @param bitmap pointer to the bitmap object
+ * @param index index of the bit, less than `bitCount`
+ * @return the value of the bit
+ */
+extern bool ZennyAtomicBitmapTest(struct ZennyAtomicBitmap *bitmap, size_t index);
+
+/**
+ * Set a bit atomically. This is a full barrier.
+ * @param bitmap pointer to the bitmap object
+ * @param index index of the bit, less than `bitCount`
+ * @return the value of the bit just before the operation
+ */
+extern bool ZennyAtomicBitmapTestAndSet(struct ZennyAtomicBitmap *bitmap, size_t index);
+
+/**
+ * Clear a bit atomically. This is a full barrier.
+ * @param bitmap pointer to the bitmap object
+ * @param index index of the bit, less than `bitCount`
+ * @return the value of the bit just before the operation
+ */
+extern bool ZennyAtomicBitmapTestAndReset(struct ZennyAtomicBitmap *bitmap, size_t index);
+
+/**
+ * Flip a bit atomically. This is a full barrier.
+ * @param bitmap pointer to the bitmap object
+ * @param index index of the bit, less than `bitCount`
+ * @return the value of the bit just before the operation
+ */
+extern bool ZennyAtomicBitmapTestAndComplement(struct ZennyAtomicBitmap *bitmap, size_t index);
+
+/**
+ * Find a clear bit without claiming it.
+ * The result is a snapshot: the bit may have been set by another thread by the time it is returned.
+ * @param bitmap pointer to the bitmap object
+ * @return index of the lowest clear bit, or ZENNY_ATOMIC_BITMAP_NOT_FOUND if every bit is set
+ */
+extern size_t ZennyAtomicBitmapFindFirstZero(struct ZennyAtomicBitmap *bitmap);
+
+/**
+ * Find a clear bit and set it atomically, e.g. to allocate a slot.
+ * The search reads one word at a time and issues a single bit-test-and-set per candidate,
+ * so a claim costs one RMW unless another thread takes the same bit first.
+ * Release the bit with ZennyAtomicBitmapTestAndReset.
+ * @param bitmap pointer to the bitmap object
+ * @param start the search begins at the word holding this bit and wraps around to cover the whole bitmap.
+ * Pass e.g. a per-thread hint to spread concurrent claims over different words.
+ * @return index of the claimed bit, or ZENNY_ATOMIC_BITMAP_NOT_FOUND if every bit is set
+ */
+extern size_t ZennyAtomicBitmapClaimFirstZero(struct ZennyAtomicBitmap *bitmap, size_t start);
+
+/**
+ * Count the set bits.
+ * The words are read with relaxed loads, so changes in flight may or may not be counted.
+ * @param bitmap pointer to the bitmap object
+ * @return the number of set bits
+ */
+extern size_t ZennyAtomicBitmapCount(struct ZennyAtomicBitmap *bitmap);
+
+#endif /* zenny_atomic_bitmap_h */
+
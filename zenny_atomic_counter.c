@@ -0,0 +1,59 @@
+//
+//  zenny_atomic_counter.c
+//  ZennyAtomics
+//
+//  Copyright © 2019 Zenny Chen. All rights reserved.
+//
+
+#include <limits.h>
+#include "zenny_atomic_counter.h"
+
+bool ZennyAtomicCounterInit(struct ZennyAtomicCounter *counter, unsigned stripeCount)
+{
+    if (stripeCount == 0)
+        stripeCount = (unsigned)ZennyAtomicProcessorCount();
+
+    // The mask has to fit in unsigned
+    const size_t roundedCount = ZennyAtomicRoundUpPowerOfTwo(stripeCount);
+    if (roundedCount == 0 || roundedCount > UINT_MAX)
+    {
+        counter->stripes = NULL;
+        return false;
+    }
+
+    counter->stripes = ZennyAtomicAllocPaddedArray(roundedCount);
+    counter->stripeMask = (unsigned)(roundedCount - 1);
+
+    return counter->stripes != NULL;
+}
+
+void ZennyAtomicCounterDestroy(struct ZennyAtomicCounter *counter)
+{
+    ZennyAtomicFreePaddedArray(counter->stripes);
+    counter->stripes = NULL;
+}
+
+void ZennyAtomicCounterAdd(struct ZennyAtomicCounter *counter, int64_t value)
+{
+    volatile struct ZennyAtomicType *stripe = &counter->stripes[ZennyAtomicThreadIndex() & counter->stripeMask].atomic;
+    ZennyAtomicAddLongExplicit(stripe, value, ZennyMemoryOrderRelaxed);
+}
+
+int64_t ZennyAtomicCounterRead(struct ZennyAtomicCounter *counter)
+{
+    int64_t sum = 0;
+    for (unsigned i = 0; i <= counter->stripeMask; i++)
+        sum += ZennyAtomicLoadLongExplicit(&counter->stripes[i].atomic, ZennyMemoryOrderRelaxed);
+
+    return sum;
+}
+
+int64_t ZennyAtomicCounterReset(struct ZennyAtomicCounter *counter)
+{
+    int64_t sum = 0;
+    for (unsigned i = 0; i <= counter->stripeMask; i++)
+        sum += ZennyAtomicExchangeLong(&counter->stripes[i].atomic, 0);
+
+    return sum;
+}
+
@@ -0,0 +1,72 @@
+//
+//  zenny_atomic_counter.h
+//  ZennyAtomics
+//
+//  Copyright © 2019 Zenny Chen. All rights reserved.
+//
+
+#ifndef zenny_atomic_counter_h
+#define zenny_atomic_counter_h
+
+#include "zenny_atomics.h"
+
+/**
+ * Scalable counter.
+ * Increments are spread over cache-line padded stripes selected by the calling thread,
+ * so threads that add concurrently rarely touch the same cache line.
+ * Reading the counter has to walk all stripes instead.
+ */
+struct ZennyAtomicCounter
+{
+    /** one int64_t stripe per cache line */
+    struct ZennyAtomicPaddedType *stripes;
+
+    /** number of stripes minus one; the number of stripes is a power of two */
+    unsigned stripeMask;
+};
+
+/**
+ * Initialize a scalable counter to zero
+ * @param counter pointer to the counter object
+ * @param stripeCount number of stripes, rounded up to a power of two.
+ * Pass 0 to use one stripe per online processor.
+ * @return true if successful; false if there are too many stripes or they cannot be allocated.
+ */
+extern bool ZennyAtomicCounterInit(struct ZennyAtomicCounter *counter, unsigned stripeCount);
+
+/**
+ * Release the stripes of a scalable counter
+ * @param counter pointer to the counter object
+ */
+extern void ZennyAtomicCounterDestroy(struct ZennyAtomicCounter *counter);
+
+/**
+ * Add a value to the stripe of the calling thread.
+ * This is a relaxed operation: it does not order any other memory access.
+ * @param counter pointer to the counter object
+ * @param value the value to be added
+ */
+extern void ZennyAtomicCounterAdd(struct ZennyAtomicCounter *counter, int64_t value);
+
+/**
+ * Read the value of the counter.
+ * Every addition that happens before this call, e.g. made by threads that have been joined, is included.
+ * Additions made concurrently with the call may or may not be, and as the stripes are loaded one by one,
+ * the result need not equal the value of the counter at any single instant while threads are adding.
+ * Use ZennyAtomicCounterReset to count every addition exactly once.
+ * @param counter pointer to the counter object
+ * @return the sum of all stripes
+ */
+extern int64_t ZennyAtomicCounterRead(struct ZennyAtomicCounter *counter);
+
+/**
+ * Reset the counter to zero.
+ * Each stripe is drained with an atomic exchange, so every addition is counted exactly once:
+ * either in the returned value or in the value after the reset.
+ * @param counter pointer to the counter object
+ * @return the value drained from the stripes
+ */
+extern int64_t ZennyAtomicCounterReset(struct ZennyAtomicCounter *counter);
+
+#endif /* zenny_atomic_counter_h */
+
@@ -6,631 +6,448 @@
 //  Copyright © 2019 Zenny Chen. All rights reserved.
 //
 
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
+#include <stdlib.h>
+#include <string.h>
 #include "zenny_atomics.h"
 
+#if defined(_WIN32)
+#include <windows.h>
 #ifdef _MSC_VER
+#pragma comment(lib, "Synchronization.lib")
+#endif
+#elif defined(__linux__)
+#include <limits.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
 
-#include <intrin.h>
+#ifndef ZENNY_ATOMICS_HEADER_ONLY
+#include "zenny_atomics_impl.h"
+#endif
 
-// MARK: Initialization
+// MARK: Lock-based fallback of the pair operations
 
-void ZennyAtomicInitByte(volatile struct ZennyAtomicType *atomic, int8_t value)
-{
-    *(int8_t*)atomic = value;
-}
+/** Number of spin locks that the pair objects are hashed onto */
+#define ZENNY_ATOMICS_PAIR_LOCK_COUNT   64
 
-void ZennyAtomicInitInt(volatile struct ZennyAtomicType *atomic, int value)
-{
-    *(int*)atomic = value;
-}
+static struct ZennyAtomicType sPairLocks[ZENNY_ATOMICS_PAIR_LOCK_COUNT];
 
-void ZennyAtomicInitLong(volatile struct ZennyAtomicType *atomic, int64_t value)
+static volatile struct ZennyAtomicType* ZennyAtomicPairLockFor(volatile struct ZennyAtomicType *atomic)
 {
-    *(int64_t*)atomic = value;
+    return &sPairLocks[((uintptr_t)atomic / sizeof(*atomic)) % ZENNY_ATOMICS_PAIR_LOCK_COUNT];
 }
 
-void ZennyAtomicInitPtr(volatile struct ZennyAtomicType *atomic, intptr_t value)
+void ZennyAtomicPairLock(volatile struct ZennyAtomicType *atomic)
 {
-    *(intptr_t*)atomic = value;
-}
+    volatile struct ZennyAtomicType *lock = ZennyAtomicPairLockFor(atomic);
+    struct ZennyAtomicBackoff backoff;
+    ZennyAtomicBackoffInit(&backoff, ZennyAtomicBackoffExponential, 1, ZENNY_ATOMICS_BACKOFF_MAX_SPINS, 0);
 
-void ZennyAtomicInitFlag(volatile struct ZennyAtomicType *atomic)
-{
-    *(bool*)atomic = false;
+    while (ZennyAtomicTestAndSetFlagExplicit(lock, ZennyMemoryOrderAcquire))
+    {
+        while (ZennyAtomicLoadFlagExplicit(lock, ZennyMemoryOrderRelaxed))
+            ZennyAtomicBackoffSpin(&backoff);
+    }
 }
 
-// MARK: Load
-
-int8_t ZennyAtomicLoadByte(volatile struct ZennyAtomicType *atomic)
+void ZennyAtomicPairUnlock(volatile struct ZennyAtomicType *atomic)
 {
-    return *(int8_t*)atomic;
+    ZennyAtomicClearFlagExplicit(ZennyAtomicPairLockFor(atomic), ZennyMemoryOrderRelease);
 }
 
-int ZennyAtomicLoadInt(volatile struct ZennyAtomicType *atomic)
-{
-    return *(int*)atomic;
-}
+// MARK: Cache-line aligned allocation
 
-int64_t ZennyAtomicLoadLong(volatile struct ZennyAtomicType* atomic)
+void* ZennyAtomicAllocCacheAligned(size_t size)
 {
-    return *(int64_t*)atomic;
-}
+    const size_t lineSize = ZENNY_ATOMICS_CACHE_LINE_SIZE;
+    if (size == 0 || size > SIZE_MAX - lineSize)
+        return NULL;
 
-intptr_t ZennyAtomicLoadPtr(volatile struct ZennyAtomicType* atomic)
-{
-    return *(intptr_t*)atomic;
-}
+    size = (size + lineSize - 1) & ~(lineSize - 1);
 
-// MARK: Flag atomic operations
+    void *memory;
+#ifdef _WIN32
+    memory = _aligned_malloc(size, lineSize);
+#else
+    if (posix_memalign(&memory, lineSize, size) != 0)
+        memory = NULL;
+#endif
 
-bool ZennyAtomicLoadFlag(volatile struct ZennyAtomicType *atomic)
-{
-    return *(bool*)atomic;
-}
+    if (memory != NULL)
+        memset(memory, 0, size);
 
-bool ZennyAtomicTestAndSetFlag(volatile struct ZennyAtomicType *atomic)
-{
-    return _interlockedbittestandset((long*)atomic, 1);
+    return memory;
 }
 
-void ZennyAtomicClearFlag(volatile struct ZennyAtomicType *atomic)
+void ZennyAtomicFreeCacheAligned(void *memory)
 {
-    _InterlockedExchange8((char*)atomic, 0);
-}
-
-// MARK: Store
-
-void ZennyAtomicStoreByte(volatile struct ZennyAtomicType *atomic, int8_t value)
-{
-    *(int8_t*)atomic = value;
+#ifdef _WIN32
+    _aligned_free(memory);
+#else
+    free(memory);
+#endif
 }
 
-void ZennyAtomicStoreInt(volatile struct ZennyAtomicType *atomic, int value)
+struct ZennyAtomicPaddedType* ZennyAtomicAllocPaddedArray(size_t count)
 {
-    *(int*)atomic = value;
-}
+    if (count == 0 || count > SIZE_MAX / sizeof(struct ZennyAtomicPaddedType))
+        return NULL;
 
-void ZennyAtomicStoreLong(volatile struct ZennyAtomicType *atomic, int64_t value)
-{
-    *(int64_t*)atomic = value;
+    return ZennyAtomicAllocCacheAligned(count * sizeof(struct ZennyAtomicPaddedType));
 }
 
-void ZennyAtomicStorePtr(volatile struct ZennyAtomicType *atomic, intptr_t value)
+void ZennyAtomicFreePaddedArray(struct ZennyAtomicPaddedType *array)
 {
-    *(intptr_t*)atomic = value;
+    ZennyAtomicFreeCacheAligned(array);
 }
 
-// MARK: Add
-
-int8_t ZennyAtomicAddByte(volatile struct ZennyAtomicType *atomic, int8_t value)
+size_t ZennyAtomicRoundUpPowerOfTwo(size_t value)
 {
-    int8_t comparand;
-    int8_t desired;
-    bool successful;
+    // Past the top power of two, the shift below would wrap to 0 and never end
+    if (value > SIZE_MAX / 2 + 1)
+        return 0;
 
-    do
-    {
-        comparand = *(int8_t*)atomic;
-        desired = comparand + value;
-        const int8_t dstValue = _InterlockedCompareExchange8((volatile char*)atomic, desired, comparand);
-        successful = dstValue == comparand;
-        if (!successful)
-            _mm_pause();
-    } while (!successful);
+    size_t rounded = 1;
+    while (rounded < value)
+        rounded <<= 1;
 
-    return comparand;
+    return rounded;
 }
 
-int ZennyAtomicAddInt(volatile struct ZennyAtomicType *atomic, int value)
-{
-    long comparand;
-    long desired;
-    bool successful;
-
-    do
-    {
-        comparand = *(long*)atomic;
-        desired = comparand + value;
-        const long dstValue = _InterlockedCompareExchange((volatile long*)atomic, desired, comparand);
-        successful = dstValue == comparand;
-        if (!successful)
-            _mm_pause();
-    } while (!successful);
-
-    return comparand;
-}
+// MARK: Thread utilities
 
-int64_t ZennyAtomicAddLong(volatile struct ZennyAtomicType *atomic, int64_t value)
+int ZennyAtomicProcessorCount(void)
 {
-    int64_t comparand;
-    int64_t desired;
-    bool successful;
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? (int)info.dwNumberOfProcessors : 1;
+#else
+    const long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? (int)count : 1;
+#endif
+}
 
-    do
-    {
-        comparand = *(int64_t*)atomic;
-        desired = comparand + value;
-        const int64_t dstValue = _InterlockedCompareExchange64((volatile int64_t*)atomic, desired, comparand);
-        successful = dstValue == comparand;
-        if (!successful)
-            _mm_pause();
-    } while (!successful);
+static struct ZennyAtomicInt sNextThreadIndex;
 
-    return comparand;
-}
+/** Index of the calling thread plus one, or 0 if it has not been assigned yet */
+static ZENNY_ATOMICS_THREAD_LOCAL unsigned tThreadIndexPlusOne;
 
-intptr_t ZennyAtomicAddPtr(volatile struct ZennyAtomicType *atomic, intptr_t value)
+unsigned ZennyAtomicThreadIndex(void)
 {
-    intptr_t comparand;
-    intptr_t desired;
-    bool successful;
-
-    do
-    {
-        comparand = *(intptr_t*)atomic;
-        desired = comparand + value;
-        const intptr_t dstValue = (intptr_t)_InterlockedCompareExchangePointer((void* volatile *)atomic, (void*)desired, (void*)comparand);
-        successful = dstValue == comparand;
-        if (!successful)
-            _mm_pause();
-    } while (!successful);
+    if (tThreadIndexPlusOne == 0)
+        tThreadIndexPlusOne = (unsigned)ZennyAtomicIntAddExplicit(&sNextThreadIndex, 1, ZennyMemoryOrderRelaxed) + 1;
 
-    return comparand;
+    return tThreadIndexPlusOne - 1;
 }
 
-// MARK: Subtract
+// MARK: Wait and notify
 
-int8_t ZennyAtomicSubByte(volatile struct ZennyAtomicType *atomic, int8_t value)
-{
-    int8_t comparand;
-    int8_t desired;
-    bool successful;
+/** Number of times a waiting thread polls the atomic object before it parks */
+#define ZENNY_ATOMICS_WAIT_SPIN_COUNT   128
 
-    do
-    {
-        comparand = *(int8_t*)atomic;
-        desired = comparand - value;
-        const int8_t dstValue = _InterlockedCompareExchange8((volatile char*)atomic, desired, comparand);
-        successful = dstValue == comparand;
-        if (!successful)
-            _mm_pause();
-    } while (!successful);
+#ifdef _WIN32
 
-    return comparand;
-}
+// WaitOnAddress compares the object itself and wakes exactly the threads waiting on its address,
+// so no parking table is needed.
 
-int ZennyAtomicSubInt(volatile struct ZennyAtomicType *atomic, int value)
+void ZennyAtomicWaitInt(volatile struct ZennyAtomicType *atomic, int old)
 {
-    long comparand;
-    long desired;
-    bool successful;
-
-    do
+    for (int i = 0; i < ZENNY_ATOMICS_WAIT_SPIN_COUNT; i++)
     {
-        comparand = *(long*)atomic;
-        desired = comparand - value;
-        const long dstValue = _InterlockedCompareExchange((volatile long*)atomic, desired, comparand);
-        successful = dstValue == comparand;
-        if (!successful)
-            _mm_pause();
-    } while (!successful);
+        if (ZennyAtomicLoadInt(atomic) != old)
+            return;
+        ZennyAtomicPause();
+    }
 
-    return comparand;
+    while (ZennyAtomicLoadInt(atomic) == old)
+        WaitOnAddress((volatile VOID*)atomic, &old, sizeof(old), INFINITE);
 }
 
-int64_t ZennyAtomicSubLong(volatile struct ZennyAtomicType *atomic, int64_t value)
+void ZennyAtomicWaitFlag(volatile struct ZennyAtomicType *atomic, bool old)
 {
-    int64_t comparand;
-    int64_t desired;
-    bool successful;
-
-    do
+    for (int i = 0; i < ZENNY_ATOMICS_WAIT_SPIN_COUNT; i++)
     {
-        comparand = *(int64_t*)atomic;
-        desired = comparand - value;
-        const int64_t dstValue = _InterlockedCompareExchange64((volatile int64_t*)atomic, desired, comparand);
-        successful = dstValue == comparand;
-        if (!successful)
-            _mm_pause();
-    } while (!successful);
-
-    return comparand;
-}
+        if (ZennyAtomicLoadFlag(atomic) != old)
+            return;
+        ZennyAtomicPause();
+    }
 
-intptr_t ZennyAtomicSubPtr(volatile struct ZennyAtomicType *atomic, intptr_t value)
-{
-    intptr_t comparand;
-    intptr_t desired;
-    bool successful;
-
-    do
+    for (;;)
     {
-        comparand = *(intptr_t*)atomic;
-        desired = comparand - value;
-        const intptr_t dstValue = (intptr_t)_InterlockedCompareExchangePointer((void* volatile *)atomic, (void*)desired, (void*)comparand);
-        successful = dstValue == comparand;
-        if (!successful)
-            _mm_pause();
-    } while (!successful);
-
-    return comparand;
-}
-
-// MARK: Bitwise OR
-
-int8_t ZennyAtomicOrByte(volatile struct ZennyAtomicType *atomic, int8_t value)
-{
-    return _InterlockedOr8((volatile char*)atomic, value);
-}
-
-int ZennyAtomicOrInt(volatile struct ZennyAtomicType *atomic, int value)
-{
-    return _InterlockedOr((volatile long*)atomic, value);
-}
-
-int64_t ZennyAtomicOrLong(volatile struct ZennyAtomicType *atomic, int64_t value)
-{
-    return _InterlockedOr64((volatile int64_t*)atomic, value);
+        // A set flag is not necessarily stored as 1, so compare the raw byte
+        char flagByte = *(volatile char*)atomic;
+        if ((flagByte != 0) != old)
+            return;
+        WaitOnAddress((volatile VOID*)atomic, &flagByte, sizeof(flagByte), INFINITE);
+    }
 }
 
-intptr_t ZennyAtomicOrPtr(volatile struct ZennyAtomicType *atomic, intptr_t value)
+void ZennyAtomicWaitPtr(volatile struct ZennyAtomicType *atomic, intptr_t old)
 {
-    return sizeof(intptr_t) == 8 ? _InterlockedOr64((volatile int64_t*)atomic, value) : _InterlockedOr((volatile long*)atomic, value);
-}
-
-// MARK: Bitwise XOR
-
-int8_t ZennyAtomicXorByte(volatile struct ZennyAtomicType *atomic, int8_t value)
-{
-    return _InterlockedXor8((volatile char*)atomic, value);
-}
-
-int ZennyAtomicXorInt(volatile struct ZennyAtomicType *atomic, int value)
-{
-    return _InterlockedXor((volatile long*)atomic, value);
-}
-
-int64_t ZennyAtomicXorLong(volatile struct ZennyAtomicType *atomic, int64_t value)
-{
-    return _InterlockedXor64((volatile int64_t*)atomic, value);
-}
-
-intptr_t ZennyAtomicXorPtr(volatile struct ZennyAtomicType *atomic, intptr_t value)
-{
-    return sizeof(intptr_t) == 8 ? _InterlockedXor64((volatile int64_t*)atomic, value) : _InterlockedXor((volatile long*)atomic, value);
-}
-
-// MARK: Bitwise And
-
-int8_t ZennyAtomicAndByte(volatile struct ZennyAtomicType *atomic, int8_t value)
-{
-    return _InterlockedAnd8((volatile char*)atomic, value);
-}
-
-int ZennyAtomicAndInt(volatile struct ZennyAtomicType *atomic, int value)
-{
-    return _InterlockedAnd((volatile long*)atomic, value);
-}
-
-int64_t ZennyAtomicAndLong(volatile struct ZennyAtomicType *atomic, int64_t value)
-{
-    return _InterlockedAnd64((volatile int64_t*)atomic, value);
-}
-
-intptr_t ZennyAtomicAndPtr(volatile struct ZennyAtomicType *atomic, intptr_t value)
-{
-    return sizeof(intptr_t) == 8 ? _InterlockedAnd64((volatile int64_t*)atomic, value) : _InterlockedAnd((volatile long*)atomic, value);
-}
-
-// MARK: Exchange
-
-int8_t ZennyAtomicExchangeByte(volatile struct ZennyAtomicType *atomic, int8_t value)
-{
-    return _InterlockedExchange8((volatile char*)atomic, value);
-}
-
-int ZennyAtomicExchangeInt(volatile struct ZennyAtomicType *atomic, int value)
-{
-    return _InterlockedExchange((volatile long*)atomic, value);
-}
-
-int64_t ZennyAtomicExchangeLong(volatile struct ZennyAtomicType *atomic, int64_t value)
-{
-    return _InterlockedExchange64((volatile int64_t*)atomic, value);
-}
+    for (int i = 0; i < ZENNY_ATOMICS_WAIT_SPIN_COUNT; i++)
+    {
+        if (ZennyAtomicLoadPtr(atomic) != old)
+            return;
+        ZennyAtomicPause();
+    }
 
-intptr_t ZennyAtomicExchangePtr(volatile struct ZennyAtomicType *atomic, intptr_t value)
-{
-    return (intptr_t)_InterlockedExchangePointer((void* volatile *)atomic, (void*)value);
+    while (ZennyAtomicLoadPtr(atomic) == old)
+        WaitOnAddress((volatile VOID*)atomic, &old, sizeof(old), INFINITE);
 }
 
-// MARK: Compare and Exchange
-
-bool ZennyAtomicCompareExchangeByte(volatile struct ZennyAtomicType *atomic, int8_t *expected, int8_t desired)
+void ZennyAtomicNotifyOne(volatile struct ZennyAtomicType *atomic)
 {
-    const int8_t dstValue = _InterlockedCompareExchange8((volatile char*)atomic, desired, *expected);
-    const bool successful = dstValue == *expected;
-    if (!successful)
-        *expected = dstValue;
-
-    return successful;
+    WakeByAddressSingle((PVOID)atomic);
 }
 
-bool ZennyAtomicCompareExchangeInt(volatile struct ZennyAtomicType *atomic, int *expected, int desired)
+void ZennyAtomicNotifyAll(volatile struct ZennyAtomicType *atomic)
 {
-    const long dstValue = _InterlockedCompareExchange((volatile long*)atomic, desired, *expected);
-    const bool successful = dstValue == *expected;
-    if (!successful)
-        *expected = dstValue;
-
-    return successful;
+    WakeByAddressAll((PVOID)atomic);
 }
 
-bool ZennyAtomicCompareExchangeLong(volatile struct ZennyAtomicType *atomic, int64_t *expected, int64_t desired)
-{
-    const int64_t dstValue = _InterlockedCompareExchange64((volatile int64_t*)atomic, desired, *expected);
-    const bool successful = dstValue == *expected;
-    if (!successful)
-        *expected = dstValue;
+#else
 
-    return successful;
-}
+/** Number of parking slots that waited-on objects are hashed onto */
+#define ZENNY_ATOMICS_WAIT_SLOT_COUNT   64
 
-bool ZennyAtomicCompareExchangePtr(volatile struct ZennyAtomicType *atomic, intptr_t *expected, intptr_t desired)
+/** Parking slot shared by the atomic objects hashed onto it */
+struct ZennyAtomicWaitSlot
 {
-    const intptr_t dstValue = (intptr_t)_InterlockedCompareExchangePointer((void* volatile *)atomic, (void*)desired, (void*)*expected);
-    const bool successful = dstValue == *expected;
-    if (!successful)
-        *expected = dstValue;
+    /** number of threads sleeping on the futex word of an atomic object itself */
+    struct ZennyAtomicType directWaiters;
 
-    return successful;
-}
+    /** number of threads sleeping on this slot */
+    struct ZennyAtomicType slotWaiters;
 
+#ifdef __linux__
+    /** futex word bumped by every notification that finds slot waiters */
+    struct ZennyAtomicType sequence;
 #else
+    pthread_mutex_t mutex;
+    pthread_cond_t condition;
+#endif
+};
 
-#include <stdatomic.h>
-
-// MARK: Initialization
-
-void ZennyAtomicInitByte(volatile struct ZennyAtomicType *atomic, int8_t value)
+enum ZennyAtomicWaitKind
 {
-    atomic_init((atomic_schar*)atomic, value);
-}
+    ZennyAtomicWaitKindInt,
+    ZennyAtomicWaitKindFlag,
+    ZennyAtomicWaitKindPtr
+};
 
-void ZennyAtomicInitInt(volatile struct ZennyAtomicType *atomic, int value)
-{
-    atomic_init((atomic_int*)atomic, value);
-}
-
-void ZennyAtomicInitLong(volatile struct ZennyAtomicType *atomic, int64_t value)
-{
-    atomic_init((atomic_llong*)atomic, value);
-}
+static struct ZennyAtomicWaitSlot sWaitSlots[ZENNY_ATOMICS_WAIT_SLOT_COUNT];
 
-void ZennyAtomicInitPtr(volatile struct ZennyAtomicType *atomic, intptr_t value)
+static struct ZennyAtomicWaitSlot* ZennyAtomicWaitSlotFor(volatile struct ZennyAtomicType *atomic)
 {
-    atomic_init((atomic_intptr_t*)atomic, value);
+    return &sWaitSlots[((uintptr_t)atomic / sizeof(*atomic)) % ZENNY_ATOMICS_WAIT_SLOT_COUNT];
 }
 
-void ZennyAtomicInitFlag(volatile struct ZennyAtomicType *atomic)
+static bool ZennyAtomicWaitUnchanged(volatile struct ZennyAtomicType *atomic, enum ZennyAtomicWaitKind kind, intptr_t old)
 {
-    *(atomic_flag*)atomic = (atomic_flag)ATOMIC_FLAG_INIT;
-}
+    switch (kind)
+    {
+        case ZennyAtomicWaitKindInt:
+            return ZennyAtomicLoadInt(atomic) == (int)old;
 
-// MARK: Load
+        case ZennyAtomicWaitKindFlag:
+            return ZennyAtomicLoadFlag(atomic) == (old != 0);
 
-int8_t ZennyAtomicLoadByte(volatile struct ZennyAtomicType *atomic)
-{
-    return atomic_load((atomic_schar*)atomic);
-}
-
-int ZennyAtomicLoadInt(volatile struct ZennyAtomicType *atomic)
-{
-    return atomic_load((atomic_int*)atomic);
+        default:
+            return ZennyAtomicLoadPtr(atomic) == old;
+    }
 }
 
-int64_t ZennyAtomicLoadLong(volatile struct ZennyAtomicType* atomic)
+static bool ZennyAtomicWaitSpin(volatile struct ZennyAtomicType *atomic, enum ZennyAtomicWaitKind kind, intptr_t old)
 {
-    return atomic_load((atomic_llong*)atomic);
-}
+    for (int i = 0; i < ZENNY_ATOMICS_WAIT_SPIN_COUNT; i++)
+    {
+        if (!ZennyAtomicWaitUnchanged(atomic, kind, old))
+            return true;
+        ZennyAtomicPause();
+    }
 
-intptr_t ZennyAtomicLoadPtr(volatile struct ZennyAtomicType* atomic)
-{
-    return atomic_load((atomic_intptr_t*)atomic);
+    return false;
 }
 
-// MARK: Flag atomic operations
-
-bool ZennyAtomicLoadFlag(volatile struct ZennyAtomicType *atomic)
-{
-    return atomic_load(&((atomic_flag*)atomic)->_Value);
-}
+#ifdef __linux__
 
-bool ZennyAtomicTestAndSetFlag(volatile struct ZennyAtomicType *atomic)
+static void ZennyAtomicFutexWait(volatile void *address, int value)
 {
-    return atomic_flag_test_and_set((atomic_flag*)atomic);
+    syscall(SYS_futex, address, FUTEX_WAIT_PRIVATE, value, NULL, NULL, 0);
 }
 
-void ZennyAtomicClearFlag(volatile struct ZennyAtomicType *atomic)
+static void ZennyAtomicFutexWake(volatile void *address, int count)
 {
-    atomic_flag_clear((atomic_flag*)atomic);
+    syscall(SYS_futex, address, FUTEX_WAKE_PRIVATE, count, NULL, NULL, 0);
 }
 
-// MARK: Store
-
-void ZennyAtomicStoreByte(volatile struct ZennyAtomicType *atomic, int8_t value)
+/** Sleep on the first 32-bit word of the atomic object itself */
+static void ZennyAtomicParkDirect(volatile struct ZennyAtomicType *atomic, enum ZennyAtomicWaitKind kind, intptr_t old)
 {
-    atomic_store((atomic_schar*)atomic, value);
-}
+    struct ZennyAtomicWaitSlot *slot = ZennyAtomicWaitSlotFor(atomic);
+    ZennyAtomicAddInt(&slot->directWaiters, 1);
 
-void ZennyAtomicStoreInt(volatile struct ZennyAtomicType *atomic, int value)
-{
-    atomic_store((atomic_int*)atomic, value);
-}
+    for (;;)
+    {
+        // The futex word covers the whole flag byte, so the flag value is taken from the same snapshot
+        const int word = ZennyAtomicLoadInt(atomic);
+        const bool unchanged = kind == ZennyAtomicWaitKindFlag ? (*(const char*)&word != 0) == (old != 0) : word == (int)old;
+        if (!unchanged)
+            break;
+        ZennyAtomicFutexWait(atomic, word);
+    }
 
-void ZennyAtomicStoreLong(volatile struct ZennyAtomicType *atomic, int64_t value)
-{
-    atomic_store((atomic_llong*)atomic, value);
+    ZennyAtomicSubInt(&slot->directWaiters, 1);
 }
 
-void ZennyAtomicStorePtr(volatile struct ZennyAtomicType *atomic, intptr_t value)
+/** Sleep on the sequence word of the parking slot, for values wider than a futex word */
+static void ZennyAtomicParkOnSlot(volatile struct ZennyAtomicType *atomic, enum ZennyAtomicWaitKind kind, intptr_t old)
 {
-    atomic_store((atomic_intptr_t*)atomic, value);
-}
+    struct ZennyAtomicWaitSlot *slot = ZennyAtomicWaitSlotFor(atomic);
+    ZennyAtomicAddInt(&slot->slotWaiters, 1);
 
-// MARK: Add
-
-int8_t ZennyAtomicAddByte(volatile struct ZennyAtomicType *atomic, int8_t value)
-{
-    return atomic_fetch_add((atomic_schar*)atomic, value);
-}
+    for (;;)
+    {
+        const int sequence = ZennyAtomicLoadInt(&slot->sequence);
+        if (!ZennyAtomicWaitUnchanged(atomic, kind, old))
+            break;
+        ZennyAtomicFutexWait(&slot->sequence, sequence);
+    }
 
-int ZennyAtomicAddInt(volatile struct ZennyAtomicType *atomic, int value)
-{
-    return atomic_fetch_add((atomic_int*)atomic, value);
+    ZennyAtomicSubInt(&slot->slotWaiters, 1);
 }
 
-int64_t ZennyAtomicAddLong(volatile struct ZennyAtomicType *atomic, int64_t value)
+static void ZennyAtomicNotify(volatile struct ZennyAtomicType *atomic, int count)
 {
-    return atomic_fetch_add((atomic_llong*)atomic, value);
-}
+    struct ZennyAtomicWaitSlot *slot = ZennyAtomicWaitSlotFor(atomic);
 
-intptr_t ZennyAtomicAddPtr(volatile struct ZennyAtomicType *atomic, intptr_t value)
-{
-    return atomic_fetch_add((atomic_intptr_t*)atomic, value);
-}
+    // Pairs with the waiter count increment made before a waiter checks the value
+    ZennyAtomicThreadFence(ZennyMemoryOrderSeqCst);
 
-// MARK: Subtract
+    if (ZennyAtomicLoadIntExplicit(&slot->directWaiters, ZennyMemoryOrderRelaxed) > 0)
+        ZennyAtomicFutexWake(atomic, count);
 
-int8_t ZennyAtomicSubByte(volatile struct ZennyAtomicType *atomic, int8_t value)
-{
-    return atomic_fetch_sub((atomic_schar*)atomic, value);
-}
-
-int ZennyAtomicSubInt(volatile struct ZennyAtomicType *atomic, int value)
-{
-    return atomic_fetch_sub((atomic_int*)atomic, value);
-}
-
-int64_t ZennyAtomicSubLong(volatile struct ZennyAtomicType *atomic, int64_t value)
-{
-    return atomic_fetch_sub((atomic_llong*)atomic, value);
+    if (ZennyAtomicLoadIntExplicit(&slot->slotWaiters, ZennyMemoryOrderRelaxed) > 0)
+    {
+        ZennyAtomicAddInt(&slot->sequence, 1);
+        ZennyAtomicFutexWake(&slot->sequence, INT_MAX);
+    }
 }
 
-intptr_t ZennyAtomicSubPtr(volatile struct ZennyAtomicType *atomic, intptr_t value)
+void ZennyAtomicWaitInt(volatile struct ZennyAtomicType *atomic, int old)
 {
-    return atomic_fetch_sub((atomic_intptr_t*)atomic, value);
+    if (!ZennyAtomicWaitSpin(atomic, ZennyAtomicWaitKindInt, old))
+        ZennyAtomicParkDirect(atomic, ZennyAtomicWaitKindInt, old);
 }
 
-// MARK: Bitwise OR
-
-int8_t ZennyAtomicOrByte(volatile struct ZennyAtomicType *atomic, int8_t value)
+void ZennyAtomicWaitFlag(volatile struct ZennyAtomicType *atomic, bool old)
 {
-    return atomic_fetch_or((atomic_schar*)atomic, value);
+    if (!ZennyAtomicWaitSpin(atomic, ZennyAtomicWaitKindFlag, old))
+        ZennyAtomicParkDirect(atomic, ZennyAtomicWaitKindFlag, old);
 }
 
-int ZennyAtomicOrInt(volatile struct ZennyAtomicType *atomic, int value)
+void ZennyAtomicWaitPtr(volatile struct ZennyAtomicType *atomic, intptr_t old)
 {
-    return atomic_fetch_or((atomic_int*)atomic, value);
-}
+    if (ZennyAtomicWaitSpin(atomic, ZennyAtomicWaitKindPtr, old))
+        return;
 
-int64_t ZennyAtomicOrLong(volatile struct ZennyAtomicType *atomic, int64_t value)
-{
-    return atomic_fetch_or((atomic_llong*)atomic, value);
+    if (sizeof(intptr_t) == sizeof(int))
+        ZennyAtomicParkDirect(atomic, ZennyAtomicWaitKindInt, old);
+    else
+        ZennyAtomicParkOnSlot(atomic, ZennyAtomicWaitKindPtr, old);
 }
 
-intptr_t ZennyAtomicOrPtr(volatile struct ZennyAtomicType *atomic, intptr_t value)
+void ZennyAtomicNotifyOne(volatile struct ZennyAtomicType *atomic)
 {
-    return atomic_fetch_or((atomic_intptr_t*)atomic, value);
+    ZennyAtomicNotify(atomic, 1);
 }
 
-// MARK: Bitwise XOR
-
-int8_t ZennyAtomicXorByte(volatile struct ZennyAtomicType *atomic, int8_t value)
+void ZennyAtomicNotifyAll(volatile struct ZennyAtomicType *atomic)
 {
-    return atomic_fetch_xor((atomic_schar*)atomic, value);
+    ZennyAtomicNotify(atomic, INT_MAX);
 }
 
-int ZennyAtomicXorInt(volatile struct ZennyAtomicType *atomic, int value)
-{
-    return atomic_fetch_xor((atomic_int*)atomic, value);
-}
+#else
 
-int64_t ZennyAtomicXorLong(volatile struct ZennyAtomicType *atomic, int64_t value)
-{
-    return atomic_fetch_xor((atomic_llong*)atomic, value);
-}
+static pthread_once_t sWaitSlotsOnce = PTHREAD_ONCE_INIT;
 
-intptr_t ZennyAtomicXorPtr(volatile struct ZennyAtomicType *atomic, intptr_t value)
+static void ZennyAtomicInitWaitSlots(void)
 {
-    return atomic_fetch_xor((atomic_intptr_t*)atomic, value);
+    for (int i = 0; i < ZENNY_ATOMICS_WAIT_SLOT_COUNT; i++)
+    {
+        pthread_mutex_init(&sWaitSlots[i].mutex, NULL);
+        pthread_cond_init(&sWaitSlots[i].condition, NULL);
+    }
 }
 
-// MARK: Bitwise And
-
-int8_t ZennyAtomicAndByte(volatile struct ZennyAtomicType *atomic, int8_t value)
+static void ZennyAtomicParkOnSlot(volatile struct ZennyAtomicType *atomic, enum ZennyAtomicWaitKind kind, intptr_t old)
 {
-    return atomic_fetch_and((atomic_schar*)atomic, value);
-}
+    pthread_once(&sWaitSlotsOnce, ZennyAtomicInitWaitSlots);
 
-int ZennyAtomicAndInt(volatile struct ZennyAtomicType *atomic, int value)
-{
-    return atomic_fetch_and((atomic_int*)atomic, value);
-}
+    struct ZennyAtomicWaitSlot *slot = ZennyAtomicWaitSlotFor(atomic);
+    pthread_mutex_lock(&slot->mutex);
+    ZennyAtomicAddInt(&slot->slotWaiters, 1);
 
-int64_t ZennyAtomicAndLong(volatile struct ZennyAtomicType *atomic, int64_t value)
-{
-    return atomic_fetch_and((atomic_llong*)atomic, value);
-}
+    while (ZennyAtomicWaitUnchanged(atomic, kind, old))
+        pthread_cond_wait(&slot->condition, &slot->mutex);
 
-intptr_t ZennyAtomicAndPtr(volatile struct ZennyAtomicType *atomic, intptr_t value)
-{
-    return atomic_fetch_and((atomic_intptr_t*)atomic, value);
+    ZennyAtomicSubInt(&slot->slotWaiters, 1);
+    pthread_mutex_unlock(&slot->mutex);
 }
 
-// MARK: Exchange
-
-int8_t ZennyAtomicExchangeByte(volatile struct ZennyAtomicType *atomic, int8_t value)
+static void ZennyAtomicNotify(volatile struct ZennyAtomicType *atomic)
 {
-    return atomic_exchange((atomic_schar*)atomic, value);
-}
+    struct ZennyAtomicWaitSlot *slot = ZennyAtomicWaitSlotFor(atomic);
 
-int ZennyAtomicExchangeInt(volatile struct ZennyAtomicType *atomic, int value)
-{
-    return atomic_exchange((atomic_int*)atomic, value);
-}
+    // Pairs with the waiter count increment made before a waiter checks the value
+    ZennyAtomicThreadFence(ZennyMemoryOrderSeqCst);
+    if (ZennyAtomicLoadIntExplicit(&slot->slotWaiters, ZennyMemoryOrderRelaxed) == 0)
+        return;
 
-int64_t ZennyAtomicExchangeLong(volatile struct ZennyAtomicType *atomic, int64_t value)
-{
-    return atomic_exchange((atomic_llong*)atomic, value);
+    // Taking the mutex orders this notification after any waiter that is between its check and its sleep.
+    // The slot may be shared with other objects, so every sleeper is woken to recheck its own value.
+    pthread_mutex_lock(&slot->mutex);
+    pthread_mutex_unlock(&slot->mutex);
+    pthread_cond_broadcast(&slot->condition);
 }
 
-intptr_t ZennyAtomicExchangePtr(volatile struct ZennyAtomicType *atomic, intptr_t value)
+void ZennyAtomicWaitInt(volatile struct ZennyAtomicType *atomic, int old)
 {
-    return atomic_exchange((atomic_intptr_t*)atomic, value);
+    if (!ZennyAtomicWaitSpin(atomic, ZennyAtomicWaitKindInt, old))
+        ZennyAtomicParkOnSlot(atomic, ZennyAtomicWaitKindInt, old);
 }
 
-// MARK: Compare and Exchange
-
-bool ZennyAtomicCompareExchangeByte(volatile struct ZennyAtomicType *atomic, int8_t *expected, int8_t desired)
+void ZennyAtomicWaitFlag(volatile struct ZennyAtomicType *atomic, bool old)
 {
-    return atomic_compare_exchange_strong((atomic_schar*)atomic, expected, desired);
+    if (!ZennyAtomicWaitSpin(atomic, ZennyAtomicWaitKindFlag, old))
+        ZennyAtomicParkOnSlot(atomic, ZennyAtomicWaitKindFlag, old);
 }
 
-bool ZennyAtomicCompareExchangeInt(volatile struct ZennyAtomicType *atomic, int *expected, int desired)
+void ZennyAtomicWaitPtr(volatile struct ZennyAtomicType *atomic, intptr_t old)
 {
-    return atomic_compare_exchange_strong((atomic_int*)atomic, expected, desired);
+    if (!ZennyAtomicWaitSpin(atomic, ZennyAtomicWaitKindPtr, old))
+        ZennyAtomicParkOnSlot(atomic, ZennyAtomicWaitKindPtr, old);
 }
 
-bool ZennyAtomicCompareExchangeLong(volatile struct ZennyAtomicType *atomic, int64_t *expected, int64_t desired)
+void ZennyAtomicNotifyOne(volatile struct ZennyAtomicType *atomic)
 {
-    return atomic_compare_exchange_strong((atomic_llong*)atomic, expected, desired);
+    ZennyAtomicNotify(atomic);
 }
 
-bool ZennyAtomicCompareExchangePtr(volatile struct ZennyAtomicType *atomic, intptr_t *expected, intptr_t desired)
+void ZennyAtomicNotifyAll(volatile struct ZennyAtomicType *atomic)
 {
-    return atomic_compare_exchange_strong((atomic_intptr_t*)atomic, expected, desired);
+    ZennyAtomicNotify(atomic);
 }
 
-#endif // _MSC_VER
+#endif // __linux__
 
+#endif // _WIN32
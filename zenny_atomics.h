@@ -9,16 +9,147 @@
 #ifndef zenny_atomics_h
 #define zenny_atomics_h
 
+#include <stddef.h>
 #include <stdint.h>
 #include <stdbool.h>
 #include <stdalign.h>
 
-/** Common Atomic Type */
+/**
+ * Define ZENNY_ATOMICS_HEADER_ONLY (before including this header, or on the command line)
+ * to have every operation defined as a static inline function in this header.
+ * Otherwise the operations are external functions provided by zenny_atomics.c.
+ */
+#ifdef ZENNY_ATOMICS_HEADER_ONLY
+#ifdef _MSC_VER
+#define ZENNY_ATOMICS_API   static __inline
+#else
+#define ZENNY_ATOMICS_API   static inline
+#endif
+#else
+#define ZENNY_ATOMICS_API   extern
+#endif
+
+/**
+ * Common Atomic Type.
+ * It can hold any of the value types below, at the cost of 16 bytes per object.
+ * The compact types that follow it take only the size of the value they hold.
+ */
 struct ZennyAtomicType
 {
     intmax_t alignas(sizeof(intmax_t[2])) values[2];
 };
 
+/** Storage class specifier of the thread-local variables used by the modules built on these atomics */
+#ifdef _MSC_VER
+#define ZENNY_ATOMICS_THREAD_LOCAL  __declspec(thread)
+#else
+#define ZENNY_ATOMICS_THREAD_LOCAL  _Thread_local
+#endif
+
+/**
+ * Size in bytes that padded atomic objects are aligned to.
+ * 128 bytes covers both a 64-byte cache line and the adjacent-line prefetcher of x86 processors.
+ * Define it before including this header to override it; it must be a power of two.
+ */
+#ifndef ZENNY_ATOMICS_CACHE_LINE_SIZE
+#define ZENNY_ATOMICS_CACHE_LINE_SIZE   128
+#endif
+
+/** Common atomic type padded to a whole cache line, so that it never shares one with another object */
+struct ZennyAtomicPaddedType
+{
+    alignas(ZENNY_ATOMICS_CACHE_LINE_SIZE) struct ZennyAtomicType atomic;
+};
+
+/** Compact atomic flag, occupying a single byte */
+struct ZennyAtomicFlag
+{
+    bool value;
+};
+
+/** Compact atomic int8_t object */
+struct ZennyAtomicByte
+{
+    int8_t value;
+};
+
+/** Compact atomic int16_t object */
+struct ZennyAtomicShort
+{
+    int16_t alignas(sizeof(int16_t)) value;
+};
+
+/** Compact atomic int object */
+struct ZennyAtomicInt
+{
+    int alignas(sizeof(int)) value;
+};
+
+/** Compact atomic int64_t object, naturally aligned even on 32-bit targets */
+struct ZennyAtomicLong
+{
+    int64_t alignas(sizeof(int64_t)) value;
+};
+
+/** Compact atomic intptr_t object */
+struct ZennyAtomicPtr
+{
+    intptr_t alignas(sizeof(intptr_t)) value;
+};
+
+/** Compact atomic uint8_t object */
+struct ZennyAtomicUByte
+{
+    uint8_t value;
+};
+
+/** Compact atomic uint16_t object */
+struct ZennyAtomicUShort
+{
+    uint16_t alignas(sizeof(uint16_t)) value;
+};
+
+/** Compact atomic unsigned int object */
+struct ZennyAtomicUInt
+{
+    unsigned alignas(sizeof(unsigned)) value;
+};
+
+/** Compact atomic uint64_t object, naturally aligned even on 32-bit targets */
+struct ZennyAtomicULong
+{
+    uint64_t alignas(sizeof(uint64_t)) value;
+};
+
+/** Compact atomic size_t object */
+struct ZennyAtomicSize
+{
+    size_t alignas(sizeof(size_t)) value;
+};
+
+/** Value of both words of a `struct ZennyAtomicType` object accessed as one atomic unit */
+struct ZennyAtomicPair
+{
+    intmax_t first;
+    intmax_t second;
+};
+
+/**
+ * Set to 1 if the pair operations compile to a native double-width compare-and-swap
+ * (cmpxchg16b on x86-64, CASP / LDXP-STXP on ARM64); otherwise they are guarded by a striped spin lock.
+ */
+#if defined(_MSC_VER)
+#if defined(_M_X64) || defined(_M_ARM64)
+#define ZENNY_ATOMICS_PAIR_LOCK_FREE    1
+#else
+#define ZENNY_ATOMICS_PAIR_LOCK_FREE    0
+#endif
+#elif defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16) || defined(__x86_64__)
+#define ZENNY_ATOMICS_PAIR_LOCK_FREE    1
+#else
+#define ZENNY_ATOMICS_PAIR_LOCK_FREE    0
+#endif
+
 // MARK: Initialization
 
 /**
@@ -26,34 +157,34 @@ struct ZennyAtomicType
  * @param atomic pointer to an atomic int8_t object
  * @param value the initial value assigned to `atomic`
  */
-extern void ZennyAtomicInitByte(volatile struct ZennyAtomicType *atomic, int8_t value);
+ZENNY_ATOMICS_API void ZennyAtomicInitByte(volatile struct ZennyAtomicType *atomic, int8_t value);
 
 /**
  * Initialize an atomic int object
  * @param atomic pointer to an atomic int object
  * @param value the initial value assigned to `atomic`
  */
-extern void ZennyAtomicInitInt(volatile struct ZennyAtomicType *atomic, int value);
+ZENNY_ATOMICS_API void ZennyAtomicInitInt(volatile struct ZennyAtomicType *atomic, int value);
 
 /**
  * Initialize atomic long object
  * @param atomic pointer to an atomic int64_t object
  * @param value the initial value assigned to `atomic`
  */
-extern void ZennyAtomicInitLong(volatile struct ZennyAtomicType *atomic, int64_t value);
+ZENNY_ATOMICS_API void ZennyAtomicInitLong(volatile struct ZennyAtomicType *atomic, int64_t value);
 
 /**
 * Initialize atomic pointer object
 * @param atomic pointer to an atomic intptr_t object
 * @param value the initial value assigned to `atomic`
 */
-extern void ZennyAtomicInitPtr(volatile struct ZennyAtomicType *atomic, intptr_t value);
+ZENNY_ATOMICS_API void ZennyAtomicInitPtr(volatile struct ZennyAtomicType *atomic, intptr_t value);
 
 /**
  * Initialize an atomic flag object
  * @param atomic pointer to an atomic flag object
  */
-extern void ZennyAtomicInitFlag(volatile struct ZennyAtomicType *atomic);
+ZENNY_ATOMICS_API void ZennyAtomicInitFlag(volatile struct ZennyAtomicType *atomic);
 
 // MARK: Load
 
@@ -62,28 +193,28 @@ extern void ZennyAtomicInitFlag(volatile struct ZennyAtomicType *atomic);
  * @param atomic pointer to an atomic int8_t object
  * @return the value of the atomic object
  */
-extern int8_t ZennyAtomicLoadByte(volatile struct ZennyAtomicType *atomic);
+ZENNY_ATOMICS_API int8_t ZennyAtomicLoadByte(volatile struct ZennyAtomicType *atomic);
 
 /**
  * Load an atomic int object
  * @param atomic pointer to an atomic int object
  * @return the value of the atomic object
  */
-extern int ZennyAtomicLoadInt(volatile struct ZennyAtomicType *atomic);
+ZENNY_ATOMICS_API int ZennyAtomicLoadInt(volatile struct ZennyAtomicType *atomic);
 
 /**
  * Load an atomic long object
  * @param atomic pointer to an atomic long object
  * @return the value of the atomic object
  */
-extern int64_t ZennyAtomicLoadLong(volatile struct ZennyAtomicType* atomic);
+ZENNY_ATOMICS_API int64_t ZennyAtomicLoadLong(volatile struct ZennyAtomicType* atomic);
 
 /**
 * Load an atomic pointer object
 * @param atomic pointer to an atomic intptr_t object
 * @return the value of the atomic object
 */
-extern intptr_t ZennyAtomicLoadPtr(volatile struct ZennyAtomicType* atomic);
+ZENNY_ATOMICS_API intptr_t ZennyAtomicLoadPtr(volatile struct ZennyAtomicType* atomic);
 
 // MARK: Flag atomic operations
 
@@ -92,20 +223,20 @@ extern intptr_t ZennyAtomicLoadPtr(volatile struct ZennyAtomicType* atomic);
  * @param atomic pointer to an atomic flag object
  * @return the value of the atomic object
  */
-extern bool ZennyAtomicLoadFlag(volatile struct ZennyAtomicType *atomic);
+ZENNY_ATOMICS_API bool ZennyAtomicLoadFlag(volatile struct ZennyAtomicType *atomic);
 
 /**
  * Perform test and set atomic operation.
  * @param atomic pointer to an atomic flag object
  * @return If the flag was set before the call, return true; Otherwise return false.
  */
-extern bool ZennyAtomicTestAndSetFlag(volatile struct ZennyAtomicType *atomic);
+ZENNY_ATOMICS_API bool ZennyAtomicTestAndSetFlag(volatile struct ZennyAtomicType *atomic);
 
 /**
  * Clear the atomic flag
  * @param atomic pointer to an atomic flag object
  */
-extern void ZennyAtomicClearFlag(volatile struct ZennyAtomicType *atomic);
+ZENNY_ATOMICS_API void ZennyAtomicClearFlag(volatile struct ZennyAtomicType *atomic);
 
 // MARK: Store
 
@@ -114,28 +245,28 @@ extern void ZennyAtomicClearFlag(volatile struct ZennyAtomicType *atomic);
  * @param atomic pointer to an atomic int8_t object
  * @param value the value to be stored
  */
-extern void ZennyAtomicStoreByte(volatile struct ZennyAtomicType *atomic, int8_t value);
+ZENNY_ATOMICS_API void ZennyAtomicStoreByte(volatile struct ZennyAtomicType *atomic, int8_t value);
 
 /**
  * Store a value to an atomic int object
  * @param atomic pointer to an atomic int object
  * @param value the value to be stored
  */
-extern void ZennyAtomicStoreInt(volatile struct ZennyAtomicType *atomic, int value);
+ZENNY_ATOMICS_API void ZennyAtomicStoreInt(volatile struct ZennyAtomicType *atomic, int value);
 
 /**
  * Store a value to an atomic int64_t object
  * @param atomic pointer to an atomic int64_t object
  * @param value the value to be stored
  */
-extern void ZennyAtomicStoreLong(volatile struct ZennyAtomicType *atomic, int64_t value);
+ZENNY_ATOMICS_API void ZennyAtomicStoreLong(volatile struct ZennyAtomicType *atomic, int64_t value);
 
 /**
 * Store a value to an atomic pointer object
 * @param atomic pointer to an atomic intptr_t object
 * @param value the value to be stored
 */
-extern void ZennyAtomicStorePtr(volatile struct ZennyAtomicType *atomic, intptr_t value);
+ZENNY_ATOMICS_API void ZennyAtomicStorePtr(volatile struct ZennyAtomicType *atomic, intptr_t value);
 
 // MARK: Add
 
@@ -145,7 +276,7 @@ extern void ZennyAtomicStorePtr(volatile struct ZennyAtomicType *atomic, intptr_
  * @param value the value to be added
  * @return the value of the atomic object just before the addition
  */
-extern int8_t ZennyAtomicAddByte(volatile struct ZennyAtomicType *atomic, int8_t value);
+ZENNY_ATOMICS_API int8_t ZennyAtomicAddByte(volatile struct ZennyAtomicType *atomic, int8_t value);
 
 /**
  * Add a value to an atomic int object
@@ -153,7 +284,7 @@ extern int8_t ZennyAtomicAddByte(volatile struct ZennyAtomicType *atomic, int8_t
  * @param value the value to be added
  * @return the value of the atomic object just before the addition
  */
-extern int ZennyAtomicAddInt(volatile struct ZennyAtomicType *atomic, int value);
+ZENNY_ATOMICS_API int ZennyAtomicAddInt(volatile struct ZennyAtomicType *atomic, int value);
 
 /**
  * Add a value to an atomic int64_t object
@@ -161,7 +292,7 @@ extern int ZennyAtomicAddInt(volatile struct ZennyAtomicType *atomic, int value)
  * @param value the value to be added
  * @return the value of the atomic object just before the addition
  */
-extern int64_t ZennyAtomicAddLong(volatile struct ZennyAtomicType *atomic, int64_t value);
+ZENNY_ATOMICS_API int64_t ZennyAtomicAddLong(volatile struct ZennyAtomicType *atomic, int64_t value);
 
 /**
 * Add a value to an atomic pointer object
@@ -169,7 +300,7 @@ extern int64_t ZennyAtomicAddLong(volatile struct ZennyAtomicType *atomic, int64
 * @param value the value to be added
 * @return the value of the atomic object just before the addition
 */
-extern intptr_t ZennyAtomicAddPtr(volatile struct ZennyAtomicType *atomic, intptr_t value);
+ZENNY_ATOMICS_API intptr_t ZennyAtomicAddPtr(volatile struct ZennyAtomicType *atomic, intptr_t value);
 
 // MARK: Subtract
 
@@ -179,7 +310,7 @@ extern intptr_t ZennyAtomicAddPtr(volatile struct ZennyAtomicType *atomic, intpt
  * @param value the value to be subtracted
  * @return the value of the atomic object just before the subtraction
  */
-extern int8_t ZennyAtomicSubByte(volatile struct ZennyAtomicType *atomic, int8_t value);
+ZENNY_ATOMICS_API int8_t ZennyAtomicSubByte(volatile struct ZennyAtomicType *atomic, int8_t value);
 
 /**
  * Subtract a value to an atomic int object
@@ -187,7 +318,7 @@ extern int8_t ZennyAtomicSubByte(volatile struct ZennyAtomicType *atomic, int8_t
  * @param value the value to be subtracted
  * @return the value of the atomic object just before the subtraction
  */
-extern int ZennyAtomicSubInt(volatile struct ZennyAtomicType *atomic, int value);
+ZENNY_ATOMICS_API int ZennyAtomicSubInt(volatile struct ZennyAtomicType *atomic, int value);
 
 /**
  * Subtract a value to an atomic int64_t object
@@ -195,7 +326,7 @@ extern int ZennyAtomicSubInt(volatile struct ZennyAtomicType *atomic, int value)
  * @param value the value to be subtracted
  * @return the value of the atomic object just before the subtraction
  */
-extern int64_t ZennyAtomicSubLong(volatile struct ZennyAtomicType *atomic, int64_t value);
+ZENNY_ATOMICS_API int64_t ZennyAtomicSubLong(volatile struct ZennyAtomicType *atomic, int64_t value);
 
 /**
 * Subtract a value to an atomic pointer object
@@ -203,7 +334,7 @@ extern int64_t ZennyAtomicSubLong(volatile struct ZennyAtomicType *atomic, int64
 * @param value the value to be subtracted
 * @return the value of the atomic object just before the subtraction
 */
-extern intptr_t ZennyAtomicSubPtr(volatile struct ZennyAtomicType *atomic, intptr_t value);
+ZENNY_ATOMICS_API intptr_t ZennyAtomicSubPtr(volatile struct ZennyAtomicType *atomic, intptr_t value);
 
 // MARK: bitwise OR
 
@@ -213,7 +344,7 @@ extern intptr_t ZennyAtomicSubPtr(volatile struct ZennyAtomicType *atomic, intpt
  * @param value the value as a bitwise OR operand
  * @return the value of the atomic object just before the bitwise OR
  */
-extern int8_t ZennyAtomicOrByte(volatile struct ZennyAtomicType *atomic, int8_t value);
+ZENNY_ATOMICS_API int8_t ZennyAtomicOrByte(volatile struct ZennyAtomicType *atomic, int8_t value);
 
 /**
  * Perform bitwise OR to an atomic int object with a value
@@ -221,7 +352,7 @@ extern int8_t ZennyAtomicOrByte(volatile struct ZennyAtomicType *atomic, int8_t
  * @param value the value as a bitwise OR operand
  * @return the value of the atomic object just before the bitwise OR
  */
-extern int ZennyAtomicOrInt(volatile struct ZennyAtomicType *atomic, int value);
+ZENNY_ATOMICS_API int ZennyAtomicOrInt(volatile struct ZennyAtomicType *atomic, int value);
 
 /**
  * Perform bitwise OR to an atomic int64_t object with a value
@@ -229,7 +360,7 @@ extern int ZennyAtomicOrInt(volatile struct ZennyAtomicType *atomic, int value);
  * @param value the value as a bitwise OR operand
  * @return the value of the atomic object just before the bitwise OR
  */
-extern int64_t ZennyAtomicOrLong(volatile struct ZennyAtomicType *atomic, int64_t value);
+ZENNY_ATOMICS_API int64_t ZennyAtomicOrLong(volatile struct ZennyAtomicType *atomic, int64_t value);
 
 /**
 * Perform bitwise OR to an atomic pointer object with a value
@@ -237,7 +368,7 @@ extern int64_t ZennyAtomicOrLong(volatile struct ZennyAtomicType *atomic, int64_
 * @param value the value as a bitwise OR operand
 * @return the value of the atomic object just before the bitwise OR
 */
-extern intptr_t ZennyAtomicOrPtr(volatile struct ZennyAtomicType *atomic, intptr_t value);
+ZENNY_ATOMICS_API intptr_t ZennyAtomicOrPtr(volatile struct ZennyAtomicType *atomic, intptr_t value);
 
 // MARK: bitwise XOR
 
@@ -247,7 +378,7 @@ extern intptr_t ZennyAtomicOrPtr(volatile struct ZennyAtomicType *atomic, intptr
  * @param value the value as a bitwise XOR operand
  * @return the value of the atomic object just before the bitwise XOR
  */
-extern int8_t ZennyAtomicXorByte(volatile struct ZennyAtomicType *atomic, int8_t value);
+ZENNY_ATOMICS_API int8_t ZennyAtomicXorByte(volatile struct ZennyAtomicType *atomic, int8_t value);
 
 /**
  * Perform bitwise XOR to an atomic int object with a value
@@ -255,7 +386,7 @@ extern int8_t ZennyAtomicXorByte(volatile struct ZennyAtomicType *atomic, int8_t
  * @param value the value as a bitwise XOR operand
  * @return the value of the atomic object just before the bitwise XOR
  */
-extern int ZennyAtomicXorInt(volatile struct ZennyAtomicType *atomic, int value);
+ZENNY_ATOMICS_API int ZennyAtomicXorInt(volatile struct ZennyAtomicType *atomic, int value);
 
 /**
  * Perform bitwise XOR to an atomic int64_t object with a value
@@ -263,7 +394,7 @@ extern int ZennyAtomicXorInt(volatile struct ZennyAtomicType *atomic, int value)
  * @param value the value as a bitwise XOR operand
  * @return the value of the atomic object just before the bitwise XOR
  */
-extern int64_t ZennyAtomicXorLong(volatile struct ZennyAtomicType *atomic, int64_t value);
+ZENNY_ATOMICS_API int64_t ZennyAtomicXorLong(volatile struct ZennyAtomicType *atomic, int64_t value);
 
 /**
 * Perform bitwise XOR to an atomic pointer object with a value
@@ -271,7 +402,7 @@ extern int64_t ZennyAtomicXorLong(volatile struct ZennyAtomicType *atomic, int64
 * @param value the value as a bitwise XOR operand
 * @return the value of the atomic object just before the bitwise XOR
 */
-extern intptr_t ZennyAtomicXorPtr(volatile struct ZennyAtomicType *atomic, intptr_t value);
+ZENNY_ATOMICS_API intptr_t ZennyAtomicXorPtr(volatile struct ZennyAtomicType *atomic, intptr_t value);
 
 // MARK: bitwise AND
 
@@ -281,7 +412,7 @@ extern intptr_t ZennyAtomicXorPtr(volatile struct ZennyAtomicType *atomic, intpt
  * @param value the value as a bitwise AND operand
  * @return the value of the atomic object just before the bitwise AND
  */
-extern int8_t ZennyAtomicAndByte(volatile struct ZennyAtomicType *atomic, int8_t value);
+ZENNY_ATOMICS_API int8_t ZennyAtomicAndByte(volatile struct ZennyAtomicType *atomic, int8_t value);
 
 /**
  * Perform bitwise AND to an atomic int object with a value
@@ -289,7 +420,7 @@ extern int8_t ZennyAtomicAndByte(volatile struct ZennyAtomicType *atomic, int8_t
  * @param value the value as a bitwise AND operand
  * @return the value of the atomic object just before the bitwise AND
  */
-extern int ZennyAtomicAndInt(volatile struct ZennyAtomicType *atomic, int value);
+ZENNY_ATOMICS_API int ZennyAtomicAndInt(volatile struct ZennyAtomicType *atomic, int value);
 
 /**
  * Perform bitwise AND to an atomic int64_t object with a value
@@ -297,7 +428,7 @@ extern int ZennyAtomicAndInt(volatile struct ZennyAtomicType *atomic, int value)
  * @param value the value as a bitwise AND operand
  * @return the value of the atomic object just before the bitwise AND
  */
-extern int64_t ZennyAtomicAndLong(volatile struct ZennyAtomicType *atomic, int64_t value);
+ZENNY_ATOMICS_API int64_t ZennyAtomicAndLong(volatile struct ZennyAtomicType *atomic, int64_t value);
 
 /**
 * Perform bitwise AND to an atomic pointer object with a value
@@ -305,7 +436,7 @@ extern int64_t ZennyAtomicAndLong(volatile struct ZennyAtomicType *atomic, int64
 * @param value the value as a bitwise AND operand
 * @return the value of the atomic object just before the bitwise AND
 */
-extern intptr_t ZennyAtomicAndPtr(volatile struct ZennyAtomicType *atomic, intptr_t value);
+ZENNY_ATOMICS_API intptr_t ZennyAtomicAndPtr(volatile struct ZennyAtomicType *atomic, intptr_t value);
 
 // MARK: Exchange
 
@@ -316,7 +447,7 @@ extern intptr_t ZennyAtomicAndPtr(volatile struct ZennyAtomicType *atomic, intpt
  * @param value the value used to exchange
  * @return the value of the atomic object just before the exchange operation
  */
-extern int8_t ZennyAtomicExchangeByte(volatile struct ZennyAtomicType *atomic, int8_t value);
+ZENNY_ATOMICS_API int8_t ZennyAtomicExchangeByte(volatile struct ZennyAtomicType *atomic, int8_t value);
 
 /**
  * Atomically store the specified value to the atomic object
@@ -325,7 +456,7 @@ extern int8_t ZennyAtomicExchangeByte(volatile struct ZennyAtomicType *atomic, i
  * @param value the value used to exchange
  * @return the value of the atomic object just before the exchange operation
  */
-extern int ZennyAtomicExchangeInt(volatile struct ZennyAtomicType *atomic, int value);
+ZENNY_ATOMICS_API int ZennyAtomicExchangeInt(volatile struct ZennyAtomicType *atomic, int value);
 
 /**
  * Atomically store the specified value to the atomic object
@@ -334,7 +465,7 @@ extern int ZennyAtomicExchangeInt(volatile struct ZennyAtomicType *atomic, int v
  * @param value the value used to exchange
  * @return the value of the atomic object just before the exchange operation
  */
-extern int64_t ZennyAtomicExchangeLong(volatile struct ZennyAtomicType *atomic, int64_t value);
+ZENNY_ATOMICS_API int64_t ZennyAtomicExchangeLong(volatile struct ZennyAtomicType *atomic, int64_t value);
 
 /**
 * Atomically store the specified value to the atomic object
@@ -343,7 +474,7 @@ extern int64_t ZennyAtomicExchangeLong(volatile struct ZennyAtomicType *atomic,
 * @param value the value used to exchange
 * @return the value of the atomic object just before the exchange operation
 */
-extern intptr_t ZennyAtomicExchangePtr(volatile struct ZennyAtomicType *atomic, intptr_t value);
+ZENNY_ATOMICS_API intptr_t ZennyAtomicExchangePtr(volatile struct ZennyAtomicType *atomic, intptr_t value);
 
 // MARK: Compare and Exchange
 
@@ -356,7 +487,7 @@ extern intptr_t ZennyAtomicExchangePtr(volatile struct ZennyAtomicType *atomic,
  * @param desired the value to be stored to the atomic object
  * @return true, if the exchange happens; false otherwise.
  */
-extern bool ZennyAtomicCompareExchangeByte(volatile struct ZennyAtomicType *atomic, int8_t *expected, int8_t desired);
+ZENNY_ATOMICS_API bool ZennyAtomicCompareExchangeByte(volatile struct ZennyAtomicType *atomic, int8_t *expected, int8_t desired);
 
 /**
  * Compare the atomic object and the expected object.
@@ -367,7 +498,7 @@ extern bool ZennyAtomicCompareExchangeByte(volatile struct ZennyAtomicType *atom
  * @param desired the value to be stored to the atomic object
  * @return true, if the exchange happens; false otherwise.
  */
-extern bool ZennyAtomicCompareExchangeInt(volatile struct ZennyAtomicType *atomic, int *expected, int desired);
+ZENNY_ATOMICS_API bool ZennyAtomicCompareExchangeInt(volatile struct ZennyAtomicType *atomic, int *expected, int desired);
 
 /**
  * Compare the atomic object and the expected object.
@@ -378,7 +509,7 @@ extern bool ZennyAtomicCompareExchangeInt(volatile struct ZennyAtomicType *atomi
  * @param desired the value to be stored to the atomic object
  * @return true, if the exchange happens; false otherwise.
  */
-extern bool ZennyAtomicCompareExchangeLong(volatile struct ZennyAtomicType *atomic, int64_t *expected, int64_t desired);
+ZENNY_ATOMICS_API bool ZennyAtomicCompareExchangeLong(volatile struct ZennyAtomicType *atomic, int64_t *expected, int64_t desired);
 
 /**
 * Compare the atomic object and the expected object.
@@ -389,7 +520,3807 @@ extern bool ZennyAtomicCompareExchangeLong(volatile struct ZennyAtomicType *atom
 * @param desired the value to be stored to the atomic object
 * @return true, if the exchange happens; false otherwise.
 */
-extern bool ZennyAtomicCompareExchangePtr(volatile struct ZennyAtomicType *atomic, intptr_t *expected, intptr_t desired);
+ZENNY_ATOMICS_API bool ZennyAtomicCompareExchangePtr(volatile struct ZennyAtomicType *atomic, intptr_t *expected, intptr_t desired);
+
+// MARK: Weak compare and exchange
+
+/**
+ * Compare the atomic object and the expected object.
+ * If they are equal, store the desired value to the atomic object and return true;
+ * Otherwise store the atomic object value to the expected object and return false.
+ * Unlike the strong form, this may fail spuriously even when the objects are equal, so call it in a retry loop.
+ * On LL/SC targets such as ARM64, a loop around it compiles to a single load-linked/store-conditional pair per iteration.
+ * @param atomic pointer to an atomic int8_t object
+ * @param expected pointer to the expected object. It is commonly loaded from the atomic object.
+ * @param desired the value to be stored to the atomic object
+ * @return true, if the exchange happens; false otherwise.
+ */
+ZENNY_ATOMICS_API bool ZennyAtomicCompareExchangeWeakByte(volatile struct ZennyAtomicType *atomic, int8_t *expected, int8_t desired);
+
+/**
+ * Compare the atomic object and the expected object.
+ * If they are equal, store the desired value to the atomic object and return true;
+ * Otherwise store the atomic object value to the expected object and return false.
+ * Unlike the strong form, this may fail spuriously even when the objects are equal, so call it in a retry loop.
+ * On LL/SC targets such as ARM64, a loop around it compiles to a single load-linked/store-conditional pair per iteration.
+ * @param atomic pointer to an atomic int object
+ * @param expected pointer to the expected object. It is commonly loaded from the atomic object.
+ * @param desired the value to be stored to the atomic object
+ * @return true, if the exchange happens; false otherwise.
+ */
+ZENNY_ATOMICS_API bool ZennyAtomicCompareExchangeWeakInt(volatile struct ZennyAtomicType *atomic, int *expected, int desired);
+
+/**
+ * Compare the atomic object and the expected object.
+ * If they are equal, store the desired value to the atomic object and return true;
+ * Otherwise store the atomic object value to the expected object and return false.
+ * Unlike the strong form, this may fail spuriously even when the objects are equal, so call it in a retry loop.
+ * On LL/SC targets such as ARM64, a loop around it compiles to a single load-linked/store-conditional pair per iteration.
+ * @param atomic pointer to an atomic int64_t object
+ * @param expected pointer to the expected object. It is commonly loaded from the atomic object.
+ * @param desired the value to be stored to the atomic object
+ * @return true, if the exchange happens; false otherwise.
+ */
+ZENNY_ATOMICS_API bool ZennyAtomicCompareExchangeWeakLong(volatile struct ZennyAtomicType *atomic, int64_t *expected, int64_t desired);
+
+/**
+ * Compare the atomic object and the expected object.
+ * If they are equal, store the desired value to the atomic object and return true;
+ * Otherwise store the atomic object value to the expected object and return false.
+ * Unlike the strong form, this may fail spuriously even when the objects are equal, so call it in a retry loop.
+ * On LL/SC targets such as ARM64, a loop around it compiles to a single load-linked/store-conditional pair per iteration.
+ * @param atomic pointer to an atomic intptr_t object
+ * @param expected pointer to the expected object. It is commonly loaded from the atomic object.
+ * @param desired the value to be stored to the atomic object
+ * @return true, if the exchange happens; false otherwise.
+ */
+ZENNY_ATOMICS_API bool ZennyAtomicCompareExchangeWeakPtr(volatile struct ZennyAtomicType *atomic, intptr_t *expected, intptr_t desired);
+
+// MARK: Memory order
+
+/** Memory order constraints for the `Explicit` operations, listed in the same order as C11 `memory_order` */
+enum ZennyMemoryOrder
+{
+    ZennyMemoryOrderRelaxed,
+    ZennyMemoryOrderConsume,
+    ZennyMemoryOrderAcquire,
+    ZennyMemoryOrderRelease,
+    ZennyMemoryOrderAcqRel,
+    ZennyMemoryOrderSeqCst
+};
+
+/**
+ * Establish memory synchronization ordering of non-atomic and relaxed atomic accesses
+ * @param order memory order of the fence
+ */
+ZENNY_ATOMICS_API void ZennyAtomicThreadFence(enum ZennyMemoryOrder order);
+
+/**
+ * Establish memory ordering between a thread and a signal handler executed on the same thread.
+ * It emits no instruction; it only stops the compiler from reordering memory accesses across it.
+ * @param order memory order of the fence
+ */
+ZENNY_ATOMICS_API void ZennyAtomicSignalFence(enum ZennyMemoryOrder order);
+
+/**
+ * Hint to the processor that the calling thread is in a spin-wait loop
+ * (`pause` on x86, `yield` on ARM), which saves power and frees resources for a sibling hyper-thread.
+ */
+ZENNY_ATOMICS_API void ZennyAtomicPause(void);
+
+// MARK: Load with explicit memory order
+
+/**
+ * Load an atomic int8_t object with the specified memory order
+ * @param atomic pointer to an atomic int8_t object
+ * @param order memory order of the load. It shall not be ZennyMemoryOrderRelease or ZennyMemoryOrderAcqRel.
+ * @return the value of the atomic object
+ */
+ZENNY_ATOMICS_API int8_t ZennyAtomicLoadByteExplicit(volatile struct ZennyAtomicType *atomic, enum ZennyMemoryOrder order);
+
+/**
+ * Load an atomic int object with the specified memory order
+ * @param atomic pointer to an atomic int object
+ * @param order memory order of the load. It shall not be ZennyMemoryOrderRelease or ZennyMemoryOrderAcqRel.
+ * @return the value of the atomic object
+ */
+ZENNY_ATOMICS_API int ZennyAtomicLoadIntExplicit(volatile struct ZennyAtomicType *atomic, enum ZennyMemoryOrder order);
+
+/**
+ * Load an atomic long object with the specified memory order
+ * @param atomic pointer to an atomic int64_t object
+ * @param order memory order of the load. It shall not be ZennyMemoryOrderRelease or ZennyMemoryOrderAcqRel.
+ * @return the value of the atomic object
+ */
+ZENNY_ATOMICS_API int64_t ZennyAtomicLoadLongExplicit(volatile struct ZennyAtomicType *atomic, enum ZennyMemoryOrder order);
+
+/**
+ * Load an atomic intptr_t object with the specified memory order
+ * @param atomic pointer to an atomic intptr_t object
+ * @param order memory order of the load. It shall not be ZennyMemoryOrderRelease or ZennyMemoryOrderAcqRel.
+ * @return the value of the atomic object
+ */
+ZENNY_ATOMICS_API intptr_t ZennyAtomicLoadPtrExplicit(volatile struct ZennyAtomicType *atomic, enum ZennyMemoryOrder order);
+
+// MARK: Flag atomic operations with explicit memory order
+
+/**
+ * Load an atomic flag object with the specified memory order
+ * @param atomic pointer to an atomic flag object
+ * @param order memory order of the load. It shall not be ZennyMemoryOrderRelease or ZennyMemoryOrderAcqRel.
+ * @return the value of the atomic object
+ */
+ZENNY_ATOMICS_API bool ZennyAtomicLoadFlagExplicit(volatile struct ZennyAtomicType *atomic, enum ZennyMemoryOrder order);
+
+/**
+ * Perform test and set atomic operation with the specified memory order.
+ * @param atomic pointer to an atomic flag object
+ * @param order memory order of the operation
+ * @return If the flag was set before the call, return true; Otherwise return false.
+ */
+ZENNY_ATOMICS_API bool ZennyAtomicTestAndSetFlagExplicit(volatile struct ZennyAtomicType *atomic, enum ZennyMemoryOrder order);
+
+/**
+ * Clear the atomic flag with the specified memory order
+ * @param atomic pointer to an atomic flag object
+ * @param order memory order of the store. It shall not be ZennyMemoryOrderConsume, ZennyMemoryOrderAcquire or ZennyMemoryOrderAcqRel.
+ */
+ZENNY_ATOMICS_API void ZennyAtomicClearFlagExplicit(volatile struct ZennyAtomicType *atomic, enum ZennyMemoryOrder order);
+
+// MARK: Store with explicit memory order
+
+/**
+ * Store a value to an atomic int8_t object with the specified memory order
+ * @param atomic pointer to an atomic int8_t object
+ * @param value the value to be stored
+ * @param order memory order of the store. It shall not be ZennyMemoryOrderConsume, ZennyMemoryOrderAcquire or ZennyMemoryOrderAcqRel.
+ */
+ZENNY_ATOMICS_API void ZennyAtomicStoreByteExplicit(volatile struct ZennyAtomicType *atomic, int8_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Store a value to an atomic int object with the specified memory order
+ * @param atomic pointer to an atomic int object
+ * @param value the value to be stored
+ * @param order memory order of the store. It shall not be ZennyMemoryOrderConsume, ZennyMemoryOrderAcquire or ZennyMemoryOrderAcqRel.
+ */
+ZENNY_ATOMICS_API void ZennyAtomicStoreIntExplicit(volatile struct ZennyAtomicType *atomic, int value, enum ZennyMemoryOrder order);
+
+/**
+ * Store a value to an atomic int64_t object with the specified memory order
+ * @param atomic pointer to an atomic int64_t object
+ * @param value the value to be stored
+ * @param order memory order of the store. It shall not be ZennyMemoryOrderConsume, ZennyMemoryOrderAcquire or ZennyMemoryOrderAcqRel.
+ */
+ZENNY_ATOMICS_API void ZennyAtomicStoreLongExplicit(volatile struct ZennyAtomicType *atomic, int64_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Store a value to an atomic intptr_t object with the specified memory order
+ * @param atomic pointer to an atomic intptr_t object
+ * @param value the value to be stored
+ * @param order memory order of the store. It shall not be ZennyMemoryOrderConsume, ZennyMemoryOrderAcquire or ZennyMemoryOrderAcqRel.
+ */
+ZENNY_ATOMICS_API void ZennyAtomicStorePtrExplicit(volatile struct ZennyAtomicType *atomic, intptr_t value, enum ZennyMemoryOrder order);
+
+// MARK: Add with explicit memory order
+
+/**
+ * Add a value to an atomic int8_t object with the specified memory order
+ * @param atomic pointer to an atomic int8_t object
+ * @param value the value to be added
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the addition
+ */
+ZENNY_ATOMICS_API int8_t ZennyAtomicAddByteExplicit(volatile struct ZennyAtomicType *atomic, int8_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Add a value to an atomic int object with the specified memory order
+ * @param atomic pointer to an atomic int object
+ * @param value the value to be added
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the addition
+ */
+ZENNY_ATOMICS_API int ZennyAtomicAddIntExplicit(volatile struct ZennyAtomicType *atomic, int value, enum ZennyMemoryOrder order);
+
+/**
+ * Add a value to an atomic int64_t object with the specified memory order
+ * @param atomic pointer to an atomic int64_t object
+ * @param value the value to be added
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the addition
+ */
+ZENNY_ATOMICS_API int64_t ZennyAtomicAddLongExplicit(volatile struct ZennyAtomicType *atomic, int64_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Add a value to an atomic intptr_t object with the specified memory order
+ * @param atomic pointer to an atomic intptr_t object
+ * @param value the value to be added
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the addition
+ */
+ZENNY_ATOMICS_API intptr_t ZennyAtomicAddPtrExplicit(volatile struct ZennyAtomicType *atomic, intptr_t value, enum ZennyMemoryOrder order);
+
+// MARK: Subtract with explicit memory order
+
+/**
+ * Subtract a value from an atomic int8_t object with the specified memory order
+ * @param atomic pointer to an atomic int8_t object
+ * @param value the value to be subtracted
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the subtraction
+ */
+ZENNY_ATOMICS_API int8_t ZennyAtomicSubByteExplicit(volatile struct ZennyAtomicType *atomic, int8_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Subtract a value from an atomic int object with the specified memory order
+ * @param atomic pointer to an atomic int object
+ * @param value the value to be subtracted
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the subtraction
+ */
+ZENNY_ATOMICS_API int ZennyAtomicSubIntExplicit(volatile struct ZennyAtomicType *atomic, int value, enum ZennyMemoryOrder order);
+
+/**
+ * Subtract a value from an atomic int64_t object with the specified memory order
+ * @param atomic pointer to an atomic int64_t object
+ * @param value the value to be subtracted
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the subtraction
+ */
+ZENNY_ATOMICS_API int64_t ZennyAtomicSubLongExplicit(volatile struct ZennyAtomicType *atomic, int64_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Subtract a value from an atomic intptr_t object with the specified memory order
+ * @param atomic pointer to an atomic intptr_t object
+ * @param value the value to be subtracted
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the subtraction
+ */
+ZENNY_ATOMICS_API intptr_t ZennyAtomicSubPtrExplicit(volatile struct ZennyAtomicType *atomic, intptr_t value, enum ZennyMemoryOrder order);
+
+// MARK: bitwise OR with explicit memory order
+
+/**
+ * Perform bitwise OR to an atomic int8_t object with a value with the specified memory order
+ * @param atomic pointer to an atomic int8_t object
+ * @param value the value as a bitwise OR operand
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the bitwise OR
+ */
+ZENNY_ATOMICS_API int8_t ZennyAtomicOrByteExplicit(volatile struct ZennyAtomicType *atomic, int8_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Perform bitwise OR to an atomic int object with a value with the specified memory order
+ * @param atomic pointer to an atomic int object
+ * @param value the value as a bitwise OR operand
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the bitwise OR
+ */
+ZENNY_ATOMICS_API int ZennyAtomicOrIntExplicit(volatile struct ZennyAtomicType *atomic, int value, enum ZennyMemoryOrder order);
+
+/**
+ * Perform bitwise OR to an atomic int64_t object with a value with the specified memory order
+ * @param atomic pointer to an atomic int64_t object
+ * @param value the value as a bitwise OR operand
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the bitwise OR
+ */
+ZENNY_ATOMICS_API int64_t ZennyAtomicOrLongExplicit(volatile struct ZennyAtomicType *atomic, int64_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Perform bitwise OR to an atomic intptr_t object with a value with the specified memory order
+ * @param atomic pointer to an atomic intptr_t object
+ * @param value the value as a bitwise OR operand
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the bitwise OR
+ */
+ZENNY_ATOMICS_API intptr_t ZennyAtomicOrPtrExplicit(volatile struct ZennyAtomicType *atomic, intptr_t value, enum ZennyMemoryOrder order);
+
+// MARK: bitwise XOR with explicit memory order
+
+/**
+ * Perform bitwise XOR to an atomic int8_t object with a value with the specified memory order
+ * @param atomic pointer to an atomic int8_t object
+ * @param value the value as a bitwise XOR operand
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the bitwise XOR
+ */
+ZENNY_ATOMICS_API int8_t ZennyAtomicXorByteExplicit(volatile struct ZennyAtomicType *atomic, int8_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Perform bitwise XOR to an atomic int object with a value with the specified memory order
+ * @param atomic pointer to an atomic int object
+ * @param value the value as a bitwise XOR operand
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the bitwise XOR
+ */
+ZENNY_ATOMICS_API int ZennyAtomicXorIntExplicit(volatile struct ZennyAtomicType *atomic, int value, enum ZennyMemoryOrder order);
+
+/**
+ * Perform bitwise XOR to an atomic int64_t object with a value with the specified memory order
+ * @param atomic pointer to an atomic int64_t object
+ * @param value the value as a bitwise XOR operand
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the bitwise XOR
+ */
+ZENNY_ATOMICS_API int64_t ZennyAtomicXorLongExplicit(volatile struct ZennyAtomicType *atomic, int64_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Perform bitwise XOR to an atomic intptr_t object with a value with the specified memory order
+ * @param atomic pointer to an atomic intptr_t object
+ * @param value the value as a bitwise XOR operand
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the bitwise XOR
+ */
+ZENNY_ATOMICS_API intptr_t ZennyAtomicXorPtrExplicit(volatile struct ZennyAtomicType *atomic, intptr_t value, enum ZennyMemoryOrder order);
+
+// MARK: bitwise AND with explicit memory order
+
+/**
+ * Perform bitwise AND to an atomic int8_t object with a value with the specified memory order
+ * @param atomic pointer to an atomic int8_t object
+ * @param value the value as a bitwise AND operand
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the bitwise AND
+ */
+ZENNY_ATOMICS_API int8_t ZennyAtomicAndByteExplicit(volatile struct ZennyAtomicType *atomic, int8_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Perform bitwise AND to an atomic int object with a value with the specified memory order
+ * @param atomic pointer to an atomic int object
+ * @param value the value as a bitwise AND operand
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the bitwise AND
+ */
+ZENNY_ATOMICS_API int ZennyAtomicAndIntExplicit(volatile struct ZennyAtomicType *atomic, int value, enum ZennyMemoryOrder order);
+
+/**
+ * Perform bitwise AND to an atomic int64_t object with a value with the specified memory order
+ * @param atomic pointer to an atomic int64_t object
+ * @param value the value as a bitwise AND operand
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the bitwise AND
+ */
+ZENNY_ATOMICS_API int64_t ZennyAtomicAndLongExplicit(volatile struct ZennyAtomicType *atomic, int64_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Perform bitwise AND to an atomic intptr_t object with a value with the specified memory order
+ * @param atomic pointer to an atomic intptr_t object
+ * @param value the value as a bitwise AND operand
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the bitwise AND
+ */
+ZENNY_ATOMICS_API intptr_t ZennyAtomicAndPtrExplicit(volatile struct ZennyAtomicType *atomic, intptr_t value, enum ZennyMemoryOrder order);
+
+// MARK: Exchange with explicit memory order
+
+/**
+ * Atomically store the specified value to the atomic object with the specified memory order
+ * and return the value of the atomic object just before the exchange operation.
+ * @param atomic pointer to an atomic int8_t object
+ * @param value the value used to exchange
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the exchange operation
+ */
+ZENNY_ATOMICS_API int8_t ZennyAtomicExchangeByteExplicit(volatile struct ZennyAtomicType *atomic, int8_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Atomically store the specified value to the atomic object with the specified memory order
+ * and return the value of the atomic object just before the exchange operation.
+ * @param atomic pointer to an atomic int object
+ * @param value the value used to exchange
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the exchange operation
+ */
+ZENNY_ATOMICS_API int ZennyAtomicExchangeIntExplicit(volatile struct ZennyAtomicType *atomic, int value, enum ZennyMemoryOrder order);
+
+/**
+ * Atomically store the specified value to the atomic object with the specified memory order
+ * and return the value of the atomic object just before the exchange operation.
+ * @param atomic pointer to an atomic int64_t object
+ * @param value the value used to exchange
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the exchange operation
+ */
+ZENNY_ATOMICS_API int64_t ZennyAtomicExchangeLongExplicit(volatile struct ZennyAtomicType *atomic, int64_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Atomically store the specified value to the atomic object with the specified memory order
+ * and return the value of the atomic object just before the exchange operation.
+ * @param atomic pointer to an atomic intptr_t object
+ * @param value the value used to exchange
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the exchange operation
+ */
+ZENNY_ATOMICS_API intptr_t ZennyAtomicExchangePtrExplicit(volatile struct ZennyAtomicType *atomic, intptr_t value, enum ZennyMemoryOrder order);
+
+// MARK: Compare and Exchange with explicit memory order
+
+/**
+ * Compare the atomic object and the expected object with the specified memory orders.
+ * If they are equal, store the desired value to the atomic object and return true;
+ * Otherwise store the atomic object value to the expected object and return false.
+ * @param atomic pointer to an atomic int8_t object
+ * @param expected pointer to the expected object. It is commonly loaded from the atomic object.
+ * @param desired the value to be stored to the atomic object
+ * @param success memory order of the read-modify-write operation if the exchange happens
+ * @param failure memory order of the load if the exchange does not happen.
+ * It shall not be ZennyMemoryOrderRelease or ZennyMemoryOrderAcqRel, and shall be no stronger than `success`.
+ * @return true, if the exchange happens; false otherwise.
+ */
+ZENNY_ATOMICS_API bool ZennyAtomicCompareExchangeByteExplicit(volatile struct ZennyAtomicType *atomic, int8_t *expected, int8_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure);
+
+/**
+ * Compare the atomic object and the expected object with the specified memory orders.
+ * If they are equal, store the desired value to the atomic object and return true;
+ * Otherwise store the atomic object value to the expected object and return false.
+ * @param atomic pointer to an atomic int object
+ * @param expected pointer to the expected object. It is commonly loaded from the atomic object.
+ * @param desired the value to be stored to the atomic object
+ * @param success memory order of the read-modify-write operation if the exchange happens
+ * @param failure memory order of the load if the exchange does not happen.
+ * It shall not be ZennyMemoryOrderRelease or ZennyMemoryOrderAcqRel, and shall be no stronger than `success`.
+ * @return true, if the exchange happens; false otherwise.
+ */
+ZENNY_ATOMICS_API bool ZennyAtomicCompareExchangeIntExplicit(volatile struct ZennyAtomicType *atomic, int *expected, int desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure);
+
+/**
+ * Compare the atomic object and the expected object with the specified memory orders.
+ * If they are equal, store the desired value to the atomic object and return true;
+ * Otherwise store the atomic object value to the expected object and return false.
+ * @param atomic pointer to an atomic int64_t object
+ * @param expected pointer to the expected object. It is commonly loaded from the atomic object.
+ * @param desired the value to be stored to the atomic object
+ * @param success memory order of the read-modify-write operation if the exchange happens
+ * @param failure memory order of the load if the exchange does not happen.
+ * It shall not be ZennyMemoryOrderRelease or ZennyMemoryOrderAcqRel, and shall be no stronger than `success`.
+ * @return true, if the exchange happens; false otherwise.
+ */
+ZENNY_ATOMICS_API bool ZennyAtomicCompareExchangeLongExplicit(volatile struct ZennyAtomicType *atomic, int64_t *expected, int64_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure);
+
+/**
+ * Compare the atomic object and the expected object with the specified memory orders.
+ * If they are equal, store the desired value to the atomic object and return true;
+ * Otherwise store the atomic object value to the expected object and return false.
+ * @param atomic pointer to an atomic intptr_t object
+ * @param expected pointer to the expected object. It is commonly loaded from the atomic object.
+ * @param desired the value to be stored to the atomic object
+ * @param success memory order of the read-modify-write operation if the exchange happens
+ * @param failure memory order of the load if the exchange does not happen.
+ * It shall not be ZennyMemoryOrderRelease or ZennyMemoryOrderAcqRel, and shall be no stronger than `success`.
+ * @return true, if the exchange happens; false otherwise.
+ */
+ZENNY_ATOMICS_API bool ZennyAtomicCompareExchangePtrExplicit(volatile struct ZennyAtomicType *atomic, intptr_t *expected, intptr_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure);
+
+// MARK: Weak compare and exchange with explicit memory order
+
+/**
+ * Compare the atomic object and the expected object with the specified memory orders.
+ * If they are equal, store the desired value to the atomic object and return true;
+ * Otherwise store the atomic object value to the expected object and return false.
+ * Unlike the strong form, this may fail spuriously even when the objects are equal, so call it in a retry loop.
+ * On LL/SC targets such as ARM64, a loop around it compiles to a single load-linked/store-conditional pair per iteration.
+ * @param atomic pointer to an atomic int8_t object
+ * @param expected pointer to the expected object. It is commonly loaded from the atomic object.
+ * @param desired the value to be stored to the atomic object
+ * @param success memory order of the read-modify-write operation if the exchange happens
+ * @param failure memory order of the load operation if the exchange does not happen
+ * @return true, if the exchange happens; false otherwise.
+ */
+ZENNY_ATOMICS_API bool ZennyAtomicCompareExchangeWeakByteExplicit(volatile struct ZennyAtomicType *atomic, int8_t *expected, int8_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure);
+
+/**
+ * Compare the atomic object and the expected object with the specified memory orders.
+ * If they are equal, store the desired value to the atomic object and return true;
+ * Otherwise store the atomic object value to the expected object and return false.
+ * Unlike the strong form, this may fail spuriously even when the objects are equal, so call it in a retry loop.
+ * On LL/SC targets such as ARM64, a loop around it compiles to a single load-linked/store-conditional pair per iteration.
+ * @param atomic pointer to an atomic int object
+ * @param expected pointer to the expected object. It is commonly loaded from the atomic object.
+ * @param desired the value to be stored to the atomic object
+ * @param success memory order of the read-modify-write operation if the exchange happens
+ * @param failure memory order of the load operation if the exchange does not happen
+ * @return true, if the exchange happens; false otherwise.
+ */
+ZENNY_ATOMICS_API bool ZennyAtomicCompareExchangeWeakIntExplicit(volatile struct ZennyAtomicType *atomic, int *expected, int desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure);
+
+/**
+ * Compare the atomic object and the expected object with the specified memory orders.
+ * If they are equal, store the desired value to the atomic object and return true;
+ * Otherwise store the atomic object value to the expected object and return false.
+ * Unlike the strong form, this may fail spuriously even when the objects are equal, so call it in a retry loop.
+ * On LL/SC targets such as ARM64, a loop around it compiles to a single load-linked/store-conditional pair per iteration.
+ * @param atomic pointer to an atomic int64_t object
+ * @param expected pointer to the expected object. It is commonly loaded from the atomic object.
+ * @param desired the value to be stored to the atomic object
+ * @param success memory order of the read-modify-write operation if the exchange happens
+ * @param failure memory order of the load operation if the exchange does not happen
+ * @return true, if the exchange happens; false otherwise.
+ */
+ZENNY_ATOMICS_API bool ZennyAtomicCompareExchangeWeakLongExplicit(volatile struct ZennyAtomicType *atomic, int64_t *expected, int64_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure);
+
+/**
+ * Compare the atomic object and the expected object with the specified memory orders.
+ * If they are equal, store the desired value to the atomic object and return true;
+ * Otherwise store the atomic object value to the expected object and return false.
+ * Unlike the strong form, this may fail spuriously even when the objects are equal, so call it in a retry loop.
+ * On LL/SC targets such as ARM64, a loop around it compiles to a single load-linked/store-conditional pair per iteration.
+ * @param atomic pointer to an atomic intptr_t object
+ * @param expected pointer to the expected object. It is commonly loaded from the atomic object.
+ * @param desired the value to be stored to the atomic object
+ * @param success memory order of the read-modify-write operation if the exchange happens
+ * @param failure memory order of the load operation if the exchange does not happen
+ * @return true, if the exchange happens; false otherwise.
+ */
+ZENNY_ATOMICS_API bool ZennyAtomicCompareExchangeWeakPtrExplicit(volatile struct ZennyAtomicType *atomic, intptr_t *expected, intptr_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure);
+
+// MARK: Minimum and maximum
+
+/**
+ * Replace the value of an atomic int8_t object with `value` if `value` is smaller.
+ * The object is not modified when it already holds the smaller value.
+ * @param atomic pointer to an atomic int8_t object
+ * @param value the bound to be applied
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API int8_t ZennyAtomicMinByte(volatile struct ZennyAtomicType *atomic, int8_t value);
+
+/**
+ * Replace the value of an atomic int8_t object with `value` if `value` is smaller when both are compared as unsigned.
+ * The object is not modified when it already holds the smaller value.
+ * @param atomic pointer to an atomic int8_t object
+ * @param value the bound to be applied
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API uint8_t ZennyAtomicMinUnsignedByte(volatile struct ZennyAtomicType *atomic, uint8_t value);
+
+/**
+ * Replace the value of an atomic int8_t object with `value` if `value` is larger.
+ * The object is not modified when it already holds the larger value.
+ * @param atomic pointer to an atomic int8_t object
+ * @param value the bound to be applied
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API int8_t ZennyAtomicMaxByte(volatile struct ZennyAtomicType *atomic, int8_t value);
+
+/**
+ * Replace the value of an atomic int8_t object with `value` if `value` is larger when both are compared as unsigned.
+ * The object is not modified when it already holds the larger value.
+ * @param atomic pointer to an atomic int8_t object
+ * @param value the bound to be applied
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API uint8_t ZennyAtomicMaxUnsignedByte(volatile struct ZennyAtomicType *atomic, uint8_t value);
+
+/**
+ * Replace the value of an atomic int object with `value` if `value` is smaller.
+ * The object is not modified when it already holds the smaller value.
+ * @param atomic pointer to an atomic int object
+ * @param value the bound to be applied
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API int ZennyAtomicMinInt(volatile struct ZennyAtomicType *atomic, int value);
+
+/**
+ * Replace the value of an atomic int object with `value` if `value` is smaller when both are compared as unsigned.
+ * The object is not modified when it already holds the smaller value.
+ * @param atomic pointer to an atomic int object
+ * @param value the bound to be applied
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API unsigned ZennyAtomicMinUnsignedInt(volatile struct ZennyAtomicType *atomic, unsigned value);
+
+/**
+ * Replace the value of an atomic int object with `value` if `value` is larger.
+ * The object is not modified when it already holds the larger value.
+ * @param atomic pointer to an atomic int object
+ * @param value the bound to be applied
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API int ZennyAtomicMaxInt(volatile struct ZennyAtomicType *atomic, int value);
+
+/**
+ * Replace the value of an atomic int object with `value` if `value` is larger when both are compared as unsigned.
+ * The object is not modified when it already holds the larger value.
+ * @param atomic pointer to an atomic int object
+ * @param value the bound to be applied
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API unsigned ZennyAtomicMaxUnsignedInt(volatile struct ZennyAtomicType *atomic, unsigned value);
+
+/**
+ * Replace the value of an atomic int64_t object with `value` if `value` is smaller.
+ * The object is not modified when it already holds the smaller value.
+ * @param atomic pointer to an atomic int64_t object
+ * @param value the bound to be applied
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API int64_t ZennyAtomicMinLong(volatile struct ZennyAtomicType *atomic, int64_t value);
+
+/**
+ * Replace the value of an atomic int64_t object with `value` if `value` is smaller when both are compared as unsigned.
+ * The object is not modified when it already holds the smaller value.
+ * @param atomic pointer to an atomic int64_t object
+ * @param value the bound to be applied
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API uint64_t ZennyAtomicMinUnsignedLong(volatile struct ZennyAtomicType *atomic, uint64_t value);
+
+/**
+ * Replace the value of an atomic int64_t object with `value` if `value` is larger.
+ * The object is not modified when it already holds the larger value.
+ * @param atomic pointer to an atomic int64_t object
+ * @param value the bound to be applied
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API int64_t ZennyAtomicMaxLong(volatile struct ZennyAtomicType *atomic, int64_t value);
+
+/**
+ * Replace the value of an atomic int64_t object with `value` if `value` is larger when both are compared as unsigned.
+ * The object is not modified when it already holds the larger value.
+ * @param atomic pointer to an atomic int64_t object
+ * @param value the bound to be applied
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API uint64_t ZennyAtomicMaxUnsignedLong(volatile struct ZennyAtomicType *atomic, uint64_t value);
+
+/**
+ * Replace the value of an atomic intptr_t object with `value` if `value` is smaller.
+ * The object is not modified when it already holds the smaller value.
+ * @param atomic pointer to an atomic intptr_t object
+ * @param value the bound to be applied
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API intptr_t ZennyAtomicMinPtr(volatile struct ZennyAtomicType *atomic, intptr_t value);
+
+/**
+ * Replace the value of an atomic intptr_t object with `value` if `value` is smaller when both are compared as unsigned.
+ * The object is not modified when it already holds the smaller value.
+ * @param atomic pointer to an atomic intptr_t object
+ * @param value the bound to be applied
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API uintptr_t ZennyAtomicMinUnsignedPtr(volatile struct ZennyAtomicType *atomic, uintptr_t value);
+
+/**
+ * Replace the value of an atomic intptr_t object with `value` if `value` is larger.
+ * The object is not modified when it already holds the larger value.
+ * @param atomic pointer to an atomic intptr_t object
+ * @param value the bound to be applied
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API intptr_t ZennyAtomicMaxPtr(volatile struct ZennyAtomicType *atomic, intptr_t value);
+
+/**
+ * Replace the value of an atomic intptr_t object with `value` if `value` is larger when both are compared as unsigned.
+ * The object is not modified when it already holds the larger value.
+ * @param atomic pointer to an atomic intptr_t object
+ * @param value the bound to be applied
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API uintptr_t ZennyAtomicMaxUnsignedPtr(volatile struct ZennyAtomicType *atomic, uintptr_t value);
+
+// MARK: Operate and fetch
+
+/**
+ * Add a value to an atomic int8_t object
+ * @param atomic pointer to an atomic int8_t object
+ * @param value the value to be added
+ * @return the value of the atomic object just after the addition
+ */
+ZENNY_ATOMICS_API int8_t ZennyAtomicAddFetchByte(volatile struct ZennyAtomicType *atomic, int8_t value);
+
+/**
+ * Add a value to an atomic int object
+ * @param atomic pointer to an atomic int object
+ * @param value the value to be added
+ * @return the value of the atomic object just after the addition
+ */
+ZENNY_ATOMICS_API int ZennyAtomicAddFetchInt(volatile struct ZennyAtomicType *atomic, int value);
+
+/**
+ * Add a value to an atomic int64_t object
+ * @param atomic pointer to an atomic int64_t object
+ * @param value the value to be added
+ * @return the value of the atomic object just after the addition
+ */
+ZENNY_ATOMICS_API int64_t ZennyAtomicAddFetchLong(volatile struct ZennyAtomicType *atomic, int64_t value);
+
+/**
+ * Add a value to an atomic intptr_t object
+ * @param atomic pointer to an atomic intptr_t object
+ * @param value the value to be added
+ * @return the value of the atomic object just after the addition
+ */
+ZENNY_ATOMICS_API intptr_t ZennyAtomicAddFetchPtr(volatile struct ZennyAtomicType *atomic, intptr_t value);
+
+/**
+ * Subtract a value from an atomic int8_t object
+ * @param atomic pointer to an atomic int8_t object
+ * @param value the value to be subtracted
+ * @return the value of the atomic object just after the subtraction
+ */
+ZENNY_ATOMICS_API int8_t ZennyAtomicSubFetchByte(volatile struct ZennyAtomicType *atomic, int8_t value);
+
+/**
+ * Subtract a value from an atomic int object
+ * @param atomic pointer to an atomic int object
+ * @param value the value to be subtracted
+ * @return the value of the atomic object just after the subtraction
+ */
+ZENNY_ATOMICS_API int ZennyAtomicSubFetchInt(volatile struct ZennyAtomicType *atomic, int value);
+
+/**
+ * Subtract a value from an atomic int64_t object
+ * @param atomic pointer to an atomic int64_t object
+ * @param value the value to be subtracted
+ * @return the value of the atomic object just after the subtraction
+ */
+ZENNY_ATOMICS_API int64_t ZennyAtomicSubFetchLong(volatile struct ZennyAtomicType *atomic, int64_t value);
+
+/**
+ * Subtract a value from an atomic intptr_t object
+ * @param atomic pointer to an atomic intptr_t object
+ * @param value the value to be subtracted
+ * @return the value of the atomic object just after the subtraction
+ */
+ZENNY_ATOMICS_API intptr_t ZennyAtomicSubFetchPtr(volatile struct ZennyAtomicType *atomic, intptr_t value);
+
+/**
+ * Bitwise OR a value into an atomic int8_t object
+ * @param atomic pointer to an atomic int8_t object
+ * @param value the value to be ORed
+ * @return the value of the atomic object just after the bitwise OR
+ */
+ZENNY_ATOMICS_API int8_t ZennyAtomicOrFetchByte(volatile struct ZennyAtomicType *atomic, int8_t value);
+
+/**
+ * Bitwise OR a value into an atomic int object
+ * @param atomic pointer to an atomic int object
+ * @param value the value to be ORed
+ * @return the value of the atomic object just after the bitwise OR
+ */
+ZENNY_ATOMICS_API int ZennyAtomicOrFetchInt(volatile struct ZennyAtomicType *atomic, int value);
+
+/**
+ * Bitwise OR a value into an atomic int64_t object
+ * @param atomic pointer to an atomic int64_t object
+ * @param value the value to be ORed
+ * @return the value of the atomic object just after the bitwise OR
+ */
+ZENNY_ATOMICS_API int64_t ZennyAtomicOrFetchLong(volatile struct ZennyAtomicType *atomic, int64_t value);
+
+/**
+ * Bitwise OR a value into an atomic intptr_t object
+ * @param atomic pointer to an atomic intptr_t object
+ * @param value the value to be ORed
+ * @return the value of the atomic object just after the bitwise OR
+ */
+ZENNY_ATOMICS_API intptr_t ZennyAtomicOrFetchPtr(volatile struct ZennyAtomicType *atomic, intptr_t value);
+
+/**
+ * Bitwise AND a value into an atomic int8_t object
+ * @param atomic pointer to an atomic int8_t object
+ * @param value the value to be ANDed
+ * @return the value of the atomic object just after the bitwise AND
+ */
+ZENNY_ATOMICS_API int8_t ZennyAtomicAndFetchByte(volatile struct ZennyAtomicType *atomic, int8_t value);
+
+/**
+ * Bitwise AND a value into an atomic int object
+ * @param atomic pointer to an atomic int object
+ * @param value the value to be ANDed
+ * @return the value of the atomic object just after the bitwise AND
+ */
+ZENNY_ATOMICS_API int ZennyAtomicAndFetchInt(volatile struct ZennyAtomicType *atomic, int value);
+
+/**
+ * Bitwise AND a value into an atomic int64_t object
+ * @param atomic pointer to an atomic int64_t object
+ * @param value the value to be ANDed
+ * @return the value of the atomic object just after the bitwise AND
+ */
+ZENNY_ATOMICS_API int64_t ZennyAtomicAndFetchLong(volatile struct ZennyAtomicType *atomic, int64_t value);
+
+/**
+ * Bitwise AND a value into an atomic intptr_t object
+ * @param atomic pointer to an atomic intptr_t object
+ * @param value the value to be ANDed
+ * @return the value of the atomic object just after the bitwise AND
+ */
+ZENNY_ATOMICS_API intptr_t ZennyAtomicAndFetchPtr(volatile struct ZennyAtomicType *atomic, intptr_t value);
+
+/**
+ * Bitwise XOR a value into an atomic int8_t object
+ * @param atomic pointer to an atomic int8_t object
+ * @param value the value to be XORed
+ * @return the value of the atomic object just after the bitwise XOR
+ */
+ZENNY_ATOMICS_API int8_t ZennyAtomicXorFetchByte(volatile struct ZennyAtomicType *atomic, int8_t value);
+
+/**
+ * Bitwise XOR a value into an atomic int object
+ * @param atomic pointer to an atomic int object
+ * @param value the value to be XORed
+ * @return the value of the atomic object just after the bitwise XOR
+ */
+ZENNY_ATOMICS_API int ZennyAtomicXorFetchInt(volatile struct ZennyAtomicType *atomic, int value);
+
+/**
+ * Bitwise XOR a value into an atomic int64_t object
+ * @param atomic pointer to an atomic int64_t object
+ * @param value the value to be XORed
+ * @return the value of the atomic object just after the bitwise XOR
+ */
+ZENNY_ATOMICS_API int64_t ZennyAtomicXorFetchLong(volatile struct ZennyAtomicType *atomic, int64_t value);
+
+/**
+ * Bitwise XOR a value into an atomic intptr_t object
+ * @param atomic pointer to an atomic intptr_t object
+ * @param value the value to be XORed
+ * @return the value of the atomic object just after the bitwise XOR
+ */
+ZENNY_ATOMICS_API intptr_t ZennyAtomicXorFetchPtr(volatile struct ZennyAtomicType *atomic, intptr_t value);
+
+// MARK: Minimum and maximum with explicit memory order
+
+/**
+ * Replace the value of an atomic int8_t object with `value` if `value` is smaller with the specified memory order.
+ * The object is not modified when it already holds the smaller value.
+ * @param atomic pointer to an atomic int8_t object
+ * @param value the bound to be applied
+ * @param order memory order of the operation when the object is modified; the check alone is a load of the corresponding order
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API int8_t ZennyAtomicMinByteExplicit(volatile struct ZennyAtomicType *atomic, int8_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Replace the value of an atomic int8_t object with `value` if `value` is smaller when both are compared as unsigned with the specified memory order.
+ * The object is not modified when it already holds the smaller value.
+ * @param atomic pointer to an atomic int8_t object
+ * @param value the bound to be applied
+ * @param order memory order of the operation when the object is modified; the check alone is a load of the corresponding order
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API uint8_t ZennyAtomicMinUnsignedByteExplicit(volatile struct ZennyAtomicType *atomic, uint8_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Replace the value of an atomic int8_t object with `value` if `value` is larger with the specified memory order.
+ * The object is not modified when it already holds the larger value.
+ * @param atomic pointer to an atomic int8_t object
+ * @param value the bound to be applied
+ * @param order memory order of the operation when the object is modified; the check alone is a load of the corresponding order
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API int8_t ZennyAtomicMaxByteExplicit(volatile struct ZennyAtomicType *atomic, int8_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Replace the value of an atomic int8_t object with `value` if `value` is larger when both are compared as unsigned with the specified memory order.
+ * The object is not modified when it already holds the larger value.
+ * @param atomic pointer to an atomic int8_t object
+ * @param value the bound to be applied
+ * @param order memory order of the operation when the object is modified; the check alone is a load of the corresponding order
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API uint8_t ZennyAtomicMaxUnsignedByteExplicit(volatile struct ZennyAtomicType *atomic, uint8_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Replace the value of an atomic int object with `value` if `value` is smaller with the specified memory order.
+ * The object is not modified when it already holds the smaller value.
+ * @param atomic pointer to an atomic int object
+ * @param value the bound to be applied
+ * @param order memory order of the operation when the object is modified; the check alone is a load of the corresponding order
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API int ZennyAtomicMinIntExplicit(volatile struct ZennyAtomicType *atomic, int value, enum ZennyMemoryOrder order);
+
+/**
+ * Replace the value of an atomic int object with `value` if `value` is smaller when both are compared as unsigned with the specified memory order.
+ * The object is not modified when it already holds the smaller value.
+ * @param atomic pointer to an atomic int object
+ * @param value the bound to be applied
+ * @param order memory order of the operation when the object is modified; the check alone is a load of the corresponding order
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API unsigned ZennyAtomicMinUnsignedIntExplicit(volatile struct ZennyAtomicType *atomic, unsigned value, enum ZennyMemoryOrder order);
+
+/**
+ * Replace the value of an atomic int object with `value` if `value` is larger with the specified memory order.
+ * The object is not modified when it already holds the larger value.
+ * @param atomic pointer to an atomic int object
+ * @param value the bound to be applied
+ * @param order memory order of the operation when the object is modified; the check alone is a load of the corresponding order
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API int ZennyAtomicMaxIntExplicit(volatile struct ZennyAtomicType *atomic, int value, enum ZennyMemoryOrder order);
+
+/**
+ * Replace the value of an atomic int object with `value` if `value` is larger when both are compared as unsigned with the specified memory order.
+ * The object is not modified when it already holds the larger value.
+ * @param atomic pointer to an atomic int object
+ * @param value the bound to be applied
+ * @param order memory order of the operation when the object is modified; the check alone is a load of the corresponding order
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API unsigned ZennyAtomicMaxUnsignedIntExplicit(volatile struct ZennyAtomicType *atomic, unsigned value, enum ZennyMemoryOrder order);
+
+/**
+ * Replace the value of an atomic int64_t object with `value` if `value` is smaller with the specified memory order.
+ * The object is not modified when it already holds the smaller value.
+ * @param atomic pointer to an atomic int64_t object
+ * @param value the bound to be applied
+ * @param order memory order of the operation when the object is modified; the check alone is a load of the corresponding order
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API int64_t ZennyAtomicMinLongExplicit(volatile struct ZennyAtomicType *atomic, int64_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Replace the value of an atomic int64_t object with `value` if `value` is smaller when both are compared as unsigned with the specified memory order.
+ * The object is not modified when it already holds the smaller value.
+ * @param atomic pointer to an atomic int64_t object
+ * @param value the bound to be applied
+ * @param order memory order of the operation when the object is modified; the check alone is a load of the corresponding order
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API uint64_t ZennyAtomicMinUnsignedLongExplicit(volatile struct ZennyAtomicType *atomic, uint64_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Replace the value of an atomic int64_t object with `value` if `value` is larger with the specified memory order.
+ * The object is not modified when it already holds the larger value.
+ * @param atomic pointer to an atomic int64_t object
+ * @param value the bound to be applied
+ * @param order memory order of the operation when the object is modified; the check alone is a load of the corresponding order
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API int64_t ZennyAtomicMaxLongExplicit(volatile struct ZennyAtomicType *atomic, int64_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Replace the value of an atomic int64_t object with `value` if `value` is larger when both are compared as unsigned with the specified memory order.
+ * The object is not modified when it already holds the larger value.
+ * @param atomic pointer to an atomic int64_t object
+ * @param value the bound to be applied
+ * @param order memory order of the operation when the object is modified; the check alone is a load of the corresponding order
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API uint64_t ZennyAtomicMaxUnsignedLongExplicit(volatile struct ZennyAtomicType *atomic, uint64_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Replace the value of an atomic intptr_t object with `value` if `value` is smaller with the specified memory order.
+ * The object is not modified when it already holds the smaller value.
+ * @param atomic pointer to an atomic intptr_t object
+ * @param value the bound to be applied
+ * @param order memory order of the operation when the object is modified; the check alone is a load of the corresponding order
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API intptr_t ZennyAtomicMinPtrExplicit(volatile struct ZennyAtomicType *atomic, intptr_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Replace the value of an atomic intptr_t object with `value` if `value` is smaller when both are compared as unsigned with the specified memory order.
+ * The object is not modified when it already holds the smaller value.
+ * @param atomic pointer to an atomic intptr_t object
+ * @param value the bound to be applied
+ * @param order memory order of the operation when the object is modified; the check alone is a load of the corresponding order
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API uintptr_t ZennyAtomicMinUnsignedPtrExplicit(volatile struct ZennyAtomicType *atomic, uintptr_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Replace the value of an atomic intptr_t object with `value` if `value` is larger with the specified memory order.
+ * The object is not modified when it already holds the larger value.
+ * @param atomic pointer to an atomic intptr_t object
+ * @param value the bound to be applied
+ * @param order memory order of the operation when the object is modified; the check alone is a load of the corresponding order
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API intptr_t ZennyAtomicMaxPtrExplicit(volatile struct ZennyAtomicType *atomic, intptr_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Replace the value of an atomic intptr_t object with `value` if `value` is larger when both are compared as unsigned with the specified memory order.
+ * The object is not modified when it already holds the larger value.
+ * @param atomic pointer to an atomic intptr_t object
+ * @param value the bound to be applied
+ * @param order memory order of the operation when the object is modified; the check alone is a load of the corresponding order
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API uintptr_t ZennyAtomicMaxUnsignedPtrExplicit(volatile struct ZennyAtomicType *atomic, uintptr_t value, enum ZennyMemoryOrder order);
+
+// MARK: Operate and fetch with explicit memory order
+
+/**
+ * Add a value to an atomic int8_t object with the specified memory order
+ * @param atomic pointer to an atomic int8_t object
+ * @param value the value to be added
+ * @param order memory order of the operation
+ * @return the value of the atomic object just after the addition
+ */
+ZENNY_ATOMICS_API int8_t ZennyAtomicAddFetchByteExplicit(volatile struct ZennyAtomicType *atomic, int8_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Add a value to an atomic int object with the specified memory order
+ * @param atomic pointer to an atomic int object
+ * @param value the value to be added
+ * @param order memory order of the operation
+ * @return the value of the atomic object just after the addition
+ */
+ZENNY_ATOMICS_API int ZennyAtomicAddFetchIntExplicit(volatile struct ZennyAtomicType *atomic, int value, enum ZennyMemoryOrder order);
+
+/**
+ * Add a value to an atomic int64_t object with the specified memory order
+ * @param atomic pointer to an atomic int64_t object
+ * @param value the value to be added
+ * @param order memory order of the operation
+ * @return the value of the atomic object just after the addition
+ */
+ZENNY_ATOMICS_API int64_t ZennyAtomicAddFetchLongExplicit(volatile struct ZennyAtomicType *atomic, int64_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Add a value to an atomic intptr_t object with the specified memory order
+ * @param atomic pointer to an atomic intptr_t object
+ * @param value the value to be added
+ * @param order memory order of the operation
+ * @return the value of the atomic object just after the addition
+ */
+ZENNY_ATOMICS_API intptr_t ZennyAtomicAddFetchPtrExplicit(volatile struct ZennyAtomicType *atomic, intptr_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Subtract a value from an atomic int8_t object with the specified memory order
+ * @param atomic pointer to an atomic int8_t object
+ * @param value the value to be subtracted
+ * @param order memory order of the operation
+ * @return the value of the atomic object just after the subtraction
+ */
+ZENNY_ATOMICS_API int8_t ZennyAtomicSubFetchByteExplicit(volatile struct ZennyAtomicType *atomic, int8_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Subtract a value from an atomic int object with the specified memory order
+ * @param atomic pointer to an atomic int object
+ * @param value the value to be subtracted
+ * @param order memory order of the operation
+ * @return the value of the atomic object just after the subtraction
+ */
+ZENNY_ATOMICS_API int ZennyAtomicSubFetchIntExplicit(volatile struct ZennyAtomicType *atomic, int value, enum ZennyMemoryOrder order);
+
+/**
+ * Subtract a value from an atomic int64_t object with the specified memory order
+ * @param atomic pointer to an atomic int64_t object
+ * @param value the value to be subtracted
+ * @param order memory order of the operation
+ * @return the value of the atomic object just after the subtraction
+ */
+ZENNY_ATOMICS_API int64_t ZennyAtomicSubFetchLongExplicit(volatile struct ZennyAtomicType *atomic, int64_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Subtract a value from an atomic intptr_t object with the specified memory order
+ * @param atomic pointer to an atomic intptr_t object
+ * @param value the value to be subtracted
+ * @param order memory order of the operation
+ * @return the value of the atomic object just after the subtraction
+ */
+ZENNY_ATOMICS_API intptr_t ZennyAtomicSubFetchPtrExplicit(volatile struct ZennyAtomicType *atomic, intptr_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Bitwise OR a value into an atomic int8_t object with the specified memory order
+ * @param atomic pointer to an atomic int8_t object
+ * @param value the value to be ORed
+ * @param order memory order of the operation
+ * @return the value of the atomic object just after the bitwise OR
+ */
+ZENNY_ATOMICS_API int8_t ZennyAtomicOrFetchByteExplicit(volatile struct ZennyAtomicType *atomic, int8_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Bitwise OR a value into an atomic int object with the specified memory order
+ * @param atomic pointer to an atomic int object
+ * @param value the value to be ORed
+ * @param order memory order of the operation
+ * @return the value of the atomic object just after the bitwise OR
+ */
+ZENNY_ATOMICS_API int ZennyAtomicOrFetchIntExplicit(volatile struct ZennyAtomicType *atomic, int value, enum ZennyMemoryOrder order);
+
+/**
+ * Bitwise OR a value into an atomic int64_t object with the specified memory order
+ * @param atomic pointer to an atomic int64_t object
+ * @param value the value to be ORed
+ * @param order memory order of the operation
+ * @return the value of the atomic object just after the bitwise OR
+ */
+ZENNY_ATOMICS_API int64_t ZennyAtomicOrFetchLongExplicit(volatile struct ZennyAtomicType *atomic, int64_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Bitwise OR a value into an atomic intptr_t object with the specified memory order
+ * @param atomic pointer to an atomic intptr_t object
+ * @param value the value to be ORed
+ * @param order memory order of the operation
+ * @return the value of the atomic object just after the bitwise OR
+ */
+ZENNY_ATOMICS_API intptr_t ZennyAtomicOrFetchPtrExplicit(volatile struct ZennyAtomicType *atomic, intptr_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Bitwise AND a value into an atomic int8_t object with the specified memory order
+ * @param atomic pointer to an atomic int8_t object
+ * @param value the value to be ANDed
+ * @param order memory order of the operation
+ * @return the value of the atomic object just after the bitwise AND
+ */
+ZENNY_ATOMICS_API int8_t ZennyAtomicAndFetchByteExplicit(volatile struct ZennyAtomicType *atomic, int8_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Bitwise AND a value into an atomic int object with the specified memory order
+ * @param atomic pointer to an atomic int object
+ * @param value the value to be ANDed
+ * @param order memory order of the operation
+ * @return the value of the atomic object just after the bitwise AND
+ */
+ZENNY_ATOMICS_API int ZennyAtomicAndFetchIntExplicit(volatile struct ZennyAtomicType *atomic, int value, enum ZennyMemoryOrder order);
+
+/**
+ * Bitwise AND a value into an atomic int64_t object with the specified memory order
+ * @param atomic pointer to an atomic int64_t object
+ * @param value the value to be ANDed
+ * @param order memory order of the operation
+ * @return the value of the atomic object just after the bitwise AND
+ */
+ZENNY_ATOMICS_API int64_t ZennyAtomicAndFetchLongExplicit(volatile struct ZennyAtomicType *atomic, int64_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Bitwise AND a value into an atomic intptr_t object with the specified memory order
+ * @param atomic pointer to an atomic intptr_t object
+ * @param value the value to be ANDed
+ * @param order memory order of the operation
+ * @return the value of the atomic object just after the bitwise AND
+ */
+ZENNY_ATOMICS_API intptr_t ZennyAtomicAndFetchPtrExplicit(volatile struct ZennyAtomicType *atomic, intptr_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Bitwise XOR a value into an atomic int8_t object with the specified memory order
+ * @param atomic pointer to an atomic int8_t object
+ * @param value the value to be XORed
+ * @param order memory order of the operation
+ * @return the value of the atomic object just after the bitwise XOR
+ */
+ZENNY_ATOMICS_API int8_t ZennyAtomicXorFetchByteExplicit(volatile struct ZennyAtomicType *atomic, int8_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Bitwise XOR a value into an atomic int object with the specified memory order
+ * @param atomic pointer to an atomic int object
+ * @param value the value to be XORed
+ * @param order memory order of the operation
+ * @return the value of the atomic object just after the bitwise XOR
+ */
+ZENNY_ATOMICS_API int ZennyAtomicXorFetchIntExplicit(volatile struct ZennyAtomicType *atomic, int value, enum ZennyMemoryOrder order);
+
+/**
+ * Bitwise XOR a value into an atomic int64_t object with the specified memory order
+ * @param atomic pointer to an atomic int64_t object
+ * @param value the value to be XORed
+ * @param order memory order of the operation
+ * @return the value of the atomic object just after the bitwise XOR
+ */
+ZENNY_ATOMICS_API int64_t ZennyAtomicXorFetchLongExplicit(volatile struct ZennyAtomicType *atomic, int64_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Bitwise XOR a value into an atomic intptr_t object with the specified memory order
+ * @param atomic pointer to an atomic intptr_t object
+ * @param value the value to be XORed
+ * @param order memory order of the operation
+ * @return the value of the atomic object just after the bitwise XOR
+ */
+ZENNY_ATOMICS_API intptr_t ZennyAtomicXorFetchPtrExplicit(volatile struct ZennyAtomicType *atomic, intptr_t value, enum ZennyMemoryOrder order);
+
+// MARK: Floating point
+
+// A float occupies the storage of an atomic int and a double that of an atomic int64_t.
+// Compare-exchange compares bit patterns, so it succeeds on a NaN that is bitwise identical to the expected one
+// and tells -0.0 apart from +0.0. The read-modify-write operations below are built on it and so never spin forever on a NaN.
+
+/**
+ * Initialize an atomic float object
+ * @param atomic pointer to an atomic float object
+ * @param value the initial value assigned to `atomic`
+ */
+ZENNY_ATOMICS_API void ZennyAtomicInitFloat(volatile struct ZennyAtomicType *atomic, float value);
+
+/**
+ * Load an atomic float object
+ * @param atomic pointer to an atomic float object
+ * @return the value of the atomic object
+ */
+ZENNY_ATOMICS_API float ZennyAtomicLoadFloat(volatile struct ZennyAtomicType *atomic);
+
+/**
+ * Store a value to an atomic float object
+ * @param atomic pointer to an atomic float object
+ * @param value the value to be stored
+ */
+ZENNY_ATOMICS_API void ZennyAtomicStoreFloat(volatile struct ZennyAtomicType *atomic, float value);
+
+/**
+ * Exchange the value of an atomic float object
+ * @param atomic pointer to an atomic float object
+ * @param value the value to be stored
+ * @return the value of the atomic object just before the exchange
+ */
+ZENNY_ATOMICS_API float ZennyAtomicExchangeFloat(volatile struct ZennyAtomicType *atomic, float value);
+
+/**
+ * Compare the bit patterns of an atomic float object and the expected object.
+ * If they are equal, store the desired value to the atomic object and return true;
+ * Otherwise store the atomic object value to the expected object and return false.
+ * @param atomic pointer to an atomic float object
+ * @param expected pointer to the expected object. It is commonly loaded from the atomic object.
+ * @param desired the value to be stored to the atomic object
+ * @return true, if the exchange happens; false otherwise.
+ */
+ZENNY_ATOMICS_API bool ZennyAtomicCompareExchangeFloat(volatile struct ZennyAtomicType *atomic, float *expected, float desired);
+
+/**
+ * Add a value to an atomic float object
+ * @param atomic pointer to an atomic float object
+ * @param value the value to be added
+ * @return the value of the atomic object just before the addition
+ */
+ZENNY_ATOMICS_API float ZennyAtomicAddFloat(volatile struct ZennyAtomicType *atomic, float value);
+
+/**
+ * Replace the value of an atomic float object with `value` if `value` is smaller.
+ * -0.0 counts as smaller than +0.0. A NaN `value` is ignored, and a NaN in the object is replaced by any other value.
+ * The object is not modified when it already holds the smaller value.
+ * @param atomic pointer to an atomic float object
+ * @param value the bound to be applied
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API float ZennyAtomicMinFloat(volatile struct ZennyAtomicType *atomic, float value);
+
+/**
+ * Replace the value of an atomic float object with `value` if `value` is larger.
+ * +0.0 counts as larger than -0.0. A NaN `value` is ignored, and a NaN in the object is replaced by any other value.
+ * The object is not modified when it already holds the larger value.
+ * @param atomic pointer to an atomic float object
+ * @param value the bound to be applied
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API float ZennyAtomicMaxFloat(volatile struct ZennyAtomicType *atomic, float value);
+
+/**
+ * Initialize an atomic double object
+ * @param atomic pointer to an atomic double object
+ * @param value the initial value assigned to `atomic`
+ */
+ZENNY_ATOMICS_API void ZennyAtomicInitDouble(volatile struct ZennyAtomicType *atomic, double value);
+
+/**
+ * Load an atomic double object
+ * @param atomic pointer to an atomic double object
+ * @return the value of the atomic object
+ */
+ZENNY_ATOMICS_API double ZennyAtomicLoadDouble(volatile struct ZennyAtomicType *atomic);
+
+/**
+ * Store a value to an atomic double object
+ * @param atomic pointer to an atomic double object
+ * @param value the value to be stored
+ */
+ZENNY_ATOMICS_API void ZennyAtomicStoreDouble(volatile struct ZennyAtomicType *atomic, double value);
+
+/**
+ * Exchange the value of an atomic double object
+ * @param atomic pointer to an atomic double object
+ * @param value the value to be stored
+ * @return the value of the atomic object just before the exchange
+ */
+ZENNY_ATOMICS_API double ZennyAtomicExchangeDouble(volatile struct ZennyAtomicType *atomic, double value);
+
+/**
+ * Compare the bit patterns of an atomic double object and the expected object.
+ * If they are equal, store the desired value to the atomic object and return true;
+ * Otherwise store the atomic object value to the expected object and return false.
+ * @param atomic pointer to an atomic double object
+ * @param expected pointer to the expected object. It is commonly loaded from the atomic object.
+ * @param desired the value to be stored to the atomic object
+ * @return true, if the exchange happens; false otherwise.
+ */
+ZENNY_ATOMICS_API bool ZennyAtomicCompareExchangeDouble(volatile struct ZennyAtomicType *atomic, double *expected, double desired);
+
+/**
+ * Add a value to an atomic double object
+ * @param atomic pointer to an atomic double object
+ * @param value the value to be added
+ * @return the value of the atomic object just before the addition
+ */
+ZENNY_ATOMICS_API double ZennyAtomicAddDouble(volatile struct ZennyAtomicType *atomic, double value);
+
+/**
+ * Replace the value of an atomic double object with `value` if `value` is smaller.
+ * -0.0 counts as smaller than +0.0. A NaN `value` is ignored, and a NaN in the object is replaced by any other value.
+ * The object is not modified when it already holds the smaller value.
+ * @param atomic pointer to an atomic double object
+ * @param value the bound to be applied
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API double ZennyAtomicMinDouble(volatile struct ZennyAtomicType *atomic, double value);
+
+/**
+ * Replace the value of an atomic double object with `value` if `value` is larger.
+ * +0.0 counts as larger than -0.0. A NaN `value` is ignored, and a NaN in the object is replaced by any other value.
+ * The object is not modified when it already holds the larger value.
+ * @param atomic pointer to an atomic double object
+ * @param value the bound to be applied
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API double ZennyAtomicMaxDouble(volatile struct ZennyAtomicType *atomic, double value);
+
+// MARK: Floating point with explicit memory order
+
+/**
+ * Load an atomic float object with the specified memory order
+ * @param atomic pointer to an atomic float object
+ * @param order memory order of the operation
+ * @return the value of the atomic object
+ */
+ZENNY_ATOMICS_API float ZennyAtomicLoadFloatExplicit(volatile struct ZennyAtomicType *atomic, enum ZennyMemoryOrder order);
+
+/**
+ * Store a value to an atomic float object with the specified memory order
+ * @param atomic pointer to an atomic float object
+ * @param value the value to be stored
+ * @param order memory order of the operation
+ */
+ZENNY_ATOMICS_API void ZennyAtomicStoreFloatExplicit(volatile struct ZennyAtomicType *atomic, float value, enum ZennyMemoryOrder order);
+
+/**
+ * Exchange the value of an atomic float object with the specified memory order
+ * @param atomic pointer to an atomic float object
+ * @param value the value to be stored
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the exchange
+ */
+ZENNY_ATOMICS_API float ZennyAtomicExchangeFloatExplicit(volatile struct ZennyAtomicType *atomic, float value, enum ZennyMemoryOrder order);
+
+/**
+ * Compare the bit patterns of an atomic float object and the expected object with the specified memory orders.
+ * If they are equal, store the desired value to the atomic object and return true;
+ * Otherwise store the atomic object value to the expected object and return false.
+ * @param atomic pointer to an atomic float object
+ * @param expected pointer to the expected object. It is commonly loaded from the atomic object.
+ * @param desired the value to be stored to the atomic object
+ * @param success memory order of the read-modify-write operation if the exchange happens
+ * @param failure memory order of the load operation if the exchange does not happen
+ * @return true, if the exchange happens; false otherwise.
+ */
+ZENNY_ATOMICS_API bool ZennyAtomicCompareExchangeFloatExplicit(volatile struct ZennyAtomicType *atomic, float *expected, float desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure);
+
+/**
+ * Add a value to an atomic float object with the specified memory order
+ * @param atomic pointer to an atomic float object
+ * @param value the value to be added
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the addition
+ */
+ZENNY_ATOMICS_API float ZennyAtomicAddFloatExplicit(volatile struct ZennyAtomicType *atomic, float value, enum ZennyMemoryOrder order);
+
+/**
+ * Replace the value of an atomic float object with `value` if `value` is smaller with the specified memory order.
+ * -0.0 counts as smaller than +0.0. A NaN `value` is ignored, and a NaN in the object is replaced by any other value.
+ * The object is not modified when it already holds the smaller value.
+ * @param atomic pointer to an atomic float object
+ * @param value the bound to be applied
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API float ZennyAtomicMinFloatExplicit(volatile struct ZennyAtomicType *atomic, float value, enum ZennyMemoryOrder order);
+
+/**
+ * Replace the value of an atomic float object with `value` if `value` is larger with the specified memory order.
+ * +0.0 counts as larger than -0.0. A NaN `value` is ignored, and a NaN in the object is replaced by any other value.
+ * The object is not modified when it already holds the larger value.
+ * @param atomic pointer to an atomic float object
+ * @param value the bound to be applied
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API float ZennyAtomicMaxFloatExplicit(volatile struct ZennyAtomicType *atomic, float value, enum ZennyMemoryOrder order);
+
+/**
+ * Load an atomic double object with the specified memory order
+ * @param atomic pointer to an atomic double object
+ * @param order memory order of the operation
+ * @return the value of the atomic object
+ */
+ZENNY_ATOMICS_API double ZennyAtomicLoadDoubleExplicit(volatile struct ZennyAtomicType *atomic, enum ZennyMemoryOrder order);
+
+/**
+ * Store a value to an atomic double object with the specified memory order
+ * @param atomic pointer to an atomic double object
+ * @param value the value to be stored
+ * @param order memory order of the operation
+ */
+ZENNY_ATOMICS_API void ZennyAtomicStoreDoubleExplicit(volatile struct ZennyAtomicType *atomic, double value, enum ZennyMemoryOrder order);
+
+/**
+ * Exchange the value of an atomic double object with the specified memory order
+ * @param atomic pointer to an atomic double object
+ * @param value the value to be stored
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the exchange
+ */
+ZENNY_ATOMICS_API double ZennyAtomicExchangeDoubleExplicit(volatile struct ZennyAtomicType *atomic, double value, enum ZennyMemoryOrder order);
+
+/**
+ * Compare the bit patterns of an atomic double object and the expected object with the specified memory orders.
+ * If they are equal, store the desired value to the atomic object and return true;
+ * Otherwise store the atomic object value to the expected object and return false.
+ * @param atomic pointer to an atomic double object
+ * @param expected pointer to the expected object. It is commonly loaded from the atomic object.
+ * @param desired the value to be stored to the atomic object
+ * @param success memory order of the read-modify-write operation if the exchange happens
+ * @param failure memory order of the load operation if the exchange does not happen
+ * @return true, if the exchange happens; false otherwise.
+ */
+ZENNY_ATOMICS_API bool ZennyAtomicCompareExchangeDoubleExplicit(volatile struct ZennyAtomicType *atomic, double *expected, double desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure);
+
+/**
+ * Add a value to an atomic double object with the specified memory order
+ * @param atomic pointer to an atomic double object
+ * @param value the value to be added
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the addition
+ */
+ZENNY_ATOMICS_API double ZennyAtomicAddDoubleExplicit(volatile struct ZennyAtomicType *atomic, double value, enum ZennyMemoryOrder order);
+
+/**
+ * Replace the value of an atomic double object with `value` if `value` is smaller with the specified memory order.
+ * -0.0 counts as smaller than +0.0. A NaN `value` is ignored, and a NaN in the object is replaced by any other value.
+ * The object is not modified when it already holds the smaller value.
+ * @param atomic pointer to an atomic double object
+ * @param value the bound to be applied
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API double ZennyAtomicMinDoubleExplicit(volatile struct ZennyAtomicType *atomic, double value, enum ZennyMemoryOrder order);
+
+/**
+ * Replace the value of an atomic double object with `value` if `value` is larger with the specified memory order.
+ * +0.0 counts as larger than -0.0. A NaN `value` is ignored, and a NaN in the object is replaced by any other value.
+ * The object is not modified when it already holds the larger value.
+ * @param atomic pointer to an atomic double object
+ * @param value the bound to be applied
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API double ZennyAtomicMaxDoubleExplicit(volatile struct ZennyAtomicType *atomic, double value, enum ZennyMemoryOrder order);
+
+// MARK: Compact atomic flag
+
+/**
+ * Initialize a compact atomic flag object
+ * @param atomic pointer to a compact atomic flag object
+ */
+ZENNY_ATOMICS_API void ZennyAtomicFlagInit(volatile struct ZennyAtomicFlag *atomic);
+
+/**
+ * Load a compact atomic flag object
+ * @param atomic pointer to a compact atomic flag object
+ * @return the value of the atomic object
+ */
+ZENNY_ATOMICS_API bool ZennyAtomicFlagLoad(volatile struct ZennyAtomicFlag *atomic);
+
+/**
+ * Perform test and set atomic operation on a compact atomic flag object.
+ * @param atomic pointer to a compact atomic flag object
+ * @return If the flag was set before the call, return true; Otherwise return false.
+ */
+ZENNY_ATOMICS_API bool ZennyAtomicFlagTestAndSet(volatile struct ZennyAtomicFlag *atomic);
+
+/**
+ * Clear a compact atomic flag object
+ * @param atomic pointer to a compact atomic flag object
+ */
+ZENNY_ATOMICS_API void ZennyAtomicFlagClear(volatile struct ZennyAtomicFlag *atomic);
+
+/**
+ * Load a compact atomic flag object with the specified memory order
+ * @param atomic pointer to a compact atomic flag object
+ * @param order memory order of the load. It shall not be ZennyMemoryOrderRelease or ZennyMemoryOrderAcqRel.
+ * @return the value of the atomic object
+ */
+ZENNY_ATOMICS_API bool ZennyAtomicFlagLoadExplicit(volatile struct ZennyAtomicFlag *atomic, enum ZennyMemoryOrder order);
+
+/**
+ * Perform test and set atomic operation on a compact atomic flag object with the specified memory order.
+ * @param atomic pointer to a compact atomic flag object
+ * @param order memory order of the operation
+ * @return If the flag was set before the call, return true; Otherwise return false.
+ */
+ZENNY_ATOMICS_API bool ZennyAtomicFlagTestAndSetExplicit(volatile struct ZennyAtomicFlag *atomic, enum ZennyMemoryOrder order);
+
+/**
+ * Clear a compact atomic flag object with the specified memory order
+ * @param atomic pointer to a compact atomic flag object
+ * @param order memory order of the store. It shall not be ZennyMemoryOrderConsume, ZennyMemoryOrderAcquire or ZennyMemoryOrderAcqRel.
+ */
+ZENNY_ATOMICS_API void ZennyAtomicFlagClearExplicit(volatile struct ZennyAtomicFlag *atomic, enum ZennyMemoryOrder order);
+
+// MARK: Compact atomic int8_t
+
+/**
+ * Initialize a compact atomic int8_t object
+ * @param atomic pointer to a compact atomic int8_t object
+ * @param value the initial value assigned to `atomic`
+ */
+ZENNY_ATOMICS_API void ZennyAtomicByteInit(volatile struct ZennyAtomicByte *atomic, int8_t value);
+
+/**
+ * Load a compact atomic int8_t object
+ * @param atomic pointer to a compact atomic int8_t object
+ * @return the value of the atomic object
+ */
+ZENNY_ATOMICS_API int8_t ZennyAtomicByteLoad(volatile struct ZennyAtomicByte *atomic);
+
+/**
+ * Store a value to a compact atomic int8_t object
+ * @param atomic pointer to a compact atomic int8_t object
+ * @param value the value to be stored
+ */
+ZENNY_ATOMICS_API void ZennyAtomicByteStore(volatile struct ZennyAtomicByte *atomic, int8_t value);
+
+/**
+ * Add a value to a compact atomic int8_t object
+ * @param atomic pointer to a compact atomic int8_t object
+ * @param value the value to be added
+ * @return the value of the atomic object just before the addition
+ */
+ZENNY_ATOMICS_API int8_t ZennyAtomicByteAdd(volatile struct ZennyAtomicByte *atomic, int8_t value);
+
+/**
+ * Subtract a value from a compact atomic int8_t object
+ * @param atomic pointer to a compact atomic int8_t object
+ * @param value the value to be subtracted
+ * @return the value of the atomic object just before the subtraction
+ */
+ZENNY_ATOMICS_API int8_t ZennyAtomicByteSub(volatile struct ZennyAtomicByte *atomic, int8_t value);
+
+/**
+ * Perform bitwise OR to a compact atomic int8_t object with a value
+ * @param atomic pointer to a compact atomic int8_t object
+ * @param value the value as a bitwise OR operand
+ * @return the value of the atomic object just before the bitwise OR
+ */
+ZENNY_ATOMICS_API int8_t ZennyAtomicByteOr(volatile struct ZennyAtomicByte *atomic, int8_t value);
+
+/**
+ * Perform bitwise XOR to a compact atomic int8_t object with a value
+ * @param atomic pointer to a compact atomic int8_t object
+ * @param value the value as a bitwise XOR operand
+ * @return the value of the atomic object just before the bitwise XOR
+ */
+ZENNY_ATOMICS_API int8_t ZennyAtomicByteXor(volatile struct ZennyAtomicByte *atomic, int8_t value);
+
+/**
+ * Perform bitwise AND to a compact atomic int8_t object with a value
+ * @param atomic pointer to a compact atomic int8_t object
+ * @param value the value as a bitwise AND operand
+ * @return the value of the atomic object just before the bitwise AND
+ */
+ZENNY_ATOMICS_API int8_t ZennyAtomicByteAnd(volatile struct ZennyAtomicByte *atomic, int8_t value);
+
+/**
+ * Atomically store the specified value to a compact atomic int8_t object
+ * and return the value of the atomic object just before the exchange operation.
+ * @param atomic pointer to a compact atomic int8_t object
+ * @param value the value used to exchange
+ * @return the value of the atomic object just before the exchange operation
+ */
+ZENNY_ATOMICS_API int8_t ZennyAtomicByteExchange(volatile struct ZennyAtomicByte *atomic, int8_t value);
+
+/**
+ * Compare the atomic object and the expected object.
+ * If they are equal, store the desired value to the atomic object and return true;
+ * Otherwise store the atomic object value to the expected object and return false.
+ * @param atomic pointer to a compact atomic int8_t object
+ * @param expected pointer to the expected object. It is commonly loaded from the atomic object.
+ * @param desired the value to be stored to the atomic object
+ * @return true, if the exchange happens; false otherwise.
+ */
+ZENNY_ATOMICS_API bool ZennyAtomicByteCompareExchange(volatile struct ZennyAtomicByte *atomic, int8_t *expected, int8_t desired);
+
+/**
+ * Load a compact atomic int8_t object with the specified memory order
+ * @param atomic pointer to a compact atomic int8_t object
+ * @param order memory order of the load. It shall not be ZennyMemoryOrderRelease or ZennyMemoryOrderAcqRel.
+ * @return the value of the atomic object
+ */
+ZENNY_ATOMICS_API int8_t ZennyAtomicByteLoadExplicit(volatile struct ZennyAtomicByte *atomic, enum ZennyMemoryOrder order);
+
+/**
+ * Store a value to a compact atomic int8_t object with the specified memory order
+ * @param atomic pointer to a compact atomic int8_t object
+ * @param value the value to be stored
+ * @param order memory order of the store. It shall not be ZennyMemoryOrderConsume, ZennyMemoryOrderAcquire or ZennyMemoryOrderAcqRel.
+ */
+ZENNY_ATOMICS_API void ZennyAtomicByteStoreExplicit(volatile struct ZennyAtomicByte *atomic, int8_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Add a value to a compact atomic int8_t object with the specified memory order
+ * @param atomic pointer to a compact atomic int8_t object
+ * @param value the value to be added
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the addition
+ */
+ZENNY_ATOMICS_API int8_t ZennyAtomicByteAddExplicit(volatile struct ZennyAtomicByte *atomic, int8_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Subtract a value from a compact atomic int8_t object with the specified memory order
+ * @param atomic pointer to a compact atomic int8_t object
+ * @param value the value to be subtracted
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the subtraction
+ */
+ZENNY_ATOMICS_API int8_t ZennyAtomicByteSubExplicit(volatile struct ZennyAtomicByte *atomic, int8_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Perform bitwise OR to a compact atomic int8_t object with a value with the specified memory order
+ * @param atomic pointer to a compact atomic int8_t object
+ * @param value the value as a bitwise OR operand
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the bitwise OR
+ */
+ZENNY_ATOMICS_API int8_t ZennyAtomicByteOrExplicit(volatile struct ZennyAtomicByte *atomic, int8_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Perform bitwise XOR to a compact atomic int8_t object with a value with the specified memory order
+ * @param atomic pointer to a compact atomic int8_t object
+ * @param value the value as a bitwise XOR operand
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the bitwise XOR
+ */
+ZENNY_ATOMICS_API int8_t ZennyAtomicByteXorExplicit(volatile struct ZennyAtomicByte *atomic, int8_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Perform bitwise AND to a compact atomic int8_t object with a value with the specified memory order
+ * @param atomic pointer to a compact atomic int8_t object
+ * @param value the value as a bitwise AND operand
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the bitwise AND
+ */
+ZENNY_ATOMICS_API int8_t ZennyAtomicByteAndExplicit(volatile struct ZennyAtomicByte *atomic, int8_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Atomically store the specified value to a compact atomic int8_t object with the specified memory order
+ * and return the value of the atomic object just before the exchange operation.
+ * @param atomic pointer to a compact atomic int8_t object
+ * @param value the value used to exchange
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the exchange operation
+ */
+ZENNY_ATOMICS_API int8_t ZennyAtomicByteExchangeExplicit(volatile struct ZennyAtomicByte *atomic, int8_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Compare the atomic object and the expected object with the specified memory orders.
+ * If they are equal, store the desired value to the atomic object and return true;
+ * Otherwise store the atomic object value to the expected object and return false.
+ * @param atomic pointer to a compact atomic int8_t object
+ * @param expected pointer to the expected object. It is commonly loaded from the atomic object.
+ * @param desired the value to be stored to the atomic object
+ * @param success memory order of the read-modify-write operation if the exchange happens
+ * @param failure memory order of the load if the exchange does not happen.
+ * It shall not be ZennyMemoryOrderRelease or ZennyMemoryOrderAcqRel, and shall be no stronger than `success`.
+ * @return true, if the exchange happens; false otherwise.
+ */
+ZENNY_ATOMICS_API bool ZennyAtomicByteCompareExchangeExplicit(volatile struct ZennyAtomicByte *atomic, int8_t *expected, int8_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure);
+
+// MARK: Compact atomic int16_t
+
+/**
+ * Initialize a compact atomic int16_t object
+ * @param atomic pointer to a compact atomic int16_t object
+ * @param value the initial value assigned to `atomic`
+ */
+ZENNY_ATOMICS_API void ZennyAtomicShortInit(volatile struct ZennyAtomicShort *atomic, int16_t value);
+
+/**
+ * Load a compact atomic int16_t object
+ * @param atomic pointer to a compact atomic int16_t object
+ * @return the value of the atomic object
+ */
+ZENNY_ATOMICS_API int16_t ZennyAtomicShortLoad(volatile struct ZennyAtomicShort *atomic);
+
+/**
+ * Store a value to a compact atomic int16_t object
+ * @param atomic pointer to a compact atomic int16_t object
+ * @param value the value to be stored
+ */
+ZENNY_ATOMICS_API void ZennyAtomicShortStore(volatile struct ZennyAtomicShort *atomic, int16_t value);
+
+/**
+ * Add a value to a compact atomic int16_t object
+ * @param atomic pointer to a compact atomic int16_t object
+ * @param value the value to be added
+ * @return the value of the atomic object just before the addition
+ */
+ZENNY_ATOMICS_API int16_t ZennyAtomicShortAdd(volatile struct ZennyAtomicShort *atomic, int16_t value);
+
+/**
+ * Subtract a value from a compact atomic int16_t object
+ * @param atomic pointer to a compact atomic int16_t object
+ * @param value the value to be subtracted
+ * @return the value of the atomic object just before the subtraction
+ */
+ZENNY_ATOMICS_API int16_t ZennyAtomicShortSub(volatile struct ZennyAtomicShort *atomic, int16_t value);
+
+/**
+ * Perform bitwise OR to a compact atomic int16_t object with a value
+ * @param atomic pointer to a compact atomic int16_t object
+ * @param value the value as a bitwise OR operand
+ * @return the value of the atomic object just before the bitwise OR
+ */
+ZENNY_ATOMICS_API int16_t ZennyAtomicShortOr(volatile struct ZennyAtomicShort *atomic, int16_t value);
+
+/**
+ * Perform bitwise XOR to a compact atomic int16_t object with a value
+ * @param atomic pointer to a compact atomic int16_t object
+ * @param value the value as a bitwise XOR operand
+ * @return the value of the atomic object just before the bitwise XOR
+ */
+ZENNY_ATOMICS_API int16_t ZennyAtomicShortXor(volatile struct ZennyAtomicShort *atomic, int16_t value);
+
+/**
+ * Perform bitwise AND to a compact atomic int16_t object with a value
+ * @param atomic pointer to a compact atomic int16_t object
+ * @param value the value as a bitwise AND operand
+ * @return the value of the atomic object just before the bitwise AND
+ */
+ZENNY_ATOMICS_API int16_t ZennyAtomicShortAnd(volatile struct ZennyAtomicShort *atomic, int16_t value);
+
+/**
+ * Atomically store the specified value to a compact atomic int16_t object
+ * and return the value of the atomic object just before the exchange operation.
+ * @param atomic pointer to a compact atomic int16_t object
+ * @param value the value used to exchange
+ * @return the value of the atomic object just before the exchange operation
+ */
+ZENNY_ATOMICS_API int16_t ZennyAtomicShortExchange(volatile struct ZennyAtomicShort *atomic, int16_t value);
+
+/**
+ * Compare the atomic object and the expected object.
+ * If they are equal, store the desired value to the atomic object and return true;
+ * Otherwise store the atomic object value to the expected object and return false.
+ * @param atomic pointer to a compact atomic int16_t object
+ * @param expected pointer to the expected object. It is commonly loaded from the atomic object.
+ * @param desired the value to be stored to the atomic object
+ * @return true, if the exchange happens; false otherwise.
+ */
+ZENNY_ATOMICS_API bool ZennyAtomicShortCompareExchange(volatile struct ZennyAtomicShort *atomic, int16_t *expected, int16_t desired);
+
+/**
+ * Load a compact atomic int16_t object with the specified memory order
+ * @param atomic pointer to a compact atomic int16_t object
+ * @param order memory order of the load. It shall not be ZennyMemoryOrderRelease or ZennyMemoryOrderAcqRel.
+ * @return the value of the atomic object
+ */
+ZENNY_ATOMICS_API int16_t ZennyAtomicShortLoadExplicit(volatile struct ZennyAtomicShort *atomic, enum ZennyMemoryOrder order);
+
+/**
+ * Store a value to a compact atomic int16_t object with the specified memory order
+ * @param atomic pointer to a compact atomic int16_t object
+ * @param value the value to be stored
+ * @param order memory order of the store. It shall not be ZennyMemoryOrderConsume, ZennyMemoryOrderAcquire or ZennyMemoryOrderAcqRel.
+ */
+ZENNY_ATOMICS_API void ZennyAtomicShortStoreExplicit(volatile struct ZennyAtomicShort *atomic, int16_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Add a value to a compact atomic int16_t object with the specified memory order
+ * @param atomic pointer to a compact atomic int16_t object
+ * @param value the value to be added
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the addition
+ */
+ZENNY_ATOMICS_API int16_t ZennyAtomicShortAddExplicit(volatile struct ZennyAtomicShort *atomic, int16_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Subtract a value from a compact atomic int16_t object with the specified memory order
+ * @param atomic pointer to a compact atomic int16_t object
+ * @param value the value to be subtracted
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the subtraction
+ */
+ZENNY_ATOMICS_API int16_t ZennyAtomicShortSubExplicit(volatile struct ZennyAtomicShort *atomic, int16_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Perform bitwise OR to a compact atomic int16_t object with a value with the specified memory order
+ * @param atomic pointer to a compact atomic int16_t object
+ * @param value the value as a bitwise OR operand
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the bitwise OR
+ */
+ZENNY_ATOMICS_API int16_t ZennyAtomicShortOrExplicit(volatile struct ZennyAtomicShort *atomic, int16_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Perform bitwise XOR to a compact atomic int16_t object with a value with the specified memory order
+ * @param atomic pointer to a compact atomic int16_t object
+ * @param value the value as a bitwise XOR operand
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the bitwise XOR
+ */
+ZENNY_ATOMICS_API int16_t ZennyAtomicShortXorExplicit(volatile struct ZennyAtomicShort *atomic, int16_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Perform bitwise AND to a compact atomic int16_t object with a value with the specified memory order
+ * @param atomic pointer to a compact atomic int16_t object
+ * @param value the value as a bitwise AND operand
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the bitwise AND
+ */
+ZENNY_ATOMICS_API int16_t ZennyAtomicShortAndExplicit(volatile struct ZennyAtomicShort *atomic, int16_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Atomically store the specified value to a compact atomic int16_t object with the specified memory order
+ * and return the value of the atomic object just before the exchange operation.
+ * @param atomic pointer to a compact atomic int16_t object
+ * @param value the value used to exchange
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the exchange operation
+ */
+ZENNY_ATOMICS_API int16_t ZennyAtomicShortExchangeExplicit(volatile struct ZennyAtomicShort *atomic, int16_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Compare the atomic object and the expected object with the specified memory orders.
+ * If they are equal, store the desired value to the atomic object and return true;
+ * Otherwise store the atomic object value to the expected object and return false.
+ * @param atomic pointer to a compact atomic int16_t object
+ * @param expected pointer to the expected object. It is commonly loaded from the atomic object.
+ * @param desired the value to be stored to the atomic object
+ * @param success memory order of the read-modify-write operation if the exchange happens
+ * @param failure memory order of the load if the exchange does not happen.
+ * It shall not be ZennyMemoryOrderRelease or ZennyMemoryOrderAcqRel, and shall be no stronger than `success`.
+ * @return true, if the exchange happens; false otherwise.
+ */
+ZENNY_ATOMICS_API bool ZennyAtomicShortCompareExchangeExplicit(volatile struct ZennyAtomicShort *atomic, int16_t *expected, int16_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure);
+
+// MARK: Compact atomic int
+
+/**
+ * Initialize a compact atomic int object
+ * @param atomic pointer to a compact atomic int object
+ * @param value the initial value assigned to `atomic`
+ */
+ZENNY_ATOMICS_API void ZennyAtomicIntInit(volatile struct ZennyAtomicInt *atomic, int value);
+
+/**
+ * Load a compact atomic int object
+ * @param atomic pointer to a compact atomic int object
+ * @return the value of the atomic object
+ */
+ZENNY_ATOMICS_API int ZennyAtomicIntLoad(volatile struct ZennyAtomicInt *atomic);
+
+/**
+ * Store a value to a compact atomic int object
+ * @param atomic pointer to a compact atomic int object
+ * @param value the value to be stored
+ */
+ZENNY_ATOMICS_API void ZennyAtomicIntStore(volatile struct ZennyAtomicInt *atomic, int value);
+
+/**
+ * Add a value to a compact atomic int object
+ * @param atomic pointer to a compact atomic int object
+ * @param value the value to be added
+ * @return the value of the atomic object just before the addition
+ */
+ZENNY_ATOMICS_API int ZennyAtomicIntAdd(volatile struct ZennyAtomicInt *atomic, int value);
+
+/**
+ * Subtract a value from a compact atomic int object
+ * @param atomic pointer to a compact atomic int object
+ * @param value the value to be subtracted
+ * @return the value of the atomic object just before the subtraction
+ */
+ZENNY_ATOMICS_API int ZennyAtomicIntSub(volatile struct ZennyAtomicInt *atomic, int value);
+
+/**
+ * Perform bitwise OR to a compact atomic int object with a value
+ * @param atomic pointer to a compact atomic int object
+ * @param value the value as a bitwise OR operand
+ * @return the value of the atomic object just before the bitwise OR
+ */
+ZENNY_ATOMICS_API int ZennyAtomicIntOr(volatile struct ZennyAtomicInt *atomic, int value);
+
+/**
+ * Perform bitwise XOR to a compact atomic int object with a value
+ * @param atomic pointer to a compact atomic int object
+ * @param value the value as a bitwise XOR operand
+ * @return the value of the atomic object just before the bitwise XOR
+ */
+ZENNY_ATOMICS_API int ZennyAtomicIntXor(volatile struct ZennyAtomicInt *atomic, int value);
+
+/**
+ * Perform bitwise AND to a compact atomic int object with a value
+ * @param atomic pointer to a compact atomic int object
+ * @param value the value as a bitwise AND operand
+ * @return the value of the atomic object just before the bitwise AND
+ */
+ZENNY_ATOMICS_API int ZennyAtomicIntAnd(volatile struct ZennyAtomicInt *atomic, int value);
+
+/**
+ * Atomically store the specified value to a compact atomic int object
+ * and return the value of the atomic object just before the exchange operation.
+ * @param atomic pointer to a compact atomic int object
+ * @param value the value used to exchange
+ * @return the value of the atomic object just before the exchange operation
+ */
+ZENNY_ATOMICS_API int ZennyAtomicIntExchange(volatile struct ZennyAtomicInt *atomic, int value);
+
+/**
+ * Compare the atomic object and the expected object.
+ * If they are equal, store the desired value to the atomic object and return true;
+ * Otherwise store the atomic object value to the expected object and return false.
+ * @param atomic pointer to a compact atomic int object
+ * @param expected pointer to the expected object. It is commonly loaded from the atomic object.
+ * @param desired the value to be stored to the atomic object
+ * @return true, if the exchange happens; false otherwise.
+ */
+ZENNY_ATOMICS_API bool ZennyAtomicIntCompareExchange(volatile struct ZennyAtomicInt *atomic, int *expected, int desired);
+
+/**
+ * Load a compact atomic int object with the specified memory order
+ * @param atomic pointer to a compact atomic int object
+ * @param order memory order of the load. It shall not be ZennyMemoryOrderRelease or ZennyMemoryOrderAcqRel.
+ * @return the value of the atomic object
+ */
+ZENNY_ATOMICS_API int ZennyAtomicIntLoadExplicit(volatile struct ZennyAtomicInt *atomic, enum ZennyMemoryOrder order);
+
+/**
+ * Store a value to a compact atomic int object with the specified memory order
+ * @param atomic pointer to a compact atomic int object
+ * @param value the value to be stored
+ * @param order memory order of the store. It shall not be ZennyMemoryOrderConsume, ZennyMemoryOrderAcquire or ZennyMemoryOrderAcqRel.
+ */
+ZENNY_ATOMICS_API void ZennyAtomicIntStoreExplicit(volatile struct ZennyAtomicInt *atomic, int value, enum ZennyMemoryOrder order);
+
+/**
+ * Add a value to a compact atomic int object with the specified memory order
+ * @param atomic pointer to a compact atomic int object
+ * @param value the value to be added
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the addition
+ */
+ZENNY_ATOMICS_API int ZennyAtomicIntAddExplicit(volatile struct ZennyAtomicInt *atomic, int value, enum ZennyMemoryOrder order);
+
+/**
+ * Subtract a value from a compact atomic int object with the specified memory order
+ * @param atomic pointer to a compact atomic int object
+ * @param value the value to be subtracted
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the subtraction
+ */
+ZENNY_ATOMICS_API int ZennyAtomicIntSubExplicit(volatile struct ZennyAtomicInt *atomic, int value, enum ZennyMemoryOrder order);
+
+/**
+ * Perform bitwise OR to a compact atomic int object with a value with the specified memory order
+ * @param atomic pointer to a compact atomic int object
+ * @param value the value as a bitwise OR operand
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the bitwise OR
+ */
+ZENNY_ATOMICS_API int ZennyAtomicIntOrExplicit(volatile struct ZennyAtomicInt *atomic, int value, enum ZennyMemoryOrder order);
+
+/**
+ * Perform bitwise XOR to a compact atomic int object with a value with the specified memory order
+ * @param atomic pointer to a compact atomic int object
+ * @param value the value as a bitwise XOR operand
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the bitwise XOR
+ */
+ZENNY_ATOMICS_API int ZennyAtomicIntXorExplicit(volatile struct ZennyAtomicInt *atomic, int value, enum ZennyMemoryOrder order);
+
+/**
+ * Perform bitwise AND to a compact atomic int object with a value with the specified memory order
+ * @param atomic pointer to a compact atomic int object
+ * @param value the value as a bitwise AND operand
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the bitwise AND
+ */
+ZENNY_ATOMICS_API int ZennyAtomicIntAndExplicit(volatile struct ZennyAtomicInt *atomic, int value, enum ZennyMemoryOrder order);
+
+/**
+ * Atomically store the specified value to a compact atomic int object with the specified memory order
+ * and return the value of the atomic object just before the exchange operation.
+ * @param atomic pointer to a compact atomic int object
+ * @param value the value used to exchange
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the exchange operation
+ */
+ZENNY_ATOMICS_API int ZennyAtomicIntExchangeExplicit(volatile struct ZennyAtomicInt *atomic, int value, enum ZennyMemoryOrder order);
+
+/**
+ * Compare the atomic object and the expected object with the specified memory orders.
+ * If they are equal, store the desired value to the atomic object and return true;
+ * Otherwise store the atomic object value to the expected object and return false.
+ * @param atomic pointer to a compact atomic int object
+ * @param expected pointer to the expected object. It is commonly loaded from the atomic object.
+ * @param desired the value to be stored to the atomic object
+ * @param success memory order of the read-modify-write operation if the exchange happens
+ * @param failure memory order of the load if the exchange does not happen.
+ * It shall not be ZennyMemoryOrderRelease or ZennyMemoryOrderAcqRel, and shall be no stronger than `success`.
+ * @return true, if the exchange happens; false otherwise.
+ */
+ZENNY_ATOMICS_API bool ZennyAtomicIntCompareExchangeExplicit(volatile struct ZennyAtomicInt *atomic, int *expected, int desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure);
+
+// MARK: Compact atomic int64_t
+
+/**
+ * Initialize a compact atomic int64_t object
+ * @param atomic pointer to a compact atomic int64_t object
+ * @param value the initial value assigned to `atomic`
+ */
+ZENNY_ATOMICS_API void ZennyAtomicLongInit(volatile struct ZennyAtomicLong *atomic, int64_t value);
+
+/**
+ * Load a compact atomic int64_t object
+ * @param atomic pointer to a compact atomic int64_t object
+ * @return the value of the atomic object
+ */
+ZENNY_ATOMICS_API int64_t ZennyAtomicLongLoad(volatile struct ZennyAtomicLong *atomic);
+
+/**
+ * Store a value to a compact atomic int64_t object
+ * @param atomic pointer to a compact atomic int64_t object
+ * @param value the value to be stored
+ */
+ZENNY_ATOMICS_API void ZennyAtomicLongStore(volatile struct ZennyAtomicLong *atomic, int64_t value);
+
+/**
+ * Add a value to a compact atomic int64_t object
+ * @param atomic pointer to a compact atomic int64_t object
+ * @param value the value to be added
+ * @return the value of the atomic object just before the addition
+ */
+ZENNY_ATOMICS_API int64_t ZennyAtomicLongAdd(volatile struct ZennyAtomicLong *atomic, int64_t value);
+
+/**
+ * Subtract a value from a compact atomic int64_t object
+ * @param atomic pointer to a compact atomic int64_t object
+ * @param value the value to be subtracted
+ * @return the value of the atomic object just before the subtraction
+ */
+ZENNY_ATOMICS_API int64_t ZennyAtomicLongSub(volatile struct ZennyAtomicLong *atomic, int64_t value);
+
+/**
+ * Perform bitwise OR to a compact atomic int64_t object with a value
+ * @param atomic pointer to a compact atomic int64_t object
+ * @param value the value as a bitwise OR operand
+ * @return the value of the atomic object just before the bitwise OR
+ */
+ZENNY_ATOMICS_API int64_t ZennyAtomicLongOr(volatile struct ZennyAtomicLong *atomic, int64_t value);
+
+/**
+ * Perform bitwise XOR to a compact atomic int64_t object with a value
+ * @param atomic pointer to a compact atomic int64_t object
+ * @param value the value as a bitwise XOR operand
+ * @return the value of the atomic object just before the bitwise XOR
+ */
+ZENNY_ATOMICS_API int64_t ZennyAtomicLongXor(volatile struct ZennyAtomicLong *atomic, int64_t value);
+
+/**
+ * Perform bitwise AND to a compact atomic int64_t object with a value
+ * @param atomic pointer to a compact atomic int64_t object
+ * @param value the value as a bitwise AND operand
+ * @return the value of the atomic object just before the bitwise AND
+ */
+ZENNY_ATOMICS_API int64_t ZennyAtomicLongAnd(volatile struct ZennyAtomicLong *atomic, int64_t value);
+
+/**
+ * Atomically store the specified value to a compact atomic int64_t object
+ * and return the value of the atomic object just before the exchange operation.
+ * @param atomic pointer to a compact atomic int64_t object
+ * @param value the value used to exchange
+ * @return the value of the atomic object just before the exchange operation
+ */
+ZENNY_ATOMICS_API int64_t ZennyAtomicLongExchange(volatile struct ZennyAtomicLong *atomic, int64_t value);
+
+/**
+ * Compare the atomic object and the expected object.
+ * If they are equal, store the desired value to the atomic object and return true;
+ * Otherwise store the atomic object value to the expected object and return false.
+ * @param atomic pointer to a compact atomic int64_t object
+ * @param expected pointer to the expected object. It is commonly loaded from the atomic object.
+ * @param desired the value to be stored to the atomic object
+ * @return true, if the exchange happens; false otherwise.
+ */
+ZENNY_ATOMICS_API bool ZennyAtomicLongCompareExchange(volatile struct ZennyAtomicLong *atomic, int64_t *expected, int64_t desired);
+
+/**
+ * Load a compact atomic int64_t object with the specified memory order
+ * @param atomic pointer to a compact atomic int64_t object
+ * @param order memory order of the load. It shall not be ZennyMemoryOrderRelease or ZennyMemoryOrderAcqRel.
+ * @return the value of the atomic object
+ */
+ZENNY_ATOMICS_API int64_t ZennyAtomicLongLoadExplicit(volatile struct ZennyAtomicLong *atomic, enum ZennyMemoryOrder order);
+
+/**
+ * Store a value to a compact atomic int64_t object with the specified memory order
+ * @param atomic pointer to a compact atomic int64_t object
+ * @param value the value to be stored
+ * @param order memory order of the store. It shall not be ZennyMemoryOrderConsume, ZennyMemoryOrderAcquire or ZennyMemoryOrderAcqRel.
+ */
+ZENNY_ATOMICS_API void ZennyAtomicLongStoreExplicit(volatile struct ZennyAtomicLong *atomic, int64_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Add a value to a compact atomic int64_t object with the specified memory order
+ * @param atomic pointer to a compact atomic int64_t object
+ * @param value the value to be added
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the addition
+ */
+ZENNY_ATOMICS_API int64_t ZennyAtomicLongAddExplicit(volatile struct ZennyAtomicLong *atomic, int64_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Subtract a value from a compact atomic int64_t object with the specified memory order
+ * @param atomic pointer to a compact atomic int64_t object
+ * @param value the value to be subtracted
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the subtraction
+ */
+ZENNY_ATOMICS_API int64_t ZennyAtomicLongSubExplicit(volatile struct ZennyAtomicLong *atomic, int64_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Perform bitwise OR to a compact atomic int64_t object with a value with the specified memory order
+ * @param atomic pointer to a compact atomic int64_t object
+ * @param value the value as a bitwise OR operand
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the bitwise OR
+ */
+ZENNY_ATOMICS_API int64_t ZennyAtomicLongOrExplicit(volatile struct ZennyAtomicLong *atomic, int64_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Perform bitwise XOR to a compact atomic int64_t object with a value with the specified memory order
+ * @param atomic pointer to a compact atomic int64_t object
+ * @param value the value as a bitwise XOR operand
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the bitwise XOR
+ */
+ZENNY_ATOMICS_API int64_t ZennyAtomicLongXorExplicit(volatile struct ZennyAtomicLong *atomic, int64_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Perform bitwise AND to a compact atomic int64_t object with a value with the specified memory order
+ * @param atomic pointer to a compact atomic int64_t object
+ * @param value the value as a bitwise AND operand
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the bitwise AND
+ */
+ZENNY_ATOMICS_API int64_t ZennyAtomicLongAndExplicit(volatile struct ZennyAtomicLong *atomic, int64_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Atomically store the specified value to a compact atomic int64_t object with the specified memory order
+ * and return the value of the atomic object just before the exchange operation.
+ * @param atomic pointer to a compact atomic int64_t object
+ * @param value the value used to exchange
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the exchange operation
+ */
+ZENNY_ATOMICS_API int64_t ZennyAtomicLongExchangeExplicit(volatile struct ZennyAtomicLong *atomic, int64_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Compare the atomic object and the expected object with the specified memory orders.
+ * If they are equal, store the desired value to the atomic object and return true;
+ * Otherwise store the atomic object value to the expected object and return false.
+ * @param atomic pointer to a compact atomic int64_t object
+ * @param expected pointer to the expected object. It is commonly loaded from the atomic object.
+ * @param desired the value to be stored to the atomic object
+ * @param success memory order of the read-modify-write operation if the exchange happens
+ * @param failure memory order of the load if the exchange does not happen.
+ * It shall not be ZennyMemoryOrderRelease or ZennyMemoryOrderAcqRel, and shall be no stronger than `success`.
+ * @return true, if the exchange happens; false otherwise.
+ */
+ZENNY_ATOMICS_API bool ZennyAtomicLongCompareExchangeExplicit(volatile struct ZennyAtomicLong *atomic, int64_t *expected, int64_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure);
+
+// MARK: Compact atomic intptr_t
+
+/**
+ * Initialize a compact atomic intptr_t object
+ * @param atomic pointer to a compact atomic intptr_t object
+ * @param value the initial value assigned to `atomic`
+ */
+ZENNY_ATOMICS_API void ZennyAtomicPtrInit(volatile struct ZennyAtomicPtr *atomic, intptr_t value);
+
+/**
+ * Load a compact atomic intptr_t object
+ * @param atomic pointer to a compact atomic intptr_t object
+ * @return the value of the atomic object
+ */
+ZENNY_ATOMICS_API intptr_t ZennyAtomicPtrLoad(volatile struct ZennyAtomicPtr *atomic);
+
+/**
+ * Store a value to a compact atomic intptr_t object
+ * @param atomic pointer to a compact atomic intptr_t object
+ * @param value the value to be stored
+ */
+ZENNY_ATOMICS_API void ZennyAtomicPtrStore(volatile struct ZennyAtomicPtr *atomic, intptr_t value);
+
+/**
+ * Add a value to a compact atomic intptr_t object
+ * @param atomic pointer to a compact atomic intptr_t object
+ * @param value the value to be added
+ * @return the value of the atomic object just before the addition
+ */
+ZENNY_ATOMICS_API intptr_t ZennyAtomicPtrAdd(volatile struct ZennyAtomicPtr *atomic, intptr_t value);
+
+/**
+ * Subtract a value from a compact atomic intptr_t object
+ * @param atomic pointer to a compact atomic intptr_t object
+ * @param value the value to be subtracted
+ * @return the value of the atomic object just before the subtraction
+ */
+ZENNY_ATOMICS_API intptr_t ZennyAtomicPtrSub(volatile struct ZennyAtomicPtr *atomic, intptr_t value);
+
+/**
+ * Perform bitwise OR to a compact atomic intptr_t object with a value
+ * @param atomic pointer to a compact atomic intptr_t object
+ * @param value the value as a bitwise OR operand
+ * @return the value of the atomic object just before the bitwise OR
+ */
+ZENNY_ATOMICS_API intptr_t ZennyAtomicPtrOr(volatile struct ZennyAtomicPtr *atomic, intptr_t value);
+
+/**
+ * Perform bitwise XOR to a compact atomic intptr_t object with a value
+ * @param atomic pointer to a compact atomic intptr_t object
+ * @param value the value as a bitwise XOR operand
+ * @return the value of the atomic object just before the bitwise XOR
+ */
+ZENNY_ATOMICS_API intptr_t ZennyAtomicPtrXor(volatile struct ZennyAtomicPtr *atomic, intptr_t value);
+
+/**
+ * Perform bitwise AND to a compact atomic intptr_t object with a value
+ * @param atomic pointer to a compact atomic intptr_t object
+ * @param value the value as a bitwise AND operand
+ * @return the value of the atomic object just before the bitwise AND
+ */
+ZENNY_ATOMICS_API intptr_t ZennyAtomicPtrAnd(volatile struct ZennyAtomicPtr *atomic, intptr_t value);
+
+/**
+ * Atomically store the specified value to a compact atomic intptr_t object
+ * and return the value of the atomic object just before the exchange operation.
+ * @param atomic pointer to a compact atomic intptr_t object
+ * @param value the value used to exchange
+ * @return the value of the atomic object just before the exchange operation
+ */
+ZENNY_ATOMICS_API intptr_t ZennyAtomicPtrExchange(volatile struct ZennyAtomicPtr *atomic, intptr_t value);
+
+/**
+ * Compare the atomic object and the expected object.
+ * If they are equal, store the desired value to the atomic object and return true;
+ * Otherwise store the atomic object value to the expected object and return false.
+ * @param atomic pointer to a compact atomic intptr_t object
+ * @param expected pointer to the expected object. It is commonly loaded from the atomic object.
+ * @param desired the value to be stored to the atomic object
+ * @return true, if the exchange happens; false otherwise.
+ */
+ZENNY_ATOMICS_API bool ZennyAtomicPtrCompareExchange(volatile struct ZennyAtomicPtr *atomic, intptr_t *expected, intptr_t desired);
+
+/**
+ * Load a compact atomic intptr_t object with the specified memory order
+ * @param atomic pointer to a compact atomic intptr_t object
+ * @param order memory order of the load. It shall not be ZennyMemoryOrderRelease or ZennyMemoryOrderAcqRel.
+ * @return the value of the atomic object
+ */
+ZENNY_ATOMICS_API intptr_t ZennyAtomicPtrLoadExplicit(volatile struct ZennyAtomicPtr *atomic, enum ZennyMemoryOrder order);
+
+/**
+ * Store a value to a compact atomic intptr_t object with the specified memory order
+ * @param atomic pointer to a compact atomic intptr_t object
+ * @param value the value to be stored
+ * @param order memory order of the store. It shall not be ZennyMemoryOrderConsume, ZennyMemoryOrderAcquire or ZennyMemoryOrderAcqRel.
+ */
+ZENNY_ATOMICS_API void ZennyAtomicPtrStoreExplicit(volatile struct ZennyAtomicPtr *atomic, intptr_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Add a value to a compact atomic intptr_t object with the specified memory order
+ * @param atomic pointer to a compact atomic intptr_t object
+ * @param value the value to be added
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the addition
+ */
+ZENNY_ATOMICS_API intptr_t ZennyAtomicPtrAddExplicit(volatile struct ZennyAtomicPtr *atomic, intptr_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Subtract a value from a compact atomic intptr_t object with the specified memory order
+ * @param atomic pointer to a compact atomic intptr_t object
+ * @param value the value to be subtracted
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the subtraction
+ */
+ZENNY_ATOMICS_API intptr_t ZennyAtomicPtrSubExplicit(volatile struct ZennyAtomicPtr *atomic, intptr_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Perform bitwise OR to a compact atomic intptr_t object with a value with the specified memory order
+ * @param atomic pointer to a compact atomic intptr_t object
+ * @param value the value as a bitwise OR operand
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the bitwise OR
+ */
+ZENNY_ATOMICS_API intptr_t ZennyAtomicPtrOrExplicit(volatile struct ZennyAtomicPtr *atomic, intptr_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Perform bitwise XOR to a compact atomic intptr_t object with a value with the specified memory order
+ * @param atomic pointer to a compact atomic intptr_t object
+ * @param value the value as a bitwise XOR operand
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the bitwise XOR
+ */
+ZENNY_ATOMICS_API intptr_t ZennyAtomicPtrXorExplicit(volatile struct ZennyAtomicPtr *atomic, intptr_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Perform bitwise AND to a compact atomic intptr_t object with a value with the specified memory order
+ * @param atomic pointer to a compact atomic intptr_t object
+ * @param value the value as a bitwise AND operand
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the bitwise AND
+ */
+ZENNY_ATOMICS_API intptr_t ZennyAtomicPtrAndExplicit(volatile struct ZennyAtomicPtr *atomic, intptr_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Atomically store the specified value to a compact atomic intptr_t object with the specified memory order
+ * and return the value of the atomic object just before the exchange operation.
+ * @param atomic pointer to a compact atomic intptr_t object
+ * @param value the value used to exchange
+ * @param order memory order of the operation
+ * @return the value of the atomic object just before the exchange operation
+ */
+ZENNY_ATOMICS_API intptr_t ZennyAtomicPtrExchangeExplicit(volatile struct ZennyAtomicPtr *atomic, intptr_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Compare the atomic object and the expected object with the specified memory orders.
+ * If they are equal, store the desired value to the atomic object and return true;
+ * Otherwise store the atomic object value to the expected object and return false.
+ * @param atomic pointer to a compact atomic intptr_t object
+ * @param expected pointer to the expected object. It is commonly loaded from the atomic object.
+ * @param desired the value to be stored to the atomic object
+ * @param success memory order of the read-modify-write operation if the exchange happens
+ * @param failure memory order of the load if the exchange does not happen.
+ * It shall not be ZennyMemoryOrderRelease or ZennyMemoryOrderAcqRel, and shall be no stronger than `success`.
+ * @return true, if the exchange happens; false otherwise.
+ */
+ZENNY_ATOMICS_API bool ZennyAtomicPtrCompareExchangeExplicit(volatile struct ZennyAtomicPtr *atomic, intptr_t *expected, intptr_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure);
+
+// MARK: Compact weak compare and exchange
+
+/**
+ * Compare the atomic object and the expected object.
+ * If they are equal, store the desired value to the atomic object and return true;
+ * Otherwise store the atomic object value to the expected object and return false.
+ * Unlike the strong form, this may fail spuriously even when the objects are equal, so call it in a retry loop.
+ * On LL/SC targets such as ARM64, a loop around it compiles to a single load-linked/store-conditional pair per iteration.
+ * @param atomic pointer to a compact atomic int8_t object
+ * @param expected pointer to the expected object. It is commonly loaded from the atomic object.
+ * @param desired the value to be stored to the atomic object
+ * @return true, if the exchange happens; false otherwise.
+ */
+ZENNY_ATOMICS_API bool ZennyAtomicByteCompareExchangeWeak(volatile struct ZennyAtomicByte *atomic, int8_t *expected, int8_t desired);
+
+/**
+ * Compare the atomic object and the expected object.
+ * If they are equal, store the desired value to the atomic object and return true;
+ * Otherwise store the atomic object value to the expected object and return false.
+ * Unlike the strong form, this may fail spuriously even when the objects are equal, so call it in a retry loop.
+ * On LL/SC targets such as ARM64, a loop around it compiles to a single load-linked/store-conditional pair per iteration.
+ * @param atomic pointer to a compact atomic int16_t object
+ * @param expected pointer to the expected object. It is commonly loaded from the atomic object.
+ * @param desired the value to be stored to the atomic object
+ * @return true, if the exchange happens; false otherwise.
+ */
+ZENNY_ATOMICS_API bool ZennyAtomicShortCompareExchangeWeak(volatile struct ZennyAtomicShort *atomic, int16_t *expected, int16_t desired);
+
+/**
+ * Compare the atomic object and the expected object.
+ * If they are equal, store the desired value to the atomic object and return true;
+ * Otherwise store the atomic object value to the expected object and return false.
+ * Unlike the strong form, this may fail spuriously even when the objects are equal, so call it in a retry loop.
+ * On LL/SC targets such as ARM64, a loop around it compiles to a single load-linked/store-conditional pair per iteration.
+ * @param atomic pointer to a compact atomic int object
+ * @param expected pointer to the expected object. It is commonly loaded from the atomic object.
+ * @param desired the value to be stored to the atomic object
+ * @return true, if the exchange happens; false otherwise.
+ */
+ZENNY_ATOMICS_API bool ZennyAtomicIntCompareExchangeWeak(volatile struct ZennyAtomicInt *atomic, int *expected, int desired);
+
+/**
+ * Compare the atomic object and the expected object.
+ * If they are equal, store the desired value to the atomic object and return true;
+ * Otherwise store the atomic object value to the expected object and return false.
+ * Unlike the strong form, this may fail spuriously even when the objects are equal, so call it in a retry loop.
+ * On LL/SC targets such as ARM64, a loop around it compiles to a single load-linked/store-conditional pair per iteration.
+ * @param atomic pointer to a compact atomic int64_t object
+ * @param expected pointer to the expected object. It is commonly loaded from the atomic object.
+ * @param desired the value to be stored to the atomic object
+ * @return true, if the exchange happens; false otherwise.
+ */
+ZENNY_ATOMICS_API bool ZennyAtomicLongCompareExchangeWeak(volatile struct ZennyAtomicLong *atomic, int64_t *expected, int64_t desired);
+
+/**
+ * Compare the atomic object and the expected object.
+ * If they are equal, store the desired value to the atomic object and return true;
+ * Otherwise store the atomic object value to the expected object and return false.
+ * Unlike the strong form, this may fail spuriously even when the objects are equal, so call it in a retry loop.
+ * On LL/SC targets such as ARM64, a loop around it compiles to a single load-linked/store-conditional pair per iteration.
+ * @param atomic pointer to a compact atomic intptr_t object
+ * @param expected pointer to the expected object. It is commonly loaded from the atomic object.
+ * @param desired the value to be stored to the atomic object
+ * @return true, if the exchange happens; false otherwise.
+ */
+ZENNY_ATOMICS_API bool ZennyAtomicPtrCompareExchangeWeak(volatile struct ZennyAtomicPtr *atomic, intptr_t *expected, intptr_t desired);
+
+// MARK: Compact weak compare and exchange with explicit memory order
+
+/**
+ * Compare the atomic object and the expected object with the specified memory orders.
+ * If they are equal, store the desired value to the atomic object and return true;
+ * Otherwise store the atomic object value to the expected object and return false.
+ * Unlike the strong form, this may fail spuriously even when the objects are equal, so call it in a retry loop.
+ * On LL/SC targets such as ARM64, a loop around it compiles to a single load-linked/store-conditional pair per iteration.
+ * @param atomic pointer to a compact atomic int8_t object
+ * @param expected pointer to the expected object. It is commonly loaded from the atomic object.
+ * @param desired the value to be stored to the atomic object
+ * @param success memory order of the read-modify-write operation if the exchange happens
+ * @param failure memory order of the load operation if the exchange does not happen
+ * @return true, if the exchange happens; false otherwise.
+ */
+ZENNY_ATOMICS_API bool ZennyAtomicByteCompareExchangeWeakExplicit(volatile struct ZennyAtomicByte *atomic, int8_t *expected, int8_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure);
+
+/**
+ * Compare the atomic object and the expected object with the specified memory orders.
+ * If they are equal, store the desired value to the atomic object and return true;
+ * Otherwise store the atomic object value to the expected object and return false.
+ * Unlike the strong form, this may fail spuriously even when the objects are equal, so call it in a retry loop.
+ * On LL/SC targets such as ARM64, a loop around it compiles to a single load-linked/store-conditional pair per iteration.
+ * @param atomic pointer to a compact atomic int16_t object
+ * @param expected pointer to the expected object. It is commonly loaded from the atomic object.
+ * @param desired the value to be stored to the atomic object
+ * @param success memory order of the read-modify-write operation if the exchange happens
+ * @param failure memory order of the load operation if the exchange does not happen
+ * @return true, if the exchange happens; false otherwise.
+ */
+ZENNY_ATOMICS_API bool ZennyAtomicShortCompareExchangeWeakExplicit(volatile struct ZennyAtomicShort *atomic, int16_t *expected, int16_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure);
+
+/**
+ * Compare the atomic object and the expected object with the specified memory orders.
+ * If they are equal, store the desired value to the atomic object and return true;
+ * Otherwise store the atomic object value to the expected object and return false.
+ * Unlike the strong form, this may fail spuriously even when the objects are equal, so call it in a retry loop.
+ * On LL/SC targets such as ARM64, a loop around it compiles to a single load-linked/store-conditional pair per iteration.
+ * @param atomic pointer to a compact atomic int object
+ * @param expected pointer to the expected object. It is commonly loaded from the atomic object.
+ * @param desired the value to be stored to the atomic object
+ * @param success memory order of the read-modify-write operation if the exchange happens
+ * @param failure memory order of the load operation if the exchange does not happen
+ * @return true, if the exchange happens; false otherwise.
+ */
+ZENNY_ATOMICS_API bool ZennyAtomicIntCompareExchangeWeakExplicit(volatile struct ZennyAtomicInt *atomic, int *expected, int desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure);
+
+/**
+ * Compare the atomic object and the expected object with the specified memory orders.
+ * If they are equal, store the desired value to the atomic object and return true;
+ * Otherwise store the atomic object value to the expected object and return false.
+ * Unlike the strong form, this may fail spuriously even when the objects are equal, so call it in a retry loop.
+ * On LL/SC targets such as ARM64, a loop around it compiles to a single load-linked/store-conditional pair per iteration.
+ * @param atomic pointer to a compact atomic int64_t object
+ * @param expected pointer to the expected object. It is commonly loaded from the atomic object.
+ * @param desired the value to be stored to the atomic object
+ * @param success memory order of the read-modify-write operation if the exchange happens
+ * @param failure memory order of the load operation if the exchange does not happen
+ * @return true, if the exchange happens; false otherwise.
+ */
+ZENNY_ATOMICS_API bool ZennyAtomicLongCompareExchangeWeakExplicit(volatile struct ZennyAtomicLong *atomic, int64_t *expected, int64_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure);
+
+/**
+ * Compare the atomic object and the expected object with the specified memory orders.
+ * If they are equal, store the desired value to the atomic object and return true;
+ * Otherwise store the atomic object value to the expected object and return false.
+ * Unlike the strong form, this may fail spuriously even when the objects are equal, so call it in a retry loop.
+ * On LL/SC targets such as ARM64, a loop around it compiles to a single load-linked/store-conditional pair per iteration.
+ * @param atomic pointer to a compact atomic intptr_t object
+ * @param expected pointer to the expected object. It is commonly loaded from the atomic object.
+ * @param desired the value to be stored to the atomic object
+ * @param success memory order of the read-modify-write operation if the exchange happens
+ * @param failure memory order of the load operation if the exchange does not happen
+ * @return true, if the exchange happens; false otherwise.
+ */
+ZENNY_ATOMICS_API bool ZennyAtomicPtrCompareExchangeWeakExplicit(volatile struct ZennyAtomicPtr *atomic, intptr_t *expected, intptr_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure);
+
+// MARK: Compact minimum and maximum
+
+/**
+ * Replace the value of a compact atomic int8_t object with `value` if `value` is smaller.
+ * The object is not modified when it already holds the smaller value.
+ * @param atomic pointer to a compact atomic int8_t object
+ * @param value the bound to be applied
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API int8_t ZennyAtomicByteMin(volatile struct ZennyAtomicByte *atomic, int8_t value);
+
+/**
+ * Replace the value of a compact atomic int16_t object with `value` if `value` is smaller.
+ * The object is not modified when it already holds the smaller value.
+ * @param atomic pointer to a compact atomic int16_t object
+ * @param value the bound to be applied
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API int16_t ZennyAtomicShortMin(volatile struct ZennyAtomicShort *atomic, int16_t value);
+
+/**
+ * Replace the value of a compact atomic int8_t object with `value` if `value` is smaller when both are compared as unsigned.
+ * The object is not modified when it already holds the smaller value.
+ * @param atomic pointer to a compact atomic int8_t object
+ * @param value the bound to be applied
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API uint8_t ZennyAtomicByteMinUnsigned(volatile struct ZennyAtomicByte *atomic, uint8_t value);
+
+/**
+ * Replace the value of a compact atomic int16_t object with `value` if `value` is smaller when both are compared as unsigned.
+ * The object is not modified when it already holds the smaller value.
+ * @param atomic pointer to a compact atomic int16_t object
+ * @param value the bound to be applied
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API uint16_t ZennyAtomicShortMinUnsigned(volatile struct ZennyAtomicShort *atomic, uint16_t value);
+
+/**
+ * Replace the value of a compact atomic int8_t object with `value` if `value` is larger.
+ * The object is not modified when it already holds the larger value.
+ * @param atomic pointer to a compact atomic int8_t object
+ * @param value the bound to be applied
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API int8_t ZennyAtomicByteMax(volatile struct ZennyAtomicByte *atomic, int8_t value);
+
+/**
+ * Replace the value of a compact atomic int16_t object with `value` if `value` is larger.
+ * The object is not modified when it already holds the larger value.
+ * @param atomic pointer to a compact atomic int16_t object
+ * @param value the bound to be applied
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API int16_t ZennyAtomicShortMax(volatile struct ZennyAtomicShort *atomic, int16_t value);
+
+/**
+ * Replace the value of a compact atomic int8_t object with `value` if `value` is larger when both are compared as unsigned.
+ * The object is not modified when it already holds the larger value.
+ * @param atomic pointer to a compact atomic int8_t object
+ * @param value the bound to be applied
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API uint8_t ZennyAtomicByteMaxUnsigned(volatile struct ZennyAtomicByte *atomic, uint8_t value);
+
+/**
+ * Replace the value of a compact atomic int16_t object with `value` if `value` is larger when both are compared as unsigned.
+ * The object is not modified when it already holds the larger value.
+ * @param atomic pointer to a compact atomic int16_t object
+ * @param value the bound to be applied
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API uint16_t ZennyAtomicShortMaxUnsigned(volatile struct ZennyAtomicShort *atomic, uint16_t value);
+
+/**
+ * Replace the value of a compact atomic int object with `value` if `value` is smaller.
+ * The object is not modified when it already holds the smaller value.
+ * @param atomic pointer to a compact atomic int object
+ * @param value the bound to be applied
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API int ZennyAtomicIntMin(volatile struct ZennyAtomicInt *atomic, int value);
+
+/**
+ * Replace the value of a compact atomic int object with `value` if `value` is smaller when both are compared as unsigned.
+ * The object is not modified when it already holds the smaller value.
+ * @param atomic pointer to a compact atomic int object
+ * @param value the bound to be applied
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API unsigned ZennyAtomicIntMinUnsigned(volatile struct ZennyAtomicInt *atomic, unsigned value);
+
+/**
+ * Replace the value of a compact atomic int object with `value` if `value` is larger.
+ * The object is not modified when it already holds the larger value.
+ * @param atomic pointer to a compact atomic int object
+ * @param value the bound to be applied
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API int ZennyAtomicIntMax(volatile struct ZennyAtomicInt *atomic, int value);
+
+/**
+ * Replace the value of a compact atomic int object with `value` if `value` is larger when both are compared as unsigned.
+ * The object is not modified when it already holds the larger value.
+ * @param atomic pointer to a compact atomic int object
+ * @param value the bound to be applied
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API unsigned ZennyAtomicIntMaxUnsigned(volatile struct ZennyAtomicInt *atomic, unsigned value);
+
+/**
+ * Replace the value of a compact atomic int64_t object with `value` if `value` is smaller.
+ * The object is not modified when it already holds the smaller value.
+ * @param atomic pointer to a compact atomic int64_t object
+ * @param value the bound to be applied
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API int64_t ZennyAtomicLongMin(volatile struct ZennyAtomicLong *atomic, int64_t value);
+
+/**
+ * Replace the value of a compact atomic int64_t object with `value` if `value` is smaller when both are compared as unsigned.
+ * The object is not modified when it already holds the smaller value.
+ * @param atomic pointer to a compact atomic int64_t object
+ * @param value the bound to be applied
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API uint64_t ZennyAtomicLongMinUnsigned(volatile struct ZennyAtomicLong *atomic, uint64_t value);
+
+/**
+ * Replace the value of a compact atomic int64_t object with `value` if `value` is larger.
+ * The object is not modified when it already holds the larger value.
+ * @param atomic pointer to a compact atomic int64_t object
+ * @param value the bound to be applied
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API int64_t ZennyAtomicLongMax(volatile struct ZennyAtomicLong *atomic, int64_t value);
+
+/**
+ * Replace the value of a compact atomic int64_t object with `value` if `value` is larger when both are compared as unsigned.
+ * The object is not modified when it already holds the larger value.
+ * @param atomic pointer to a compact atomic int64_t object
+ * @param value the bound to be applied
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API uint64_t ZennyAtomicLongMaxUnsigned(volatile struct ZennyAtomicLong *atomic, uint64_t value);
+
+/**
+ * Replace the value of a compact atomic intptr_t object with `value` if `value` is smaller.
+ * The object is not modified when it already holds the smaller value.
+ * @param atomic pointer to a compact atomic intptr_t object
+ * @param value the bound to be applied
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API intptr_t ZennyAtomicPtrMin(volatile struct ZennyAtomicPtr *atomic, intptr_t value);
+
+/**
+ * Replace the value of a compact atomic intptr_t object with `value` if `value` is smaller when both are compared as unsigned.
+ * The object is not modified when it already holds the smaller value.
+ * @param atomic pointer to a compact atomic intptr_t object
+ * @param value the bound to be applied
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API uintptr_t ZennyAtomicPtrMinUnsigned(volatile struct ZennyAtomicPtr *atomic, uintptr_t value);
+
+/**
+ * Replace the value of a compact atomic intptr_t object with `value` if `value` is larger.
+ * The object is not modified when it already holds the larger value.
+ * @param atomic pointer to a compact atomic intptr_t object
+ * @param value the bound to be applied
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API intptr_t ZennyAtomicPtrMax(volatile struct ZennyAtomicPtr *atomic, intptr_t value);
+
+/**
+ * Replace the value of a compact atomic intptr_t object with `value` if `value` is larger when both are compared as unsigned.
+ * The object is not modified when it already holds the larger value.
+ * @param atomic pointer to a compact atomic intptr_t object
+ * @param value the bound to be applied
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API uintptr_t ZennyAtomicPtrMaxUnsigned(volatile struct ZennyAtomicPtr *atomic, uintptr_t value);
+
+// MARK: Compact operate and fetch
+
+/**
+ * Add a value to a compact atomic int8_t object
+ * @param atomic pointer to a compact atomic int8_t object
+ * @param value the value to be added
+ * @return the value of the atomic object just after the addition
+ */
+ZENNY_ATOMICS_API int8_t ZennyAtomicByteAddFetch(volatile struct ZennyAtomicByte *atomic, int8_t value);
+
+/**
+ * Add a value to a compact atomic int16_t object
+ * @param atomic pointer to a compact atomic int16_t object
+ * @param value the value to be added
+ * @return the value of the atomic object just after the addition
+ */
+ZENNY_ATOMICS_API int16_t ZennyAtomicShortAddFetch(volatile struct ZennyAtomicShort *atomic, int16_t value);
+
+/**
+ * Add a value to a compact atomic int object
+ * @param atomic pointer to a compact atomic int object
+ * @param value the value to be added
+ * @return the value of the atomic object just after the addition
+ */
+ZENNY_ATOMICS_API int ZennyAtomicIntAddFetch(volatile struct ZennyAtomicInt *atomic, int value);
+
+/**
+ * Add a value to a compact atomic int64_t object
+ * @param atomic pointer to a compact atomic int64_t object
+ * @param value the value to be added
+ * @return the value of the atomic object just after the addition
+ */
+ZENNY_ATOMICS_API int64_t ZennyAtomicLongAddFetch(volatile struct ZennyAtomicLong *atomic, int64_t value);
+
+/**
+ * Add a value to a compact atomic intptr_t object
+ * @param atomic pointer to a compact atomic intptr_t object
+ * @param value the value to be added
+ * @return the value of the atomic object just after the addition
+ */
+ZENNY_ATOMICS_API intptr_t ZennyAtomicPtrAddFetch(volatile struct ZennyAtomicPtr *atomic, intptr_t value);
+
+/**
+ * Subtract a value from a compact atomic int8_t object
+ * @param atomic pointer to a compact atomic int8_t object
+ * @param value the value to be subtracted
+ * @return the value of the atomic object just after the subtraction
+ */
+ZENNY_ATOMICS_API int8_t ZennyAtomicByteSubFetch(volatile struct ZennyAtomicByte *atomic, int8_t value);
+
+/**
+ * Subtract a value from a compact atomic int16_t object
+ * @param atomic pointer to a compact atomic int16_t object
+ * @param value the value to be subtracted
+ * @return the value of the atomic object just after the subtraction
+ */
+ZENNY_ATOMICS_API int16_t ZennyAtomicShortSubFetch(volatile struct ZennyAtomicShort *atomic, int16_t value);
+
+/**
+ * Subtract a value from a compact atomic int object
+ * @param atomic pointer to a compact atomic int object
+ * @param value the value to be subtracted
+ * @return the value of the atomic object just after the subtraction
+ */
+ZENNY_ATOMICS_API int ZennyAtomicIntSubFetch(volatile struct ZennyAtomicInt *atomic, int value);
+
+/**
+ * Subtract a value from a compact atomic int64_t object
+ * @param atomic pointer to a compact atomic int64_t object
+ * @param value the value to be subtracted
+ * @return the value of the atomic object just after the subtraction
+ */
+ZENNY_ATOMICS_API int64_t ZennyAtomicLongSubFetch(volatile struct ZennyAtomicLong *atomic, int64_t value);
+
+/**
+ * Subtract a value from a compact atomic intptr_t object
+ * @param atomic pointer to a compact atomic intptr_t object
+ * @param value the value to be subtracted
+ * @return the value of the atomic object just after the subtraction
+ */
+ZENNY_ATOMICS_API intptr_t ZennyAtomicPtrSubFetch(volatile struct ZennyAtomicPtr *atomic, intptr_t value);
+
+/**
+ * Bitwise OR a value into a compact atomic int8_t object
+ * @param atomic pointer to a compact atomic int8_t object
+ * @param value the value to be ORed
+ * @return the value of the atomic object just after the bitwise OR
+ */
+ZENNY_ATOMICS_API int8_t ZennyAtomicByteOrFetch(volatile struct ZennyAtomicByte *atomic, int8_t value);
+
+/**
+ * Bitwise OR a value into a compact atomic int16_t object
+ * @param atomic pointer to a compact atomic int16_t object
+ * @param value the value to be ORed
+ * @return the value of the atomic object just after the bitwise OR
+ */
+ZENNY_ATOMICS_API int16_t ZennyAtomicShortOrFetch(volatile struct ZennyAtomicShort *atomic, int16_t value);
+
+/**
+ * Bitwise OR a value into a compact atomic int object
+ * @param atomic pointer to a compact atomic int object
+ * @param value the value to be ORed
+ * @return the value of the atomic object just after the bitwise OR
+ */
+ZENNY_ATOMICS_API int ZennyAtomicIntOrFetch(volatile struct ZennyAtomicInt *atomic, int value);
+
+/**
+ * Bitwise OR a value into a compact atomic int64_t object
+ * @param atomic pointer to a compact atomic int64_t object
+ * @param value the value to be ORed
+ * @return the value of the atomic object just after the bitwise OR
+ */
+ZENNY_ATOMICS_API int64_t ZennyAtomicLongOrFetch(volatile struct ZennyAtomicLong *atomic, int64_t value);
+
+/**
+ * Bitwise OR a value into a compact atomic intptr_t object
+ * @param atomic pointer to a compact atomic intptr_t object
+ * @param value the value to be ORed
+ * @return the value of the atomic object just after the bitwise OR
+ */
+ZENNY_ATOMICS_API intptr_t ZennyAtomicPtrOrFetch(volatile struct ZennyAtomicPtr *atomic, intptr_t value);
+
+/**
+ * Bitwise AND a value into a compact atomic int8_t object
+ * @param atomic pointer to a compact atomic int8_t object
+ * @param value the value to be ANDed
+ * @return the value of the atomic object just after the bitwise AND
+ */
+ZENNY_ATOMICS_API int8_t ZennyAtomicByteAndFetch(volatile struct ZennyAtomicByte *atomic, int8_t value);
+
+/**
+ * Bitwise AND a value into a compact atomic int16_t object
+ * @param atomic pointer to a compact atomic int16_t object
+ * @param value the value to be ANDed
+ * @return the value of the atomic object just after the bitwise AND
+ */
+ZENNY_ATOMICS_API int16_t ZennyAtomicShortAndFetch(volatile struct ZennyAtomicShort *atomic, int16_t value);
+
+/**
+ * Bitwise AND a value into a compact atomic int object
+ * @param atomic pointer to a compact atomic int object
+ * @param value the value to be ANDed
+ * @return the value of the atomic object just after the bitwise AND
+ */
+ZENNY_ATOMICS_API int ZennyAtomicIntAndFetch(volatile struct ZennyAtomicInt *atomic, int value);
+
+/**
+ * Bitwise AND a value into a compact atomic int64_t object
+ * @param atomic pointer to a compact atomic int64_t object
+ * @param value the value to be ANDed
+ * @return the value of the atomic object just after the bitwise AND
+ */
+ZENNY_ATOMICS_API int64_t ZennyAtomicLongAndFetch(volatile struct ZennyAtomicLong *atomic, int64_t value);
+
+/**
+ * Bitwise AND a value into a compact atomic intptr_t object
+ * @param atomic pointer to a compact atomic intptr_t object
+ * @param value the value to be ANDed
+ * @return the value of the atomic object just after the bitwise AND
+ */
+ZENNY_ATOMICS_API intptr_t ZennyAtomicPtrAndFetch(volatile struct ZennyAtomicPtr *atomic, intptr_t value);
+
+/**
+ * Bitwise XOR a value into a compact atomic int8_t object
+ * @param atomic pointer to a compact atomic int8_t object
+ * @param value the value to be XORed
+ * @return the value of the atomic object just after the bitwise XOR
+ */
+ZENNY_ATOMICS_API int8_t ZennyAtomicByteXorFetch(volatile struct ZennyAtomicByte *atomic, int8_t value);
+
+/**
+ * Bitwise XOR a value into a compact atomic int16_t object
+ * @param atomic pointer to a compact atomic int16_t object
+ * @param value the value to be XORed
+ * @return the value of the atomic object just after the bitwise XOR
+ */
+ZENNY_ATOMICS_API int16_t ZennyAtomicShortXorFetch(volatile struct ZennyAtomicShort *atomic, int16_t value);
+
+/**
+ * Bitwise XOR a value into a compact atomic int object
+ * @param atomic pointer to a compact atomic int object
+ * @param value the value to be XORed
+ * @return the value of the atomic object just after the bitwise XOR
+ */
+ZENNY_ATOMICS_API int ZennyAtomicIntXorFetch(volatile struct ZennyAtomicInt *atomic, int value);
+
+/**
+ * Bitwise XOR a value into a compact atomic int64_t object
+ * @param atomic pointer to a compact atomic int64_t object
+ * @param value the value to be XORed
+ * @return the value of the atomic object just after the bitwise XOR
+ */
+ZENNY_ATOMICS_API int64_t ZennyAtomicLongXorFetch(volatile struct ZennyAtomicLong *atomic, int64_t value);
+
+/**
+ * Bitwise XOR a value into a compact atomic intptr_t object
+ * @param atomic pointer to a compact atomic intptr_t object
+ * @param value the value to be XORed
+ * @return the value of the atomic object just after the bitwise XOR
+ */
+ZENNY_ATOMICS_API intptr_t ZennyAtomicPtrXorFetch(volatile struct ZennyAtomicPtr *atomic, intptr_t value);
+
+// MARK: Compact minimum and maximum with explicit memory order
+
+/**
+ * Replace the value of a compact atomic int8_t object with `value` if `value` is smaller with the specified memory order.
+ * The object is not modified when it already holds the smaller value.
+ * @param atomic pointer to a compact atomic int8_t object
+ * @param value the bound to be applied
+ * @param order memory order of the operation when the object is modified; the check alone is a load of the corresponding order
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API int8_t ZennyAtomicByteMinExplicit(volatile struct ZennyAtomicByte *atomic, int8_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Replace the value of a compact atomic int16_t object with `value` if `value` is smaller with the specified memory order.
+ * The object is not modified when it already holds the smaller value.
+ * @param atomic pointer to a compact atomic int16_t object
+ * @param value the bound to be applied
+ * @param order memory order of the operation when the object is modified; the check alone is a load of the corresponding order
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API int16_t ZennyAtomicShortMinExplicit(volatile struct ZennyAtomicShort *atomic, int16_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Replace the value of a compact atomic int8_t object with `value` if `value` is smaller when both are compared as unsigned with the specified memory order.
+ * The object is not modified when it already holds the smaller value.
+ * @param atomic pointer to a compact atomic int8_t object
+ * @param value the bound to be applied
+ * @param order memory order of the operation when the object is modified; the check alone is a load of the corresponding order
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API uint8_t ZennyAtomicByteMinUnsignedExplicit(volatile struct ZennyAtomicByte *atomic, uint8_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Replace the value of a compact atomic int16_t object with `value` if `value` is smaller when both are compared as unsigned with the specified memory order.
+ * The object is not modified when it already holds the smaller value.
+ * @param atomic pointer to a compact atomic int16_t object
+ * @param value the bound to be applied
+ * @param order memory order of the operation when the object is modified; the check alone is a load of the corresponding order
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API uint16_t ZennyAtomicShortMinUnsignedExplicit(volatile struct ZennyAtomicShort *atomic, uint16_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Replace the value of a compact atomic int8_t object with `value` if `value` is larger with the specified memory order.
+ * The object is not modified when it already holds the larger value.
+ * @param atomic pointer to a compact atomic int8_t object
+ * @param value the bound to be applied
+ * @param order memory order of the operation when the object is modified; the check alone is a load of the corresponding order
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API int8_t ZennyAtomicByteMaxExplicit(volatile struct ZennyAtomicByte *atomic, int8_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Replace the value of a compact atomic int16_t object with `value` if `value` is larger with the specified memory order.
+ * The object is not modified when it already holds the larger value.
+ * @param atomic pointer to a compact atomic int16_t object
+ * @param value the bound to be applied
+ * @param order memory order of the operation when the object is modified; the check alone is a load of the corresponding order
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API int16_t ZennyAtomicShortMaxExplicit(volatile struct ZennyAtomicShort *atomic, int16_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Replace the value of a compact atomic int8_t object with `value` if `value` is larger when both are compared as unsigned with the specified memory order.
+ * The object is not modified when it already holds the larger value.
+ * @param atomic pointer to a compact atomic int8_t object
+ * @param value the bound to be applied
+ * @param order memory order of the operation when the object is modified; the check alone is a load of the corresponding order
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API uint8_t ZennyAtomicByteMaxUnsignedExplicit(volatile struct ZennyAtomicByte *atomic, uint8_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Replace the value of a compact atomic int16_t object with `value` if `value` is larger when both are compared as unsigned with the specified memory order.
+ * The object is not modified when it already holds the larger value.
+ * @param atomic pointer to a compact atomic int16_t object
+ * @param value the bound to be applied
+ * @param order memory order of the operation when the object is modified; the check alone is a load of the corresponding order
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API uint16_t ZennyAtomicShortMaxUnsignedExplicit(volatile struct ZennyAtomicShort *atomic, uint16_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Replace the value of a compact atomic int object with `value` if `value` is smaller with the specified memory order.
+ * The object is not modified when it already holds the smaller value.
+ * @param atomic pointer to a compact atomic int object
+ * @param value the bound to be applied
+ * @param order memory order of the operation when the object is modified; the check alone is a load of the corresponding order
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API int ZennyAtomicIntMinExplicit(volatile struct ZennyAtomicInt *atomic, int value, enum ZennyMemoryOrder order);
+
+/**
+ * Replace the value of a compact atomic int object with `value` if `value` is smaller when both are compared as unsigned with the specified memory order.
+ * The object is not modified when it already holds the smaller value.
+ * @param atomic pointer to a compact atomic int object
+ * @param value the bound to be applied
+ * @param order memory order of the operation when the object is modified; the check alone is a load of the corresponding order
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API unsigned ZennyAtomicIntMinUnsignedExplicit(volatile struct ZennyAtomicInt *atomic, unsigned value, enum ZennyMemoryOrder order);
+
+/**
+ * Replace the value of a compact atomic int object with `value` if `value` is larger with the specified memory order.
+ * The object is not modified when it already holds the larger value.
+ * @param atomic pointer to a compact atomic int object
+ * @param value the bound to be applied
+ * @param order memory order of the operation when the object is modified; the check alone is a load of the corresponding order
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API int ZennyAtomicIntMaxExplicit(volatile struct ZennyAtomicInt *atomic, int value, enum ZennyMemoryOrder order);
+
+/**
+ * Replace the value of a compact atomic int object with `value` if `value` is larger when both are compared as unsigned with the specified memory order.
+ * The object is not modified when it already holds the larger value.
+ * @param atomic pointer to a compact atomic int object
+ * @param value the bound to be applied
+ * @param order memory order of the operation when the object is modified; the check alone is a load of the corresponding order
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API unsigned ZennyAtomicIntMaxUnsignedExplicit(volatile struct ZennyAtomicInt *atomic, unsigned value, enum ZennyMemoryOrder order);
+
+/**
+ * Replace the value of a compact atomic int64_t object with `value` if `value` is smaller with the specified memory order.
+ * The object is not modified when it already holds the smaller value.
+ * @param atomic pointer to a compact atomic int64_t object
+ * @param value the bound to be applied
+ * @param order memory order of the operation when the object is modified; the check alone is a load of the corresponding order
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API int64_t ZennyAtomicLongMinExplicit(volatile struct ZennyAtomicLong *atomic, int64_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Replace the value of a compact atomic int64_t object with `value` if `value` is smaller when both are compared as unsigned with the specified memory order.
+ * The object is not modified when it already holds the smaller value.
+ * @param atomic pointer to a compact atomic int64_t object
+ * @param value the bound to be applied
+ * @param order memory order of the operation when the object is modified; the check alone is a load of the corresponding order
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API uint64_t ZennyAtomicLongMinUnsignedExplicit(volatile struct ZennyAtomicLong *atomic, uint64_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Replace the value of a compact atomic int64_t object with `value` if `value` is larger with the specified memory order.
+ * The object is not modified when it already holds the larger value.
+ * @param atomic pointer to a compact atomic int64_t object
+ * @param value the bound to be applied
+ * @param order memory order of the operation when the object is modified; the check alone is a load of the corresponding order
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API int64_t ZennyAtomicLongMaxExplicit(volatile struct ZennyAtomicLong *atomic, int64_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Replace the value of a compact atomic int64_t object with `value` if `value` is larger when both are compared as unsigned with the specified memory order.
+ * The object is not modified when it already holds the larger value.
+ * @param atomic pointer to a compact atomic int64_t object
+ * @param value the bound to be applied
+ * @param order memory order of the operation when the object is modified; the check alone is a load of the corresponding order
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API uint64_t ZennyAtomicLongMaxUnsignedExplicit(volatile struct ZennyAtomicLong *atomic, uint64_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Replace the value of a compact atomic intptr_t object with `value` if `value` is smaller with the specified memory order.
+ * The object is not modified when it already holds the smaller value.
+ * @param atomic pointer to a compact atomic intptr_t object
+ * @param value the bound to be applied
+ * @param order memory order of the operation when the object is modified; the check alone is a load of the corresponding order
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API intptr_t ZennyAtomicPtrMinExplicit(volatile struct ZennyAtomicPtr *atomic, intptr_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Replace the value of a compact atomic intptr_t object with `value` if `value` is smaller when both are compared as unsigned with the specified memory order.
+ * The object is not modified when it already holds the smaller value.
+ * @param atomic pointer to a compact atomic intptr_t object
+ * @param value the bound to be applied
+ * @param order memory order of the operation when the object is modified; the check alone is a load of the corresponding order
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API uintptr_t ZennyAtomicPtrMinUnsignedExplicit(volatile struct ZennyAtomicPtr *atomic, uintptr_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Replace the value of a compact atomic intptr_t object with `value` if `value` is larger with the specified memory order.
+ * The object is not modified when it already holds the larger value.
+ * @param atomic pointer to a compact atomic intptr_t object
+ * @param value the bound to be applied
+ * @param order memory order of the operation when the object is modified; the check alone is a load of the corresponding order
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API intptr_t ZennyAtomicPtrMaxExplicit(volatile struct ZennyAtomicPtr *atomic, intptr_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Replace the value of a compact atomic intptr_t object with `value` if `value` is larger when both are compared as unsigned with the specified memory order.
+ * The object is not modified when it already holds the larger value.
+ * @param atomic pointer to a compact atomic intptr_t object
+ * @param value the bound to be applied
+ * @param order memory order of the operation when the object is modified; the check alone is a load of the corresponding order
+ * @return the value of the atomic object just before the operation
+ */
+ZENNY_ATOMICS_API uintptr_t ZennyAtomicPtrMaxUnsignedExplicit(volatile struct ZennyAtomicPtr *atomic, uintptr_t value, enum ZennyMemoryOrder order);
+
+// MARK: Compact operate and fetch with explicit memory order
+
+/**
+ * Add a value to a compact atomic int8_t object with the specified memory order
+ * @param atomic pointer to a compact atomic int8_t object
+ * @param value the value to be added
+ * @param order memory order of the operation
+ * @return the value of the atomic object just after the addition
+ */
+ZENNY_ATOMICS_API int8_t ZennyAtomicByteAddFetchExplicit(volatile struct ZennyAtomicByte *atomic, int8_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Add a value to a compact atomic int16_t object with the specified memory order
+ * @param atomic pointer to a compact atomic int16_t object
+ * @param value the value to be added
+ * @param order memory order of the operation
+ * @return the value of the atomic object just after the addition
+ */
+ZENNY_ATOMICS_API int16_t ZennyAtomicShortAddFetchExplicit(volatile struct ZennyAtomicShort *atomic, int16_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Add a value to a compact atomic int object with the specified memory order
+ * @param atomic pointer to a compact atomic int object
+ * @param value the value to be added
+ * @param order memory order of the operation
+ * @return the value of the atomic object just after the addition
+ */
+ZENNY_ATOMICS_API int ZennyAtomicIntAddFetchExplicit(volatile struct ZennyAtomicInt *atomic, int value, enum ZennyMemoryOrder order);
+
+/**
+ * Add a value to a compact atomic int64_t object with the specified memory order
+ * @param atomic pointer to a compact atomic int64_t object
+ * @param value the value to be added
+ * @param order memory order of the operation
+ * @return the value of the atomic object just after the addition
+ */
+ZENNY_ATOMICS_API int64_t ZennyAtomicLongAddFetchExplicit(volatile struct ZennyAtomicLong *atomic, int64_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Add a value to a compact atomic intptr_t object with the specified memory order
+ * @param atomic pointer to a compact atomic intptr_t object
+ * @param value the value to be added
+ * @param order memory order of the operation
+ * @return the value of the atomic object just after the addition
+ */
+ZENNY_ATOMICS_API intptr_t ZennyAtomicPtrAddFetchExplicit(volatile struct ZennyAtomicPtr *atomic, intptr_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Subtract a value from a compact atomic int8_t object with the specified memory order
+ * @param atomic pointer to a compact atomic int8_t object
+ * @param value the value to be subtracted
+ * @param order memory order of the operation
+ * @return the value of the atomic object just after the subtraction
+ */
+ZENNY_ATOMICS_API int8_t ZennyAtomicByteSubFetchExplicit(volatile struct ZennyAtomicByte *atomic, int8_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Subtract a value from a compact atomic int16_t object with the specified memory order
+ * @param atomic pointer to a compact atomic int16_t object
+ * @param value the value to be subtracted
+ * @param order memory order of the operation
+ * @return the value of the atomic object just after the subtraction
+ */
+ZENNY_ATOMICS_API int16_t ZennyAtomicShortSubFetchExplicit(volatile struct ZennyAtomicShort *atomic, int16_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Subtract a value from a compact atomic int object with the specified memory order
+ * @param atomic pointer to a compact atomic int object
+ * @param value the value to be subtracted
+ * @param order memory order of the operation
+ * @return the value of the atomic object just after the subtraction
+ */
+ZENNY_ATOMICS_API int ZennyAtomicIntSubFetchExplicit(volatile struct ZennyAtomicInt *atomic, int value, enum ZennyMemoryOrder order);
+
+/**
+ * Subtract a value from a compact atomic int64_t object with the specified memory order
+ * @param atomic pointer to a compact atomic int64_t object
+ * @param value the value to be subtracted
+ * @param order memory order of the operation
+ * @return the value of the atomic object just after the subtraction
+ */
+ZENNY_ATOMICS_API int64_t ZennyAtomicLongSubFetchExplicit(volatile struct ZennyAtomicLong *atomic, int64_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Subtract a value from a compact atomic intptr_t object with the specified memory order
+ * @param atomic pointer to a compact atomic intptr_t object
+ * @param value the value to be subtracted
+ * @param order memory order of the operation
+ * @return the value of the atomic object just after the subtraction
+ */
+ZENNY_ATOMICS_API intptr_t ZennyAtomicPtrSubFetchExplicit(volatile struct ZennyAtomicPtr *atomic, intptr_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Bitwise OR a value into a compact atomic int8_t object with the specified memory order
+ * @param atomic pointer to a compact atomic int8_t object
+ * @param value the value to be ORed
+ * @param order memory order of the operation
+ * @return the value of the atomic object just after the bitwise OR
+ */
+ZENNY_ATOMICS_API int8_t ZennyAtomicByteOrFetchExplicit(volatile struct ZennyAtomicByte *atomic, int8_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Bitwise OR a value into a compact atomic int16_t object with the specified memory order
+ * @param atomic pointer to a compact atomic int16_t object
+ * @param value the value to be ORed
+ * @param order memory order of the operation
+ * @return the value of the atomic object just after the bitwise OR
+ */
+ZENNY_ATOMICS_API int16_t ZennyAtomicShortOrFetchExplicit(volatile struct ZennyAtomicShort *atomic, int16_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Bitwise OR a value into a compact atomic int object with the specified memory order
+ * @param atomic pointer to a compact atomic int object
+ * @param value the value to be ORed
+ * @param order memory order of the operation
+ * @return the value of the atomic object just after the bitwise OR
+ */
+ZENNY_ATOMICS_API int ZennyAtomicIntOrFetchExplicit(volatile struct ZennyAtomicInt *atomic, int value, enum ZennyMemoryOrder order);
+
+/**
+ * Bitwise OR a value into a compact atomic int64_t object with the specified memory order
+ * @param atomic pointer to a compact atomic int64_t object
+ * @param value the value to be ORed
+ * @param order memory order of the operation
+ * @return the value of the atomic object just after the bitwise OR
+ */
+ZENNY_ATOMICS_API int64_t ZennyAtomicLongOrFetchExplicit(volatile struct ZennyAtomicLong *atomic, int64_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Bitwise OR a value into a compact atomic intptr_t object with the specified memory order
+ * @param atomic pointer to a compact atomic intptr_t object
+ * @param value the value to be ORed
+ * @param order memory order of the operation
+ * @return the value of the atomic object just after the bitwise OR
+ */
+ZENNY_ATOMICS_API intptr_t ZennyAtomicPtrOrFetchExplicit(volatile struct ZennyAtomicPtr *atomic, intptr_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Bitwise AND a value into a compact atomic int8_t object with the specified memory order
+ * @param atomic pointer to a compact atomic int8_t object
+ * @param value the value to be ANDed
+ * @param order memory order of the operation
+ * @return the value of the atomic object just after the bitwise AND
+ */
+ZENNY_ATOMICS_API int8_t ZennyAtomicByteAndFetchExplicit(volatile struct ZennyAtomicByte *atomic, int8_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Bitwise AND a value into a compact atomic int16_t object with the specified memory order
+ * @param atomic pointer to a compact atomic int16_t object
+ * @param value the value to be ANDed
+ * @param order memory order of the operation
+ * @return the value of the atomic object just after the bitwise AND
+ */
+ZENNY_ATOMICS_API int16_t ZennyAtomicShortAndFetchExplicit(volatile struct ZennyAtomicShort *atomic, int16_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Bitwise AND a value into a compact atomic int object with the specified memory order
+ * @param atomic pointer to a compact atomic int object
+ * @param value the value to be ANDed
+ * @param order memory order of the operation
+ * @return the value of the atomic object just after the bitwise AND
+ */
+ZENNY_ATOMICS_API int ZennyAtomicIntAndFetchExplicit(volatile struct ZennyAtomicInt *atomic, int value, enum ZennyMemoryOrder order);
+
+/**
+ * Bitwise AND a value into a compact atomic int64_t object with the specified memory order
+ * @param atomic pointer to a compact atomic int64_t object
+ * @param value the value to be ANDed
+ * @param order memory order of the operation
+ * @return the value of the atomic object just after the bitwise AND
+ */
+ZENNY_ATOMICS_API int64_t ZennyAtomicLongAndFetchExplicit(volatile struct ZennyAtomicLong *atomic, int64_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Bitwise AND a value into a compact atomic intptr_t object with the specified memory order
+ * @param atomic pointer to a compact atomic intptr_t object
+ * @param value the value to be ANDed
+ * @param order memory order of the operation
+ * @return the value of the atomic object just after the bitwise AND
+ */
+ZENNY_ATOMICS_API intptr_t ZennyAtomicPtrAndFetchExplicit(volatile struct ZennyAtomicPtr *atomic, intptr_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Bitwise XOR a value into a compact atomic int8_t object with the specified memory order
+ * @param atomic pointer to a compact atomic int8_t object
+ * @param value the value to be XORed
+ * @param order memory order of the operation
+ * @return the value of the atomic object just after the bitwise XOR
+ */
+ZENNY_ATOMICS_API int8_t ZennyAtomicByteXorFetchExplicit(volatile struct ZennyAtomicByte *atomic, int8_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Bitwise XOR a value into a compact atomic int16_t object with the specified memory order
+ * @param atomic pointer to a compact atomic int16_t object
+ * @param value the value to be XORed
+ * @param order memory order of the operation
+ * @return the value of the atomic object just after the bitwise XOR
+ */
+ZENNY_ATOMICS_API int16_t ZennyAtomicShortXorFetchExplicit(volatile struct ZennyAtomicShort *atomic, int16_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Bitwise XOR a value into a compact atomic int object with the specified memory order
+ * @param atomic pointer to a compact atomic int object
+ * @param value the value to be XORed
+ * @param order memory order of the operation
+ * @return the value of the atomic object just after the bitwise XOR
+ */
+ZENNY_ATOMICS_API int ZennyAtomicIntXorFetchExplicit(volatile struct ZennyAtomicInt *atomic, int value, enum ZennyMemoryOrder order);
+
+/**
+ * Bitwise XOR a value into a compact atomic int64_t object with the specified memory order
+ * @param atomic pointer to a compact atomic int64_t object
+ * @param value the value to be XORed
+ * @param order memory order of the operation
+ * @return the value of the atomic object just after the bitwise XOR
+ */
+ZENNY_ATOMICS_API int64_t ZennyAtomicLongXorFetchExplicit(volatile struct ZennyAtomicLong *atomic, int64_t value, enum ZennyMemoryOrder order);
+
+/**
+ * Bitwise XOR a value into a compact atomic intptr_t object with the specified memory order
+ * @param atomic pointer to a compact atomic intptr_t object
+ * @param value the value to be XORed
+ * @param order memory order of the operation
+ * @return the value of the atomic object just after the bitwise XOR
+ */
+ZENNY_ATOMICS_API intptr_t ZennyAtomicPtrXorFetchExplicit(volatile struct ZennyAtomicPtr *atomic, intptr_t value, enum ZennyMemoryOrder order);
+
+// MARK: Compact unsigned atomics
+
+// Each unsigned compact type behaves like the signed compact type of the same width, and struct ZennyAtomicSize like
+// the unsigned one as wide as size_t. Arithmetic wraps around and Min/Max compare as unsigned.
+// The operations are documented on their signed counterparts.
+
+/** Operations on a compact atomic uint8_t object */
+ZENNY_ATOMICS_API void ZennyAtomicUByteInit(volatile struct ZennyAtomicUByte *atomic, uint8_t value);
+ZENNY_ATOMICS_API uint8_t ZennyAtomicUByteLoad(volatile struct ZennyAtomicUByte *atomic);
+ZENNY_ATOMICS_API void ZennyAtomicUByteStore(volatile struct ZennyAtomicUByte *atomic, uint8_t value);
+ZENNY_ATOMICS_API uint8_t ZennyAtomicUByteAdd(volatile struct ZennyAtomicUByte *atomic, uint8_t value);
+ZENNY_ATOMICS_API uint8_t ZennyAtomicUByteSub(volatile struct ZennyAtomicUByte *atomic, uint8_t value);
+ZENNY_ATOMICS_API uint8_t ZennyAtomicUByteOr(volatile struct ZennyAtomicUByte *atomic, uint8_t value);
+ZENNY_ATOMICS_API uint8_t ZennyAtomicUByteXor(volatile struct ZennyAtomicUByte *atomic, uint8_t value);
+ZENNY_ATOMICS_API uint8_t ZennyAtomicUByteAnd(volatile struct ZennyAtomicUByte *atomic, uint8_t value);
+ZENNY_ATOMICS_API uint8_t ZennyAtomicUByteExchange(volatile struct ZennyAtomicUByte *atomic, uint8_t value);
+ZENNY_ATOMICS_API bool ZennyAtomicUByteCompareExchange(volatile struct ZennyAtomicUByte *atomic, uint8_t *expected, uint8_t desired);
+ZENNY_ATOMICS_API bool ZennyAtomicUByteCompareExchangeWeak(volatile struct ZennyAtomicUByte *atomic, uint8_t *expected, uint8_t desired);
+ZENNY_ATOMICS_API uint8_t ZennyAtomicUByteMin(volatile struct ZennyAtomicUByte *atomic, uint8_t value);
+ZENNY_ATOMICS_API uint8_t ZennyAtomicUByteMax(volatile struct ZennyAtomicUByte *atomic, uint8_t value);
+ZENNY_ATOMICS_API uint8_t ZennyAtomicUByteAddFetch(volatile struct ZennyAtomicUByte *atomic, uint8_t value);
+ZENNY_ATOMICS_API uint8_t ZennyAtomicUByteSubFetch(volatile struct ZennyAtomicUByte *atomic, uint8_t value);
+ZENNY_ATOMICS_API uint8_t ZennyAtomicUByteOrFetch(volatile struct ZennyAtomicUByte *atomic, uint8_t value);
+ZENNY_ATOMICS_API uint8_t ZennyAtomicUByteAndFetch(volatile struct ZennyAtomicUByte *atomic, uint8_t value);
+ZENNY_ATOMICS_API uint8_t ZennyAtomicUByteXorFetch(volatile struct ZennyAtomicUByte *atomic, uint8_t value);
+ZENNY_ATOMICS_API uint8_t ZennyAtomicUByteLoadExplicit(volatile struct ZennyAtomicUByte *atomic, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API void ZennyAtomicUByteStoreExplicit(volatile struct ZennyAtomicUByte *atomic, uint8_t value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API uint8_t ZennyAtomicUByteAddExplicit(volatile struct ZennyAtomicUByte *atomic, uint8_t value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API uint8_t ZennyAtomicUByteSubExplicit(volatile struct ZennyAtomicUByte *atomic, uint8_t value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API uint8_t ZennyAtomicUByteOrExplicit(volatile struct ZennyAtomicUByte *atomic, uint8_t value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API uint8_t ZennyAtomicUByteXorExplicit(volatile struct ZennyAtomicUByte *atomic, uint8_t value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API uint8_t ZennyAtomicUByteAndExplicit(volatile struct ZennyAtomicUByte *atomic, uint8_t value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API uint8_t ZennyAtomicUByteExchangeExplicit(volatile struct ZennyAtomicUByte *atomic, uint8_t value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API bool ZennyAtomicUByteCompareExchangeExplicit(volatile struct ZennyAtomicUByte *atomic, uint8_t *expected, uint8_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure);
+ZENNY_ATOMICS_API bool ZennyAtomicUByteCompareExchangeWeakExplicit(volatile struct ZennyAtomicUByte *atomic, uint8_t *expected, uint8_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure);
+ZENNY_ATOMICS_API uint8_t ZennyAtomicUByteMinExplicit(volatile struct ZennyAtomicUByte *atomic, uint8_t value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API uint8_t ZennyAtomicUByteMaxExplicit(volatile struct ZennyAtomicUByte *atomic, uint8_t value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API uint8_t ZennyAtomicUByteAddFetchExplicit(volatile struct ZennyAtomicUByte *atomic, uint8_t value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API uint8_t ZennyAtomicUByteSubFetchExplicit(volatile struct ZennyAtomicUByte *atomic, uint8_t value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API uint8_t ZennyAtomicUByteOrFetchExplicit(volatile struct ZennyAtomicUByte *atomic, uint8_t value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API uint8_t ZennyAtomicUByteAndFetchExplicit(volatile struct ZennyAtomicUByte *atomic, uint8_t value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API uint8_t ZennyAtomicUByteXorFetchExplicit(volatile struct ZennyAtomicUByte *atomic, uint8_t value, enum ZennyMemoryOrder order);
+
+/** Operations on a compact atomic uint16_t object */
+ZENNY_ATOMICS_API void ZennyAtomicUShortInit(volatile struct ZennyAtomicUShort *atomic, uint16_t value);
+ZENNY_ATOMICS_API uint16_t ZennyAtomicUShortLoad(volatile struct ZennyAtomicUShort *atomic);
+ZENNY_ATOMICS_API void ZennyAtomicUShortStore(volatile struct ZennyAtomicUShort *atomic, uint16_t value);
+ZENNY_ATOMICS_API uint16_t ZennyAtomicUShortAdd(volatile struct ZennyAtomicUShort *atomic, uint16_t value);
+ZENNY_ATOMICS_API uint16_t ZennyAtomicUShortSub(volatile struct ZennyAtomicUShort *atomic, uint16_t value);
+ZENNY_ATOMICS_API uint16_t ZennyAtomicUShortOr(volatile struct ZennyAtomicUShort *atomic, uint16_t value);
+ZENNY_ATOMICS_API uint16_t ZennyAtomicUShortXor(volatile struct ZennyAtomicUShort *atomic, uint16_t value);
+ZENNY_ATOMICS_API uint16_t ZennyAtomicUShortAnd(volatile struct ZennyAtomicUShort *atomic, uint16_t value);
+ZENNY_ATOMICS_API uint16_t ZennyAtomicUShortExchange(volatile struct ZennyAtomicUShort *atomic, uint16_t value);
+ZENNY_ATOMICS_API bool ZennyAtomicUShortCompareExchange(volatile struct ZennyAtomicUShort *atomic, uint16_t *expected, uint16_t desired);
+ZENNY_ATOMICS_API bool ZennyAtomicUShortCompareExchangeWeak(volatile struct ZennyAtomicUShort *atomic, uint16_t *expected, uint16_t desired);
+ZENNY_ATOMICS_API uint16_t ZennyAtomicUShortMin(volatile struct ZennyAtomicUShort *atomic, uint16_t value);
+ZENNY_ATOMICS_API uint16_t ZennyAtomicUShortMax(volatile struct ZennyAtomicUShort *atomic, uint16_t value);
+ZENNY_ATOMICS_API uint16_t ZennyAtomicUShortAddFetch(volatile struct ZennyAtomicUShort *atomic, uint16_t value);
+ZENNY_ATOMICS_API uint16_t ZennyAtomicUShortSubFetch(volatile struct ZennyAtomicUShort *atomic, uint16_t value);
+ZENNY_ATOMICS_API uint16_t ZennyAtomicUShortOrFetch(volatile struct ZennyAtomicUShort *atomic, uint16_t value);
+ZENNY_ATOMICS_API uint16_t ZennyAtomicUShortAndFetch(volatile struct ZennyAtomicUShort *atomic, uint16_t value);
+ZENNY_ATOMICS_API uint16_t ZennyAtomicUShortXorFetch(volatile struct ZennyAtomicUShort *atomic, uint16_t value);
+ZENNY_ATOMICS_API uint16_t ZennyAtomicUShortLoadExplicit(volatile struct ZennyAtomicUShort *atomic, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API void ZennyAtomicUShortStoreExplicit(volatile struct ZennyAtomicUShort *atomic, uint16_t value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API uint16_t ZennyAtomicUShortAddExplicit(volatile struct ZennyAtomicUShort *atomic, uint16_t value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API uint16_t ZennyAtomicUShortSubExplicit(volatile struct ZennyAtomicUShort *atomic, uint16_t value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API uint16_t ZennyAtomicUShortOrExplicit(volatile struct ZennyAtomicUShort *atomic, uint16_t value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API uint16_t ZennyAtomicUShortXorExplicit(volatile struct ZennyAtomicUShort *atomic, uint16_t value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API uint16_t ZennyAtomicUShortAndExplicit(volatile struct ZennyAtomicUShort *atomic, uint16_t value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API uint16_t ZennyAtomicUShortExchangeExplicit(volatile struct ZennyAtomicUShort *atomic, uint16_t value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API bool ZennyAtomicUShortCompareExchangeExplicit(volatile struct ZennyAtomicUShort *atomic, uint16_t *expected, uint16_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure);
+ZENNY_ATOMICS_API bool ZennyAtomicUShortCompareExchangeWeakExplicit(volatile struct ZennyAtomicUShort *atomic, uint16_t *expected, uint16_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure);
+ZENNY_ATOMICS_API uint16_t ZennyAtomicUShortMinExplicit(volatile struct ZennyAtomicUShort *atomic, uint16_t value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API uint16_t ZennyAtomicUShortMaxExplicit(volatile struct ZennyAtomicUShort *atomic, uint16_t value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API uint16_t ZennyAtomicUShortAddFetchExplicit(volatile struct ZennyAtomicUShort *atomic, uint16_t value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API uint16_t ZennyAtomicUShortSubFetchExplicit(volatile struct ZennyAtomicUShort *atomic, uint16_t value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API uint16_t ZennyAtomicUShortOrFetchExplicit(volatile struct ZennyAtomicUShort *atomic, uint16_t value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API uint16_t ZennyAtomicUShortAndFetchExplicit(volatile struct ZennyAtomicUShort *atomic, uint16_t value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API uint16_t ZennyAtomicUShortXorFetchExplicit(volatile struct ZennyAtomicUShort *atomic, uint16_t value, enum ZennyMemoryOrder order);
+
+/** Operations on a compact atomic unsigned int object */
+ZENNY_ATOMICS_API void ZennyAtomicUIntInit(volatile struct ZennyAtomicUInt *atomic, unsigned value);
+ZENNY_ATOMICS_API unsigned ZennyAtomicUIntLoad(volatile struct ZennyAtomicUInt *atomic);
+ZENNY_ATOMICS_API void ZennyAtomicUIntStore(volatile struct ZennyAtomicUInt *atomic, unsigned value);
+ZENNY_ATOMICS_API unsigned ZennyAtomicUIntAdd(volatile struct ZennyAtomicUInt *atomic, unsigned value);
+ZENNY_ATOMICS_API unsigned ZennyAtomicUIntSub(volatile struct ZennyAtomicUInt *atomic, unsigned value);
+ZENNY_ATOMICS_API unsigned ZennyAtomicUIntOr(volatile struct ZennyAtomicUInt *atomic, unsigned value);
+ZENNY_ATOMICS_API unsigned ZennyAtomicUIntXor(volatile struct ZennyAtomicUInt *atomic, unsigned value);
+ZENNY_ATOMICS_API unsigned ZennyAtomicUIntAnd(volatile struct ZennyAtomicUInt *atomic, unsigned value);
+ZENNY_ATOMICS_API unsigned ZennyAtomicUIntExchange(volatile struct ZennyAtomicUInt *atomic, unsigned value);
+ZENNY_ATOMICS_API bool ZennyAtomicUIntCompareExchange(volatile struct ZennyAtomicUInt *atomic, unsigned *expected, unsigned desired);
+ZENNY_ATOMICS_API bool ZennyAtomicUIntCompareExchangeWeak(volatile struct ZennyAtomicUInt *atomic, unsigned *expected, unsigned desired);
+ZENNY_ATOMICS_API unsigned ZennyAtomicUIntMin(volatile struct ZennyAtomicUInt *atomic, unsigned value);
+ZENNY_ATOMICS_API unsigned ZennyAtomicUIntMax(volatile struct ZennyAtomicUInt *atomic, unsigned value);
+ZENNY_ATOMICS_API unsigned ZennyAtomicUIntAddFetch(volatile struct ZennyAtomicUInt *atomic, unsigned value);
+ZENNY_ATOMICS_API unsigned ZennyAtomicUIntSubFetch(volatile struct ZennyAtomicUInt *atomic, unsigned value);
+ZENNY_ATOMICS_API unsigned ZennyAtomicUIntOrFetch(volatile struct ZennyAtomicUInt *atomic, unsigned value);
+ZENNY_ATOMICS_API unsigned ZennyAtomicUIntAndFetch(volatile struct ZennyAtomicUInt *atomic, unsigned value);
+ZENNY_ATOMICS_API unsigned ZennyAtomicUIntXorFetch(volatile struct ZennyAtomicUInt *atomic, unsigned value);
+ZENNY_ATOMICS_API unsigned ZennyAtomicUIntLoadExplicit(volatile struct ZennyAtomicUInt *atomic, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API void ZennyAtomicUIntStoreExplicit(volatile struct ZennyAtomicUInt *atomic, unsigned value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API unsigned ZennyAtomicUIntAddExplicit(volatile struct ZennyAtomicUInt *atomic, unsigned value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API unsigned ZennyAtomicUIntSubExplicit(volatile struct ZennyAtomicUInt *atomic, unsigned value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API unsigned ZennyAtomicUIntOrExplicit(volatile struct ZennyAtomicUInt *atomic, unsigned value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API unsigned ZennyAtomicUIntXorExplicit(volatile struct ZennyAtomicUInt *atomic, unsigned value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API unsigned ZennyAtomicUIntAndExplicit(volatile struct ZennyAtomicUInt *atomic, unsigned value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API unsigned ZennyAtomicUIntExchangeExplicit(volatile struct ZennyAtomicUInt *atomic, unsigned value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API bool ZennyAtomicUIntCompareExchangeExplicit(volatile struct ZennyAtomicUInt *atomic, unsigned *expected, unsigned desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure);
+ZENNY_ATOMICS_API bool ZennyAtomicUIntCompareExchangeWeakExplicit(volatile struct ZennyAtomicUInt *atomic, unsigned *expected, unsigned desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure);
+ZENNY_ATOMICS_API unsigned ZennyAtomicUIntMinExplicit(volatile struct ZennyAtomicUInt *atomic, unsigned value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API unsigned ZennyAtomicUIntMaxExplicit(volatile struct ZennyAtomicUInt *atomic, unsigned value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API unsigned ZennyAtomicUIntAddFetchExplicit(volatile struct ZennyAtomicUInt *atomic, unsigned value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API unsigned ZennyAtomicUIntSubFetchExplicit(volatile struct ZennyAtomicUInt *atomic, unsigned value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API unsigned ZennyAtomicUIntOrFetchExplicit(volatile struct ZennyAtomicUInt *atomic, unsigned value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API unsigned ZennyAtomicUIntAndFetchExplicit(volatile struct ZennyAtomicUInt *atomic, unsigned value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API unsigned ZennyAtomicUIntXorFetchExplicit(volatile struct ZennyAtomicUInt *atomic, unsigned value, enum ZennyMemoryOrder order);
+
+/** Operations on a compact atomic uint64_t object */
+ZENNY_ATOMICS_API void ZennyAtomicULongInit(volatile struct ZennyAtomicULong *atomic, uint64_t value);
+ZENNY_ATOMICS_API uint64_t ZennyAtomicULongLoad(volatile struct ZennyAtomicULong *atomic);
+ZENNY_ATOMICS_API void ZennyAtomicULongStore(volatile struct ZennyAtomicULong *atomic, uint64_t value);
+ZENNY_ATOMICS_API uint64_t ZennyAtomicULongAdd(volatile struct ZennyAtomicULong *atomic, uint64_t value);
+ZENNY_ATOMICS_API uint64_t ZennyAtomicULongSub(volatile struct ZennyAtomicULong *atomic, uint64_t value);
+ZENNY_ATOMICS_API uint64_t ZennyAtomicULongOr(volatile struct ZennyAtomicULong *atomic, uint64_t value);
+ZENNY_ATOMICS_API uint64_t ZennyAtomicULongXor(volatile struct ZennyAtomicULong *atomic, uint64_t value);
+ZENNY_ATOMICS_API uint64_t ZennyAtomicULongAnd(volatile struct ZennyAtomicULong *atomic, uint64_t value);
+ZENNY_ATOMICS_API uint64_t ZennyAtomicULongExchange(volatile struct ZennyAtomicULong *atomic, uint64_t value);
+ZENNY_ATOMICS_API bool ZennyAtomicULongCompareExchange(volatile struct ZennyAtomicULong *atomic, uint64_t *expected, uint64_t desired);
+ZENNY_ATOMICS_API bool ZennyAtomicULongCompareExchangeWeak(volatile struct ZennyAtomicULong *atomic, uint64_t *expected, uint64_t desired);
+ZENNY_ATOMICS_API uint64_t ZennyAtomicULongMin(volatile struct ZennyAtomicULong *atomic, uint64_t value);
+ZENNY_ATOMICS_API uint64_t ZennyAtomicULongMax(volatile struct ZennyAtomicULong *atomic, uint64_t value);
+ZENNY_ATOMICS_API uint64_t ZennyAtomicULongAddFetch(volatile struct ZennyAtomicULong *atomic, uint64_t value);
+ZENNY_ATOMICS_API uint64_t ZennyAtomicULongSubFetch(volatile struct ZennyAtomicULong *atomic, uint64_t value);
+ZENNY_ATOMICS_API uint64_t ZennyAtomicULongOrFetch(volatile struct ZennyAtomicULong *atomic, uint64_t value);
+ZENNY_ATOMICS_API uint64_t ZennyAtomicULongAndFetch(volatile struct ZennyAtomicULong *atomic, uint64_t value);
+ZENNY_ATOMICS_API uint64_t ZennyAtomicULongXorFetch(volatile struct ZennyAtomicULong *atomic, uint64_t value);
+ZENNY_ATOMICS_API uint64_t ZennyAtomicULongLoadExplicit(volatile struct ZennyAtomicULong *atomic, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API void ZennyAtomicULongStoreExplicit(volatile struct ZennyAtomicULong *atomic, uint64_t value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API uint64_t ZennyAtomicULongAddExplicit(volatile struct ZennyAtomicULong *atomic, uint64_t value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API uint64_t ZennyAtomicULongSubExplicit(volatile struct ZennyAtomicULong *atomic, uint64_t value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API uint64_t ZennyAtomicULongOrExplicit(volatile struct ZennyAtomicULong *atomic, uint64_t value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API uint64_t ZennyAtomicULongXorExplicit(volatile struct ZennyAtomicULong *atomic, uint64_t value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API uint64_t ZennyAtomicULongAndExplicit(volatile struct ZennyAtomicULong *atomic, uint64_t value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API uint64_t ZennyAtomicULongExchangeExplicit(volatile struct ZennyAtomicULong *atomic, uint64_t value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API bool ZennyAtomicULongCompareExchangeExplicit(volatile struct ZennyAtomicULong *atomic, uint64_t *expected, uint64_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure);
+ZENNY_ATOMICS_API bool ZennyAtomicULongCompareExchangeWeakExplicit(volatile struct ZennyAtomicULong *atomic, uint64_t *expected, uint64_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure);
+ZENNY_ATOMICS_API uint64_t ZennyAtomicULongMinExplicit(volatile struct ZennyAtomicULong *atomic, uint64_t value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API uint64_t ZennyAtomicULongMaxExplicit(volatile struct ZennyAtomicULong *atomic, uint64_t value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API uint64_t ZennyAtomicULongAddFetchExplicit(volatile struct ZennyAtomicULong *atomic, uint64_t value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API uint64_t ZennyAtomicULongSubFetchExplicit(volatile struct ZennyAtomicULong *atomic, uint64_t value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API uint64_t ZennyAtomicULongOrFetchExplicit(volatile struct ZennyAtomicULong *atomic, uint64_t value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API uint64_t ZennyAtomicULongAndFetchExplicit(volatile struct ZennyAtomicULong *atomic, uint64_t value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API uint64_t ZennyAtomicULongXorFetchExplicit(volatile struct ZennyAtomicULong *atomic, uint64_t value, enum ZennyMemoryOrder order);
+
+/** Operations on a compact atomic size_t object */
+ZENNY_ATOMICS_API void ZennyAtomicSizeInit(volatile struct ZennyAtomicSize *atomic, size_t value);
+ZENNY_ATOMICS_API size_t ZennyAtomicSizeLoad(volatile struct ZennyAtomicSize *atomic);
+ZENNY_ATOMICS_API void ZennyAtomicSizeStore(volatile struct ZennyAtomicSize *atomic, size_t value);
+ZENNY_ATOMICS_API size_t ZennyAtomicSizeAdd(volatile struct ZennyAtomicSize *atomic, size_t value);
+ZENNY_ATOMICS_API size_t ZennyAtomicSizeSub(volatile struct ZennyAtomicSize *atomic, size_t value);
+ZENNY_ATOMICS_API size_t ZennyAtomicSizeOr(volatile struct ZennyAtomicSize *atomic, size_t value);
+ZENNY_ATOMICS_API size_t ZennyAtomicSizeXor(volatile struct ZennyAtomicSize *atomic, size_t value);
+ZENNY_ATOMICS_API size_t ZennyAtomicSizeAnd(volatile struct ZennyAtomicSize *atomic, size_t value);
+ZENNY_ATOMICS_API size_t ZennyAtomicSizeExchange(volatile struct ZennyAtomicSize *atomic, size_t value);
+ZENNY_ATOMICS_API bool ZennyAtomicSizeCompareExchange(volatile struct ZennyAtomicSize *atomic, size_t *expected, size_t desired);
+ZENNY_ATOMICS_API bool ZennyAtomicSizeCompareExchangeWeak(volatile struct ZennyAtomicSize *atomic, size_t *expected, size_t desired);
+ZENNY_ATOMICS_API size_t ZennyAtomicSizeMin(volatile struct ZennyAtomicSize *atomic, size_t value);
+ZENNY_ATOMICS_API size_t ZennyAtomicSizeMax(volatile struct ZennyAtomicSize *atomic, size_t value);
+ZENNY_ATOMICS_API size_t ZennyAtomicSizeAddFetch(volatile struct ZennyAtomicSize *atomic, size_t value);
+ZENNY_ATOMICS_API size_t ZennyAtomicSizeSubFetch(volatile struct ZennyAtomicSize *atomic, size_t value);
+ZENNY_ATOMICS_API size_t ZennyAtomicSizeOrFetch(volatile struct ZennyAtomicSize *atomic, size_t value);
+ZENNY_ATOMICS_API size_t ZennyAtomicSizeAndFetch(volatile struct ZennyAtomicSize *atomic, size_t value);
+ZENNY_ATOMICS_API size_t ZennyAtomicSizeXorFetch(volatile struct ZennyAtomicSize *atomic, size_t value);
+ZENNY_ATOMICS_API size_t ZennyAtomicSizeLoadExplicit(volatile struct ZennyAtomicSize *atomic, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API void ZennyAtomicSizeStoreExplicit(volatile struct ZennyAtomicSize *atomic, size_t value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API size_t ZennyAtomicSizeAddExplicit(volatile struct ZennyAtomicSize *atomic, size_t value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API size_t ZennyAtomicSizeSubExplicit(volatile struct ZennyAtomicSize *atomic, size_t value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API size_t ZennyAtomicSizeOrExplicit(volatile struct ZennyAtomicSize *atomic, size_t value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API size_t ZennyAtomicSizeXorExplicit(volatile struct ZennyAtomicSize *atomic, size_t value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API size_t ZennyAtomicSizeAndExplicit(volatile struct ZennyAtomicSize *atomic, size_t value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API size_t ZennyAtomicSizeExchangeExplicit(volatile struct ZennyAtomicSize *atomic, size_t value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API bool ZennyAtomicSizeCompareExchangeExplicit(volatile struct ZennyAtomicSize *atomic, size_t *expected, size_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure);
+ZENNY_ATOMICS_API bool ZennyAtomicSizeCompareExchangeWeakExplicit(volatile struct ZennyAtomicSize *atomic, size_t *expected, size_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure);
+ZENNY_ATOMICS_API size_t ZennyAtomicSizeMinExplicit(volatile struct ZennyAtomicSize *atomic, size_t value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API size_t ZennyAtomicSizeMaxExplicit(volatile struct ZennyAtomicSize *atomic, size_t value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API size_t ZennyAtomicSizeAddFetchExplicit(volatile struct ZennyAtomicSize *atomic, size_t value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API size_t ZennyAtomicSizeSubFetchExplicit(volatile struct ZennyAtomicSize *atomic, size_t value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API size_t ZennyAtomicSizeOrFetchExplicit(volatile struct ZennyAtomicSize *atomic, size_t value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API size_t ZennyAtomicSizeAndFetchExplicit(volatile struct ZennyAtomicSize *atomic, size_t value, enum ZennyMemoryOrder order);
+ZENNY_ATOMICS_API size_t ZennyAtomicSizeXorFetchExplicit(volatile struct ZennyAtomicSize *atomic, size_t value, enum ZennyMemoryOrder order);
+
+// MARK: Type-generic front end
+
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+
+/**
+ * Resolve to the compact operation `op` of the type `obj` points to, e.g. ZennyAtomicShortAdd for a struct ZennyAtomicShort.
+ * The selection happens at compile time, and an unsupported type is a compile error.
+ * `*(obj)` undergoes lvalue conversion, which drops the volatile and const qualifiers of the pointed-to type.
+ */
+#define ZENNY_ATOMICS_GENERIC(obj, op)  _Generic(*(obj),                    \
+    struct ZennyAtomicByte: ZennyAtomicByte##op,                        \
+    struct ZennyAtomicShort: ZennyAtomicShort##op,                      \
+    struct ZennyAtomicInt: ZennyAtomicInt##op,                          \
+    struct ZennyAtomicLong: ZennyAtomicLong##op,                        \
+    struct ZennyAtomicPtr: ZennyAtomicPtr##op,                          \
+    struct ZennyAtomicUByte: ZennyAtomicUByte##op,                      \
+    struct ZennyAtomicUShort: ZennyAtomicUShort##op,                    \
+    struct ZennyAtomicUInt: ZennyAtomicUInt##op,                        \
+    struct ZennyAtomicULong: ZennyAtomicULong##op,                      \
+    struct ZennyAtomicSize: ZennyAtomicSize##op)
+
+// Counterparts of the C11 <stdatomic.h> generic functions over the compact types.
+// zenny_atomic_fetch_min/max compare as signed or unsigned according to the type, and the *_fetch forms return the new value.
+#define zenny_atomic_init(obj, value)                    ZENNY_ATOMICS_GENERIC(obj, Init)(obj, value)
+#define zenny_atomic_load(obj)                           ZENNY_ATOMICS_GENERIC(obj, Load)(obj)
+#define zenny_atomic_load_explicit(obj, order)           ZENNY_ATOMICS_GENERIC(obj, LoadExplicit)(obj, order)
+#define zenny_atomic_store(obj, value)                   ZENNY_ATOMICS_GENERIC(obj, Store)(obj, value)
+#define zenny_atomic_store_explicit(obj, value, order)   ZENNY_ATOMICS_GENERIC(obj, StoreExplicit)(obj, value, order)
+#define zenny_atomic_exchange(obj, value)                ZENNY_ATOMICS_GENERIC(obj, Exchange)(obj, value)
+#define zenny_atomic_exchange_explicit(obj, value, order) ZENNY_ATOMICS_GENERIC(obj, ExchangeExplicit)(obj, value, order)
+#define zenny_atomic_compare_exchange_strong(obj, expected, desired) ZENNY_ATOMICS_GENERIC(obj, CompareExchange)(obj, expected, desired)
+#define zenny_atomic_compare_exchange_strong_explicit(obj, expected, desired, success, failure) ZENNY_ATOMICS_GENERIC(obj, CompareExchangeExplicit)(obj, expected, desired, success, failure)
+#define zenny_atomic_compare_exchange_weak(obj, expected, desired) ZENNY_ATOMICS_GENERIC(obj, CompareExchangeWeak)(obj, expected, desired)
+#define zenny_atomic_compare_exchange_weak_explicit(obj, expected, desired, success, failure) ZENNY_ATOMICS_GENERIC(obj, CompareExchangeWeakExplicit)(obj, expected, desired, success, failure)
+#define zenny_atomic_fetch_add(obj, value)               ZENNY_ATOMICS_GENERIC(obj, Add)(obj, value)
+#define zenny_atomic_fetch_add_explicit(obj, value, order) ZENNY_ATOMICS_GENERIC(obj, AddExplicit)(obj, value, order)
+#define zenny_atomic_fetch_sub(obj, value)               ZENNY_ATOMICS_GENERIC(obj, Sub)(obj, value)
+#define zenny_atomic_fetch_sub_explicit(obj, value, order) ZENNY_ATOMICS_GENERIC(obj, SubExplicit)(obj, value, order)
+#define zenny_atomic_fetch_or(obj, value)                ZENNY_ATOMICS_GENERIC(obj, Or)(obj, value)
+#define zenny_atomic_fetch_or_explicit(obj, value, order) ZENNY_ATOMICS_GENERIC(obj, OrExplicit)(obj, value, order)
+#define zenny_atomic_fetch_xor(obj, value)               ZENNY_ATOMICS_GENERIC(obj, Xor)(obj, value)
+#define zenny_atomic_fetch_xor_explicit(obj, value, order) ZENNY_ATOMICS_GENERIC(obj, XorExplicit)(obj, value, order)
+#define zenny_atomic_fetch_and(obj, value)               ZENNY_ATOMICS_GENERIC(obj, And)(obj, value)
+#define zenny_atomic_fetch_and_explicit(obj, value, order) ZENNY_ATOMICS_GENERIC(obj, AndExplicit)(obj, value, order)
+#define zenny_atomic_fetch_min(obj, value)               ZENNY_ATOMICS_GENERIC(obj, Min)(obj, value)
+#define zenny_atomic_fetch_min_explicit(obj, value, order) ZENNY_ATOMICS_GENERIC(obj, MinExplicit)(obj, value, order)
+#define zenny_atomic_fetch_max(obj, value)               ZENNY_ATOMICS_GENERIC(obj, Max)(obj, value)
+#define zenny_atomic_fetch_max_explicit(obj, value, order) ZENNY_ATOMICS_GENERIC(obj, MaxExplicit)(obj, value, order)
+#define zenny_atomic_add_fetch(obj, value)               ZENNY_ATOMICS_GENERIC(obj, AddFetch)(obj, value)
+#define zenny_atomic_add_fetch_explicit(obj, value, order) ZENNY_ATOMICS_GENERIC(obj, AddFetchExplicit)(obj, value, order)
+#define zenny_atomic_sub_fetch(obj, value)               ZENNY_ATOMICS_GENERIC(obj, SubFetch)(obj, value)
+#define zenny_atomic_sub_fetch_explicit(obj, value, order) ZENNY_ATOMICS_GENERIC(obj, SubFetchExplicit)(obj, value, order)
+#define zenny_atomic_or_fetch(obj, value)                ZENNY_ATOMICS_GENERIC(obj, OrFetch)(obj, value)
+#define zenny_atomic_or_fetch_explicit(obj, value, order) ZENNY_ATOMICS_GENERIC(obj, OrFetchExplicit)(obj, value, order)
+#define zenny_atomic_xor_fetch(obj, value)               ZENNY_ATOMICS_GENERIC(obj, XorFetch)(obj, value)
+#define zenny_atomic_xor_fetch_explicit(obj, value, order) ZENNY_ATOMICS_GENERIC(obj, XorFetchExplicit)(obj, value, order)
+#define zenny_atomic_and_fetch(obj, value)               ZENNY_ATOMICS_GENERIC(obj, AndFetch)(obj, value)
+#define zenny_atomic_and_fetch_explicit(obj, value, order) ZENNY_ATOMICS_GENERIC(obj, AndFetchExplicit)(obj, value, order)
+
+#endif // __STDC_VERSION__ >= 201112L
+
+// MARK: Backoff
+
+/** Policies of waiting between two attempts of a retry loop */
+enum ZennyAtomicBackoffPolicy
+{
+    /** retry immediately */
+    ZennyAtomicBackoffNone,
+
+    /** pause `minSpins` times before every retry */
+    ZennyAtomicBackoffConstant,
+
+    /** pause `minSpins` times before the first retry, doubling up to `maxSpins` */
+    ZennyAtomicBackoffExponential,
+
+    /** like ZennyAtomicBackoffExponential, but pause a random number of times up to the current bound */
+    ZennyAtomicBackoffJitter
+};
+
+/**
+ * State of the backoff of one retry loop. It lives on the stack of the retrying thread.
+ * Call ZennyAtomicBackoffSpin after every failed attempt, e.g. when a compare-exchange fails.
+ */
+struct ZennyAtomicBackoff
+{
+    enum ZennyAtomicBackoffPolicy policy;
+
+    /** pauses of the first wait */
+    unsigned minSpins;
+
+    /** upper bound of the pauses of one wait */
+    unsigned maxSpins;
+
+    /** after this many waits in a row, each wait also yields the processor; 0 never yields */
+    unsigned yieldAfter;
+
+    /** bound of the pauses of the next wait */
+    unsigned currentSpins;
+
+    /** number of waits since initialization or the last reset */
+    unsigned waits;
+
+    /** state of the pseudo-random generator used for jitter */
+    uint32_t seed;
+};
+
+/** Upper bound of the pauses of one wait in the retry loops inside this library */
+#define ZENNY_ATOMICS_BACKOFF_MAX_SPINS     64
+
+/**
+ * Yield the processor to another ready thread, if there is one.
+ */
+ZENNY_ATOMICS_API void ZennyAtomicYield(void);
+
+/**
+ * Initialize the backoff state of a retry loop
+ * @param backoff pointer to the backoff state
+ * @param policy how to wait between attempts
+ * @param minSpins pauses of the first wait, at least 1
+ * @param maxSpins upper bound of the pauses of one wait
+ * @param yieldAfter after this many waits in a row, each wait also yields the processor; 0 never yields
+ */
+ZENNY_ATOMICS_API void ZennyAtomicBackoffInit(struct ZennyAtomicBackoff *backoff, enum ZennyAtomicBackoffPolicy policy,
+                                              unsigned minSpins, unsigned maxSpins, unsigned yieldAfter);
+
+/**
+ * Wait according to the policy after a failed attempt, and advance the backoff state
+ * @param backoff pointer to the backoff state
+ */
+ZENNY_ATOMICS_API void ZennyAtomicBackoffSpin(struct ZennyAtomicBackoff *backoff);
+
+/**
+ * Return the backoff state to its initial bound, e.g. after an attempt has succeeded
+ * @param backoff pointer to the backoff state
+ */
+ZENNY_ATOMICS_API void ZennyAtomicBackoffReset(struct ZennyAtomicBackoff *backoff);
+
+// MARK: Pair (double-width) atomic operations
+
+/**
+ * Initialize both words of an atomic pair object
+ * @param atomic pointer to an atomic pair object
+ * @param value the initial value assigned to `atomic`
+ */
+ZENNY_ATOMICS_API void ZennyAtomicInitPair(volatile struct ZennyAtomicType *atomic, struct ZennyAtomicPair value);
+
+/**
+ * Load both words of an atomic pair object as one atomic unit.
+ * With a native double-width compare-and-swap, this is a read-modify-write, so `atomic` must be in writable memory.
+ * @param atomic pointer to an atomic pair object
+ * @return the value of the atomic object
+ */
+ZENNY_ATOMICS_API struct ZennyAtomicPair ZennyAtomicLoadPair(volatile struct ZennyAtomicType *atomic);
+
+/**
+ * Store a value to both words of an atomic pair object as one atomic unit
+ * @param atomic pointer to an atomic pair object
+ * @param value the value to be stored
+ */
+ZENNY_ATOMICS_API void ZennyAtomicStorePair(volatile struct ZennyAtomicType *atomic, struct ZennyAtomicPair value);
+
+/**
+ * Atomically store the specified value to both words of the atomic pair object
+ * and return the value of the atomic object just before the exchange operation.
+ * @param atomic pointer to an atomic pair object
+ * @param value the value used to exchange
+ * @return the value of the atomic object just before the exchange operation
+ */
+ZENNY_ATOMICS_API struct ZennyAtomicPair ZennyAtomicExchangePair(volatile struct ZennyAtomicType *atomic, struct ZennyAtomicPair value);
+
+/**
+ * Compare both words of the atomic pair object and the expected object.
+ * If they are equal, store the desired value to the atomic object and return true;
+ * Otherwise store the atomic object value to the expected object and return false.
+ * @param atomic pointer to an atomic pair object
+ * @param expected pointer to the expected object. It is commonly loaded from the atomic object.
+ * @param desired the value to be stored to the atomic object
+ * @return true, if the exchange happens; false otherwise.
+ */
+ZENNY_ATOMICS_API bool ZennyAtomicCompareExchangePair(volatile struct ZennyAtomicType *atomic, struct ZennyAtomicPair *expected, struct ZennyAtomicPair desired);
+
+/**
+ * Acquire the striped spin lock that guards `atomic` when ZENNY_ATOMICS_PAIR_LOCK_FREE is 0.
+ * It is used internally by the pair operations and is always provided by zenny_atomics.c.
+ * @param atomic pointer to an atomic pair object
+ */
+extern void ZennyAtomicPairLock(volatile struct ZennyAtomicType *atomic);
+
+/**
+ * Release the striped spin lock acquired by ZennyAtomicPairLock
+ * @param atomic pointer to an atomic pair object
+ */
+extern void ZennyAtomicPairUnlock(volatile struct ZennyAtomicType *atomic);
+
+// MARK: Wait and notify
+
+/**
+ * Block the calling thread until the value of the atomic int object is no longer `old`.
+ * The thread spins for a short while before it parks, and it is woken by ZennyAtomicNotifyOne or ZennyAtomicNotifyAll.
+ * These functions are always provided by zenny_atomics.c.
+ * @param atomic pointer to an atomic int object
+ * @param old the value to wait on
+ */
+extern void ZennyAtomicWaitInt(volatile struct ZennyAtomicType *atomic, int old);
+
+/**
+ * Block the calling thread until the value of the atomic flag object is no longer `old`.
+ * @param atomic pointer to an atomic flag object
+ * @param old the value to wait on
+ */
+extern void ZennyAtomicWaitFlag(volatile struct ZennyAtomicType *atomic, bool old);
+
+/**
+ * Block the calling thread until the value of the atomic pointer object is no longer `old`.
+ * @param atomic pointer to an atomic intptr_t object
+ * @param old the value to wait on
+ */
+extern void ZennyAtomicWaitPtr(volatile struct ZennyAtomicType *atomic, intptr_t old);
+
+/**
+ * Wake at least one thread blocked in a wait operation on the atomic object.
+ * Pointer waiters, and all waiters on platforms without futex or WaitOnAddress, share parking slots,
+ * so they may all be woken and go back to sleep if their value has not changed.
+ * Nothing beyond a fence and a load is done if no thread is waiting.
+ * @param atomic pointer to an atomic object that has just been modified
+ */
+extern void ZennyAtomicNotifyOne(volatile struct ZennyAtomicType *atomic);
+
+/**
+ * Wake all threads blocked in a wait operation on the atomic object.
+ * @param atomic pointer to an atomic object that has just been modified
+ */
+extern void ZennyAtomicNotifyAll(volatile struct ZennyAtomicType *atomic);
+
+// MARK: Cache-line aligned allocation
+
+/**
+ * Allocate zero-filled memory aligned to ZENNY_ATOMICS_CACHE_LINE_SIZE.
+ * The size is rounded up to a multiple of ZENNY_ATOMICS_CACHE_LINE_SIZE,
+ * so the block does not share its last cache line with any other allocation.
+ * This function is always provided by zenny_atomics.c.
+ * @param size number of bytes to allocate
+ * @return pointer to the allocated memory, or NULL on failure. Release it with ZennyAtomicFreeCacheAligned.
+ */
+extern void* ZennyAtomicAllocCacheAligned(size_t size);
+
+/**
+ * Release memory allocated by ZennyAtomicAllocCacheAligned
+ * @param memory pointer returned by ZennyAtomicAllocCacheAligned, or NULL
+ */
+extern void ZennyAtomicFreeCacheAligned(void *memory);
+
+/**
+ * Allocate an array of padded atomic objects, each on its own cache line.
+ * All objects are zero-filled, which is a valid initial state for a value of 0 or a clear flag.
+ * @param count number of elements
+ * @return pointer to the first element, or NULL on failure. Release it with ZennyAtomicFreePaddedArray.
+ */
+extern struct ZennyAtomicPaddedType* ZennyAtomicAllocPaddedArray(size_t count);
+
+/**
+ * Release an array allocated by ZennyAtomicAllocPaddedArray
+ * @param array pointer returned by ZennyAtomicAllocPaddedArray, or NULL
+ */
+extern void ZennyAtomicFreePaddedArray(struct ZennyAtomicPaddedType *array);
+
+/**
+ * Round a count up to a power of two, e.g. to size a ring buffer or a set of stripes that are indexed with a mask.
+ * This function is always provided by zenny_atomics.c.
+ * @param value the count to round; 0 rounds to 1
+ * @return the smallest power of two not below `value`, or 0 if it does not fit in size_t.
+ */
+extern size_t ZennyAtomicRoundUpPowerOfTwo(size_t value);
+
+// MARK: Thread utilities
+
+/**
+ * Get the number of online processors.
+ * This function is always provided by zenny_atomics.c.
+ * @return the number of online processors, at least 1
+ */
+extern int ZennyAtomicProcessorCount(void);
+
+/**
+ * Get a small index that identifies the calling thread.
+ * Indices are handed out 0, 1, 2, ... in the order threads first call this function and are never reused,
+ * which makes them suitable for spreading threads over stripes or slots.
+ * This function is always provided by zenny_atomics.c.
+ * @return the index of the calling thread
+ */
+extern unsigned ZennyAtomicThreadIndex(void);
+
+#ifdef ZENNY_ATOMICS_HEADER_ONLY
+#include "zenny_atomics_impl.h"
+#endif
 
 #endif /* zenny_atomics_h */
 
@@ -0,0 +1,5446 @@
+//
+//  zenny_atomics_impl.h
+//  ZennyAtomics
+//
+//  Created by Zenny Chen on 2019/2/4.
+//  Copyright © 2019 Zenny Chen. All rights reserved.
+//
+
+// Implementation of the operations declared in zenny_atomics.h.
+// It is compiled into zenny_atomics.c for the library build,
+// or pulled into zenny_atomics.h itself when ZENNY_ATOMICS_HEADER_ONLY is defined.
+
+#ifndef zenny_atomics_impl_h
+#define zenny_atomics_impl_h
+
+#ifndef zenny_atomics_h
+#error "Do not include zenny_atomics_impl.h directly. Include zenny_atomics.h instead."
+#endif
+
+#ifdef ZENNY_ATOMICS_HEADER_ONLY
+#define ZENNY_ATOMICS_IMPL  ZENNY_ATOMICS_API
+#else
+#define ZENNY_ATOMICS_IMPL
+#endif
+
+#ifdef _MSC_VER
+#define ZENNY_ATOMICS_PRIVATE   static __inline
+#else
+#define ZENNY_ATOMICS_PRIVATE   static inline
+#endif
+
+/**
+ * Wait after a failed compare-exchange of a retry loop.
+ * The backoff state is only set up on the first failure, so that an uncontended operation never touches it.
+ * @param backoff backoff state of the loop
+ * @param backingOff false before the first failure of the loop; set by this function
+ */
+ZENNY_ATOMICS_PRIVATE void ZennyAtomicRetryBackoff(struct ZennyAtomicBackoff *backoff, bool *backingOff)
+{
+    if (!*backingOff)
+    {
+        ZennyAtomicBackoffInit(backoff, ZennyAtomicBackoffExponential, 1, ZENNY_ATOMICS_BACKOFF_MAX_SPINS, 0);
+        *backingOff = true;
+    }
+
+    ZennyAtomicBackoffSpin(backoff);
+}
+
+#ifdef _MSC_VER
+
+#include <intrin.h>
+
+// MARK: Initialization
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicInitByte(volatile struct ZennyAtomicType *atomic, int8_t value)
+{
+    *(volatile int8_t*)atomic = value;
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicInitInt(volatile struct ZennyAtomicType *atomic, int value)
+{
+    *(volatile int*)atomic = value;
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicInitLong(volatile struct ZennyAtomicType *atomic, int64_t value)
+{
+    *(volatile int64_t*)atomic = value;
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicInitPtr(volatile struct ZennyAtomicType *atomic, intptr_t value)
+{
+    *(volatile intptr_t*)atomic = value;
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicInitFlag(volatile struct ZennyAtomicType *atomic)
+{
+    *(volatile bool*)atomic = false;
+}
+
+// MARK: Load
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicLoadByte(volatile struct ZennyAtomicType *atomic)
+{
+    return *(volatile int8_t*)atomic;
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicLoadInt(volatile struct ZennyAtomicType *atomic)
+{
+    return *(volatile int*)atomic;
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicLoadLong(volatile struct ZennyAtomicType* atomic)
+{
+    return *(volatile int64_t*)atomic;
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicLoadPtr(volatile struct ZennyAtomicType* atomic)
+{
+    return *(volatile intptr_t*)atomic;
+}
+
+// MARK: Flag atomic operations
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicLoadFlag(volatile struct ZennyAtomicType *atomic)
+{
+    return *(volatile bool*)atomic;
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicTestAndSetFlag(volatile struct ZennyAtomicType *atomic)
+{
+    return _interlockedbittestandset((long*)atomic, 1);
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicClearFlag(volatile struct ZennyAtomicType *atomic)
+{
+    _InterlockedExchange8((char*)atomic, 0);
+}
+
+// MARK: Store
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicStoreByte(volatile struct ZennyAtomicType *atomic, int8_t value)
+{
+    *(volatile int8_t*)atomic = value;
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicStoreInt(volatile struct ZennyAtomicType *atomic, int value)
+{
+    *(volatile int*)atomic = value;
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicStoreLong(volatile struct ZennyAtomicType *atomic, int64_t value)
+{
+    *(volatile int64_t*)atomic = value;
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicStorePtr(volatile struct ZennyAtomicType *atomic, intptr_t value)
+{
+    *(volatile intptr_t*)atomic = value;
+}
+
+// MARK: Add
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicAddByte(volatile struct ZennyAtomicType *atomic, int8_t value)
+{
+    int8_t comparand;
+    int8_t desired;
+    bool successful;
+    struct ZennyAtomicBackoff backoff;
+    bool backingOff = false;
+
+    do
+    {
+        comparand = *(volatile int8_t*)atomic;
+        desired = comparand + value;
+        const int8_t dstValue = _InterlockedCompareExchange8((volatile char*)atomic, desired, comparand);
+        successful = dstValue == comparand;
+        if (!successful)
+            ZennyAtomicRetryBackoff(&backoff, &backingOff);
+    } while (!successful);
+
+    return comparand;
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicAddInt(volatile struct ZennyAtomicType *atomic, int value)
+{
+    long comparand;
+    long desired;
+    bool successful;
+    struct ZennyAtomicBackoff backoff;
+    bool backingOff = false;
+
+    do
+    {
+        comparand = *(volatile long*)atomic;
+        desired = comparand + value;
+        const long dstValue = _InterlockedCompareExchange((volatile long*)atomic, desired, comparand);
+        successful = dstValue == comparand;
+        if (!successful)
+            ZennyAtomicRetryBackoff(&backoff, &backingOff);
+    } while (!successful);
+
+    return comparand;
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicAddLong(volatile struct ZennyAtomicType *atomic, int64_t value)
+{
+    int64_t comparand;
+    int64_t desired;
+    bool successful;
+    struct ZennyAtomicBackoff backoff;
+    bool backingOff = false;
+
+    do
+    {
+        comparand = *(volatile int64_t*)atomic;
+        desired = comparand + value;
+        const int64_t dstValue = _InterlockedCompareExchange64((volatile int64_t*)atomic, desired, comparand);
+        successful = dstValue == comparand;
+        if (!successful)
+            ZennyAtomicRetryBackoff(&backoff, &backingOff);
+    } while (!successful);
+
+    return comparand;
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicAddPtr(volatile struct ZennyAtomicType *atomic, intptr_t value)
+{
+    intptr_t comparand;
+    intptr_t desired;
+    bool successful;
+    struct ZennyAtomicBackoff backoff;
+    bool backingOff = false;
+
+    do
+    {
+        comparand = *(volatile intptr_t*)atomic;
+        desired = comparand + value;
+        const intptr_t dstValue = (intptr_t)_InterlockedCompareExchangePointer((void* volatile *)atomic, (void*)desired, (void*)comparand);
+        successful = dstValue == comparand;
+        if (!successful)
+            ZennyAtomicRetryBackoff(&backoff, &backingOff);
+    } while (!successful);
+
+    return comparand;
+}
+
+// MARK: Subtract
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicSubByte(volatile struct ZennyAtomicType *atomic, int8_t value)
+{
+    int8_t comparand;
+    int8_t desired;
+    bool successful;
+    struct ZennyAtomicBackoff backoff;
+    bool backingOff = false;
+
+    do
+    {
+        comparand = *(volatile int8_t*)atomic;
+        desired = comparand - value;
+        const int8_t dstValue = _InterlockedCompareExchange8((volatile char*)atomic, desired, comparand);
+        successful = dstValue == comparand;
+        if (!successful)
+            ZennyAtomicRetryBackoff(&backoff, &backingOff);
+    } while (!successful);
+
+    return comparand;
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicSubInt(volatile struct ZennyAtomicType *atomic, int value)
+{
+    long comparand;
+    long desired;
+    bool successful;
+    struct ZennyAtomicBackoff backoff;
+    bool backingOff = false;
+
+    do
+    {
+        comparand = *(volatile long*)atomic;
+        desired = comparand - value;
+        const long dstValue = _InterlockedCompareExchange((volatile long*)atomic, desired, comparand);
+        successful = dstValue == comparand;
+        if (!successful)
+            ZennyAtomicRetryBackoff(&backoff, &backingOff);
+    } while (!successful);
+
+    return comparand;
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicSubLong(volatile struct ZennyAtomicType *atomic, int64_t value)
+{
+    int64_t comparand;
+    int64_t desired;
+    bool successful;
+    struct ZennyAtomicBackoff backoff;
+    bool backingOff = false;
+
+    do
+    {
+        comparand = *(volatile int64_t*)atomic;
+        desired = comparand - value;
+        const int64_t dstValue = _InterlockedCompareExchange64((volatile int64_t*)atomic, desired, comparand);
+        successful = dstValue == comparand;
+        if (!successful)
+            ZennyAtomicRetryBackoff(&backoff, &backingOff);
+    } while (!successful);
+
+    return comparand;
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicSubPtr(volatile struct ZennyAtomicType *atomic, intptr_t value)
+{
+    intptr_t comparand;
+    intptr_t desired;
+    bool successful;
+    struct ZennyAtomicBackoff backoff;
+    bool backingOff = false;
+
+    do
+    {
+        comparand = *(volatile intptr_t*)atomic;
+        desired = comparand - value;
+        const intptr_t dstValue = (intptr_t)_InterlockedCompareExchangePointer((void* volatile *)atomic, (void*)desired, (void*)comparand);
+        successful = dstValue == comparand;
+        if (!successful)
+            ZennyAtomicRetryBackoff(&backoff, &backingOff);
+    } while (!successful);
+
+    return comparand;
+}
+
+// MARK: Bitwise OR
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicOrByte(volatile struct ZennyAtomicType *atomic, int8_t value)
+{
+    return _InterlockedOr8((volatile char*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicOrInt(volatile struct ZennyAtomicType *atomic, int value)
+{
+    return _InterlockedOr((volatile long*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicOrLong(volatile struct ZennyAtomicType *atomic, int64_t value)
+{
+    return _InterlockedOr64((volatile int64_t*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicOrPtr(volatile struct ZennyAtomicType *atomic, intptr_t value)
+{
+    return sizeof(intptr_t) == 8 ? _InterlockedOr64((volatile int64_t*)atomic, value) : _InterlockedOr((volatile long*)atomic, value);
+}
+
+// MARK: Bitwise XOR
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicXorByte(volatile struct ZennyAtomicType *atomic, int8_t value)
+{
+    return _InterlockedXor8((volatile char*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicXorInt(volatile struct ZennyAtomicType *atomic, int value)
+{
+    return _InterlockedXor((volatile long*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicXorLong(volatile struct ZennyAtomicType *atomic, int64_t value)
+{
+    return _InterlockedXor64((volatile int64_t*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicXorPtr(volatile struct ZennyAtomicType *atomic, intptr_t value)
+{
+    return sizeof(intptr_t) == 8 ? _InterlockedXor64((volatile int64_t*)atomic, value) : _InterlockedXor((volatile long*)atomic, value);
+}
+
+// MARK: Bitwise And
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicAndByte(volatile struct ZennyAtomicType *atomic, int8_t value)
+{
+    return _InterlockedAnd8((volatile char*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicAndInt(volatile struct ZennyAtomicType *atomic, int value)
+{
+    return _InterlockedAnd((volatile long*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicAndLong(volatile struct ZennyAtomicType *atomic, int64_t value)
+{
+    return _InterlockedAnd64((volatile int64_t*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicAndPtr(volatile struct ZennyAtomicType *atomic, intptr_t value)
+{
+    return sizeof(intptr_t) == 8 ? _InterlockedAnd64((volatile int64_t*)atomic, value) : _InterlockedAnd((volatile long*)atomic, value);
+}
+
+// MARK: Exchange
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicExchangeByte(volatile struct ZennyAtomicType *atomic, int8_t value)
+{
+    return _InterlockedExchange8((volatile char*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicExchangeInt(volatile struct ZennyAtomicType *atomic, int value)
+{
+    return _InterlockedExchange((volatile long*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicExchangeLong(volatile struct ZennyAtomicType *atomic, int64_t value)
+{
+    return _InterlockedExchange64((volatile int64_t*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicExchangePtr(volatile struct ZennyAtomicType *atomic, intptr_t value)
+{
+    return (intptr_t)_InterlockedExchangePointer((void* volatile *)atomic, (void*)value);
+}
+
+// MARK: Compare and Exchange
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicCompareExchangeByte(volatile struct ZennyAtomicType *atomic, int8_t *expected, int8_t desired)
+{
+    const int8_t dstValue = _InterlockedCompareExchange8((volatile char*)atomic, desired, *expected);
+    const bool successful = dstValue == *expected;
+    if (!successful)
+        *expected = dstValue;
+
+    return successful;
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicCompareExchangeInt(volatile struct ZennyAtomicType *atomic, int *expected, int desired)
+{
+    const long dstValue = _InterlockedCompareExchange((volatile long*)atomic, desired, *expected);
+    const bool successful = dstValue == *expected;
+    if (!successful)
+        *expected = dstValue;
+
+    return successful;
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicCompareExchangeLong(volatile struct ZennyAtomicType *atomic, int64_t *expected, int64_t desired)
+{
+    const int64_t dstValue = _InterlockedCompareExchange64((volatile int64_t*)atomic, desired, *expected);
+    const bool successful = dstValue == *expected;
+    if (!successful)
+        *expected = dstValue;
+
+    return successful;
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicCompareExchangePtr(volatile struct ZennyAtomicType *atomic, intptr_t *expected, intptr_t desired)
+{
+    const intptr_t dstValue = (intptr_t)_InterlockedCompareExchangePointer((void* volatile *)atomic, (void*)desired, (void*)*expected);
+    const bool successful = dstValue == *expected;
+    if (!successful)
+        *expected = dstValue;
+
+    return successful;
+}
+
+// MARK: Weak compare and exchange
+
+// Interlocked compare-exchange has no weak form, so the weak operations are the strong ones.
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicCompareExchangeWeakByte(volatile struct ZennyAtomicType *atomic, int8_t *expected, int8_t desired)
+{
+    return ZennyAtomicCompareExchangeByte(atomic, expected, desired);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicCompareExchangeWeakInt(volatile struct ZennyAtomicType *atomic, int *expected, int desired)
+{
+    return ZennyAtomicCompareExchangeInt(atomic, expected, desired);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicCompareExchangeWeakLong(volatile struct ZennyAtomicType *atomic, int64_t *expected, int64_t desired)
+{
+    return ZennyAtomicCompareExchangeLong(atomic, expected, desired);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicCompareExchangeWeakPtr(volatile struct ZennyAtomicType *atomic, intptr_t *expected, intptr_t desired)
+{
+    return ZennyAtomicCompareExchangePtr(atomic, expected, desired);
+}
+
+// MARK: Memory order
+
+// On ARM, interlocked intrinsics come in relaxed (_nf), acquire (_acq) and release (_rel) flavors.
+// On x86 and x64, every interlocked intrinsic is a full barrier, so the order is only honored by the compiler.
+#if defined(_M_ARM) || defined(_M_ARM64)
+#define ZENNY_MSVC_INTERLOCKED(func, order, ...)    ((order) == ZennyMemoryOrderRelaxed ? func##_nf(__VA_ARGS__) : \
+                                                    (order) == ZennyMemoryOrderConsume || (order) == ZennyMemoryOrderAcquire ? func##_acq(__VA_ARGS__) : \
+                                                    (order) == ZennyMemoryOrderRelease ? func##_rel(__VA_ARGS__) : func(__VA_ARGS__))
+#define ZENNY_MSVC_HARDWARE_FENCE()                 __dmb(0xB /* ISH */)
+#else
+#define ZENNY_MSVC_INTERLOCKED(func, order, ...)    ((void)(order), func(__VA_ARGS__))
+#define ZENNY_MSVC_HARDWARE_FENCE()                 _ReadWriteBarrier()
+#endif
+
+/** Fence to be issued just after a plain load of the specified order */
+static __inline void ZennyMSVCFenceAfterLoad(enum ZennyMemoryOrder order)
+{
+    if (order != ZennyMemoryOrderRelaxed)
+        ZENNY_MSVC_HARDWARE_FENCE();
+}
+
+/** Fence to be issued just before a plain store of the specified order */
+static __inline void ZennyMSVCFenceBeforeStore(enum ZennyMemoryOrder order)
+{
+    if (order != ZennyMemoryOrderRelaxed)
+        ZENNY_MSVC_HARDWARE_FENCE();
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicThreadFence(enum ZennyMemoryOrder order)
+{
+    if (order == ZennyMemoryOrderSeqCst)
+    {
+#if defined(_M_ARM) || defined(_M_ARM64)
+        __dmb(0xB /* ISH */);
+#else
+        _mm_mfence();
+#endif
+    }
+    else if (order != ZennyMemoryOrderRelaxed)
+        ZENNY_MSVC_HARDWARE_FENCE();
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicSignalFence(enum ZennyMemoryOrder order)
+{
+    if (order != ZennyMemoryOrderRelaxed)
+        _ReadWriteBarrier();
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicPause(void)
+{
+#if defined(_M_ARM) || defined(_M_ARM64)
+    __yield();
+#else
+    _mm_pause();
+#endif
+}
+
+// MARK: Load with explicit memory order
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicLoadByteExplicit(volatile struct ZennyAtomicType *atomic, enum ZennyMemoryOrder order)
+{
+    const int8_t value = *(volatile int8_t*)atomic;
+    ZennyMSVCFenceAfterLoad(order);
+    return value;
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicLoadIntExplicit(volatile struct ZennyAtomicType *atomic, enum ZennyMemoryOrder order)
+{
+    const int value = *(volatile int*)atomic;
+    ZennyMSVCFenceAfterLoad(order);
+    return value;
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicLoadLongExplicit(volatile struct ZennyAtomicType *atomic, enum ZennyMemoryOrder order)
+{
+    const int64_t value = *(volatile int64_t*)atomic;
+    ZennyMSVCFenceAfterLoad(order);
+    return value;
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicLoadPtrExplicit(volatile struct ZennyAtomicType *atomic, enum ZennyMemoryOrder order)
+{
+    const intptr_t value = *(volatile intptr_t*)atomic;
+    ZennyMSVCFenceAfterLoad(order);
+    return value;
+}
+
+// MARK: Flag atomic operations with explicit memory order
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicLoadFlagExplicit(volatile struct ZennyAtomicType *atomic, enum ZennyMemoryOrder order)
+{
+    const bool value = *(volatile bool*)atomic;
+    ZennyMSVCFenceAfterLoad(order);
+    return value;
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicTestAndSetFlagExplicit(volatile struct ZennyAtomicType *atomic, enum ZennyMemoryOrder order)
+{
+    return ZENNY_MSVC_INTERLOCKED(_interlockedbittestandset, order, (long*)atomic, 1);
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicClearFlagExplicit(volatile struct ZennyAtomicType *atomic, enum ZennyMemoryOrder order)
+{
+    if (order == ZennyMemoryOrderSeqCst)
+        _InterlockedExchange8((char*)atomic, 0);
+    else
+    {
+        ZennyMSVCFenceBeforeStore(order);
+        *(volatile bool*)atomic = false;
+    }
+}
+
+// MARK: Store with explicit memory order
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicStoreByteExplicit(volatile struct ZennyAtomicType *atomic, int8_t value, enum ZennyMemoryOrder order)
+{
+    if (order == ZennyMemoryOrderSeqCst)
+        _InterlockedExchange8((volatile char*)atomic, value);
+    else
+    {
+        ZennyMSVCFenceBeforeStore(order);
+        *(volatile int8_t*)atomic = value;
+    }
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicStoreIntExplicit(volatile struct ZennyAtomicType *atomic, int value, enum ZennyMemoryOrder order)
+{
+    if (order == ZennyMemoryOrderSeqCst)
+        _InterlockedExchange((volatile long*)atomic, value);
+    else
+    {
+        ZennyMSVCFenceBeforeStore(order);
+        *(volatile int*)atomic = value;
+    }
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicStoreLongExplicit(volatile struct ZennyAtomicType *atomic, int64_t value, enum ZennyMemoryOrder order)
+{
+    if (order == ZennyMemoryOrderSeqCst)
+        _InterlockedExchange64((volatile int64_t*)atomic, value);
+    else
+    {
+        ZennyMSVCFenceBeforeStore(order);
+        *(volatile int64_t*)atomic = value;
+    }
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicStorePtrExplicit(volatile struct ZennyAtomicType *atomic, intptr_t value, enum ZennyMemoryOrder order)
+{
+    if (order == ZennyMemoryOrderSeqCst)
+        _InterlockedExchangePointer((void* volatile *)atomic, (void*)value);
+    else
+    {
+        ZennyMSVCFenceBeforeStore(order);
+        *(volatile intptr_t*)atomic = value;
+    }
+}
+
+// MARK: Add with explicit memory order
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicAddByteExplicit(volatile struct ZennyAtomicType *atomic, int8_t value, enum ZennyMemoryOrder order)
+{
+    int8_t comparand;
+    int8_t desired;
+    bool successful;
+    struct ZennyAtomicBackoff backoff;
+    bool backingOff = false;
+
+    do
+    {
+        comparand = *(volatile int8_t*)atomic;
+        desired = comparand + value;
+        const int8_t dstValue = ZENNY_MSVC_INTERLOCKED(_InterlockedCompareExchange8, order, (volatile char*)atomic, desired, comparand);
+        successful = dstValue == comparand;
+        if (!successful)
+            ZennyAtomicRetryBackoff(&backoff, &backingOff);
+    } while (!successful);
+
+    return comparand;
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicAddIntExplicit(volatile struct ZennyAtomicType *atomic, int value, enum ZennyMemoryOrder order)
+{
+    long comparand;
+    long desired;
+    bool successful;
+    struct ZennyAtomicBackoff backoff;
+    bool backingOff = false;
+
+    do
+    {
+        comparand = *(volatile long*)atomic;
+        desired = comparand + value;
+        const long dstValue = ZENNY_MSVC_INTERLOCKED(_InterlockedCompareExchange, order, (volatile long*)atomic, desired, comparand);
+        successful = dstValue == comparand;
+        if (!successful)
+            ZennyAtomicRetryBackoff(&backoff, &backingOff);
+    } while (!successful);
+
+    return comparand;
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicAddLongExplicit(volatile struct ZennyAtomicType *atomic, int64_t value, enum ZennyMemoryOrder order)
+{
+    int64_t comparand;
+    int64_t desired;
+    bool successful;
+    struct ZennyAtomicBackoff backoff;
+    bool backingOff = false;
+
+    do
+    {
+        comparand = *(volatile int64_t*)atomic;
+        desired = comparand + value;
+        const int64_t dstValue = ZENNY_MSVC_INTERLOCKED(_InterlockedCompareExchange64, order, (volatile int64_t*)atomic, desired, comparand);
+        successful = dstValue == comparand;
+        if (!successful)
+            ZennyAtomicRetryBackoff(&backoff, &backingOff);
+    } while (!successful);
+
+    return comparand;
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicAddPtrExplicit(volatile struct ZennyAtomicType *atomic, intptr_t value, enum ZennyMemoryOrder order)
+{
+    intptr_t comparand;
+    intptr_t desired;
+    bool successful;
+    struct ZennyAtomicBackoff backoff;
+    bool backingOff = false;
+
+    do
+    {
+        comparand = *(volatile intptr_t*)atomic;
+        desired = comparand + value;
+        const intptr_t dstValue = (intptr_t)ZENNY_MSVC_INTERLOCKED(_InterlockedCompareExchangePointer, order, (void* volatile *)atomic, (void*)desired, (void*)comparand);
+        successful = dstValue == comparand;
+        if (!successful)
+            ZennyAtomicRetryBackoff(&backoff, &backingOff);
+    } while (!successful);
+
+    return comparand;
+}
+
+// MARK: Subtract with explicit memory order
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicSubByteExplicit(volatile struct ZennyAtomicType *atomic, int8_t value, enum ZennyMemoryOrder order)
+{
+    int8_t comparand;
+    int8_t desired;
+    bool successful;
+    struct ZennyAtomicBackoff backoff;
+    bool backingOff = false;
+
+    do
+    {
+        comparand = *(volatile int8_t*)atomic;
+        desired = comparand - value;
+        const int8_t dstValue = ZENNY_MSVC_INTERLOCKED(_InterlockedCompareExchange8, order, (volatile char*)atomic, desired, comparand);
+        successful = dstValue == comparand;
+        if (!successful)
+            ZennyAtomicRetryBackoff(&backoff, &backingOff);
+    } while (!successful);
+
+    return comparand;
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicSubIntExplicit(volatile struct ZennyAtomicType *atomic, int value, enum ZennyMemoryOrder order)
+{
+    long comparand;
+    long desired;
+    bool successful;
+    struct ZennyAtomicBackoff backoff;
+    bool backingOff = false;
+
+    do
+    {
+        comparand = *(volatile long*)atomic;
+        desired = comparand - value;
+        const long dstValue = ZENNY_MSVC_INTERLOCKED(_InterlockedCompareExchange, order, (volatile long*)atomic, desired, comparand);
+        successful = dstValue == comparand;
+        if (!successful)
+            ZennyAtomicRetryBackoff(&backoff, &backingOff);
+    } while (!successful);
+
+    return comparand;
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicSubLongExplicit(volatile struct ZennyAtomicType *atomic, int64_t value, enum ZennyMemoryOrder order)
+{
+    int64_t comparand;
+    int64_t desired;
+    bool successful;
+    struct ZennyAtomicBackoff backoff;
+    bool backingOff = false;
+
+    do
+    {
+        comparand = *(volatile int64_t*)atomic;
+        desired = comparand - value;
+        const int64_t dstValue = ZENNY_MSVC_INTERLOCKED(_InterlockedCompareExchange64, order, (volatile int64_t*)atomic, desired, comparand);
+        successful = dstValue == comparand;
+        if (!successful)
+            ZennyAtomicRetryBackoff(&backoff, &backingOff);
+    } while (!successful);
+
+    return comparand;
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicSubPtrExplicit(volatile struct ZennyAtomicType *atomic, intptr_t value, enum ZennyMemoryOrder order)
+{
+    intptr_t comparand;
+    intptr_t desired;
+    bool successful;
+    struct ZennyAtomicBackoff backoff;
+    bool backingOff = false;
+
+    do
+    {
+        comparand = *(volatile intptr_t*)atomic;
+        desired = comparand - value;
+        const intptr_t dstValue = (intptr_t)ZENNY_MSVC_INTERLOCKED(_InterlockedCompareExchangePointer, order, (void* volatile *)atomic, (void*)desired, (void*)comparand);
+        successful = dstValue == comparand;
+        if (!successful)
+            ZennyAtomicRetryBackoff(&backoff, &backingOff);
+    } while (!successful);
+
+    return comparand;
+}
+
+// MARK: Bitwise OR with explicit memory order
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicOrByteExplicit(volatile struct ZennyAtomicType *atomic, int8_t value, enum ZennyMemoryOrder order)
+{
+    return ZENNY_MSVC_INTERLOCKED(_InterlockedOr8, order, (volatile char*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicOrIntExplicit(volatile struct ZennyAtomicType *atomic, int value, enum ZennyMemoryOrder order)
+{
+    return ZENNY_MSVC_INTERLOCKED(_InterlockedOr, order, (volatile long*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicOrLongExplicit(volatile struct ZennyAtomicType *atomic, int64_t value, enum ZennyMemoryOrder order)
+{
+    return ZENNY_MSVC_INTERLOCKED(_InterlockedOr64, order, (volatile int64_t*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicOrPtrExplicit(volatile struct ZennyAtomicType *atomic, intptr_t value, enum ZennyMemoryOrder order)
+{
+    return sizeof(intptr_t) == 8 ? ZENNY_MSVC_INTERLOCKED(_InterlockedOr64, order, (volatile int64_t*)atomic, value) : ZENNY_MSVC_INTERLOCKED(_InterlockedOr, order, (volatile long*)atomic, value);
+}
+
+// MARK: Bitwise XOR with explicit memory order
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicXorByteExplicit(volatile struct ZennyAtomicType *atomic, int8_t value, enum ZennyMemoryOrder order)
+{
+    return ZENNY_MSVC_INTERLOCKED(_InterlockedXor8, order, (volatile char*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicXorIntExplicit(volatile struct ZennyAtomicType *atomic, int value, enum ZennyMemoryOrder order)
+{
+    return ZENNY_MSVC_INTERLOCKED(_InterlockedXor, order, (volatile long*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicXorLongExplicit(volatile struct ZennyAtomicType *atomic, int64_t value, enum ZennyMemoryOrder order)
+{
+    return ZENNY_MSVC_INTERLOCKED(_InterlockedXor64, order, (volatile int64_t*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicXorPtrExplicit(volatile struct ZennyAtomicType *atomic, intptr_t value, enum ZennyMemoryOrder order)
+{
+    return sizeof(intptr_t) == 8 ? ZENNY_MSVC_INTERLOCKED(_InterlockedXor64, order, (volatile int64_t*)atomic, value) : ZENNY_MSVC_INTERLOCKED(_InterlockedXor, order, (volatile long*)atomic, value);
+}
+
+// MARK: Bitwise And with explicit memory order
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicAndByteExplicit(volatile struct ZennyAtomicType *atomic, int8_t value, enum ZennyMemoryOrder order)
+{
+    return ZENNY_MSVC_INTERLOCKED(_InterlockedAnd8, order, (volatile char*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicAndIntExplicit(volatile struct ZennyAtomicType *atomic, int value, enum ZennyMemoryOrder order)
+{
+    return ZENNY_MSVC_INTERLOCKED(_InterlockedAnd, order, (volatile long*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicAndLongExplicit(volatile struct ZennyAtomicType *atomic, int64_t value, enum ZennyMemoryOrder order)
+{
+    return ZENNY_MSVC_INTERLOCKED(_InterlockedAnd64, order, (volatile int64_t*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicAndPtrExplicit(volatile struct ZennyAtomicType *atomic, intptr_t value, enum ZennyMemoryOrder order)
+{
+    return sizeof(intptr_t) == 8 ? ZENNY_MSVC_INTERLOCKED(_InterlockedAnd64, order, (volatile int64_t*)atomic, value) : ZENNY_MSVC_INTERLOCKED(_InterlockedAnd, order, (volatile long*)atomic, value);
+}
+
+// MARK: Exchange with explicit memory order
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicExchangeByteExplicit(volatile struct ZennyAtomicType *atomic, int8_t value, enum ZennyMemoryOrder order)
+{
+    return ZENNY_MSVC_INTERLOCKED(_InterlockedExchange8, order, (volatile char*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicExchangeIntExplicit(volatile struct ZennyAtomicType *atomic, int value, enum ZennyMemoryOrder order)
+{
+    return ZENNY_MSVC_INTERLOCKED(_InterlockedExchange, order, (volatile long*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicExchangeLongExplicit(volatile struct ZennyAtomicType *atomic, int64_t value, enum ZennyMemoryOrder order)
+{
+    return ZENNY_MSVC_INTERLOCKED(_InterlockedExchange64, order, (volatile int64_t*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicExchangePtrExplicit(volatile struct ZennyAtomicType *atomic, intptr_t value, enum ZennyMemoryOrder order)
+{
+    return (intptr_t)ZENNY_MSVC_INTERLOCKED(_InterlockedExchangePointer, order, (void* volatile *)atomic, (void*)value);
+}
+
+// MARK: Compare and Exchange with explicit memory order
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicCompareExchangeByteExplicit(volatile struct ZennyAtomicType *atomic, int8_t *expected, int8_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure)
+{
+    (void)failure;
+
+    const int8_t dstValue = ZENNY_MSVC_INTERLOCKED(_InterlockedCompareExchange8, success, (volatile char*)atomic, desired, *expected);
+    const bool successful = dstValue == *expected;
+    if (!successful)
+        *expected = dstValue;
+
+    return successful;
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicCompareExchangeIntExplicit(volatile struct ZennyAtomicType *atomic, int *expected, int desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure)
+{
+    (void)failure;
+
+    const long dstValue = ZENNY_MSVC_INTERLOCKED(_InterlockedCompareExchange, success, (volatile long*)atomic, desired, *expected);
+    const bool successful = dstValue == *expected;
+    if (!successful)
+        *expected = dstValue;
+
+    return successful;
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicCompareExchangeLongExplicit(volatile struct ZennyAtomicType *atomic, int64_t *expected, int64_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure)
+{
+    (void)failure;
+
+    const int64_t dstValue = ZENNY_MSVC_INTERLOCKED(_InterlockedCompareExchange64, success, (volatile int64_t*)atomic, desired, *expected);
+    const bool successful = dstValue == *expected;
+    if (!successful)
+        *expected = dstValue;
+
+    return successful;
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicCompareExchangePtrExplicit(volatile struct ZennyAtomicType *atomic, intptr_t *expected, intptr_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure)
+{
+    (void)failure;
+
+    const intptr_t dstValue = (intptr_t)ZENNY_MSVC_INTERLOCKED(_InterlockedCompareExchangePointer, success, (void* volatile *)atomic, (void*)desired, (void*)*expected);
+    const bool successful = dstValue == *expected;
+    if (!successful)
+        *expected = dstValue;
+
+    return successful;
+}
+
+// MARK: Weak compare and exchange with explicit memory order
+
+// Interlocked compare-exchange has no weak form, so the weak operations are the strong ones.
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicCompareExchangeWeakByteExplicit(volatile struct ZennyAtomicType *atomic, int8_t *expected, int8_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure)
+{
+    return ZennyAtomicCompareExchangeByteExplicit(atomic, expected, desired, success, failure);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicCompareExchangeWeakIntExplicit(volatile struct ZennyAtomicType *atomic, int *expected, int desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure)
+{
+    return ZennyAtomicCompareExchangeIntExplicit(atomic, expected, desired, success, failure);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicCompareExchangeWeakLongExplicit(volatile struct ZennyAtomicType *atomic, int64_t *expected, int64_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure)
+{
+    return ZennyAtomicCompareExchangeLongExplicit(atomic, expected, desired, success, failure);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicCompareExchangeWeakPtrExplicit(volatile struct ZennyAtomicType *atomic, intptr_t *expected, intptr_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure)
+{
+    return ZennyAtomicCompareExchangePtrExplicit(atomic, expected, desired, success, failure);
+}
+
+// MARK: Compact atomic flag
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicFlagInit(volatile struct ZennyAtomicFlag *atomic)
+{
+    atomic->value = false;
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicFlagLoad(volatile struct ZennyAtomicFlag *atomic)
+{
+    return ZennyAtomicFlagLoadExplicit(atomic, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicFlagTestAndSet(volatile struct ZennyAtomicFlag *atomic)
+{
+    return ZennyAtomicFlagTestAndSetExplicit(atomic, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicFlagClear(volatile struct ZennyAtomicFlag *atomic)
+{
+    ZennyAtomicFlagClearExplicit(atomic, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicFlagLoadExplicit(volatile struct ZennyAtomicFlag *atomic, enum ZennyMemoryOrder order)
+{
+    const bool value = atomic->value;
+    ZennyMSVCFenceAfterLoad(order);
+    return value;
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicFlagTestAndSetExplicit(volatile struct ZennyAtomicFlag *atomic, enum ZennyMemoryOrder order)
+{
+    // The flag is a single byte, so a bit test-and-set on a long would touch its neighbours
+    return ZENNY_MSVC_INTERLOCKED(_InterlockedExchange8, order, (volatile char*)&atomic->value, 1) != 0;
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicFlagClearExplicit(volatile struct ZennyAtomicFlag *atomic, enum ZennyMemoryOrder order)
+{
+    if (order == ZennyMemoryOrderSeqCst)
+        _InterlockedExchange8((volatile char*)&atomic->value, 0);
+    else
+    {
+        ZennyMSVCFenceBeforeStore(order);
+        atomic->value = false;
+    }
+}
+
+// MARK: Compact atomic int8_t
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicByteInit(volatile struct ZennyAtomicByte *atomic, int8_t value)
+{
+    atomic->value = value;
+}
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicByteLoad(volatile struct ZennyAtomicByte *atomic)
+{
+    return ZennyAtomicByteLoadExplicit(atomic, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicByteStore(volatile struct ZennyAtomicByte *atomic, int8_t value)
+{
+    ZennyAtomicByteStoreExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicByteAdd(volatile struct ZennyAtomicByte *atomic, int8_t value)
+{
+    return ZennyAtomicByteAddExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicByteSub(volatile struct ZennyAtomicByte *atomic, int8_t value)
+{
+    return ZennyAtomicByteSubExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicByteOr(volatile struct ZennyAtomicByte *atomic, int8_t value)
+{
+    return ZennyAtomicByteOrExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicByteXor(volatile struct ZennyAtomicByte *atomic, int8_t value)
+{
+    return ZennyAtomicByteXorExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicByteAnd(volatile struct ZennyAtomicByte *atomic, int8_t value)
+{
+    return ZennyAtomicByteAndExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicByteExchange(volatile struct ZennyAtomicByte *atomic, int8_t value)
+{
+    return ZennyAtomicByteExchangeExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicByteCompareExchange(volatile struct ZennyAtomicByte *atomic, int8_t *expected, int8_t desired)
+{
+    return ZennyAtomicByteCompareExchangeExplicit(atomic, expected, desired, ZennyMemoryOrderSeqCst, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicByteLoadExplicit(volatile struct ZennyAtomicByte *atomic, enum ZennyMemoryOrder order)
+{
+    const int8_t value = atomic->value;
+    ZennyMSVCFenceAfterLoad(order);
+    return value;
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicByteStoreExplicit(volatile struct ZennyAtomicByte *atomic, int8_t value, enum ZennyMemoryOrder order)
+{
+    if (order == ZennyMemoryOrderSeqCst)
+        _InterlockedExchange8((volatile char*)&atomic->value, value);
+    else
+    {
+        ZennyMSVCFenceBeforeStore(order);
+        atomic->value = value;
+    }
+}
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicByteAddExplicit(volatile struct ZennyAtomicByte *atomic, int8_t value, enum ZennyMemoryOrder order)
+{
+    int8_t comparand;
+    int8_t desired;
+    bool successful;
+    struct ZennyAtomicBackoff backoff;
+    bool backingOff = false;
+
+    do
+    {
+        comparand = atomic->value;
+        desired = comparand + value;
+        const int8_t dstValue = ZENNY_MSVC_INTERLOCKED(_InterlockedCompareExchange8, order, (volatile char*)&atomic->value, desired, comparand);
+        successful = dstValue == comparand;
+        if (!successful)
+            ZennyAtomicRetryBackoff(&backoff, &backingOff);
+    } while (!successful);
+
+    return comparand;
+}
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicByteSubExplicit(volatile struct ZennyAtomicByte *atomic, int8_t value, enum ZennyMemoryOrder order)
+{
+    int8_t comparand;
+    int8_t desired;
+    bool successful;
+    struct ZennyAtomicBackoff backoff;
+    bool backingOff = false;
+
+    do
+    {
+        comparand = atomic->value;
+        desired = comparand - value;
+        const int8_t dstValue = ZENNY_MSVC_INTERLOCKED(_InterlockedCompareExchange8, order, (volatile char*)&atomic->value, desired, comparand);
+        successful = dstValue == comparand;
+        if (!successful)
+            ZennyAtomicRetryBackoff(&backoff, &backingOff);
+    } while (!successful);
+
+    return comparand;
+}
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicByteOrExplicit(volatile struct ZennyAtomicByte *atomic, int8_t value, enum ZennyMemoryOrder order)
+{
+    return ZENNY_MSVC_INTERLOCKED(_InterlockedOr8, order, (volatile char*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicByteXorExplicit(volatile struct ZennyAtomicByte *atomic, int8_t value, enum ZennyMemoryOrder order)
+{
+    return ZENNY_MSVC_INTERLOCKED(_InterlockedXor8, order, (volatile char*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicByteAndExplicit(volatile struct ZennyAtomicByte *atomic, int8_t value, enum ZennyMemoryOrder order)
+{
+    return ZENNY_MSVC_INTERLOCKED(_InterlockedAnd8, order, (volatile char*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicByteExchangeExplicit(volatile struct ZennyAtomicByte *atomic, int8_t value, enum ZennyMemoryOrder order)
+{
+    return ZENNY_MSVC_INTERLOCKED(_InterlockedExchange8, order, (volatile char*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicByteCompareExchangeExplicit(volatile struct ZennyAtomicByte *atomic, int8_t *expected, int8_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure)
+{
+    (void)failure;
+
+    const int8_t dstValue = ZENNY_MSVC_INTERLOCKED(_InterlockedCompareExchange8, success, (volatile char*)&atomic->value, desired, *expected);
+    const bool successful = dstValue == *expected;
+    if (!successful)
+        *expected = dstValue;
+
+    return successful;
+}
+
+// MARK: Compact atomic int16_t
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicShortInit(volatile struct ZennyAtomicShort *atomic, int16_t value)
+{
+    atomic->value = value;
+}
+
+ZENNY_ATOMICS_IMPL int16_t ZennyAtomicShortLoad(volatile struct ZennyAtomicShort *atomic)
+{
+    return ZennyAtomicShortLoadExplicit(atomic, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicShortStore(volatile struct ZennyAtomicShort *atomic, int16_t value)
+{
+    ZennyAtomicShortStoreExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int16_t ZennyAtomicShortAdd(volatile struct ZennyAtomicShort *atomic, int16_t value)
+{
+    return ZennyAtomicShortAddExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int16_t ZennyAtomicShortSub(volatile struct ZennyAtomicShort *atomic, int16_t value)
+{
+    return ZennyAtomicShortSubExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int16_t ZennyAtomicShortOr(volatile struct ZennyAtomicShort *atomic, int16_t value)
+{
+    return ZennyAtomicShortOrExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int16_t ZennyAtomicShortXor(volatile struct ZennyAtomicShort *atomic, int16_t value)
+{
+    return ZennyAtomicShortXorExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int16_t ZennyAtomicShortAnd(volatile struct ZennyAtomicShort *atomic, int16_t value)
+{
+    return ZennyAtomicShortAndExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int16_t ZennyAtomicShortExchange(volatile struct ZennyAtomicShort *atomic, int16_t value)
+{
+    return ZennyAtomicShortExchangeExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicShortCompareExchange(volatile struct ZennyAtomicShort *atomic, int16_t *expected, int16_t desired)
+{
+    return ZennyAtomicShortCompareExchangeExplicit(atomic, expected, desired, ZennyMemoryOrderSeqCst, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int16_t ZennyAtomicShortLoadExplicit(volatile struct ZennyAtomicShort *atomic, enum ZennyMemoryOrder order)
+{
+    const int16_t value = atomic->value;
+    ZennyMSVCFenceAfterLoad(order);
+    return value;
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicShortStoreExplicit(volatile struct ZennyAtomicShort *atomic, int16_t value, enum ZennyMemoryOrder order)
+{
+    if (order == ZennyMemoryOrderSeqCst)
+        _InterlockedExchange16((volatile short*)&atomic->value, value);
+    else
+    {
+        ZennyMSVCFenceBeforeStore(order);
+        atomic->value = value;
+    }
+}
+
+ZENNY_ATOMICS_IMPL int16_t ZennyAtomicShortAddExplicit(volatile struct ZennyAtomicShort *atomic, int16_t value, enum ZennyMemoryOrder order)
+{
+    int16_t comparand;
+    int16_t desired;
+    bool successful;
+    struct ZennyAtomicBackoff backoff;
+    bool backingOff = false;
+
+    do
+    {
+        comparand = atomic->value;
+        desired = comparand + value;
+        const int16_t dstValue = ZENNY_MSVC_INTERLOCKED(_InterlockedCompareExchange16, order, (volatile short*)&atomic->value, desired, comparand);
+        successful = dstValue == comparand;
+        if (!successful)
+            ZennyAtomicRetryBackoff(&backoff, &backingOff);
+    } while (!successful);
+
+    return comparand;
+}
+
+ZENNY_ATOMICS_IMPL int16_t ZennyAtomicShortSubExplicit(volatile struct ZennyAtomicShort *atomic, int16_t value, enum ZennyMemoryOrder order)
+{
+    int16_t comparand;
+    int16_t desired;
+    bool successful;
+    struct ZennyAtomicBackoff backoff;
+    bool backingOff = false;
+
+    do
+    {
+        comparand = atomic->value;
+        desired = comparand - value;
+        const int16_t dstValue = ZENNY_MSVC_INTERLOCKED(_InterlockedCompareExchange16, order, (volatile short*)&atomic->value, desired, comparand);
+        successful = dstValue == comparand;
+        if (!successful)
+            ZennyAtomicRetryBackoff(&backoff, &backingOff);
+    } while (!successful);
+
+    return comparand;
+}
+
+ZENNY_ATOMICS_IMPL int16_t ZennyAtomicShortOrExplicit(volatile struct ZennyAtomicShort *atomic, int16_t value, enum ZennyMemoryOrder order)
+{
+    return ZENNY_MSVC_INTERLOCKED(_InterlockedOr16, order, (volatile short*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL int16_t ZennyAtomicShortXorExplicit(volatile struct ZennyAtomicShort *atomic, int16_t value, enum ZennyMemoryOrder order)
+{
+    return ZENNY_MSVC_INTERLOCKED(_InterlockedXor16, order, (volatile short*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL int16_t ZennyAtomicShortAndExplicit(volatile struct ZennyAtomicShort *atomic, int16_t value, enum ZennyMemoryOrder order)
+{
+    return ZENNY_MSVC_INTERLOCKED(_InterlockedAnd16, order, (volatile short*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL int16_t ZennyAtomicShortExchangeExplicit(volatile struct ZennyAtomicShort *atomic, int16_t value, enum ZennyMemoryOrder order)
+{
+    return ZENNY_MSVC_INTERLOCKED(_InterlockedExchange16, order, (volatile short*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicShortCompareExchangeExplicit(volatile struct ZennyAtomicShort *atomic, int16_t *expected, int16_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure)
+{
+    (void)failure;
+
+    const int16_t dstValue = ZENNY_MSVC_INTERLOCKED(_InterlockedCompareExchange16, success, (volatile short*)&atomic->value, desired, *expected);
+    const bool successful = dstValue == *expected;
+    if (!successful)
+        *expected = dstValue;
+
+    return successful;
+}
+
+// MARK: Compact atomic int
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicIntInit(volatile struct ZennyAtomicInt *atomic, int value)
+{
+    atomic->value = value;
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicIntLoad(volatile struct ZennyAtomicInt *atomic)
+{
+    return ZennyAtomicIntLoadExplicit(atomic, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicIntStore(volatile struct ZennyAtomicInt *atomic, int value)
+{
+    ZennyAtomicIntStoreExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicIntAdd(volatile struct ZennyAtomicInt *atomic, int value)
+{
+    return ZennyAtomicIntAddExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicIntSub(volatile struct ZennyAtomicInt *atomic, int value)
+{
+    return ZennyAtomicIntSubExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicIntOr(volatile struct ZennyAtomicInt *atomic, int value)
+{
+    return ZennyAtomicIntOrExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicIntXor(volatile struct ZennyAtomicInt *atomic, int value)
+{
+    return ZennyAtomicIntXorExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicIntAnd(volatile struct ZennyAtomicInt *atomic, int value)
+{
+    return ZennyAtomicIntAndExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicIntExchange(volatile struct ZennyAtomicInt *atomic, int value)
+{
+    return ZennyAtomicIntExchangeExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicIntCompareExchange(volatile struct ZennyAtomicInt *atomic, int *expected, int desired)
+{
+    return ZennyAtomicIntCompareExchangeExplicit(atomic, expected, desired, ZennyMemoryOrderSeqCst, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicIntLoadExplicit(volatile struct ZennyAtomicInt *atomic, enum ZennyMemoryOrder order)
+{
+    const int value = atomic->value;
+    ZennyMSVCFenceAfterLoad(order);
+    return value;
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicIntStoreExplicit(volatile struct ZennyAtomicInt *atomic, int value, enum ZennyMemoryOrder order)
+{
+    if (order == ZennyMemoryOrderSeqCst)
+        _InterlockedExchange((volatile long*)&atomic->value, value);
+    else
+    {
+        ZennyMSVCFenceBeforeStore(order);
+        atomic->value = value;
+    }
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicIntAddExplicit(volatile struct ZennyAtomicInt *atomic, int value, enum ZennyMemoryOrder order)
+{
+    long comparand;
+    long desired;
+    bool successful;
+    struct ZennyAtomicBackoff backoff;
+    bool backingOff = false;
+
+    do
+    {
+        comparand = atomic->value;
+        desired = comparand + value;
+        const long dstValue = ZENNY_MSVC_INTERLOCKED(_InterlockedCompareExchange, order, (volatile long*)&atomic->value, desired, comparand);
+        successful = dstValue == comparand;
+        if (!successful)
+            ZennyAtomicRetryBackoff(&backoff, &backingOff);
+    } while (!successful);
+
+    return comparand;
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicIntSubExplicit(volatile struct ZennyAtomicInt *atomic, int value, enum ZennyMemoryOrder order)
+{
+    long comparand;
+    long desired;
+    bool successful;
+    struct ZennyAtomicBackoff backoff;
+    bool backingOff = false;
+
+    do
+    {
+        comparand = atomic->value;
+        desired = comparand - value;
+        const long dstValue = ZENNY_MSVC_INTERLOCKED(_InterlockedCompareExchange, order, (volatile long*)&atomic->value, desired, comparand);
+        successful = dstValue == comparand;
+        if (!successful)
+            ZennyAtomicRetryBackoff(&backoff, &backingOff);
+    } while (!successful);
+
+    return comparand;
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicIntOrExplicit(volatile struct ZennyAtomicInt *atomic, int value, enum ZennyMemoryOrder order)
+{
+    return ZENNY_MSVC_INTERLOCKED(_InterlockedOr, order, (volatile long*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicIntXorExplicit(volatile struct ZennyAtomicInt *atomic, int value, enum ZennyMemoryOrder order)
+{
+    return ZENNY_MSVC_INTERLOCKED(_InterlockedXor, order, (volatile long*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicIntAndExplicit(volatile struct ZennyAtomicInt *atomic, int value, enum ZennyMemoryOrder order)
+{
+    return ZENNY_MSVC_INTERLOCKED(_InterlockedAnd, order, (volatile long*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicIntExchangeExplicit(volatile struct ZennyAtomicInt *atomic, int value, enum ZennyMemoryOrder order)
+{
+    return ZENNY_MSVC_INTERLOCKED(_InterlockedExchange, order, (volatile long*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicIntCompareExchangeExplicit(volatile struct ZennyAtomicInt *atomic, int *expected, int desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure)
+{
+    (void)failure;
+
+    const long dstValue = ZENNY_MSVC_INTERLOCKED(_InterlockedCompareExchange, success, (volatile long*)&atomic->value, desired, *expected);
+    const bool successful = dstValue == *expected;
+    if (!successful)
+        *expected = dstValue;
+
+    return successful;
+}
+
+// MARK: Compact atomic int64_t
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicLongInit(volatile struct ZennyAtomicLong *atomic, int64_t value)
+{
+    atomic->value = value;
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicLongLoad(volatile struct ZennyAtomicLong *atomic)
+{
+    return ZennyAtomicLongLoadExplicit(atomic, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicLongStore(volatile struct ZennyAtomicLong *atomic, int64_t value)
+{
+    ZennyAtomicLongStoreExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicLongAdd(volatile struct ZennyAtomicLong *atomic, int64_t value)
+{
+    return ZennyAtomicLongAddExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicLongSub(volatile struct ZennyAtomicLong *atomic, int64_t value)
+{
+    return ZennyAtomicLongSubExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicLongOr(volatile struct ZennyAtomicLong *atomic, int64_t value)
+{
+    return ZennyAtomicLongOrExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicLongXor(volatile struct ZennyAtomicLong *atomic, int64_t value)
+{
+    return ZennyAtomicLongXorExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicLongAnd(volatile struct ZennyAtomicLong *atomic, int64_t value)
+{
+    return ZennyAtomicLongAndExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicLongExchange(volatile struct ZennyAtomicLong *atomic, int64_t value)
+{
+    return ZennyAtomicLongExchangeExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicLongCompareExchange(volatile struct ZennyAtomicLong *atomic, int64_t *expected, int64_t desired)
+{
+    return ZennyAtomicLongCompareExchangeExplicit(atomic, expected, desired, ZennyMemoryOrderSeqCst, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicLongLoadExplicit(volatile struct ZennyAtomicLong *atomic, enum ZennyMemoryOrder order)
+{
+    const int64_t value = atomic->value;
+    ZennyMSVCFenceAfterLoad(order);
+    return value;
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicLongStoreExplicit(volatile struct ZennyAtomicLong *atomic, int64_t value, enum ZennyMemoryOrder order)
+{
+    if (order == ZennyMemoryOrderSeqCst)
+        _InterlockedExchange64((volatile int64_t*)&atomic->value, value);
+    else
+    {
+        ZennyMSVCFenceBeforeStore(order);
+        atomic->value = value;
+    }
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicLongAddExplicit(volatile struct ZennyAtomicLong *atomic, int64_t value, enum ZennyMemoryOrder order)
+{
+    int64_t comparand;
+    int64_t desired;
+    bool successful;
+    struct ZennyAtomicBackoff backoff;
+    bool backingOff = false;
+
+    do
+    {
+        comparand = atomic->value;
+        desired = comparand + value;
+        const int64_t dstValue = ZENNY_MSVC_INTERLOCKED(_InterlockedCompareExchange64, order, (volatile int64_t*)&atomic->value, desired, comparand);
+        successful = dstValue == comparand;
+        if (!successful)
+            ZennyAtomicRetryBackoff(&backoff, &backingOff);
+    } while (!successful);
+
+    return comparand;
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicLongSubExplicit(volatile struct ZennyAtomicLong *atomic, int64_t value, enum ZennyMemoryOrder order)
+{
+    int64_t comparand;
+    int64_t desired;
+    bool successful;
+    struct ZennyAtomicBackoff backoff;
+    bool backingOff = false;
+
+    do
+    {
+        comparand = atomic->value;
+        desired = comparand - value;
+        const int64_t dstValue = ZENNY_MSVC_INTERLOCKED(_InterlockedCompareExchange64, order, (volatile int64_t*)&atomic->value, desired, comparand);
+        successful = dstValue == comparand;
+        if (!successful)
+            ZennyAtomicRetryBackoff(&backoff, &backingOff);
+    } while (!successful);
+
+    return comparand;
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicLongOrExplicit(volatile struct ZennyAtomicLong *atomic, int64_t value, enum ZennyMemoryOrder order)
+{
+    return ZENNY_MSVC_INTERLOCKED(_InterlockedOr64, order, (volatile int64_t*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicLongXorExplicit(volatile struct ZennyAtomicLong *atomic, int64_t value, enum ZennyMemoryOrder order)
+{
+    return ZENNY_MSVC_INTERLOCKED(_InterlockedXor64, order, (volatile int64_t*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicLongAndExplicit(volatile struct ZennyAtomicLong *atomic, int64_t value, enum ZennyMemoryOrder order)
+{
+    return ZENNY_MSVC_INTERLOCKED(_InterlockedAnd64, order, (volatile int64_t*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicLongExchangeExplicit(volatile struct ZennyAtomicLong *atomic, int64_t value, enum ZennyMemoryOrder order)
+{
+    return ZENNY_MSVC_INTERLOCKED(_InterlockedExchange64, order, (volatile int64_t*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicLongCompareExchangeExplicit(volatile struct ZennyAtomicLong *atomic, int64_t *expected, int64_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure)
+{
+    (void)failure;
+
+    const int64_t dstValue = ZENNY_MSVC_INTERLOCKED(_InterlockedCompareExchange64, success, (volatile int64_t*)&atomic->value, desired, *expected);
+    const bool successful = dstValue == *expected;
+    if (!successful)
+        *expected = dstValue;
+
+    return successful;
+}
+
+// MARK: Compact atomic intptr_t
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicPtrInit(volatile struct ZennyAtomicPtr *atomic, intptr_t value)
+{
+    atomic->value = value;
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicPtrLoad(volatile struct ZennyAtomicPtr *atomic)
+{
+    return ZennyAtomicPtrLoadExplicit(atomic, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicPtrStore(volatile struct ZennyAtomicPtr *atomic, intptr_t value)
+{
+    ZennyAtomicPtrStoreExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicPtrAdd(volatile struct ZennyAtomicPtr *atomic, intptr_t value)
+{
+    return ZennyAtomicPtrAddExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicPtrSub(volatile struct ZennyAtomicPtr *atomic, intptr_t value)
+{
+    return ZennyAtomicPtrSubExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicPtrOr(volatile struct ZennyAtomicPtr *atomic, intptr_t value)
+{
+    return ZennyAtomicPtrOrExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicPtrXor(volatile struct ZennyAtomicPtr *atomic, intptr_t value)
+{
+    return ZennyAtomicPtrXorExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicPtrAnd(volatile struct ZennyAtomicPtr *atomic, intptr_t value)
+{
+    return ZennyAtomicPtrAndExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicPtrExchange(volatile struct ZennyAtomicPtr *atomic, intptr_t value)
+{
+    return ZennyAtomicPtrExchangeExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicPtrCompareExchange(volatile struct ZennyAtomicPtr *atomic, intptr_t *expected, intptr_t desired)
+{
+    return ZennyAtomicPtrCompareExchangeExplicit(atomic, expected, desired, ZennyMemoryOrderSeqCst, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicPtrLoadExplicit(volatile struct ZennyAtomicPtr *atomic, enum ZennyMemoryOrder order)
+{
+    const intptr_t value = atomic->value;
+    ZennyMSVCFenceAfterLoad(order);
+    return value;
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicPtrStoreExplicit(volatile struct ZennyAtomicPtr *atomic, intptr_t value, enum ZennyMemoryOrder order)
+{
+    if (order == ZennyMemoryOrderSeqCst)
+        _InterlockedExchangePointer((void* volatile *)&atomic->value, (void*)value);
+    else
+    {
+        ZennyMSVCFenceBeforeStore(order);
+        atomic->value = value;
+    }
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicPtrAddExplicit(volatile struct ZennyAtomicPtr *atomic, intptr_t value, enum ZennyMemoryOrder order)
+{
+    intptr_t comparand;
+    intptr_t desired;
+    bool successful;
+    struct ZennyAtomicBackoff backoff;
+    bool backingOff = false;
+
+    do
+    {
+        comparand = atomic->value;
+        desired = comparand + value;
+        const intptr_t dstValue = (intptr_t)ZENNY_MSVC_INTERLOCKED(_InterlockedCompareExchangePointer, order, (void* volatile *)&atomic->value, (void*)desired, (void*)comparand);
+        successful = dstValue == comparand;
+        if (!successful)
+            ZennyAtomicRetryBackoff(&backoff, &backingOff);
+    } while (!successful);
+
+    return comparand;
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicPtrSubExplicit(volatile struct ZennyAtomicPtr *atomic, intptr_t value, enum ZennyMemoryOrder order)
+{
+    intptr_t comparand;
+    intptr_t desired;
+    bool successful;
+    struct ZennyAtomicBackoff backoff;
+    bool backingOff = false;
+
+    do
+    {
+        comparand = atomic->value;
+        desired = comparand - value;
+        const intptr_t dstValue = (intptr_t)ZENNY_MSVC_INTERLOCKED(_InterlockedCompareExchangePointer, order, (void* volatile *)&atomic->value, (void*)desired, (void*)comparand);
+        successful = dstValue == comparand;
+        if (!successful)
+            ZennyAtomicRetryBackoff(&backoff, &backingOff);
+    } while (!successful);
+
+    return comparand;
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicPtrOrExplicit(volatile struct ZennyAtomicPtr *atomic, intptr_t value, enum ZennyMemoryOrder order)
+{
+    return sizeof(intptr_t) == 8 ? ZENNY_MSVC_INTERLOCKED(_InterlockedOr64, order, (volatile int64_t*)&atomic->value, value) : ZENNY_MSVC_INTERLOCKED(_InterlockedOr, order, (volatile long*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicPtrXorExplicit(volatile struct ZennyAtomicPtr *atomic, intptr_t value, enum ZennyMemoryOrder order)
+{
+    return sizeof(intptr_t) == 8 ? ZENNY_MSVC_INTERLOCKED(_InterlockedXor64, order, (volatile int64_t*)&atomic->value, value) : ZENNY_MSVC_INTERLOCKED(_InterlockedXor, order, (volatile long*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicPtrAndExplicit(volatile struct ZennyAtomicPtr *atomic, intptr_t value, enum ZennyMemoryOrder order)
+{
+    return sizeof(intptr_t) == 8 ? ZENNY_MSVC_INTERLOCKED(_InterlockedAnd64, order, (volatile int64_t*)&atomic->value, value) : ZENNY_MSVC_INTERLOCKED(_InterlockedAnd, order, (volatile long*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicPtrExchangeExplicit(volatile struct ZennyAtomicPtr *atomic, intptr_t value, enum ZennyMemoryOrder order)
+{
+    return (intptr_t)ZENNY_MSVC_INTERLOCKED(_InterlockedExchangePointer, order, (void* volatile *)&atomic->value, (void*)value);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicPtrCompareExchangeExplicit(volatile struct ZennyAtomicPtr *atomic, intptr_t *expected, intptr_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure)
+{
+    (void)failure;
+
+    const intptr_t dstValue = (intptr_t)ZENNY_MSVC_INTERLOCKED(_InterlockedCompareExchangePointer, success, (void* volatile *)&atomic->value, (void*)desired, (void*)*expected);
+    const bool successful = dstValue == *expected;
+    if (!successful)
+        *expected = dstValue;
+
+    return successful;
+}
+
+// MARK: Compact weak compare and exchange
+
+// Interlocked compare-exchange has no weak form, so the weak operations are the strong ones.
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicByteCompareExchangeWeak(volatile struct ZennyAtomicByte *atomic, int8_t *expected, int8_t desired)
+{
+    return ZennyAtomicByteCompareExchange(atomic, expected, desired);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicShortCompareExchangeWeak(volatile struct ZennyAtomicShort *atomic, int16_t *expected, int16_t desired)
+{
+    return ZennyAtomicShortCompareExchange(atomic, expected, desired);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicIntCompareExchangeWeak(volatile struct ZennyAtomicInt *atomic, int *expected, int desired)
+{
+    return ZennyAtomicIntCompareExchange(atomic, expected, desired);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicLongCompareExchangeWeak(volatile struct ZennyAtomicLong *atomic, int64_t *expected, int64_t desired)
+{
+    return ZennyAtomicLongCompareExchange(atomic, expected, desired);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicPtrCompareExchangeWeak(volatile struct ZennyAtomicPtr *atomic, intptr_t *expected, intptr_t desired)
+{
+    return ZennyAtomicPtrCompareExchange(atomic, expected, desired);
+}
+
+// MARK: Compact weak compare and exchange with explicit memory order
+
+// Interlocked compare-exchange has no weak form, so the weak operations are the strong ones.
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicByteCompareExchangeWeakExplicit(volatile struct ZennyAtomicByte *atomic, int8_t *expected, int8_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure)
+{
+    return ZennyAtomicByteCompareExchangeExplicit(atomic, expected, desired, success, failure);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicShortCompareExchangeWeakExplicit(volatile struct ZennyAtomicShort *atomic, int16_t *expected, int16_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure)
+{
+    return ZennyAtomicShortCompareExchangeExplicit(atomic, expected, desired, success, failure);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicIntCompareExchangeWeakExplicit(volatile struct ZennyAtomicInt *atomic, int *expected, int desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure)
+{
+    return ZennyAtomicIntCompareExchangeExplicit(atomic, expected, desired, success, failure);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicLongCompareExchangeWeakExplicit(volatile struct ZennyAtomicLong *atomic, int64_t *expected, int64_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure)
+{
+    return ZennyAtomicLongCompareExchangeExplicit(atomic, expected, desired, success, failure);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicPtrCompareExchangeWeakExplicit(volatile struct ZennyAtomicPtr *atomic, intptr_t *expected, intptr_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure)
+{
+    return ZennyAtomicPtrCompareExchangeExplicit(atomic, expected, desired, success, failure);
+}
+
+#else
+
+#include <stdatomic.h>
+#include <assert.h>
+
+// MARK: Initialization
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicInitByte(volatile struct ZennyAtomicType *atomic, int8_t value)
+{
+    atomic_init((atomic_schar*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicInitInt(volatile struct ZennyAtomicType *atomic, int value)
+{
+    atomic_init((atomic_int*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicInitLong(volatile struct ZennyAtomicType *atomic, int64_t value)
+{
+    atomic_init((atomic_llong*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicInitPtr(volatile struct ZennyAtomicType *atomic, intptr_t value)
+{
+    atomic_init((atomic_intptr_t*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicInitFlag(volatile struct ZennyAtomicType *atomic)
+{
+    *(atomic_flag*)atomic = (atomic_flag)ATOMIC_FLAG_INIT;
+}
+
+// MARK: Load
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicLoadByte(volatile struct ZennyAtomicType *atomic)
+{
+    return atomic_load((atomic_schar*)atomic);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicLoadInt(volatile struct ZennyAtomicType *atomic)
+{
+    return atomic_load((atomic_int*)atomic);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicLoadLong(volatile struct ZennyAtomicType* atomic)
+{
+    return atomic_load((atomic_llong*)atomic);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicLoadPtr(volatile struct ZennyAtomicType* atomic)
+{
+    return atomic_load((atomic_intptr_t*)atomic);
+}
+
+// MARK: Flag atomic operations
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicLoadFlag(volatile struct ZennyAtomicType *atomic)
+{
+    return atomic_load((atomic_bool*)atomic);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicTestAndSetFlag(volatile struct ZennyAtomicType *atomic)
+{
+    return atomic_flag_test_and_set((atomic_flag*)atomic);
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicClearFlag(volatile struct ZennyAtomicType *atomic)
+{
+    atomic_flag_clear((atomic_flag*)atomic);
+}
+
+// MARK: Store
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicStoreByte(volatile struct ZennyAtomicType *atomic, int8_t value)
+{
+    atomic_store((atomic_schar*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicStoreInt(volatile struct ZennyAtomicType *atomic, int value)
+{
+    atomic_store((atomic_int*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicStoreLong(volatile struct ZennyAtomicType *atomic, int64_t value)
+{
+    atomic_store((atomic_llong*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicStorePtr(volatile struct ZennyAtomicType *atomic, intptr_t value)
+{
+    atomic_store((atomic_intptr_t*)atomic, value);
+}
+
+// MARK: Add
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicAddByte(volatile struct ZennyAtomicType *atomic, int8_t value)
+{
+    return atomic_fetch_add((atomic_schar*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicAddInt(volatile struct ZennyAtomicType *atomic, int value)
+{
+    return atomic_fetch_add((atomic_int*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicAddLong(volatile struct ZennyAtomicType *atomic, int64_t value)
+{
+    return atomic_fetch_add((atomic_llong*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicAddPtr(volatile struct ZennyAtomicType *atomic, intptr_t value)
+{
+    return atomic_fetch_add((atomic_intptr_t*)atomic, value);
+}
+
+// MARK: Subtract
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicSubByte(volatile struct ZennyAtomicType *atomic, int8_t value)
+{
+    return atomic_fetch_sub((atomic_schar*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicSubInt(volatile struct ZennyAtomicType *atomic, int value)
+{
+    return atomic_fetch_sub((atomic_int*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicSubLong(volatile struct ZennyAtomicType *atomic, int64_t value)
+{
+    return atomic_fetch_sub((atomic_llong*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicSubPtr(volatile struct ZennyAtomicType *atomic, intptr_t value)
+{
+    return atomic_fetch_sub((atomic_intptr_t*)atomic, value);
+}
+
+// MARK: Bitwise OR
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicOrByte(volatile struct ZennyAtomicType *atomic, int8_t value)
+{
+    return atomic_fetch_or((atomic_schar*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicOrInt(volatile struct ZennyAtomicType *atomic, int value)
+{
+    return atomic_fetch_or((atomic_int*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicOrLong(volatile struct ZennyAtomicType *atomic, int64_t value)
+{
+    return atomic_fetch_or((atomic_llong*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicOrPtr(volatile struct ZennyAtomicType *atomic, intptr_t value)
+{
+    return atomic_fetch_or((atomic_intptr_t*)atomic, value);
+}
+
+// MARK: Bitwise XOR
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicXorByte(volatile struct ZennyAtomicType *atomic, int8_t value)
+{
+    return atomic_fetch_xor((atomic_schar*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicXorInt(volatile struct ZennyAtomicType *atomic, int value)
+{
+    return atomic_fetch_xor((atomic_int*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicXorLong(volatile struct ZennyAtomicType *atomic, int64_t value)
+{
+    return atomic_fetch_xor((atomic_llong*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicXorPtr(volatile struct ZennyAtomicType *atomic, intptr_t value)
+{
+    return atomic_fetch_xor((atomic_intptr_t*)atomic, value);
+}
+
+// MARK: Bitwise And
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicAndByte(volatile struct ZennyAtomicType *atomic, int8_t value)
+{
+    return atomic_fetch_and((atomic_schar*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicAndInt(volatile struct ZennyAtomicType *atomic, int value)
+{
+    return atomic_fetch_and((atomic_int*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicAndLong(volatile struct ZennyAtomicType *atomic, int64_t value)
+{
+    return atomic_fetch_and((atomic_llong*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicAndPtr(volatile struct ZennyAtomicType *atomic, intptr_t value)
+{
+    return atomic_fetch_and((atomic_intptr_t*)atomic, value);
+}
+
+// MARK: Exchange
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicExchangeByte(volatile struct ZennyAtomicType *atomic, int8_t value)
+{
+    return atomic_exchange((atomic_schar*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicExchangeInt(volatile struct ZennyAtomicType *atomic, int value)
+{
+    return atomic_exchange((atomic_int*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicExchangeLong(volatile struct ZennyAtomicType *atomic, int64_t value)
+{
+    return atomic_exchange((atomic_llong*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicExchangePtr(volatile struct ZennyAtomicType *atomic, intptr_t value)
+{
+    return atomic_exchange((atomic_intptr_t*)atomic, value);
+}
+
+// MARK: Compare and Exchange
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicCompareExchangeByte(volatile struct ZennyAtomicType *atomic, int8_t *expected, int8_t desired)
+{
+    return atomic_compare_exchange_strong((atomic_schar*)atomic, expected, desired);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicCompareExchangeInt(volatile struct ZennyAtomicType *atomic, int *expected, int desired)
+{
+    return atomic_compare_exchange_strong((atomic_int*)atomic, expected, desired);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicCompareExchangeLong(volatile struct ZennyAtomicType *atomic, int64_t *expected, int64_t desired)
+{
+    return atomic_compare_exchange_strong((atomic_llong*)atomic, expected, desired);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicCompareExchangePtr(volatile struct ZennyAtomicType *atomic, intptr_t *expected, intptr_t desired)
+{
+    return atomic_compare_exchange_strong((atomic_intptr_t*)atomic, expected, desired);
+}
+
+// MARK: Weak compare and exchange
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicCompareExchangeWeakByte(volatile struct ZennyAtomicType *atomic, int8_t *expected, int8_t desired)
+{
+    return atomic_compare_exchange_weak((atomic_schar*)atomic, expected, desired);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicCompareExchangeWeakInt(volatile struct ZennyAtomicType *atomic, int *expected, int desired)
+{
+    return atomic_compare_exchange_weak((atomic_int*)atomic, expected, desired);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicCompareExchangeWeakLong(volatile struct ZennyAtomicType *atomic, int64_t *expected, int64_t desired)
+{
+    return atomic_compare_exchange_weak((atomic_llong*)atomic, expected, desired);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicCompareExchangeWeakPtr(volatile struct ZennyAtomicType *atomic, intptr_t *expected, intptr_t desired)
+{
+    return atomic_compare_exchange_weak((atomic_intptr_t*)atomic, expected, desired);
+}
+
+// MARK: Memory order
+
+static_assert((int)ZennyMemoryOrderRelaxed == (int)memory_order_relaxed &&
+              (int)ZennyMemoryOrderConsume == (int)memory_order_consume &&
+              (int)ZennyMemoryOrderAcquire == (int)memory_order_acquire &&
+              (int)ZennyMemoryOrderRelease == (int)memory_order_release &&
+              (int)ZennyMemoryOrderAcqRel == (int)memory_order_acq_rel &&
+              (int)ZennyMemoryOrderSeqCst == (int)memory_order_seq_cst,
+              "ZennyMemoryOrder must match memory_order");
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicThreadFence(enum ZennyMemoryOrder order)
+{
+    atomic_thread_fence((memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicSignalFence(enum ZennyMemoryOrder order)
+{
+    atomic_signal_fence((memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicPause(void)
+{
+#if defined(__i386__) || defined(__x86_64__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+// MARK: Load with explicit memory order
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicLoadByteExplicit(volatile struct ZennyAtomicType *atomic, enum ZennyMemoryOrder order)
+{
+    return atomic_load_explicit((atomic_schar*)atomic, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicLoadIntExplicit(volatile struct ZennyAtomicType *atomic, enum ZennyMemoryOrder order)
+{
+    return atomic_load_explicit((atomic_int*)atomic, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicLoadLongExplicit(volatile struct ZennyAtomicType *atomic, enum ZennyMemoryOrder order)
+{
+    return atomic_load_explicit((atomic_llong*)atomic, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicLoadPtrExplicit(volatile struct ZennyAtomicType *atomic, enum ZennyMemoryOrder order)
+{
+    return atomic_load_explicit((atomic_intptr_t*)atomic, (memory_order)order);
+}
+
+// MARK: Flag atomic operations with explicit memory order
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicLoadFlagExplicit(volatile struct ZennyAtomicType *atomic, enum ZennyMemoryOrder order)
+{
+    return atomic_load_explicit((atomic_bool*)atomic, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicTestAndSetFlagExplicit(volatile struct ZennyAtomicType *atomic, enum ZennyMemoryOrder order)
+{
+    return atomic_flag_test_and_set_explicit((atomic_flag*)atomic, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicClearFlagExplicit(volatile struct ZennyAtomicType *atomic, enum ZennyMemoryOrder order)
+{
+    atomic_flag_clear_explicit((atomic_flag*)atomic, (memory_order)order);
+}
+
+// MARK: Store with explicit memory order
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicStoreByteExplicit(volatile struct ZennyAtomicType *atomic, int8_t value, enum ZennyMemoryOrder order)
+{
+    atomic_store_explicit((atomic_schar*)atomic, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicStoreIntExplicit(volatile struct ZennyAtomicType *atomic, int value, enum ZennyMemoryOrder order)
+{
+    atomic_store_explicit((atomic_int*)atomic, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicStoreLongExplicit(volatile struct ZennyAtomicType *atomic, int64_t value, enum ZennyMemoryOrder order)
+{
+    atomic_store_explicit((atomic_llong*)atomic, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicStorePtrExplicit(volatile struct ZennyAtomicType *atomic, intptr_t value, enum ZennyMemoryOrder order)
+{
+    atomic_store_explicit((atomic_intptr_t*)atomic, value, (memory_order)order);
+}
+
+// MARK: Add with explicit memory order
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicAddByteExplicit(volatile struct ZennyAtomicType *atomic, int8_t value, enum ZennyMemoryOrder order)
+{
+    return atomic_fetch_add_explicit((atomic_schar*)atomic, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicAddIntExplicit(volatile struct ZennyAtomicType *atomic, int value, enum ZennyMemoryOrder order)
+{
+    return atomic_fetch_add_explicit((atomic_int*)atomic, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicAddLongExplicit(volatile struct ZennyAtomicType *atomic, int64_t value, enum ZennyMemoryOrder order)
+{
+    return atomic_fetch_add_explicit((atomic_llong*)atomic, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicAddPtrExplicit(volatile struct ZennyAtomicType *atomic, intptr_t value, enum ZennyMemoryOrder order)
+{
+    return atomic_fetch_add_explicit((atomic_intptr_t*)atomic, value, (memory_order)order);
+}
+
+// MARK: Subtract with explicit memory order
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicSubByteExplicit(volatile struct ZennyAtomicType *atomic, int8_t value, enum ZennyMemoryOrder order)
+{
+    return atomic_fetch_sub_explicit((atomic_schar*)atomic, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicSubIntExplicit(volatile struct ZennyAtomicType *atomic, int value, enum ZennyMemoryOrder order)
+{
+    return atomic_fetch_sub_explicit((atomic_int*)atomic, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicSubLongExplicit(volatile struct ZennyAtomicType *atomic, int64_t value, enum ZennyMemoryOrder order)
+{
+    return atomic_fetch_sub_explicit((atomic_llong*)atomic, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicSubPtrExplicit(volatile struct ZennyAtomicType *atomic, intptr_t value, enum ZennyMemoryOrder order)
+{
+    return atomic_fetch_sub_explicit((atomic_intptr_t*)atomic, value, (memory_order)order);
+}
+
+// MARK: Bitwise OR with explicit memory order
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicOrByteExplicit(volatile struct ZennyAtomicType *atomic, int8_t value, enum ZennyMemoryOrder order)
+{
+    return atomic_fetch_or_explicit((atomic_schar*)atomic, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicOrIntExplicit(volatile struct ZennyAtomicType *atomic, int value, enum ZennyMemoryOrder order)
+{
+    return atomic_fetch_or_explicit((atomic_int*)atomic, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicOrLongExplicit(volatile struct ZennyAtomicType *atomic, int64_t value, enum ZennyMemoryOrder order)
+{
+    return atomic_fetch_or_explicit((atomic_llong*)atomic, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicOrPtrExplicit(volatile struct ZennyAtomicType *atomic, intptr_t value, enum ZennyMemoryOrder order)
+{
+    return atomic_fetch_or_explicit((atomic_intptr_t*)atomic, value, (memory_order)order);
+}
+
+// MARK: Bitwise XOR with explicit memory order
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicXorByteExplicit(volatile struct ZennyAtomicType *atomic, int8_t value, enum ZennyMemoryOrder order)
+{
+    return atomic_fetch_xor_explicit((atomic_schar*)atomic, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicXorIntExplicit(volatile struct ZennyAtomicType *atomic, int value, enum ZennyMemoryOrder order)
+{
+    return atomic_fetch_xor_explicit((atomic_int*)atomic, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicXorLongExplicit(volatile struct ZennyAtomicType *atomic, int64_t value, enum ZennyMemoryOrder order)
+{
+    return atomic_fetch_xor_explicit((atomic_llong*)atomic, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicXorPtrExplicit(volatile struct ZennyAtomicType *atomic, intptr_t value, enum ZennyMemoryOrder order)
+{
+    return atomic_fetch_xor_explicit((atomic_intptr_t*)atomic, value, (memory_order)order);
+}
+
+// MARK: Bitwise And with explicit memory order
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicAndByteExplicit(volatile struct ZennyAtomicType *atomic, int8_t value, enum ZennyMemoryOrder order)
+{
+    return atomic_fetch_and_explicit((atomic_schar*)atomic, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicAndIntExplicit(volatile struct ZennyAtomicType *atomic, int value, enum ZennyMemoryOrder order)
+{
+    return atomic_fetch_and_explicit((atomic_int*)atomic, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicAndLongExplicit(volatile struct ZennyAtomicType *atomic, int64_t value, enum ZennyMemoryOrder order)
+{
+    return atomic_fetch_and_explicit((atomic_llong*)atomic, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicAndPtrExplicit(volatile struct ZennyAtomicType *atomic, intptr_t value, enum ZennyMemoryOrder order)
+{
+    return atomic_fetch_and_explicit((atomic_intptr_t*)atomic, value, (memory_order)order);
+}
+
+// MARK: Exchange with explicit memory order
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicExchangeByteExplicit(volatile struct ZennyAtomicType *atomic, int8_t value, enum ZennyMemoryOrder order)
+{
+    return atomic_exchange_explicit((atomic_schar*)atomic, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicExchangeIntExplicit(volatile struct ZennyAtomicType *atomic, int value, enum ZennyMemoryOrder order)
+{
+    return atomic_exchange_explicit((atomic_int*)atomic, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicExchangeLongExplicit(volatile struct ZennyAtomicType *atomic, int64_t value, enum ZennyMemoryOrder order)
+{
+    return atomic_exchange_explicit((atomic_llong*)atomic, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicExchangePtrExplicit(volatile struct ZennyAtomicType *atomic, intptr_t value, enum ZennyMemoryOrder order)
+{
+    return atomic_exchange_explicit((atomic_intptr_t*)atomic, value, (memory_order)order);
+}
+
+// MARK: Compare and Exchange with explicit memory order
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicCompareExchangeByteExplicit(volatile struct ZennyAtomicType *atomic, int8_t *expected, int8_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure)
+{
+    return atomic_compare_exchange_strong_explicit((atomic_schar*)atomic, expected, desired, (memory_order)success, (memory_order)failure);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicCompareExchangeIntExplicit(volatile struct ZennyAtomicType *atomic, int *expected, int desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure)
+{
+    return atomic_compare_exchange_strong_explicit((atomic_int*)atomic, expected, desired, (memory_order)success, (memory_order)failure);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicCompareExchangeLongExplicit(volatile struct ZennyAtomicType *atomic, int64_t *expected, int64_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure)
+{
+    return atomic_compare_exchange_strong_explicit((atomic_llong*)atomic, expected, desired, (memory_order)success, (memory_order)failure);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicCompareExchangePtrExplicit(volatile struct ZennyAtomicType *atomic, intptr_t *expected, intptr_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure)
+{
+    return atomic_compare_exchange_strong_explicit((atomic_intptr_t*)atomic, expected, desired, (memory_order)success, (memory_order)failure);
+}
+
+// MARK: Weak compare and exchange with explicit memory order
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicCompareExchangeWeakByteExplicit(volatile struct ZennyAtomicType *atomic, int8_t *expected, int8_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure)
+{
+    return atomic_compare_exchange_weak_explicit((atomic_schar*)atomic, expected, desired, (memory_order)success, (memory_order)failure);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicCompareExchangeWeakIntExplicit(volatile struct ZennyAtomicType *atomic, int *expected, int desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure)
+{
+    return atomic_compare_exchange_weak_explicit((atomic_int*)atomic, expected, desired, (memory_order)success, (memory_order)failure);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicCompareExchangeWeakLongExplicit(volatile struct ZennyAtomicType *atomic, int64_t *expected, int64_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure)
+{
+    return atomic_compare_exchange_weak_explicit((atomic_llong*)atomic, expected, desired, (memory_order)success, (memory_order)failure);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicCompareExchangeWeakPtrExplicit(volatile struct ZennyAtomicType *atomic, intptr_t *expected, intptr_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure)
+{
+    return atomic_compare_exchange_weak_explicit((atomic_intptr_t*)atomic, expected, desired, (memory_order)success, (memory_order)failure);
+}
+
+// MARK: Compact atomic flag
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicFlagInit(volatile struct ZennyAtomicFlag *atomic)
+{
+    *(atomic_flag*)&atomic->value = (atomic_flag)ATOMIC_FLAG_INIT;
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicFlagLoad(volatile struct ZennyAtomicFlag *atomic)
+{
+    return atomic_load((atomic_bool*)&atomic->value);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicFlagTestAndSet(volatile struct ZennyAtomicFlag *atomic)
+{
+    return atomic_flag_test_and_set((atomic_flag*)&atomic->value);
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicFlagClear(volatile struct ZennyAtomicFlag *atomic)
+{
+    atomic_flag_clear((atomic_flag*)&atomic->value);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicFlagLoadExplicit(volatile struct ZennyAtomicFlag *atomic, enum ZennyMemoryOrder order)
+{
+    return atomic_load_explicit((atomic_bool*)&atomic->value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicFlagTestAndSetExplicit(volatile struct ZennyAtomicFlag *atomic, enum ZennyMemoryOrder order)
+{
+    return atomic_flag_test_and_set_explicit((atomic_flag*)&atomic->value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicFlagClearExplicit(volatile struct ZennyAtomicFlag *atomic, enum ZennyMemoryOrder order)
+{
+    atomic_flag_clear_explicit((atomic_flag*)&atomic->value, (memory_order)order);
+}
+
+// MARK: Compact atomic int8_t
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicByteInit(volatile struct ZennyAtomicByte *atomic, int8_t value)
+{
+    atomic_init((atomic_schar*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicByteLoad(volatile struct ZennyAtomicByte *atomic)
+{
+    return atomic_load((atomic_schar*)&atomic->value);
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicByteStore(volatile struct ZennyAtomicByte *atomic, int8_t value)
+{
+    atomic_store((atomic_schar*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicByteAdd(volatile struct ZennyAtomicByte *atomic, int8_t value)
+{
+    return atomic_fetch_add((atomic_schar*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicByteSub(volatile struct ZennyAtomicByte *atomic, int8_t value)
+{
+    return atomic_fetch_sub((atomic_schar*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicByteOr(volatile struct ZennyAtomicByte *atomic, int8_t value)
+{
+    return atomic_fetch_or((atomic_schar*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicByteXor(volatile struct ZennyAtomicByte *atomic, int8_t value)
+{
+    return atomic_fetch_xor((atomic_schar*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicByteAnd(volatile struct ZennyAtomicByte *atomic, int8_t value)
+{
+    return atomic_fetch_and((atomic_schar*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicByteExchange(volatile struct ZennyAtomicByte *atomic, int8_t value)
+{
+    return atomic_exchange((atomic_schar*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicByteCompareExchange(volatile struct ZennyAtomicByte *atomic, int8_t *expected, int8_t desired)
+{
+    return atomic_compare_exchange_strong((atomic_schar*)&atomic->value, expected, desired);
+}
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicByteLoadExplicit(volatile struct ZennyAtomicByte *atomic, enum ZennyMemoryOrder order)
+{
+    return atomic_load_explicit((atomic_schar*)&atomic->value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicByteStoreExplicit(volatile struct ZennyAtomicByte *atomic, int8_t value, enum ZennyMemoryOrder order)
+{
+    atomic_store_explicit((atomic_schar*)&atomic->value, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicByteAddExplicit(volatile struct ZennyAtomicByte *atomic, int8_t value, enum ZennyMemoryOrder order)
+{
+    return atomic_fetch_add_explicit((atomic_schar*)&atomic->value, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicByteSubExplicit(volatile struct ZennyAtomicByte *atomic, int8_t value, enum ZennyMemoryOrder order)
+{
+    return atomic_fetch_sub_explicit((atomic_schar*)&atomic->value, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicByteOrExplicit(volatile struct ZennyAtomicByte *atomic, int8_t value, enum ZennyMemoryOrder order)
+{
+    return atomic_fetch_or_explicit((atomic_schar*)&atomic->value, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicByteXorExplicit(volatile struct ZennyAtomicByte *atomic, int8_t value, enum ZennyMemoryOrder order)
+{
+    return atomic_fetch_xor_explicit((atomic_schar*)&atomic->value, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicByteAndExplicit(volatile struct ZennyAtomicByte *atomic, int8_t value, enum ZennyMemoryOrder order)
+{
+    return atomic_fetch_and_explicit((atomic_schar*)&atomic->value, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicByteExchangeExplicit(volatile struct ZennyAtomicByte *atomic, int8_t value, enum ZennyMemoryOrder order)
+{
+    return atomic_exchange_explicit((atomic_schar*)&atomic->value, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicByteCompareExchangeExplicit(volatile struct ZennyAtomicByte *atomic, int8_t *expected, int8_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure)
+{
+    return atomic_compare_exchange_strong_explicit((atomic_schar*)&atomic->value, expected, desired, (memory_order)success, (memory_order)failure);
+}
+
+// MARK: Compact atomic int16_t
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicShortInit(volatile struct ZennyAtomicShort *atomic, int16_t value)
+{
+    atomic_init((atomic_short*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL int16_t ZennyAtomicShortLoad(volatile struct ZennyAtomicShort *atomic)
+{
+    return atomic_load((atomic_short*)&atomic->value);
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicShortStore(volatile struct ZennyAtomicShort *atomic, int16_t value)
+{
+    atomic_store((atomic_short*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL int16_t ZennyAtomicShortAdd(volatile struct ZennyAtomicShort *atomic, int16_t value)
+{
+    return atomic_fetch_add((atomic_short*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL int16_t ZennyAtomicShortSub(volatile struct ZennyAtomicShort *atomic, int16_t value)
+{
+    return atomic_fetch_sub((atomic_short*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL int16_t ZennyAtomicShortOr(volatile struct ZennyAtomicShort *atomic, int16_t value)
+{
+    return atomic_fetch_or((atomic_short*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL int16_t ZennyAtomicShortXor(volatile struct ZennyAtomicShort *atomic, int16_t value)
+{
+    return atomic_fetch_xor((atomic_short*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL int16_t ZennyAtomicShortAnd(volatile struct ZennyAtomicShort *atomic, int16_t value)
+{
+    return atomic_fetch_and((atomic_short*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL int16_t ZennyAtomicShortExchange(volatile struct ZennyAtomicShort *atomic, int16_t value)
+{
+    return atomic_exchange((atomic_short*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicShortCompareExchange(volatile struct ZennyAtomicShort *atomic, int16_t *expected, int16_t desired)
+{
+    return atomic_compare_exchange_strong((atomic_short*)&atomic->value, expected, desired);
+}
+
+ZENNY_ATOMICS_IMPL int16_t ZennyAtomicShortLoadExplicit(volatile struct ZennyAtomicShort *atomic, enum ZennyMemoryOrder order)
+{
+    return atomic_load_explicit((atomic_short*)&atomic->value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicShortStoreExplicit(volatile struct ZennyAtomicShort *atomic, int16_t value, enum ZennyMemoryOrder order)
+{
+    atomic_store_explicit((atomic_short*)&atomic->value, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL int16_t ZennyAtomicShortAddExplicit(volatile struct ZennyAtomicShort *atomic, int16_t value, enum ZennyMemoryOrder order)
+{
+    return atomic_fetch_add_explicit((atomic_short*)&atomic->value, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL int16_t ZennyAtomicShortSubExplicit(volatile struct ZennyAtomicShort *atomic, int16_t value, enum ZennyMemoryOrder order)
+{
+    return atomic_fetch_sub_explicit((atomic_short*)&atomic->value, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL int16_t ZennyAtomicShortOrExplicit(volatile struct ZennyAtomicShort *atomic, int16_t value, enum ZennyMemoryOrder order)
+{
+    return atomic_fetch_or_explicit((atomic_short*)&atomic->value, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL int16_t ZennyAtomicShortXorExplicit(volatile struct ZennyAtomicShort *atomic, int16_t value, enum ZennyMemoryOrder order)
+{
+    return atomic_fetch_xor_explicit((atomic_short*)&atomic->value, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL int16_t ZennyAtomicShortAndExplicit(volatile struct ZennyAtomicShort *atomic, int16_t value, enum ZennyMemoryOrder order)
+{
+    return atomic_fetch_and_explicit((atomic_short*)&atomic->value, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL int16_t ZennyAtomicShortExchangeExplicit(volatile struct ZennyAtomicShort *atomic, int16_t value, enum ZennyMemoryOrder order)
+{
+    return atomic_exchange_explicit((atomic_short*)&atomic->value, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicShortCompareExchangeExplicit(volatile struct ZennyAtomicShort *atomic, int16_t *expected, int16_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure)
+{
+    return atomic_compare_exchange_strong_explicit((atomic_short*)&atomic->value, expected, desired, (memory_order)success, (memory_order)failure);
+}
+
+// MARK: Compact atomic int
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicIntInit(volatile struct ZennyAtomicInt *atomic, int value)
+{
+    atomic_init((atomic_int*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicIntLoad(volatile struct ZennyAtomicInt *atomic)
+{
+    return atomic_load((atomic_int*)&atomic->value);
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicIntStore(volatile struct ZennyAtomicInt *atomic, int value)
+{
+    atomic_store((atomic_int*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicIntAdd(volatile struct ZennyAtomicInt *atomic, int value)
+{
+    return atomic_fetch_add((atomic_int*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicIntSub(volatile struct ZennyAtomicInt *atomic, int value)
+{
+    return atomic_fetch_sub((atomic_int*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicIntOr(volatile struct ZennyAtomicInt *atomic, int value)
+{
+    return atomic_fetch_or((atomic_int*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicIntXor(volatile struct ZennyAtomicInt *atomic, int value)
+{
+    return atomic_fetch_xor((atomic_int*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicIntAnd(volatile struct ZennyAtomicInt *atomic, int value)
+{
+    return atomic_fetch_and((atomic_int*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicIntExchange(volatile struct ZennyAtomicInt *atomic, int value)
+{
+    return atomic_exchange((atomic_int*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicIntCompareExchange(volatile struct ZennyAtomicInt *atomic, int *expected, int desired)
+{
+    return atomic_compare_exchange_strong((atomic_int*)&atomic->value, expected, desired);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicIntLoadExplicit(volatile struct ZennyAtomicInt *atomic, enum ZennyMemoryOrder order)
+{
+    return atomic_load_explicit((atomic_int*)&atomic->value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicIntStoreExplicit(volatile struct ZennyAtomicInt *atomic, int value, enum ZennyMemoryOrder order)
+{
+    atomic_store_explicit((atomic_int*)&atomic->value, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicIntAddExplicit(volatile struct ZennyAtomicInt *atomic, int value, enum ZennyMemoryOrder order)
+{
+    return atomic_fetch_add_explicit((atomic_int*)&atomic->value, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicIntSubExplicit(volatile struct ZennyAtomicInt *atomic, int value, enum ZennyMemoryOrder order)
+{
+    return atomic_fetch_sub_explicit((atomic_int*)&atomic->value, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicIntOrExplicit(volatile struct ZennyAtomicInt *atomic, int value, enum ZennyMemoryOrder order)
+{
+    return atomic_fetch_or_explicit((atomic_int*)&atomic->value, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicIntXorExplicit(volatile struct ZennyAtomicInt *atomic, int value, enum ZennyMemoryOrder order)
+{
+    return atomic_fetch_xor_explicit((atomic_int*)&atomic->value, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicIntAndExplicit(volatile struct ZennyAtomicInt *atomic, int value, enum ZennyMemoryOrder order)
+{
+    return atomic_fetch_and_explicit((atomic_int*)&atomic->value, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicIntExchangeExplicit(volatile struct ZennyAtomicInt *atomic, int value, enum ZennyMemoryOrder order)
+{
+    return atomic_exchange_explicit((atomic_int*)&atomic->value, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicIntCompareExchangeExplicit(volatile struct ZennyAtomicInt *atomic, int *expected, int desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure)
+{
+    return atomic_compare_exchange_strong_explicit((atomic_int*)&atomic->value, expected, desired, (memory_order)success, (memory_order)failure);
+}
+
+// MARK: Compact atomic int64_t
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicLongInit(volatile struct ZennyAtomicLong *atomic, int64_t value)
+{
+    atomic_init((atomic_llong*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicLongLoad(volatile struct ZennyAtomicLong *atomic)
+{
+    return atomic_load((atomic_llong*)&atomic->value);
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicLongStore(volatile struct ZennyAtomicLong *atomic, int64_t value)
+{
+    atomic_store((atomic_llong*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicLongAdd(volatile struct ZennyAtomicLong *atomic, int64_t value)
+{
+    return atomic_fetch_add((atomic_llong*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicLongSub(volatile struct ZennyAtomicLong *atomic, int64_t value)
+{
+    return atomic_fetch_sub((atomic_llong*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicLongOr(volatile struct ZennyAtomicLong *atomic, int64_t value)
+{
+    return atomic_fetch_or((atomic_llong*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicLongXor(volatile struct ZennyAtomicLong *atomic, int64_t value)
+{
+    return atomic_fetch_xor((atomic_llong*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicLongAnd(volatile struct ZennyAtomicLong *atomic, int64_t value)
+{
+    return atomic_fetch_and((atomic_llong*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicLongExchange(volatile struct ZennyAtomicLong *atomic, int64_t value)
+{
+    return atomic_exchange((atomic_llong*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicLongCompareExchange(volatile struct ZennyAtomicLong *atomic, int64_t *expected, int64_t desired)
+{
+    return atomic_compare_exchange_strong((atomic_llong*)&atomic->value, expected, desired);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicLongLoadExplicit(volatile struct ZennyAtomicLong *atomic, enum ZennyMemoryOrder order)
+{
+    return atomic_load_explicit((atomic_llong*)&atomic->value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicLongStoreExplicit(volatile struct ZennyAtomicLong *atomic, int64_t value, enum ZennyMemoryOrder order)
+{
+    atomic_store_explicit((atomic_llong*)&atomic->value, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicLongAddExplicit(volatile struct ZennyAtomicLong *atomic, int64_t value, enum ZennyMemoryOrder order)
+{
+    return atomic_fetch_add_explicit((atomic_llong*)&atomic->value, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicLongSubExplicit(volatile struct ZennyAtomicLong *atomic, int64_t value, enum ZennyMemoryOrder order)
+{
+    return atomic_fetch_sub_explicit((atomic_llong*)&atomic->value, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicLongOrExplicit(volatile struct ZennyAtomicLong *atomic, int64_t value, enum ZennyMemoryOrder order)
+{
+    return atomic_fetch_or_explicit((atomic_llong*)&atomic->value, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicLongXorExplicit(volatile struct ZennyAtomicLong *atomic, int64_t value, enum ZennyMemoryOrder order)
+{
+    return atomic_fetch_xor_explicit((atomic_llong*)&atomic->value, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicLongAndExplicit(volatile struct ZennyAtomicLong *atomic, int64_t value, enum ZennyMemoryOrder order)
+{
+    return atomic_fetch_and_explicit((atomic_llong*)&atomic->value, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicLongExchangeExplicit(volatile struct ZennyAtomicLong *atomic, int64_t value, enum ZennyMemoryOrder order)
+{
+    return atomic_exchange_explicit((atomic_llong*)&atomic->value, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicLongCompareExchangeExplicit(volatile struct ZennyAtomicLong *atomic, int64_t *expected, int64_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure)
+{
+    return atomic_compare_exchange_strong_explicit((atomic_llong*)&atomic->value, expected, desired, (memory_order)success, (memory_order)failure);
+}
+
+// MARK: Compact atomic intptr_t
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicPtrInit(volatile struct ZennyAtomicPtr *atomic, intptr_t value)
+{
+    atomic_init((atomic_intptr_t*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicPtrLoad(volatile struct ZennyAtomicPtr *atomic)
+{
+    return atomic_load((atomic_intptr_t*)&atomic->value);
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicPtrStore(volatile struct ZennyAtomicPtr *atomic, intptr_t value)
+{
+    atomic_store((atomic_intptr_t*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicPtrAdd(volatile struct ZennyAtomicPtr *atomic, intptr_t value)
+{
+    return atomic_fetch_add((atomic_intptr_t*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicPtrSub(volatile struct ZennyAtomicPtr *atomic, intptr_t value)
+{
+    return atomic_fetch_sub((atomic_intptr_t*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicPtrOr(volatile struct ZennyAtomicPtr *atomic, intptr_t value)
+{
+    return atomic_fetch_or((atomic_intptr_t*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicPtrXor(volatile struct ZennyAtomicPtr *atomic, intptr_t value)
+{
+    return atomic_fetch_xor((atomic_intptr_t*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicPtrAnd(volatile struct ZennyAtomicPtr *atomic, intptr_t value)
+{
+    return atomic_fetch_and((atomic_intptr_t*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicPtrExchange(volatile struct ZennyAtomicPtr *atomic, intptr_t value)
+{
+    return atomic_exchange((atomic_intptr_t*)&atomic->value, value);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicPtrCompareExchange(volatile struct ZennyAtomicPtr *atomic, intptr_t *expected, intptr_t desired)
+{
+    return atomic_compare_exchange_strong((atomic_intptr_t*)&atomic->value, expected, desired);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicPtrLoadExplicit(volatile struct ZennyAtomicPtr *atomic, enum ZennyMemoryOrder order)
+{
+    return atomic_load_explicit((atomic_intptr_t*)&atomic->value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicPtrStoreExplicit(volatile struct ZennyAtomicPtr *atomic, intptr_t value, enum ZennyMemoryOrder order)
+{
+    atomic_store_explicit((atomic_intptr_t*)&atomic->value, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicPtrAddExplicit(volatile struct ZennyAtomicPtr *atomic, intptr_t value, enum ZennyMemoryOrder order)
+{
+    return atomic_fetch_add_explicit((atomic_intptr_t*)&atomic->value, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicPtrSubExplicit(volatile struct ZennyAtomicPtr *atomic, intptr_t value, enum ZennyMemoryOrder order)
+{
+    return atomic_fetch_sub_explicit((atomic_intptr_t*)&atomic->value, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicPtrOrExplicit(volatile struct ZennyAtomicPtr *atomic, intptr_t value, enum ZennyMemoryOrder order)
+{
+    return atomic_fetch_or_explicit((atomic_intptr_t*)&atomic->value, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicPtrXorExplicit(volatile struct ZennyAtomicPtr *atomic, intptr_t value, enum ZennyMemoryOrder order)
+{
+    return atomic_fetch_xor_explicit((atomic_intptr_t*)&atomic->value, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicPtrAndExplicit(volatile struct ZennyAtomicPtr *atomic, intptr_t value, enum ZennyMemoryOrder order)
+{
+    return atomic_fetch_and_explicit((atomic_intptr_t*)&atomic->value, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicPtrExchangeExplicit(volatile struct ZennyAtomicPtr *atomic, intptr_t value, enum ZennyMemoryOrder order)
+{
+    return atomic_exchange_explicit((atomic_intptr_t*)&atomic->value, value, (memory_order)order);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicPtrCompareExchangeExplicit(volatile struct ZennyAtomicPtr *atomic, intptr_t *expected, intptr_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure)
+{
+    return atomic_compare_exchange_strong_explicit((atomic_intptr_t*)&atomic->value, expected, desired, (memory_order)success, (memory_order)failure);
+}
+
+// MARK: Compact weak compare and exchange
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicByteCompareExchangeWeak(volatile struct ZennyAtomicByte *atomic, int8_t *expected, int8_t desired)
+{
+    return atomic_compare_exchange_weak((atomic_schar*)&atomic->value, expected, desired);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicShortCompareExchangeWeak(volatile struct ZennyAtomicShort *atomic, int16_t *expected, int16_t desired)
+{
+    return atomic_compare_exchange_weak((atomic_short*)&atomic->value, expected, desired);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicIntCompareExchangeWeak(volatile struct ZennyAtomicInt *atomic, int *expected, int desired)
+{
+    return atomic_compare_exchange_weak((atomic_int*)&atomic->value, expected, desired);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicLongCompareExchangeWeak(volatile struct ZennyAtomicLong *atomic, int64_t *expected, int64_t desired)
+{
+    return atomic_compare_exchange_weak((atomic_llong*)&atomic->value, expected, desired);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicPtrCompareExchangeWeak(volatile struct ZennyAtomicPtr *atomic, intptr_t *expected, intptr_t desired)
+{
+    return atomic_compare_exchange_weak((atomic_intptr_t*)&atomic->value, expected, desired);
+}
+
+// MARK: Compact weak compare and exchange with explicit memory order
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicByteCompareExchangeWeakExplicit(volatile struct ZennyAtomicByte *atomic, int8_t *expected, int8_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure)
+{
+    return atomic_compare_exchange_weak_explicit((atomic_schar*)&atomic->value, expected, desired, (memory_order)success, (memory_order)failure);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicShortCompareExchangeWeakExplicit(volatile struct ZennyAtomicShort *atomic, int16_t *expected, int16_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure)
+{
+    return atomic_compare_exchange_weak_explicit((atomic_short*)&atomic->value, expected, desired, (memory_order)success, (memory_order)failure);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicIntCompareExchangeWeakExplicit(volatile struct ZennyAtomicInt *atomic, int *expected, int desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure)
+{
+    return atomic_compare_exchange_weak_explicit((atomic_int*)&atomic->value, expected, desired, (memory_order)success, (memory_order)failure);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicLongCompareExchangeWeakExplicit(volatile struct ZennyAtomicLong *atomic, int64_t *expected, int64_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure)
+{
+    return atomic_compare_exchange_weak_explicit((atomic_llong*)&atomic->value, expected, desired, (memory_order)success, (memory_order)failure);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicPtrCompareExchangeWeakExplicit(volatile struct ZennyAtomicPtr *atomic, intptr_t *expected, intptr_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure)
+{
+    return atomic_compare_exchange_weak_explicit((atomic_intptr_t*)&atomic->value, expected, desired, (memory_order)success, (memory_order)failure);
+}
+
+#endif // _MSC_VER
+
+/** Order of a load that observes the object before or instead of a read-modify-write of the specified order */
+ZENNY_ATOMICS_PRIVATE enum ZennyMemoryOrder ZennyAtomicLoadOrderOf(enum ZennyMemoryOrder order)
+{
+    switch (order)
+    {
+        case ZennyMemoryOrderRelease:
+            return ZennyMemoryOrderRelaxed;
+
+        case ZennyMemoryOrderAcqRel:
+            return ZennyMemoryOrderAcquire;
+
+        default:
+            return order;
+    }
+}
+
+// MARK: Minimum and maximum
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicMinByte(volatile struct ZennyAtomicType *atomic, int8_t value)
+{
+    return ZennyAtomicMinByteExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicMinByteExplicit(volatile struct ZennyAtomicType *atomic, int8_t value, enum ZennyMemoryOrder order)
+{
+    const enum ZennyMemoryOrder loadOrder = ZennyAtomicLoadOrderOf(order);
+    int8_t current = ZennyAtomicLoadByteExplicit(atomic, loadOrder);
+
+    // A failed compare-exchange reloads `current`, so the loop ends as soon as the bound is already met
+    while (value < current)
+    {
+        if (ZennyAtomicCompareExchangeWeakByteExplicit(atomic, &current, value, order, loadOrder))
+            break;
+    }
+
+    return current;
+}
+
+ZENNY_ATOMICS_IMPL uint8_t ZennyAtomicMinUnsignedByte(volatile struct ZennyAtomicType *atomic, uint8_t value)
+{
+    return ZennyAtomicMinUnsignedByteExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL uint8_t ZennyAtomicMinUnsignedByteExplicit(volatile struct ZennyAtomicType *atomic, uint8_t value, enum ZennyMemoryOrder order)
+{
+    const enum ZennyMemoryOrder loadOrder = ZennyAtomicLoadOrderOf(order);
+    int8_t current = ZennyAtomicLoadByteExplicit(atomic, loadOrder);
+
+    // A failed compare-exchange reloads `current`, so the loop ends as soon as the bound is already met
+    while (value < (uint8_t)current)
+    {
+        if (ZennyAtomicCompareExchangeWeakByteExplicit(atomic, &current, (int8_t)value, order, loadOrder))
+            break;
+    }
+
+    return (uint8_t)current;
+}
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicMaxByte(volatile struct ZennyAtomicType *atomic, int8_t value)
+{
+    return ZennyAtomicMaxByteExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicMaxByteExplicit(volatile struct ZennyAtomicType *atomic, int8_t value, enum ZennyMemoryOrder order)
+{
+    const enum ZennyMemoryOrder loadOrder = ZennyAtomicLoadOrderOf(order);
+    int8_t current = ZennyAtomicLoadByteExplicit(atomic, loadOrder);
+
+    // A failed compare-exchange reloads `current`, so the loop ends as soon as the bound is already met
+    while (value > current)
+    {
+        if (ZennyAtomicCompareExchangeWeakByteExplicit(atomic, &current, value, order, loadOrder))
+            break;
+    }
+
+    return current;
+}
+
+ZENNY_ATOMICS_IMPL uint8_t ZennyAtomicMaxUnsignedByte(volatile struct ZennyAtomicType *atomic, uint8_t value)
+{
+    return ZennyAtomicMaxUnsignedByteExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL uint8_t ZennyAtomicMaxUnsignedByteExplicit(volatile struct ZennyAtomicType *atomic, uint8_t value, enum ZennyMemoryOrder order)
+{
+    const enum ZennyMemoryOrder loadOrder = ZennyAtomicLoadOrderOf(order);
+    int8_t current = ZennyAtomicLoadByteExplicit(atomic, loadOrder);
+
+    // A failed compare-exchange reloads `current`, so the loop ends as soon as the bound is already met
+    while (value > (uint8_t)current)
+    {
+        if (ZennyAtomicCompareExchangeWeakByteExplicit(atomic, &current, (int8_t)value, order, loadOrder))
+            break;
+    }
+
+    return (uint8_t)current;
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicMinInt(volatile struct ZennyAtomicType *atomic, int value)
+{
+    return ZennyAtomicMinIntExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicMinIntExplicit(volatile struct ZennyAtomicType *atomic, int value, enum ZennyMemoryOrder order)
+{
+    const enum ZennyMemoryOrder loadOrder = ZennyAtomicLoadOrderOf(order);
+    int current = ZennyAtomicLoadIntExplicit(atomic, loadOrder);
+
+    // A failed compare-exchange reloads `current`, so the loop ends as soon as the bound is already met
+    while (value < current)
+    {
+        if (ZennyAtomicCompareExchangeWeakIntExplicit(atomic, &current, value, order, loadOrder))
+            break;
+    }
+
+    return current;
+}
+
+ZENNY_ATOMICS_IMPL unsigned ZennyAtomicMinUnsignedInt(volatile struct ZennyAtomicType *atomic, unsigned value)
+{
+    return ZennyAtomicMinUnsignedIntExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL unsigned ZennyAtomicMinUnsignedIntExplicit(volatile struct ZennyAtomicType *atomic, unsigned value, enum ZennyMemoryOrder order)
+{
+    const enum ZennyMemoryOrder loadOrder = ZennyAtomicLoadOrderOf(order);
+    int current = ZennyAtomicLoadIntExplicit(atomic, loadOrder);
+
+    // A failed compare-exchange reloads `current`, so the loop ends as soon as the bound is already met
+    while (value < (unsigned)current)
+    {
+        if (ZennyAtomicCompareExchangeWeakIntExplicit(atomic, &current, (int)value, order, loadOrder))
+            break;
+    }
+
+    return (unsigned)current;
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicMaxInt(volatile struct ZennyAtomicType *atomic, int value)
+{
+    return ZennyAtomicMaxIntExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicMaxIntExplicit(volatile struct ZennyAtomicType *atomic, int value, enum ZennyMemoryOrder order)
+{
+    const enum ZennyMemoryOrder loadOrder = ZennyAtomicLoadOrderOf(order);
+    int current = ZennyAtomicLoadIntExplicit(atomic, loadOrder);
+
+    // A failed compare-exchange reloads `current`, so the loop ends as soon as the bound is already met
+    while (value > current)
+    {
+        if (ZennyAtomicCompareExchangeWeakIntExplicit(atomic, &current, value, order, loadOrder))
+            break;
+    }
+
+    return current;
+}
+
+ZENNY_ATOMICS_IMPL unsigned ZennyAtomicMaxUnsignedInt(volatile struct ZennyAtomicType *atomic, unsigned value)
+{
+    return ZennyAtomicMaxUnsignedIntExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL unsigned ZennyAtomicMaxUnsignedIntExplicit(volatile struct ZennyAtomicType *atomic, unsigned value, enum ZennyMemoryOrder order)
+{
+    const enum ZennyMemoryOrder loadOrder = ZennyAtomicLoadOrderOf(order);
+    int current = ZennyAtomicLoadIntExplicit(atomic, loadOrder);
+
+    // A failed compare-exchange reloads `current`, so the loop ends as soon as the bound is already met
+    while (value > (unsigned)current)
+    {
+        if (ZennyAtomicCompareExchangeWeakIntExplicit(atomic, &current, (int)value, order, loadOrder))
+            break;
+    }
+
+    return (unsigned)current;
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicMinLong(volatile struct ZennyAtomicType *atomic, int64_t value)
+{
+    return ZennyAtomicMinLongExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicMinLongExplicit(volatile struct ZennyAtomicType *atomic, int64_t value, enum ZennyMemoryOrder order)
+{
+    const enum ZennyMemoryOrder loadOrder = ZennyAtomicLoadOrderOf(order);
+    int64_t current = ZennyAtomicLoadLongExplicit(atomic, loadOrder);
+
+    // A failed compare-exchange reloads `current`, so the loop ends as soon as the bound is already met
+    while (value < current)
+    {
+        if (ZennyAtomicCompareExchangeWeakLongExplicit(atomic, &current, value, order, loadOrder))
+            break;
+    }
+
+    return current;
+}
+
+ZENNY_ATOMICS_IMPL uint64_t ZennyAtomicMinUnsignedLong(volatile struct ZennyAtomicType *atomic, uint64_t value)
+{
+    return ZennyAtomicMinUnsignedLongExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL uint64_t ZennyAtomicMinUnsignedLongExplicit(volatile struct ZennyAtomicType *atomic, uint64_t value, enum ZennyMemoryOrder order)
+{
+    const enum ZennyMemoryOrder loadOrder = ZennyAtomicLoadOrderOf(order);
+    int64_t current = ZennyAtomicLoadLongExplicit(atomic, loadOrder);
+
+    // A failed compare-exchange reloads `current`, so the loop ends as soon as the bound is already met
+    while (value < (uint64_t)current)
+    {
+        if (ZennyAtomicCompareExchangeWeakLongExplicit(atomic, &current, (int64_t)value, order, loadOrder))
+            break;
+    }
+
+    return (uint64_t)current;
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicMaxLong(volatile struct ZennyAtomicType *atomic, int64_t value)
+{
+    return ZennyAtomicMaxLongExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicMaxLongExplicit(volatile struct ZennyAtomicType *atomic, int64_t value, enum ZennyMemoryOrder order)
+{
+    const enum ZennyMemoryOrder loadOrder = ZennyAtomicLoadOrderOf(order);
+    int64_t current = ZennyAtomicLoadLongExplicit(atomic, loadOrder);
+
+    // A failed compare-exchange reloads `current`, so the loop ends as soon as the bound is already met
+    while (value > current)
+    {
+        if (ZennyAtomicCompareExchangeWeakLongExplicit(atomic, &current, value, order, loadOrder))
+            break;
+    }
+
+    return current;
+}
+
+ZENNY_ATOMICS_IMPL uint64_t ZennyAtomicMaxUnsignedLong(volatile struct ZennyAtomicType *atomic, uint64_t value)
+{
+    return ZennyAtomicMaxUnsignedLongExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL uint64_t ZennyAtomicMaxUnsignedLongExplicit(volatile struct ZennyAtomicType *atomic, uint64_t value, enum ZennyMemoryOrder order)
+{
+    const enum ZennyMemoryOrder loadOrder = ZennyAtomicLoadOrderOf(order);
+    int64_t current = ZennyAtomicLoadLongExplicit(atomic, loadOrder);
+
+    // A failed compare-exchange reloads `current`, so the loop ends as soon as the bound is already met
+    while (value > (uint64_t)current)
+    {
+        if (ZennyAtomicCompareExchangeWeakLongExplicit(atomic, &current, (int64_t)value, order, loadOrder))
+            break;
+    }
+
+    return (uint64_t)current;
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicMinPtr(volatile struct ZennyAtomicType *atomic, intptr_t value)
+{
+    return ZennyAtomicMinPtrExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicMinPtrExplicit(volatile struct ZennyAtomicType *atomic, intptr_t value, enum ZennyMemoryOrder order)
+{
+    const enum ZennyMemoryOrder loadOrder = ZennyAtomicLoadOrderOf(order);
+    intptr_t current = ZennyAtomicLoadPtrExplicit(atomic, loadOrder);
+
+    // A failed compare-exchange reloads `current`, so the loop ends as soon as the bound is already met
+    while (value < current)
+    {
+        if (ZennyAtomicCompareExchangeWeakPtrExplicit(atomic, &current, value, order, loadOrder))
+            break;
+    }
+
+    return current;
+}
+
+ZENNY_ATOMICS_IMPL uintptr_t ZennyAtomicMinUnsignedPtr(volatile struct ZennyAtomicType *atomic, uintptr_t value)
+{
+    return ZennyAtomicMinUnsignedPtrExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL uintptr_t ZennyAtomicMinUnsignedPtrExplicit(volatile struct ZennyAtomicType *atomic, uintptr_t value, enum ZennyMemoryOrder order)
+{
+    const enum ZennyMemoryOrder loadOrder = ZennyAtomicLoadOrderOf(order);
+    intptr_t current = ZennyAtomicLoadPtrExplicit(atomic, loadOrder);
+
+    // A failed compare-exchange reloads `current`, so the loop ends as soon as the bound is already met
+    while (value < (uintptr_t)current)
+    {
+        if (ZennyAtomicCompareExchangeWeakPtrExplicit(atomic, &current, (intptr_t)value, order, loadOrder))
+            break;
+    }
+
+    return (uintptr_t)current;
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicMaxPtr(volatile struct ZennyAtomicType *atomic, intptr_t value)
+{
+    return ZennyAtomicMaxPtrExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicMaxPtrExplicit(volatile struct ZennyAtomicType *atomic, intptr_t value, enum ZennyMemoryOrder order)
+{
+    const enum ZennyMemoryOrder loadOrder = ZennyAtomicLoadOrderOf(order);
+    intptr_t current = ZennyAtomicLoadPtrExplicit(atomic, loadOrder);
+
+    // A failed compare-exchange reloads `current`, so the loop ends as soon as the bound is already met
+    while (value > current)
+    {
+        if (ZennyAtomicCompareExchangeWeakPtrExplicit(atomic, &current, value, order, loadOrder))
+            break;
+    }
+
+    return current;
+}
+
+ZENNY_ATOMICS_IMPL uintptr_t ZennyAtomicMaxUnsignedPtr(volatile struct ZennyAtomicType *atomic, uintptr_t value)
+{
+    return ZennyAtomicMaxUnsignedPtrExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL uintptr_t ZennyAtomicMaxUnsignedPtrExplicit(volatile struct ZennyAtomicType *atomic, uintptr_t value, enum ZennyMemoryOrder order)
+{
+    const enum ZennyMemoryOrder loadOrder = ZennyAtomicLoadOrderOf(order);
+    intptr_t current = ZennyAtomicLoadPtrExplicit(atomic, loadOrder);
+
+    // A failed compare-exchange reloads `current`, so the loop ends as soon as the bound is already met
+    while (value > (uintptr_t)current)
+    {
+        if (ZennyAtomicCompareExchangeWeakPtrExplicit(atomic, &current, (intptr_t)value, order, loadOrder))
+            break;
+    }
+
+    return (uintptr_t)current;
+}
+
+// MARK: Operate and fetch
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicAddFetchByte(volatile struct ZennyAtomicType *atomic, int8_t value)
+{
+    return ZennyAtomicAddFetchByteExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicAddFetchByteExplicit(volatile struct ZennyAtomicType *atomic, int8_t value, enum ZennyMemoryOrder order)
+{
+    return (int8_t)((uint8_t)ZennyAtomicAddByteExplicit(atomic, value, order) + (uint8_t)value);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicAddFetchInt(volatile struct ZennyAtomicType *atomic, int value)
+{
+    return ZennyAtomicAddFetchIntExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicAddFetchIntExplicit(volatile struct ZennyAtomicType *atomic, int value, enum ZennyMemoryOrder order)
+{
+    return (int)((unsigned)ZennyAtomicAddIntExplicit(atomic, value, order) + (unsigned)value);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicAddFetchLong(volatile struct ZennyAtomicType *atomic, int64_t value)
+{
+    return ZennyAtomicAddFetchLongExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicAddFetchLongExplicit(volatile struct ZennyAtomicType *atomic, int64_t value, enum ZennyMemoryOrder order)
+{
+    return (int64_t)((uint64_t)ZennyAtomicAddLongExplicit(atomic, value, order) + (uint64_t)value);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicAddFetchPtr(volatile struct ZennyAtomicType *atomic, intptr_t value)
+{
+    return ZennyAtomicAddFetchPtrExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicAddFetchPtrExplicit(volatile struct ZennyAtomicType *atomic, intptr_t value, enum ZennyMemoryOrder order)
+{
+    return (intptr_t)((uintptr_t)ZennyAtomicAddPtrExplicit(atomic, value, order) + (uintptr_t)value);
+}
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicSubFetchByte(volatile struct ZennyAtomicType *atomic, int8_t value)
+{
+    return ZennyAtomicSubFetchByteExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicSubFetchByteExplicit(volatile struct ZennyAtomicType *atomic, int8_t value, enum ZennyMemoryOrder order)
+{
+    return (int8_t)((uint8_t)ZennyAtomicSubByteExplicit(atomic, value, order) - (uint8_t)value);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicSubFetchInt(volatile struct ZennyAtomicType *atomic, int value)
+{
+    return ZennyAtomicSubFetchIntExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicSubFetchIntExplicit(volatile struct ZennyAtomicType *atomic, int value, enum ZennyMemoryOrder order)
+{
+    return (int)((unsigned)ZennyAtomicSubIntExplicit(atomic, value, order) - (unsigned)value);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicSubFetchLong(volatile struct ZennyAtomicType *atomic, int64_t value)
+{
+    return ZennyAtomicSubFetchLongExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicSubFetchLongExplicit(volatile struct ZennyAtomicType *atomic, int64_t value, enum ZennyMemoryOrder order)
+{
+    return (int64_t)((uint64_t)ZennyAtomicSubLongExplicit(atomic, value, order) - (uint64_t)value);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicSubFetchPtr(volatile struct ZennyAtomicType *atomic, intptr_t value)
+{
+    return ZennyAtomicSubFetchPtrExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicSubFetchPtrExplicit(volatile struct ZennyAtomicType *atomic, intptr_t value, enum ZennyMemoryOrder order)
+{
+    return (intptr_t)((uintptr_t)ZennyAtomicSubPtrExplicit(atomic, value, order) - (uintptr_t)value);
+}
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicOrFetchByte(volatile struct ZennyAtomicType *atomic, int8_t value)
+{
+    return ZennyAtomicOrFetchByteExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicOrFetchByteExplicit(volatile struct ZennyAtomicType *atomic, int8_t value, enum ZennyMemoryOrder order)
+{
+    return (int8_t)(ZennyAtomicOrByteExplicit(atomic, value, order) | value);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicOrFetchInt(volatile struct ZennyAtomicType *atomic, int value)
+{
+    return ZennyAtomicOrFetchIntExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicOrFetchIntExplicit(volatile struct ZennyAtomicType *atomic, int value, enum ZennyMemoryOrder order)
+{
+    return ZennyAtomicOrIntExplicit(atomic, value, order) | value;
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicOrFetchLong(volatile struct ZennyAtomicType *atomic, int64_t value)
+{
+    return ZennyAtomicOrFetchLongExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicOrFetchLongExplicit(volatile struct ZennyAtomicType *atomic, int64_t value, enum ZennyMemoryOrder order)
+{
+    return ZennyAtomicOrLongExplicit(atomic, value, order) | value;
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicOrFetchPtr(volatile struct ZennyAtomicType *atomic, intptr_t value)
+{
+    return ZennyAtomicOrFetchPtrExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicOrFetchPtrExplicit(volatile struct ZennyAtomicType *atomic, intptr_t value, enum ZennyMemoryOrder order)
+{
+    return ZennyAtomicOrPtrExplicit(atomic, value, order) | value;
+}
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicAndFetchByte(volatile struct ZennyAtomicType *atomic, int8_t value)
+{
+    return ZennyAtomicAndFetchByteExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicAndFetchByteExplicit(volatile struct ZennyAtomicType *atomic, int8_t value, enum ZennyMemoryOrder order)
+{
+    return (int8_t)(ZennyAtomicAndByteExplicit(atomic, value, order) & value);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicAndFetchInt(volatile struct ZennyAtomicType *atomic, int value)
+{
+    return ZennyAtomicAndFetchIntExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicAndFetchIntExplicit(volatile struct ZennyAtomicType *atomic, int value, enum ZennyMemoryOrder order)
+{
+    return ZennyAtomicAndIntExplicit(atomic, value, order) & value;
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicAndFetchLong(volatile struct ZennyAtomicType *atomic, int64_t value)
+{
+    return ZennyAtomicAndFetchLongExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicAndFetchLongExplicit(volatile struct ZennyAtomicType *atomic, int64_t value, enum ZennyMemoryOrder order)
+{
+    return ZennyAtomicAndLongExplicit(atomic, value, order) & value;
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicAndFetchPtr(volatile struct ZennyAtomicType *atomic, intptr_t value)
+{
+    return ZennyAtomicAndFetchPtrExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicAndFetchPtrExplicit(volatile struct ZennyAtomicType *atomic, intptr_t value, enum ZennyMemoryOrder order)
+{
+    return ZennyAtomicAndPtrExplicit(atomic, value, order) & value;
+}
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicXorFetchByte(volatile struct ZennyAtomicType *atomic, int8_t value)
+{
+    return ZennyAtomicXorFetchByteExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicXorFetchByteExplicit(volatile struct ZennyAtomicType *atomic, int8_t value, enum ZennyMemoryOrder order)
+{
+    return (int8_t)(ZennyAtomicXorByteExplicit(atomic, value, order) ^ value);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicXorFetchInt(volatile struct ZennyAtomicType *atomic, int value)
+{
+    return ZennyAtomicXorFetchIntExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicXorFetchIntExplicit(volatile struct ZennyAtomicType *atomic, int value, enum ZennyMemoryOrder order)
+{
+    return ZennyAtomicXorIntExplicit(atomic, value, order) ^ value;
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicXorFetchLong(volatile struct ZennyAtomicType *atomic, int64_t value)
+{
+    return ZennyAtomicXorFetchLongExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicXorFetchLongExplicit(volatile struct ZennyAtomicType *atomic, int64_t value, enum ZennyMemoryOrder order)
+{
+    return ZennyAtomicXorLongExplicit(atomic, value, order) ^ value;
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicXorFetchPtr(volatile struct ZennyAtomicType *atomic, intptr_t value)
+{
+    return ZennyAtomicXorFetchPtrExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicXorFetchPtrExplicit(volatile struct ZennyAtomicType *atomic, intptr_t value, enum ZennyMemoryOrder order)
+{
+    return ZennyAtomicXorPtrExplicit(atomic, value, order) ^ value;
+}
+
+// MARK: Floating point
+
+/** Bit pattern of a float */
+ZENNY_ATOMICS_PRIVATE int ZennyAtomicBitsOfFloat(float value)
+{
+    union { float value; int bits; } pun;
+    pun.value = value;
+    return pun.bits;
+}
+
+/** float of a bit pattern */
+ZENNY_ATOMICS_PRIVATE float ZennyAtomicFloatOfBits(int bits)
+{
+    union { float value; int bits; } pun;
+    pun.bits = bits;
+    return pun.value;
+}
+
+/** Whether `value` replaces `current` as the minimum: -0.0 is below +0.0, a NaN `value` never replaces, a NaN `current` always is replaced */
+ZENNY_ATOMICS_PRIVATE bool ZennyAtomicFloatPrecedes(float value, float current)
+{
+    if (value != value)
+        return false;
+    if (current != current)
+        return true;
+    if (value == current)
+        return ZennyAtomicBitsOfFloat(value) < 0 && ZennyAtomicBitsOfFloat(current) >= 0;
+    return value < current;
+}
+
+/** Whether `value` replaces `current` as the maximum: +0.0 is above -0.0, a NaN `value` never replaces, a NaN `current` always is replaced */
+ZENNY_ATOMICS_PRIVATE bool ZennyAtomicFloatFollows(float value, float current)
+{
+    if (value != value)
+        return false;
+    if (current != current)
+        return true;
+    if (value == current)
+        return ZennyAtomicBitsOfFloat(value) >= 0 && ZennyAtomicBitsOfFloat(current) < 0;
+    return value > current;
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicInitFloat(volatile struct ZennyAtomicType *atomic, float value)
+{
+    ZennyAtomicInitInt(atomic, ZennyAtomicBitsOfFloat(value));
+}
+
+ZENNY_ATOMICS_IMPL float ZennyAtomicLoadFloat(volatile struct ZennyAtomicType *atomic)
+{
+    return ZennyAtomicLoadFloatExplicit(atomic, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL float ZennyAtomicLoadFloatExplicit(volatile struct ZennyAtomicType *atomic, enum ZennyMemoryOrder order)
+{
+    return ZennyAtomicFloatOfBits(ZennyAtomicLoadIntExplicit(atomic, order));
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicStoreFloat(volatile struct ZennyAtomicType *atomic, float value)
+{
+    ZennyAtomicStoreFloatExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicStoreFloatExplicit(volatile struct ZennyAtomicType *atomic, float value, enum ZennyMemoryOrder order)
+{
+    ZennyAtomicStoreIntExplicit(atomic, ZennyAtomicBitsOfFloat(value), order);
+}
+
+ZENNY_ATOMICS_IMPL float ZennyAtomicExchangeFloat(volatile struct ZennyAtomicType *atomic, float value)
+{
+    return ZennyAtomicExchangeFloatExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL float ZennyAtomicExchangeFloatExplicit(volatile struct ZennyAtomicType *atomic, float value, enum ZennyMemoryOrder order)
+{
+    return ZennyAtomicFloatOfBits(ZennyAtomicExchangeIntExplicit(atomic, ZennyAtomicBitsOfFloat(value), order));
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicCompareExchangeFloat(volatile struct ZennyAtomicType *atomic, float *expected, float desired)
+{
+    return ZennyAtomicCompareExchangeFloatExplicit(atomic, expected, desired, ZennyMemoryOrderSeqCst, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicCompareExchangeFloatExplicit(volatile struct ZennyAtomicType *atomic, float *expected, float desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure)
+{
+    int expectedBits = ZennyAtomicBitsOfFloat(*expected);
+    if (ZennyAtomicCompareExchangeIntExplicit(atomic, &expectedBits, ZennyAtomicBitsOfFloat(desired), success, failure))
+        return true;
+
+    *expected = ZennyAtomicFloatOfBits(expectedBits);
+    return false;
+}
+
+ZENNY_ATOMICS_IMPL float ZennyAtomicAddFloat(volatile struct ZennyAtomicType *atomic, float value)
+{
+    return ZennyAtomicAddFloatExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL float ZennyAtomicAddFloatExplicit(volatile struct ZennyAtomicType *atomic, float value, enum ZennyMemoryOrder order)
+{
+    const enum ZennyMemoryOrder loadOrder = ZennyAtomicLoadOrderOf(order);
+    int currentBits = ZennyAtomicLoadIntExplicit(atomic, loadOrder);
+    struct ZennyAtomicBackoff backoff;
+    bool backingOff = false;
+
+    // Compare bit patterns rather than values, so that a NaN sum does not make the exchange fail forever
+    while (!ZennyAtomicCompareExchangeWeakIntExplicit(atomic, &currentBits, ZennyAtomicBitsOfFloat(ZennyAtomicFloatOfBits(currentBits) + value),
+                                                      order, loadOrder))
+        ZennyAtomicRetryBackoff(&backoff, &backingOff);
+
+    return ZennyAtomicFloatOfBits(currentBits);
+}
+
+ZENNY_ATOMICS_IMPL float ZennyAtomicMinFloat(volatile struct ZennyAtomicType *atomic, float value)
+{
+    return ZennyAtomicMinFloatExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL float ZennyAtomicMinFloatExplicit(volatile struct ZennyAtomicType *atomic, float value, enum ZennyMemoryOrder order)
+{
+    const enum ZennyMemoryOrder loadOrder = ZennyAtomicLoadOrderOf(order);
+    int currentBits = ZennyAtomicLoadIntExplicit(atomic, loadOrder);
+
+    while (ZennyAtomicFloatPrecedes(value, ZennyAtomicFloatOfBits(currentBits)))
+    {
+        if (ZennyAtomicCompareExchangeWeakIntExplicit(atomic, &currentBits, ZennyAtomicBitsOfFloat(value), order, loadOrder))
+            break;
+    }
+
+    return ZennyAtomicFloatOfBits(currentBits);
+}
+
+ZENNY_ATOMICS_IMPL float ZennyAtomicMaxFloat(volatile struct ZennyAtomicType *atomic, float value)
+{
+    return ZennyAtomicMaxFloatExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL float ZennyAtomicMaxFloatExplicit(volatile struct ZennyAtomicType *atomic, float value, enum ZennyMemoryOrder order)
+{
+    const enum ZennyMemoryOrder loadOrder = ZennyAtomicLoadOrderOf(order);
+    int currentBits = ZennyAtomicLoadIntExplicit(atomic, loadOrder);
+
+    while (ZennyAtomicFloatFollows(value, ZennyAtomicFloatOfBits(currentBits)))
+    {
+        if (ZennyAtomicCompareExchangeWeakIntExplicit(atomic, &currentBits, ZennyAtomicBitsOfFloat(value), order, loadOrder))
+            break;
+    }
+
+    return ZennyAtomicFloatOfBits(currentBits);
+}
+
+/** Bit pattern of a double */
+ZENNY_ATOMICS_PRIVATE int64_t ZennyAtomicBitsOfDouble(double value)
+{
+    union { double value; int64_t bits; } pun;
+    pun.value = value;
+    return pun.bits;
+}
+
+/** double of a bit pattern */
+ZENNY_ATOMICS_PRIVATE double ZennyAtomicDoubleOfBits(int64_t bits)
+{
+    union { double value; int64_t bits; } pun;
+    pun.bits = bits;
+    return pun.value;
+}
+
+/** Whether `value` replaces `current` as the minimum: -0.0 is below +0.0, a NaN `value` never replaces, a NaN `current` always is replaced */
+ZENNY_ATOMICS_PRIVATE bool ZennyAtomicDoublePrecedes(double value, double current)
+{
+    if (value != value)
+        return false;
+    if (current != current)
+        return true;
+    if (value == current)
+        return ZennyAtomicBitsOfDouble(value) < 0 && ZennyAtomicBitsOfDouble(current) >= 0;
+    return value < current;
+}
+
+/** Whether `value` replaces `current` as the maximum: +0.0 is above -0.0, a NaN `value` never replaces, a NaN `current` always is replaced */
+ZENNY_ATOMICS_PRIVATE bool ZennyAtomicDoubleFollows(double value, double current)
+{
+    if (value != value)
+        return false;
+    if (current != current)
+        return true;
+    if (value == current)
+        return ZennyAtomicBitsOfDouble(value) >= 0 && ZennyAtomicBitsOfDouble(current) < 0;
+    return value > current;
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicInitDouble(volatile struct ZennyAtomicType *atomic, double value)
+{
+    ZennyAtomicInitLong(atomic, ZennyAtomicBitsOfDouble(value));
+}
+
+ZENNY_ATOMICS_IMPL double ZennyAtomicLoadDouble(volatile struct ZennyAtomicType *atomic)
+{
+    return ZennyAtomicLoadDoubleExplicit(atomic, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL double ZennyAtomicLoadDoubleExplicit(volatile struct ZennyAtomicType *atomic, enum ZennyMemoryOrder order)
+{
+    return ZennyAtomicDoubleOfBits(ZennyAtomicLoadLongExplicit(atomic, order));
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicStoreDouble(volatile struct ZennyAtomicType *atomic, double value)
+{
+    ZennyAtomicStoreDoubleExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicStoreDoubleExplicit(volatile struct ZennyAtomicType *atomic, double value, enum ZennyMemoryOrder order)
+{
+    ZennyAtomicStoreLongExplicit(atomic, ZennyAtomicBitsOfDouble(value), order);
+}
+
+ZENNY_ATOMICS_IMPL double ZennyAtomicExchangeDouble(volatile struct ZennyAtomicType *atomic, double value)
+{
+    return ZennyAtomicExchangeDoubleExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL double ZennyAtomicExchangeDoubleExplicit(volatile struct ZennyAtomicType *atomic, double value, enum ZennyMemoryOrder order)
+{
+    return ZennyAtomicDoubleOfBits(ZennyAtomicExchangeLongExplicit(atomic, ZennyAtomicBitsOfDouble(value), order));
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicCompareExchangeDouble(volatile struct ZennyAtomicType *atomic, double *expected, double desired)
+{
+    return ZennyAtomicCompareExchangeDoubleExplicit(atomic, expected, desired, ZennyMemoryOrderSeqCst, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicCompareExchangeDoubleExplicit(volatile struct ZennyAtomicType *atomic, double *expected, double desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure)
+{
+    int64_t expectedBits = ZennyAtomicBitsOfDouble(*expected);
+    if (ZennyAtomicCompareExchangeLongExplicit(atomic, &expectedBits, ZennyAtomicBitsOfDouble(desired), success, failure))
+        return true;
+
+    *expected = ZennyAtomicDoubleOfBits(expectedBits);
+    return false;
+}
+
+ZENNY_ATOMICS_IMPL double ZennyAtomicAddDouble(volatile struct ZennyAtomicType *atomic, double value)
+{
+    return ZennyAtomicAddDoubleExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL double ZennyAtomicAddDoubleExplicit(volatile struct ZennyAtomicType *atomic, double value, enum ZennyMemoryOrder order)
+{
+    const enum ZennyMemoryOrder loadOrder = ZennyAtomicLoadOrderOf(order);
+    int64_t currentBits = ZennyAtomicLoadLongExplicit(atomic, loadOrder);
+    struct ZennyAtomicBackoff backoff;
+    bool backingOff = false;
+
+    // Compare bit patterns rather than values, so that a NaN sum does not make the exchange fail forever
+    while (!ZennyAtomicCompareExchangeWeakLongExplicit(atomic, &currentBits, ZennyAtomicBitsOfDouble(ZennyAtomicDoubleOfBits(currentBits) + value),
+                                                      order, loadOrder))
+        ZennyAtomicRetryBackoff(&backoff, &backingOff);
+
+    return ZennyAtomicDoubleOfBits(currentBits);
+}
+
+ZENNY_ATOMICS_IMPL double ZennyAtomicMinDouble(volatile struct ZennyAtomicType *atomic, double value)
+{
+    return ZennyAtomicMinDoubleExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL double ZennyAtomicMinDoubleExplicit(volatile struct ZennyAtomicType *atomic, double value, enum ZennyMemoryOrder order)
+{
+    const enum ZennyMemoryOrder loadOrder = ZennyAtomicLoadOrderOf(order);
+    int64_t currentBits = ZennyAtomicLoadLongExplicit(atomic, loadOrder);
+
+    while (ZennyAtomicDoublePrecedes(value, ZennyAtomicDoubleOfBits(currentBits)))
+    {
+        if (ZennyAtomicCompareExchangeWeakLongExplicit(atomic, &currentBits, ZennyAtomicBitsOfDouble(value), order, loadOrder))
+            break;
+    }
+
+    return ZennyAtomicDoubleOfBits(currentBits);
+}
+
+ZENNY_ATOMICS_IMPL double ZennyAtomicMaxDouble(volatile struct ZennyAtomicType *atomic, double value)
+{
+    return ZennyAtomicMaxDoubleExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL double ZennyAtomicMaxDoubleExplicit(volatile struct ZennyAtomicType *atomic, double value, enum ZennyMemoryOrder order)
+{
+    const enum ZennyMemoryOrder loadOrder = ZennyAtomicLoadOrderOf(order);
+    int64_t currentBits = ZennyAtomicLoadLongExplicit(atomic, loadOrder);
+
+    while (ZennyAtomicDoubleFollows(value, ZennyAtomicDoubleOfBits(currentBits)))
+    {
+        if (ZennyAtomicCompareExchangeWeakLongExplicit(atomic, &currentBits, ZennyAtomicBitsOfDouble(value), order, loadOrder))
+            break;
+    }
+
+    return ZennyAtomicDoubleOfBits(currentBits);
+}
+
+// MARK: Compact minimum and maximum
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicByteMin(volatile struct ZennyAtomicByte *atomic, int8_t value)
+{
+    return ZennyAtomicByteMinExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int16_t ZennyAtomicShortMin(volatile struct ZennyAtomicShort *atomic, int16_t value)
+{
+    return ZennyAtomicShortMinExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicByteMinExplicit(volatile struct ZennyAtomicByte *atomic, int8_t value, enum ZennyMemoryOrder order)
+{
+    const enum ZennyMemoryOrder loadOrder = ZennyAtomicLoadOrderOf(order);
+    int8_t current = ZennyAtomicByteLoadExplicit(atomic, loadOrder);
+
+    // A failed compare-exchange reloads `current`, so the loop ends as soon as the bound is already met
+    while (value < current)
+    {
+        if (ZennyAtomicByteCompareExchangeWeakExplicit(atomic, &current, value, order, loadOrder))
+            break;
+    }
+
+    return current;
+}
+
+ZENNY_ATOMICS_IMPL int16_t ZennyAtomicShortMinExplicit(volatile struct ZennyAtomicShort *atomic, int16_t value, enum ZennyMemoryOrder order)
+{
+    const enum ZennyMemoryOrder loadOrder = ZennyAtomicLoadOrderOf(order);
+    int16_t current = ZennyAtomicShortLoadExplicit(atomic, loadOrder);
+
+    // A failed compare-exchange reloads `current`, so the loop ends as soon as the bound is already met
+    while (value < current)
+    {
+        if (ZennyAtomicShortCompareExchangeWeakExplicit(atomic, &current, value, order, loadOrder))
+            break;
+    }
+
+    return current;
+}
+
+ZENNY_ATOMICS_IMPL uint8_t ZennyAtomicByteMinUnsigned(volatile struct ZennyAtomicByte *atomic, uint8_t value)
+{
+    return ZennyAtomicByteMinUnsignedExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL uint16_t ZennyAtomicShortMinUnsigned(volatile struct ZennyAtomicShort *atomic, uint16_t value)
+{
+    return ZennyAtomicShortMinUnsignedExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL uint8_t ZennyAtomicByteMinUnsignedExplicit(volatile struct ZennyAtomicByte *atomic, uint8_t value, enum ZennyMemoryOrder order)
+{
+    const enum ZennyMemoryOrder loadOrder = ZennyAtomicLoadOrderOf(order);
+    int8_t current = ZennyAtomicByteLoadExplicit(atomic, loadOrder);
+
+    // A failed compare-exchange reloads `current`, so the loop ends as soon as the bound is already met
+    while (value < (uint8_t)current)
+    {
+        if (ZennyAtomicByteCompareExchangeWeakExplicit(atomic, &current, (int8_t)value, order, loadOrder))
+            break;
+    }
+
+    return (uint8_t)current;
+}
+
+ZENNY_ATOMICS_IMPL uint16_t ZennyAtomicShortMinUnsignedExplicit(volatile struct ZennyAtomicShort *atomic, uint16_t value, enum ZennyMemoryOrder order)
+{
+    const enum ZennyMemoryOrder loadOrder = ZennyAtomicLoadOrderOf(order);
+    int16_t current = ZennyAtomicShortLoadExplicit(atomic, loadOrder);
+
+    // A failed compare-exchange reloads `current`, so the loop ends as soon as the bound is already met
+    while (value < (uint16_t)current)
+    {
+        if (ZennyAtomicShortCompareExchangeWeakExplicit(atomic, &current, (int16_t)value, order, loadOrder))
+            break;
+    }
+
+    return (uint16_t)current;
+}
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicByteMax(volatile struct ZennyAtomicByte *atomic, int8_t value)
+{
+    return ZennyAtomicByteMaxExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int16_t ZennyAtomicShortMax(volatile struct ZennyAtomicShort *atomic, int16_t value)
+{
+    return ZennyAtomicShortMaxExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicByteMaxExplicit(volatile struct ZennyAtomicByte *atomic, int8_t value, enum ZennyMemoryOrder order)
+{
+    const enum ZennyMemoryOrder loadOrder = ZennyAtomicLoadOrderOf(order);
+    int8_t current = ZennyAtomicByteLoadExplicit(atomic, loadOrder);
+
+    // A failed compare-exchange reloads `current`, so the loop ends as soon as the bound is already met
+    while (value > current)
+    {
+        if (ZennyAtomicByteCompareExchangeWeakExplicit(atomic, &current, value, order, loadOrder))
+            break;
+    }
+
+    return current;
+}
+
+ZENNY_ATOMICS_IMPL int16_t ZennyAtomicShortMaxExplicit(volatile struct ZennyAtomicShort *atomic, int16_t value, enum ZennyMemoryOrder order)
+{
+    const enum ZennyMemoryOrder loadOrder = ZennyAtomicLoadOrderOf(order);
+    int16_t current = ZennyAtomicShortLoadExplicit(atomic, loadOrder);
+
+    // A failed compare-exchange reloads `current`, so the loop ends as soon as the bound is already met
+    while (value > current)
+    {
+        if (ZennyAtomicShortCompareExchangeWeakExplicit(atomic, &current, value, order, loadOrder))
+            break;
+    }
+
+    return current;
+}
+
+ZENNY_ATOMICS_IMPL uint8_t ZennyAtomicByteMaxUnsigned(volatile struct ZennyAtomicByte *atomic, uint8_t value)
+{
+    return ZennyAtomicByteMaxUnsignedExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL uint16_t ZennyAtomicShortMaxUnsigned(volatile struct ZennyAtomicShort *atomic, uint16_t value)
+{
+    return ZennyAtomicShortMaxUnsignedExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL uint8_t ZennyAtomicByteMaxUnsignedExplicit(volatile struct ZennyAtomicByte *atomic, uint8_t value, enum ZennyMemoryOrder order)
+{
+    const enum ZennyMemoryOrder loadOrder = ZennyAtomicLoadOrderOf(order);
+    int8_t current = ZennyAtomicByteLoadExplicit(atomic, loadOrder);
+
+    // A failed compare-exchange reloads `current`, so the loop ends as soon as the bound is already met
+    while (value > (uint8_t)current)
+    {
+        if (ZennyAtomicByteCompareExchangeWeakExplicit(atomic, &current, (int8_t)value, order, loadOrder))
+            break;
+    }
+
+    return (uint8_t)current;
+}
+
+ZENNY_ATOMICS_IMPL uint16_t ZennyAtomicShortMaxUnsignedExplicit(volatile struct ZennyAtomicShort *atomic, uint16_t value, enum ZennyMemoryOrder order)
+{
+    const enum ZennyMemoryOrder loadOrder = ZennyAtomicLoadOrderOf(order);
+    int16_t current = ZennyAtomicShortLoadExplicit(atomic, loadOrder);
+
+    // A failed compare-exchange reloads `current`, so the loop ends as soon as the bound is already met
+    while (value > (uint16_t)current)
+    {
+        if (ZennyAtomicShortCompareExchangeWeakExplicit(atomic, &current, (int16_t)value, order, loadOrder))
+            break;
+    }
+
+    return (uint16_t)current;
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicIntMin(volatile struct ZennyAtomicInt *atomic, int value)
+{
+    return ZennyAtomicIntMinExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicIntMinExplicit(volatile struct ZennyAtomicInt *atomic, int value, enum ZennyMemoryOrder order)
+{
+    const enum ZennyMemoryOrder loadOrder = ZennyAtomicLoadOrderOf(order);
+    int current = ZennyAtomicIntLoadExplicit(atomic, loadOrder);
+
+    // A failed compare-exchange reloads `current`, so the loop ends as soon as the bound is already met
+    while (value < current)
+    {
+        if (ZennyAtomicIntCompareExchangeWeakExplicit(atomic, &current, value, order, loadOrder))
+            break;
+    }
+
+    return current;
+}
+
+ZENNY_ATOMICS_IMPL unsigned ZennyAtomicIntMinUnsigned(volatile struct ZennyAtomicInt *atomic, unsigned value)
+{
+    return ZennyAtomicIntMinUnsignedExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL unsigned ZennyAtomicIntMinUnsignedExplicit(volatile struct ZennyAtomicInt *atomic, unsigned value, enum ZennyMemoryOrder order)
+{
+    const enum ZennyMemoryOrder loadOrder = ZennyAtomicLoadOrderOf(order);
+    int current = ZennyAtomicIntLoadExplicit(atomic, loadOrder);
+
+    // A failed compare-exchange reloads `current`, so the loop ends as soon as the bound is already met
+    while (value < (unsigned)current)
+    {
+        if (ZennyAtomicIntCompareExchangeWeakExplicit(atomic, &current, (int)value, order, loadOrder))
+            break;
+    }
+
+    return (unsigned)current;
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicIntMax(volatile struct ZennyAtomicInt *atomic, int value)
+{
+    return ZennyAtomicIntMaxExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicIntMaxExplicit(volatile struct ZennyAtomicInt *atomic, int value, enum ZennyMemoryOrder order)
+{
+    const enum ZennyMemoryOrder loadOrder = ZennyAtomicLoadOrderOf(order);
+    int current = ZennyAtomicIntLoadExplicit(atomic, loadOrder);
+
+    // A failed compare-exchange reloads `current`, so the loop ends as soon as the bound is already met
+    while (value > current)
+    {
+        if (ZennyAtomicIntCompareExchangeWeakExplicit(atomic, &current, value, order, loadOrder))
+            break;
+    }
+
+    return current;
+}
+
+ZENNY_ATOMICS_IMPL unsigned ZennyAtomicIntMaxUnsigned(volatile struct ZennyAtomicInt *atomic, unsigned value)
+{
+    return ZennyAtomicIntMaxUnsignedExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL unsigned ZennyAtomicIntMaxUnsignedExplicit(volatile struct ZennyAtomicInt *atomic, unsigned value, enum ZennyMemoryOrder order)
+{
+    const enum ZennyMemoryOrder loadOrder = ZennyAtomicLoadOrderOf(order);
+    int current = ZennyAtomicIntLoadExplicit(atomic, loadOrder);
+
+    // A failed compare-exchange reloads `current`, so the loop ends as soon as the bound is already met
+    while (value > (unsigned)current)
+    {
+        if (ZennyAtomicIntCompareExchangeWeakExplicit(atomic, &current, (int)value, order, loadOrder))
+            break;
+    }
+
+    return (unsigned)current;
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicLongMin(volatile struct ZennyAtomicLong *atomic, int64_t value)
+{
+    return ZennyAtomicLongMinExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicLongMinExplicit(volatile struct ZennyAtomicLong *atomic, int64_t value, enum ZennyMemoryOrder order)
+{
+    const enum ZennyMemoryOrder loadOrder = ZennyAtomicLoadOrderOf(order);
+    int64_t current = ZennyAtomicLongLoadExplicit(atomic, loadOrder);
+
+    // A failed compare-exchange reloads `current`, so the loop ends as soon as the bound is already met
+    while (value < current)
+    {
+        if (ZennyAtomicLongCompareExchangeWeakExplicit(atomic, &current, value, order, loadOrder))
+            break;
+    }
+
+    return current;
+}
+
+ZENNY_ATOMICS_IMPL uint64_t ZennyAtomicLongMinUnsigned(volatile struct ZennyAtomicLong *atomic, uint64_t value)
+{
+    return ZennyAtomicLongMinUnsignedExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL uint64_t ZennyAtomicLongMinUnsignedExplicit(volatile struct ZennyAtomicLong *atomic, uint64_t value, enum ZennyMemoryOrder order)
+{
+    const enum ZennyMemoryOrder loadOrder = ZennyAtomicLoadOrderOf(order);
+    int64_t current = ZennyAtomicLongLoadExplicit(atomic, loadOrder);
+
+    // A failed compare-exchange reloads `current`, so the loop ends as soon as the bound is already met
+    while (value < (uint64_t)current)
+    {
+        if (ZennyAtomicLongCompareExchangeWeakExplicit(atomic, &current, (int64_t)value, order, loadOrder))
+            break;
+    }
+
+    return (uint64_t)current;
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicLongMax(volatile struct ZennyAtomicLong *atomic, int64_t value)
+{
+    return ZennyAtomicLongMaxExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicLongMaxExplicit(volatile struct ZennyAtomicLong *atomic, int64_t value, enum ZennyMemoryOrder order)
+{
+    const enum ZennyMemoryOrder loadOrder = ZennyAtomicLoadOrderOf(order);
+    int64_t current = ZennyAtomicLongLoadExplicit(atomic, loadOrder);
+
+    // A failed compare-exchange reloads `current`, so the loop ends as soon as the bound is already met
+    while (value > current)
+    {
+        if (ZennyAtomicLongCompareExchangeWeakExplicit(atomic, &current, value, order, loadOrder))
+            break;
+    }
+
+    return current;
+}
+
+ZENNY_ATOMICS_IMPL uint64_t ZennyAtomicLongMaxUnsigned(volatile struct ZennyAtomicLong *atomic, uint64_t value)
+{
+    return ZennyAtomicLongMaxUnsignedExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL uint64_t ZennyAtomicLongMaxUnsignedExplicit(volatile struct ZennyAtomicLong *atomic, uint64_t value, enum ZennyMemoryOrder order)
+{
+    const enum ZennyMemoryOrder loadOrder = ZennyAtomicLoadOrderOf(order);
+    int64_t current = ZennyAtomicLongLoadExplicit(atomic, loadOrder);
+
+    // A failed compare-exchange reloads `current`, so the loop ends as soon as the bound is already met
+    while (value > (uint64_t)current)
+    {
+        if (ZennyAtomicLongCompareExchangeWeakExplicit(atomic, &current, (int64_t)value, order, loadOrder))
+            break;
+    }
+
+    return (uint64_t)current;
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicPtrMin(volatile struct ZennyAtomicPtr *atomic, intptr_t value)
+{
+    return ZennyAtomicPtrMinExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicPtrMinExplicit(volatile struct ZennyAtomicPtr *atomic, intptr_t value, enum ZennyMemoryOrder order)
+{
+    const enum ZennyMemoryOrder loadOrder = ZennyAtomicLoadOrderOf(order);
+    intptr_t current = ZennyAtomicPtrLoadExplicit(atomic, loadOrder);
+
+    // A failed compare-exchange reloads `current`, so the loop ends as soon as the bound is already met
+    while (value < current)
+    {
+        if (ZennyAtomicPtrCompareExchangeWeakExplicit(atomic, &current, value, order, loadOrder))
+            break;
+    }
+
+    return current;
+}
+
+ZENNY_ATOMICS_IMPL uintptr_t ZennyAtomicPtrMinUnsigned(volatile struct ZennyAtomicPtr *atomic, uintptr_t value)
+{
+    return ZennyAtomicPtrMinUnsignedExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL uintptr_t ZennyAtomicPtrMinUnsignedExplicit(volatile struct ZennyAtomicPtr *atomic, uintptr_t value, enum ZennyMemoryOrder order)
+{
+    const enum ZennyMemoryOrder loadOrder = ZennyAtomicLoadOrderOf(order);
+    intptr_t current = ZennyAtomicPtrLoadExplicit(atomic, loadOrder);
+
+    // A failed compare-exchange reloads `current`, so the loop ends as soon as the bound is already met
+    while (value < (uintptr_t)current)
+    {
+        if (ZennyAtomicPtrCompareExchangeWeakExplicit(atomic, &current, (intptr_t)value, order, loadOrder))
+            break;
+    }
+
+    return (uintptr_t)current;
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicPtrMax(volatile struct ZennyAtomicPtr *atomic, intptr_t value)
+{
+    return ZennyAtomicPtrMaxExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicPtrMaxExplicit(volatile struct ZennyAtomicPtr *atomic, intptr_t value, enum ZennyMemoryOrder order)
+{
+    const enum ZennyMemoryOrder loadOrder = ZennyAtomicLoadOrderOf(order);
+    intptr_t current = ZennyAtomicPtrLoadExplicit(atomic, loadOrder);
+
+    // A failed compare-exchange reloads `current`, so the loop ends as soon as the bound is already met
+    while (value > current)
+    {
+        if (ZennyAtomicPtrCompareExchangeWeakExplicit(atomic, &current, value, order, loadOrder))
+            break;
+    }
+
+    return current;
+}
+
+ZENNY_ATOMICS_IMPL uintptr_t ZennyAtomicPtrMaxUnsigned(volatile struct ZennyAtomicPtr *atomic, uintptr_t value)
+{
+    return ZennyAtomicPtrMaxUnsignedExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL uintptr_t ZennyAtomicPtrMaxUnsignedExplicit(volatile struct ZennyAtomicPtr *atomic, uintptr_t value, enum ZennyMemoryOrder order)
+{
+    const enum ZennyMemoryOrder loadOrder = ZennyAtomicLoadOrderOf(order);
+    intptr_t current = ZennyAtomicPtrLoadExplicit(atomic, loadOrder);
+
+    // A failed compare-exchange reloads `current`, so the loop ends as soon as the bound is already met
+    while (value > (uintptr_t)current)
+    {
+        if (ZennyAtomicPtrCompareExchangeWeakExplicit(atomic, &current, (intptr_t)value, order, loadOrder))
+            break;
+    }
+
+    return (uintptr_t)current;
+}
+
+// MARK: Compact operate and fetch
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicByteAddFetch(volatile struct ZennyAtomicByte *atomic, int8_t value)
+{
+    return ZennyAtomicByteAddFetchExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int16_t ZennyAtomicShortAddFetch(volatile struct ZennyAtomicShort *atomic, int16_t value)
+{
+    return ZennyAtomicShortAddFetchExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicByteAddFetchExplicit(volatile struct ZennyAtomicByte *atomic, int8_t value, enum ZennyMemoryOrder order)
+{
+    return (int8_t)((uint8_t)ZennyAtomicByteAddExplicit(atomic, value, order) + (uint8_t)value);
+}
+
+ZENNY_ATOMICS_IMPL int16_t ZennyAtomicShortAddFetchExplicit(volatile struct ZennyAtomicShort *atomic, int16_t value, enum ZennyMemoryOrder order)
+{
+    return (int16_t)((uint16_t)ZennyAtomicShortAddExplicit(atomic, value, order) + (uint16_t)value);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicIntAddFetch(volatile struct ZennyAtomicInt *atomic, int value)
+{
+    return ZennyAtomicIntAddFetchExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicIntAddFetchExplicit(volatile struct ZennyAtomicInt *atomic, int value, enum ZennyMemoryOrder order)
+{
+    return (int)((unsigned)ZennyAtomicIntAddExplicit(atomic, value, order) + (unsigned)value);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicLongAddFetch(volatile struct ZennyAtomicLong *atomic, int64_t value)
+{
+    return ZennyAtomicLongAddFetchExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicLongAddFetchExplicit(volatile struct ZennyAtomicLong *atomic, int64_t value, enum ZennyMemoryOrder order)
+{
+    return (int64_t)((uint64_t)ZennyAtomicLongAddExplicit(atomic, value, order) + (uint64_t)value);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicPtrAddFetch(volatile struct ZennyAtomicPtr *atomic, intptr_t value)
+{
+    return ZennyAtomicPtrAddFetchExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicPtrAddFetchExplicit(volatile struct ZennyAtomicPtr *atomic, intptr_t value, enum ZennyMemoryOrder order)
+{
+    return (intptr_t)((uintptr_t)ZennyAtomicPtrAddExplicit(atomic, value, order) + (uintptr_t)value);
+}
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicByteSubFetch(volatile struct ZennyAtomicByte *atomic, int8_t value)
+{
+    return ZennyAtomicByteSubFetchExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int16_t ZennyAtomicShortSubFetch(volatile struct ZennyAtomicShort *atomic, int16_t value)
+{
+    return ZennyAtomicShortSubFetchExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicByteSubFetchExplicit(volatile struct ZennyAtomicByte *atomic, int8_t value, enum ZennyMemoryOrder order)
+{
+    return (int8_t)((uint8_t)ZennyAtomicByteSubExplicit(atomic, value, order) - (uint8_t)value);
+}
+
+ZENNY_ATOMICS_IMPL int16_t ZennyAtomicShortSubFetchExplicit(volatile struct ZennyAtomicShort *atomic, int16_t value, enum ZennyMemoryOrder order)
+{
+    return (int16_t)((uint16_t)ZennyAtomicShortSubExplicit(atomic, value, order) - (uint16_t)value);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicIntSubFetch(volatile struct ZennyAtomicInt *atomic, int value)
+{
+    return ZennyAtomicIntSubFetchExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicIntSubFetchExplicit(volatile struct ZennyAtomicInt *atomic, int value, enum ZennyMemoryOrder order)
+{
+    return (int)((unsigned)ZennyAtomicIntSubExplicit(atomic, value, order) - (unsigned)value);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicLongSubFetch(volatile struct ZennyAtomicLong *atomic, int64_t value)
+{
+    return ZennyAtomicLongSubFetchExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicLongSubFetchExplicit(volatile struct ZennyAtomicLong *atomic, int64_t value, enum ZennyMemoryOrder order)
+{
+    return (int64_t)((uint64_t)ZennyAtomicLongSubExplicit(atomic, value, order) - (uint64_t)value);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicPtrSubFetch(volatile struct ZennyAtomicPtr *atomic, intptr_t value)
+{
+    return ZennyAtomicPtrSubFetchExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicPtrSubFetchExplicit(volatile struct ZennyAtomicPtr *atomic, intptr_t value, enum ZennyMemoryOrder order)
+{
+    return (intptr_t)((uintptr_t)ZennyAtomicPtrSubExplicit(atomic, value, order) - (uintptr_t)value);
+}
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicByteOrFetch(volatile struct ZennyAtomicByte *atomic, int8_t value)
+{
+    return ZennyAtomicByteOrFetchExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int16_t ZennyAtomicShortOrFetch(volatile struct ZennyAtomicShort *atomic, int16_t value)
+{
+    return ZennyAtomicShortOrFetchExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicByteOrFetchExplicit(volatile struct ZennyAtomicByte *atomic, int8_t value, enum ZennyMemoryOrder order)
+{
+    return (int8_t)(ZennyAtomicByteOrExplicit(atomic, value, order) | value);
+}
+
+ZENNY_ATOMICS_IMPL int16_t ZennyAtomicShortOrFetchExplicit(volatile struct ZennyAtomicShort *atomic, int16_t value, enum ZennyMemoryOrder order)
+{
+    return (int16_t)(ZennyAtomicShortOrExplicit(atomic, value, order) | value);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicIntOrFetch(volatile struct ZennyAtomicInt *atomic, int value)
+{
+    return ZennyAtomicIntOrFetchExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicIntOrFetchExplicit(volatile struct ZennyAtomicInt *atomic, int value, enum ZennyMemoryOrder order)
+{
+    return ZennyAtomicIntOrExplicit(atomic, value, order) | value;
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicLongOrFetch(volatile struct ZennyAtomicLong *atomic, int64_t value)
+{
+    return ZennyAtomicLongOrFetchExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicLongOrFetchExplicit(volatile struct ZennyAtomicLong *atomic, int64_t value, enum ZennyMemoryOrder order)
+{
+    return ZennyAtomicLongOrExplicit(atomic, value, order) | value;
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicPtrOrFetch(volatile struct ZennyAtomicPtr *atomic, intptr_t value)
+{
+    return ZennyAtomicPtrOrFetchExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicPtrOrFetchExplicit(volatile struct ZennyAtomicPtr *atomic, intptr_t value, enum ZennyMemoryOrder order)
+{
+    return ZennyAtomicPtrOrExplicit(atomic, value, order) | value;
+}
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicByteAndFetch(volatile struct ZennyAtomicByte *atomic, int8_t value)
+{
+    return ZennyAtomicByteAndFetchExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int16_t ZennyAtomicShortAndFetch(volatile struct ZennyAtomicShort *atomic, int16_t value)
+{
+    return ZennyAtomicShortAndFetchExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicByteAndFetchExplicit(volatile struct ZennyAtomicByte *atomic, int8_t value, enum ZennyMemoryOrder order)
+{
+    return (int8_t)(ZennyAtomicByteAndExplicit(atomic, value, order) & value);
+}
+
+ZENNY_ATOMICS_IMPL int16_t ZennyAtomicShortAndFetchExplicit(volatile struct ZennyAtomicShort *atomic, int16_t value, enum ZennyMemoryOrder order)
+{
+    return (int16_t)(ZennyAtomicShortAndExplicit(atomic, value, order) & value);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicIntAndFetch(volatile struct ZennyAtomicInt *atomic, int value)
+{
+    return ZennyAtomicIntAndFetchExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicIntAndFetchExplicit(volatile struct ZennyAtomicInt *atomic, int value, enum ZennyMemoryOrder order)
+{
+    return ZennyAtomicIntAndExplicit(atomic, value, order) & value;
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicLongAndFetch(volatile struct ZennyAtomicLong *atomic, int64_t value)
+{
+    return ZennyAtomicLongAndFetchExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicLongAndFetchExplicit(volatile struct ZennyAtomicLong *atomic, int64_t value, enum ZennyMemoryOrder order)
+{
+    return ZennyAtomicLongAndExplicit(atomic, value, order) & value;
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicPtrAndFetch(volatile struct ZennyAtomicPtr *atomic, intptr_t value)
+{
+    return ZennyAtomicPtrAndFetchExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicPtrAndFetchExplicit(volatile struct ZennyAtomicPtr *atomic, intptr_t value, enum ZennyMemoryOrder order)
+{
+    return ZennyAtomicPtrAndExplicit(atomic, value, order) & value;
+}
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicByteXorFetch(volatile struct ZennyAtomicByte *atomic, int8_t value)
+{
+    return ZennyAtomicByteXorFetchExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int16_t ZennyAtomicShortXorFetch(volatile struct ZennyAtomicShort *atomic, int16_t value)
+{
+    return ZennyAtomicShortXorFetchExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int8_t ZennyAtomicByteXorFetchExplicit(volatile struct ZennyAtomicByte *atomic, int8_t value, enum ZennyMemoryOrder order)
+{
+    return (int8_t)(ZennyAtomicByteXorExplicit(atomic, value, order) ^ value);
+}
+
+ZENNY_ATOMICS_IMPL int16_t ZennyAtomicShortXorFetchExplicit(volatile struct ZennyAtomicShort *atomic, int16_t value, enum ZennyMemoryOrder order)
+{
+    return (int16_t)(ZennyAtomicShortXorExplicit(atomic, value, order) ^ value);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicIntXorFetch(volatile struct ZennyAtomicInt *atomic, int value)
+{
+    return ZennyAtomicIntXorFetchExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int ZennyAtomicIntXorFetchExplicit(volatile struct ZennyAtomicInt *atomic, int value, enum ZennyMemoryOrder order)
+{
+    return ZennyAtomicIntXorExplicit(atomic, value, order) ^ value;
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicLongXorFetch(volatile struct ZennyAtomicLong *atomic, int64_t value)
+{
+    return ZennyAtomicLongXorFetchExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL int64_t ZennyAtomicLongXorFetchExplicit(volatile struct ZennyAtomicLong *atomic, int64_t value, enum ZennyMemoryOrder order)
+{
+    return ZennyAtomicLongXorExplicit(atomic, value, order) ^ value;
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicPtrXorFetch(volatile struct ZennyAtomicPtr *atomic, intptr_t value)
+{
+    return ZennyAtomicPtrXorFetchExplicit(atomic, value, ZennyMemoryOrderSeqCst);
+}
+
+ZENNY_ATOMICS_IMPL intptr_t ZennyAtomicPtrXorFetchExplicit(volatile struct ZennyAtomicPtr *atomic, intptr_t value, enum ZennyMemoryOrder order)
+{
+    return ZennyAtomicPtrXorExplicit(atomic, value, order) ^ value;
+}
+
+// MARK: Compact unsigned atomics
+
+// The unsigned types share the representation of the signed ones of the same width,
+// and unsigned and signed integers of the same width may alias each other.
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicUByteInit(volatile struct ZennyAtomicUByte *atomic, uint8_t value)
+{
+    ZennyAtomicByteInit((volatile struct ZennyAtomicByte*)atomic, (int8_t)value);
+}
+
+ZENNY_ATOMICS_IMPL uint8_t ZennyAtomicUByteLoad(volatile struct ZennyAtomicUByte *atomic)
+{
+    return (uint8_t)ZennyAtomicByteLoad((volatile struct ZennyAtomicByte*)atomic);
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicUByteStore(volatile struct ZennyAtomicUByte *atomic, uint8_t value)
+{
+    ZennyAtomicByteStore((volatile struct ZennyAtomicByte*)atomic, (int8_t)value);
+}
+
+ZENNY_ATOMICS_IMPL uint8_t ZennyAtomicUByteAdd(volatile struct ZennyAtomicUByte *atomic, uint8_t value)
+{
+    return (uint8_t)ZennyAtomicByteAdd((volatile struct ZennyAtomicByte*)atomic, (int8_t)value);
+}
+
+ZENNY_ATOMICS_IMPL uint8_t ZennyAtomicUByteSub(volatile struct ZennyAtomicUByte *atomic, uint8_t value)
+{
+    return (uint8_t)ZennyAtomicByteSub((volatile struct ZennyAtomicByte*)atomic, (int8_t)value);
+}
+
+ZENNY_ATOMICS_IMPL uint8_t ZennyAtomicUByteOr(volatile struct ZennyAtomicUByte *atomic, uint8_t value)
+{
+    return (uint8_t)ZennyAtomicByteOr((volatile struct ZennyAtomicByte*)atomic, (int8_t)value);
+}
+
+ZENNY_ATOMICS_IMPL uint8_t ZennyAtomicUByteXor(volatile struct ZennyAtomicUByte *atomic, uint8_t value)
+{
+    return (uint8_t)ZennyAtomicByteXor((volatile struct ZennyAtomicByte*)atomic, (int8_t)value);
+}
+
+ZENNY_ATOMICS_IMPL uint8_t ZennyAtomicUByteAnd(volatile struct ZennyAtomicUByte *atomic, uint8_t value)
+{
+    return (uint8_t)ZennyAtomicByteAnd((volatile struct ZennyAtomicByte*)atomic, (int8_t)value);
+}
+
+ZENNY_ATOMICS_IMPL uint8_t ZennyAtomicUByteExchange(volatile struct ZennyAtomicUByte *atomic, uint8_t value)
+{
+    return (uint8_t)ZennyAtomicByteExchange((volatile struct ZennyAtomicByte*)atomic, (int8_t)value);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicUByteCompareExchange(volatile struct ZennyAtomicUByte *atomic, uint8_t *expected, uint8_t desired)
+{
+    return ZennyAtomicByteCompareExchange((volatile struct ZennyAtomicByte*)atomic, (int8_t*)expected, (int8_t)desired);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicUByteCompareExchangeWeak(volatile struct ZennyAtomicUByte *atomic, uint8_t *expected, uint8_t desired)
+{
+    return ZennyAtomicByteCompareExchangeWeak((volatile struct ZennyAtomicByte*)atomic, (int8_t*)expected, (int8_t)desired);
+}
+
+ZENNY_ATOMICS_IMPL uint8_t ZennyAtomicUByteMin(volatile struct ZennyAtomicUByte *atomic, uint8_t value)
+{
+    return ZennyAtomicByteMinUnsigned((volatile struct ZennyAtomicByte*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL uint8_t ZennyAtomicUByteMax(volatile struct ZennyAtomicUByte *atomic, uint8_t value)
+{
+    return ZennyAtomicByteMaxUnsigned((volatile struct ZennyAtomicByte*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL uint8_t ZennyAtomicUByteAddFetch(volatile struct ZennyAtomicUByte *atomic, uint8_t value)
+{
+    return (uint8_t)ZennyAtomicByteAddFetch((volatile struct ZennyAtomicByte*)atomic, (int8_t)value);
+}
+
+ZENNY_ATOMICS_IMPL uint8_t ZennyAtomicUByteSubFetch(volatile struct ZennyAtomicUByte *atomic, uint8_t value)
+{
+    return (uint8_t)ZennyAtomicByteSubFetch((volatile struct ZennyAtomicByte*)atomic, (int8_t)value);
+}
+
+ZENNY_ATOMICS_IMPL uint8_t ZennyAtomicUByteOrFetch(volatile struct ZennyAtomicUByte *atomic, uint8_t value)
+{
+    return (uint8_t)ZennyAtomicByteOrFetch((volatile struct ZennyAtomicByte*)atomic, (int8_t)value);
+}
+
+ZENNY_ATOMICS_IMPL uint8_t ZennyAtomicUByteAndFetch(volatile struct ZennyAtomicUByte *atomic, uint8_t value)
+{
+    return (uint8_t)ZennyAtomicByteAndFetch((volatile struct ZennyAtomicByte*)atomic, (int8_t)value);
+}
+
+ZENNY_ATOMICS_IMPL uint8_t ZennyAtomicUByteXorFetch(volatile struct ZennyAtomicUByte *atomic, uint8_t value)
+{
+    return (uint8_t)ZennyAtomicByteXorFetch((volatile struct ZennyAtomicByte*)atomic, (int8_t)value);
+}
+
+ZENNY_ATOMICS_IMPL uint8_t ZennyAtomicUByteLoadExplicit(volatile struct ZennyAtomicUByte *atomic, enum ZennyMemoryOrder order)
+{
+    return (uint8_t)ZennyAtomicByteLoadExplicit((volatile struct ZennyAtomicByte*)atomic, order);
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicUByteStoreExplicit(volatile struct ZennyAtomicUByte *atomic, uint8_t value, enum ZennyMemoryOrder order)
+{
+    ZennyAtomicByteStoreExplicit((volatile struct ZennyAtomicByte*)atomic, (int8_t)value, order);
+}
+
+ZENNY_ATOMICS_IMPL uint8_t ZennyAtomicUByteAddExplicit(volatile struct ZennyAtomicUByte *atomic, uint8_t value, enum ZennyMemoryOrder order)
+{
+    return (uint8_t)ZennyAtomicByteAddExplicit((volatile struct ZennyAtomicByte*)atomic, (int8_t)value, order);
+}
+
+ZENNY_ATOMICS_IMPL uint8_t ZennyAtomicUByteSubExplicit(volatile struct ZennyAtomicUByte *atomic, uint8_t value, enum ZennyMemoryOrder order)
+{
+    return (uint8_t)ZennyAtomicByteSubExplicit((volatile struct ZennyAtomicByte*)atomic, (int8_t)value, order);
+}
+
+ZENNY_ATOMICS_IMPL uint8_t ZennyAtomicUByteOrExplicit(volatile struct ZennyAtomicUByte *atomic, uint8_t value, enum ZennyMemoryOrder order)
+{
+    return (uint8_t)ZennyAtomicByteOrExplicit((volatile struct ZennyAtomicByte*)atomic, (int8_t)value, order);
+}
+
+ZENNY_ATOMICS_IMPL uint8_t ZennyAtomicUByteXorExplicit(volatile struct ZennyAtomicUByte *atomic, uint8_t value, enum ZennyMemoryOrder order)
+{
+    return (uint8_t)ZennyAtomicByteXorExplicit((volatile struct ZennyAtomicByte*)atomic, (int8_t)value, order);
+}
+
+ZENNY_ATOMICS_IMPL uint8_t ZennyAtomicUByteAndExplicit(volatile struct ZennyAtomicUByte *atomic, uint8_t value, enum ZennyMemoryOrder order)
+{
+    return (uint8_t)ZennyAtomicByteAndExplicit((volatile struct ZennyAtomicByte*)atomic, (int8_t)value, order);
+}
+
+ZENNY_ATOMICS_IMPL uint8_t ZennyAtomicUByteExchangeExplicit(volatile struct ZennyAtomicUByte *atomic, uint8_t value, enum ZennyMemoryOrder order)
+{
+    return (uint8_t)ZennyAtomicByteExchangeExplicit((volatile struct ZennyAtomicByte*)atomic, (int8_t)value, order);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicUByteCompareExchangeExplicit(volatile struct ZennyAtomicUByte *atomic, uint8_t *expected, uint8_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure)
+{
+    return ZennyAtomicByteCompareExchangeExplicit((volatile struct ZennyAtomicByte*)atomic, (int8_t*)expected, (int8_t)desired, success, failure);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicUByteCompareExchangeWeakExplicit(volatile struct ZennyAtomicUByte *atomic, uint8_t *expected, uint8_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure)
+{
+    return ZennyAtomicByteCompareExchangeWeakExplicit((volatile struct ZennyAtomicByte*)atomic, (int8_t*)expected, (int8_t)desired, success, failure);
+}
+
+ZENNY_ATOMICS_IMPL uint8_t ZennyAtomicUByteMinExplicit(volatile struct ZennyAtomicUByte *atomic, uint8_t value, enum ZennyMemoryOrder order)
+{
+    return ZennyAtomicByteMinUnsignedExplicit((volatile struct ZennyAtomicByte*)atomic, value, order);
+}
+
+ZENNY_ATOMICS_IMPL uint8_t ZennyAtomicUByteMaxExplicit(volatile struct ZennyAtomicUByte *atomic, uint8_t value, enum ZennyMemoryOrder order)
+{
+    return ZennyAtomicByteMaxUnsignedExplicit((volatile struct ZennyAtomicByte*)atomic, value, order);
+}
+
+ZENNY_ATOMICS_IMPL uint8_t ZennyAtomicUByteAddFetchExplicit(volatile struct ZennyAtomicUByte *atomic, uint8_t value, enum ZennyMemoryOrder order)
+{
+    return (uint8_t)ZennyAtomicByteAddFetchExplicit((volatile struct ZennyAtomicByte*)atomic, (int8_t)value, order);
+}
+
+ZENNY_ATOMICS_IMPL uint8_t ZennyAtomicUByteSubFetchExplicit(volatile struct ZennyAtomicUByte *atomic, uint8_t value, enum ZennyMemoryOrder order)
+{
+    return (uint8_t)ZennyAtomicByteSubFetchExplicit((volatile struct ZennyAtomicByte*)atomic, (int8_t)value, order);
+}
+
+ZENNY_ATOMICS_IMPL uint8_t ZennyAtomicUByteOrFetchExplicit(volatile struct ZennyAtomicUByte *atomic, uint8_t value, enum ZennyMemoryOrder order)
+{
+    return (uint8_t)ZennyAtomicByteOrFetchExplicit((volatile struct ZennyAtomicByte*)atomic, (int8_t)value, order);
+}
+
+ZENNY_ATOMICS_IMPL uint8_t ZennyAtomicUByteAndFetchExplicit(volatile struct ZennyAtomicUByte *atomic, uint8_t value, enum ZennyMemoryOrder order)
+{
+    return (uint8_t)ZennyAtomicByteAndFetchExplicit((volatile struct ZennyAtomicByte*)atomic, (int8_t)value, order);
+}
+
+ZENNY_ATOMICS_IMPL uint8_t ZennyAtomicUByteXorFetchExplicit(volatile struct ZennyAtomicUByte *atomic, uint8_t value, enum ZennyMemoryOrder order)
+{
+    return (uint8_t)ZennyAtomicByteXorFetchExplicit((volatile struct ZennyAtomicByte*)atomic, (int8_t)value, order);
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicUShortInit(volatile struct ZennyAtomicUShort *atomic, uint16_t value)
+{
+    ZennyAtomicShortInit((volatile struct ZennyAtomicShort*)atomic, (int16_t)value);
+}
+
+ZENNY_ATOMICS_IMPL uint16_t ZennyAtomicUShortLoad(volatile struct ZennyAtomicUShort *atomic)
+{
+    return (uint16_t)ZennyAtomicShortLoad((volatile struct ZennyAtomicShort*)atomic);
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicUShortStore(volatile struct ZennyAtomicUShort *atomic, uint16_t value)
+{
+    ZennyAtomicShortStore((volatile struct ZennyAtomicShort*)atomic, (int16_t)value);
+}
+
+ZENNY_ATOMICS_IMPL uint16_t ZennyAtomicUShortAdd(volatile struct ZennyAtomicUShort *atomic, uint16_t value)
+{
+    return (uint16_t)ZennyAtomicShortAdd((volatile struct ZennyAtomicShort*)atomic, (int16_t)value);
+}
+
+ZENNY_ATOMICS_IMPL uint16_t ZennyAtomicUShortSub(volatile struct ZennyAtomicUShort *atomic, uint16_t value)
+{
+    return (uint16_t)ZennyAtomicShortSub((volatile struct ZennyAtomicShort*)atomic, (int16_t)value);
+}
+
+ZENNY_ATOMICS_IMPL uint16_t ZennyAtomicUShortOr(volatile struct ZennyAtomicUShort *atomic, uint16_t value)
+{
+    return (uint16_t)ZennyAtomicShortOr((volatile struct ZennyAtomicShort*)atomic, (int16_t)value);
+}
+
+ZENNY_ATOMICS_IMPL uint16_t ZennyAtomicUShortXor(volatile struct ZennyAtomicUShort *atomic, uint16_t value)
+{
+    return (uint16_t)ZennyAtomicShortXor((volatile struct ZennyAtomicShort*)atomic, (int16_t)value);
+}
+
+ZENNY_ATOMICS_IMPL uint16_t ZennyAtomicUShortAnd(volatile struct ZennyAtomicUShort *atomic, uint16_t value)
+{
+    return (uint16_t)ZennyAtomicShortAnd((volatile struct ZennyAtomicShort*)atomic, (int16_t)value);
+}
+
+ZENNY_ATOMICS_IMPL uint16_t ZennyAtomicUShortExchange(volatile struct ZennyAtomicUShort *atomic, uint16_t value)
+{
+    return (uint16_t)ZennyAtomicShortExchange((volatile struct ZennyAtomicShort*)atomic, (int16_t)value);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicUShortCompareExchange(volatile struct ZennyAtomicUShort *atomic, uint16_t *expected, uint16_t desired)
+{
+    return ZennyAtomicShortCompareExchange((volatile struct ZennyAtomicShort*)atomic, (int16_t*)expected, (int16_t)desired);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicUShortCompareExchangeWeak(volatile struct ZennyAtomicUShort *atomic, uint16_t *expected, uint16_t desired)
+{
+    return ZennyAtomicShortCompareExchangeWeak((volatile struct ZennyAtomicShort*)atomic, (int16_t*)expected, (int16_t)desired);
+}
+
+ZENNY_ATOMICS_IMPL uint16_t ZennyAtomicUShortMin(volatile struct ZennyAtomicUShort *atomic, uint16_t value)
+{
+    return ZennyAtomicShortMinUnsigned((volatile struct ZennyAtomicShort*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL uint16_t ZennyAtomicUShortMax(volatile struct ZennyAtomicUShort *atomic, uint16_t value)
+{
+    return ZennyAtomicShortMaxUnsigned((volatile struct ZennyAtomicShort*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL uint16_t ZennyAtomicUShortAddFetch(volatile struct ZennyAtomicUShort *atomic, uint16_t value)
+{
+    return (uint16_t)ZennyAtomicShortAddFetch((volatile struct ZennyAtomicShort*)atomic, (int16_t)value);
+}
+
+ZENNY_ATOMICS_IMPL uint16_t ZennyAtomicUShortSubFetch(volatile struct ZennyAtomicUShort *atomic, uint16_t value)
+{
+    return (uint16_t)ZennyAtomicShortSubFetch((volatile struct ZennyAtomicShort*)atomic, (int16_t)value);
+}
+
+ZENNY_ATOMICS_IMPL uint16_t ZennyAtomicUShortOrFetch(volatile struct ZennyAtomicUShort *atomic, uint16_t value)
+{
+    return (uint16_t)ZennyAtomicShortOrFetch((volatile struct ZennyAtomicShort*)atomic, (int16_t)value);
+}
+
+ZENNY_ATOMICS_IMPL uint16_t ZennyAtomicUShortAndFetch(volatile struct ZennyAtomicUShort *atomic, uint16_t value)
+{
+    return (uint16_t)ZennyAtomicShortAndFetch((volatile struct ZennyAtomicShort*)atomic, (int16_t)value);
+}
+
+ZENNY_ATOMICS_IMPL uint16_t ZennyAtomicUShortXorFetch(volatile struct ZennyAtomicUShort *atomic, uint16_t value)
+{
+    return (uint16_t)ZennyAtomicShortXorFetch((volatile struct ZennyAtomicShort*)atomic, (int16_t)value);
+}
+
+ZENNY_ATOMICS_IMPL uint16_t ZennyAtomicUShortLoadExplicit(volatile struct ZennyAtomicUShort *atomic, enum ZennyMemoryOrder order)
+{
+    return (uint16_t)ZennyAtomicShortLoadExplicit((volatile struct ZennyAtomicShort*)atomic, order);
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicUShortStoreExplicit(volatile struct ZennyAtomicUShort *atomic, uint16_t value, enum ZennyMemoryOrder order)
+{
+    ZennyAtomicShortStoreExplicit((volatile struct ZennyAtomicShort*)atomic, (int16_t)value, order);
+}
+
+ZENNY_ATOMICS_IMPL uint16_t ZennyAtomicUShortAddExplicit(volatile struct ZennyAtomicUShort *atomic, uint16_t value, enum ZennyMemoryOrder order)
+{
+    return (uint16_t)ZennyAtomicShortAddExplicit((volatile struct ZennyAtomicShort*)atomic, (int16_t)value, order);
+}
+
+ZENNY_ATOMICS_IMPL uint16_t ZennyAtomicUShortSubExplicit(volatile struct ZennyAtomicUShort *atomic, uint16_t value, enum ZennyMemoryOrder order)
+{
+    return (uint16_t)ZennyAtomicShortSubExplicit((volatile struct ZennyAtomicShort*)atomic, (int16_t)value, order);
+}
+
+ZENNY_ATOMICS_IMPL uint16_t ZennyAtomicUShortOrExplicit(volatile struct ZennyAtomicUShort *atomic, uint16_t value, enum ZennyMemoryOrder order)
+{
+    return (uint16_t)ZennyAtomicShortOrExplicit((volatile struct ZennyAtomicShort*)atomic, (int16_t)value, order);
+}
+
+ZENNY_ATOMICS_IMPL uint16_t ZennyAtomicUShortXorExplicit(volatile struct ZennyAtomicUShort *atomic, uint16_t value, enum ZennyMemoryOrder order)
+{
+    return (uint16_t)ZennyAtomicShortXorExplicit((volatile struct ZennyAtomicShort*)atomic, (int16_t)value, order);
+}
+
+ZENNY_ATOMICS_IMPL uint16_t ZennyAtomicUShortAndExplicit(volatile struct ZennyAtomicUShort *atomic, uint16_t value, enum ZennyMemoryOrder order)
+{
+    return (uint16_t)ZennyAtomicShortAndExplicit((volatile struct ZennyAtomicShort*)atomic, (int16_t)value, order);
+}
+
+ZENNY_ATOMICS_IMPL uint16_t ZennyAtomicUShortExchangeExplicit(volatile struct ZennyAtomicUShort *atomic, uint16_t value, enum ZennyMemoryOrder order)
+{
+    return (uint16_t)ZennyAtomicShortExchangeExplicit((volatile struct ZennyAtomicShort*)atomic, (int16_t)value, order);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicUShortCompareExchangeExplicit(volatile struct ZennyAtomicUShort *atomic, uint16_t *expected, uint16_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure)
+{
+    return ZennyAtomicShortCompareExchangeExplicit((volatile struct ZennyAtomicShort*)atomic, (int16_t*)expected, (int16_t)desired, success, failure);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicUShortCompareExchangeWeakExplicit(volatile struct ZennyAtomicUShort *atomic, uint16_t *expected, uint16_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure)
+{
+    return ZennyAtomicShortCompareExchangeWeakExplicit((volatile struct ZennyAtomicShort*)atomic, (int16_t*)expected, (int16_t)desired, success, failure);
+}
+
+ZENNY_ATOMICS_IMPL uint16_t ZennyAtomicUShortMinExplicit(volatile struct ZennyAtomicUShort *atomic, uint16_t value, enum ZennyMemoryOrder order)
+{
+    return ZennyAtomicShortMinUnsignedExplicit((volatile struct ZennyAtomicShort*)atomic, value, order);
+}
+
+ZENNY_ATOMICS_IMPL uint16_t ZennyAtomicUShortMaxExplicit(volatile struct ZennyAtomicUShort *atomic, uint16_t value, enum ZennyMemoryOrder order)
+{
+    return ZennyAtomicShortMaxUnsignedExplicit((volatile struct ZennyAtomicShort*)atomic, value, order);
+}
+
+ZENNY_ATOMICS_IMPL uint16_t ZennyAtomicUShortAddFetchExplicit(volatile struct ZennyAtomicUShort *atomic, uint16_t value, enum ZennyMemoryOrder order)
+{
+    return (uint16_t)ZennyAtomicShortAddFetchExplicit((volatile struct ZennyAtomicShort*)atomic, (int16_t)value, order);
+}
+
+ZENNY_ATOMICS_IMPL uint16_t ZennyAtomicUShortSubFetchExplicit(volatile struct ZennyAtomicUShort *atomic, uint16_t value, enum ZennyMemoryOrder order)
+{
+    return (uint16_t)ZennyAtomicShortSubFetchExplicit((volatile struct ZennyAtomicShort*)atomic, (int16_t)value, order);
+}
+
+ZENNY_ATOMICS_IMPL uint16_t ZennyAtomicUShortOrFetchExplicit(volatile struct ZennyAtomicUShort *atomic, uint16_t value, enum ZennyMemoryOrder order)
+{
+    return (uint16_t)ZennyAtomicShortOrFetchExplicit((volatile struct ZennyAtomicShort*)atomic, (int16_t)value, order);
+}
+
+ZENNY_ATOMICS_IMPL uint16_t ZennyAtomicUShortAndFetchExplicit(volatile struct ZennyAtomicUShort *atomic, uint16_t value, enum ZennyMemoryOrder order)
+{
+    return (uint16_t)ZennyAtomicShortAndFetchExplicit((volatile struct ZennyAtomicShort*)atomic, (int16_t)value, order);
+}
+
+ZENNY_ATOMICS_IMPL uint16_t ZennyAtomicUShortXorFetchExplicit(volatile struct ZennyAtomicUShort *atomic, uint16_t value, enum ZennyMemoryOrder order)
+{
+    return (uint16_t)ZennyAtomicShortXorFetchExplicit((volatile struct ZennyAtomicShort*)atomic, (int16_t)value, order);
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicUIntInit(volatile struct ZennyAtomicUInt *atomic, unsigned value)
+{
+    ZennyAtomicIntInit((volatile struct ZennyAtomicInt*)atomic, (int)value);
+}
+
+ZENNY_ATOMICS_IMPL unsigned ZennyAtomicUIntLoad(volatile struct ZennyAtomicUInt *atomic)
+{
+    return (unsigned)ZennyAtomicIntLoad((volatile struct ZennyAtomicInt*)atomic);
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicUIntStore(volatile struct ZennyAtomicUInt *atomic, unsigned value)
+{
+    ZennyAtomicIntStore((volatile struct ZennyAtomicInt*)atomic, (int)value);
+}
+
+ZENNY_ATOMICS_IMPL unsigned ZennyAtomicUIntAdd(volatile struct ZennyAtomicUInt *atomic, unsigned value)
+{
+    return (unsigned)ZennyAtomicIntAdd((volatile struct ZennyAtomicInt*)atomic, (int)value);
+}
+
+ZENNY_ATOMICS_IMPL unsigned ZennyAtomicUIntSub(volatile struct ZennyAtomicUInt *atomic, unsigned value)
+{
+    return (unsigned)ZennyAtomicIntSub((volatile struct ZennyAtomicInt*)atomic, (int)value);
+}
+
+ZENNY_ATOMICS_IMPL unsigned ZennyAtomicUIntOr(volatile struct ZennyAtomicUInt *atomic, unsigned value)
+{
+    return (unsigned)ZennyAtomicIntOr((volatile struct ZennyAtomicInt*)atomic, (int)value);
+}
+
+ZENNY_ATOMICS_IMPL unsigned ZennyAtomicUIntXor(volatile struct ZennyAtomicUInt *atomic, unsigned value)
+{
+    return (unsigned)ZennyAtomicIntXor((volatile struct ZennyAtomicInt*)atomic, (int)value);
+}
+
+ZENNY_ATOMICS_IMPL unsigned ZennyAtomicUIntAnd(volatile struct ZennyAtomicUInt *atomic, unsigned value)
+{
+    return (unsigned)ZennyAtomicIntAnd((volatile struct ZennyAtomicInt*)atomic, (int)value);
+}
+
+ZENNY_ATOMICS_IMPL unsigned ZennyAtomicUIntExchange(volatile struct ZennyAtomicUInt *atomic, unsigned value)
+{
+    return (unsigned)ZennyAtomicIntExchange((volatile struct ZennyAtomicInt*)atomic, (int)value);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicUIntCompareExchange(volatile struct ZennyAtomicUInt *atomic, unsigned *expected, unsigned desired)
+{
+    return ZennyAtomicIntCompareExchange((volatile struct ZennyAtomicInt*)atomic, (int*)expected, (int)desired);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicUIntCompareExchangeWeak(volatile struct ZennyAtomicUInt *atomic, unsigned *expected, unsigned desired)
+{
+    return ZennyAtomicIntCompareExchangeWeak((volatile struct ZennyAtomicInt*)atomic, (int*)expected, (int)desired);
+}
+
+ZENNY_ATOMICS_IMPL unsigned ZennyAtomicUIntMin(volatile struct ZennyAtomicUInt *atomic, unsigned value)
+{
+    return ZennyAtomicIntMinUnsigned((volatile struct ZennyAtomicInt*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL unsigned ZennyAtomicUIntMax(volatile struct ZennyAtomicUInt *atomic, unsigned value)
+{
+    return ZennyAtomicIntMaxUnsigned((volatile struct ZennyAtomicInt*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL unsigned ZennyAtomicUIntAddFetch(volatile struct ZennyAtomicUInt *atomic, unsigned value)
+{
+    return (unsigned)ZennyAtomicIntAddFetch((volatile struct ZennyAtomicInt*)atomic, (int)value);
+}
+
+ZENNY_ATOMICS_IMPL unsigned ZennyAtomicUIntSubFetch(volatile struct ZennyAtomicUInt *atomic, unsigned value)
+{
+    return (unsigned)ZennyAtomicIntSubFetch((volatile struct ZennyAtomicInt*)atomic, (int)value);
+}
+
+ZENNY_ATOMICS_IMPL unsigned ZennyAtomicUIntOrFetch(volatile struct ZennyAtomicUInt *atomic, unsigned value)
+{
+    return (unsigned)ZennyAtomicIntOrFetch((volatile struct ZennyAtomicInt*)atomic, (int)value);
+}
+
+ZENNY_ATOMICS_IMPL unsigned ZennyAtomicUIntAndFetch(volatile struct ZennyAtomicUInt *atomic, unsigned value)
+{
+    return (unsigned)ZennyAtomicIntAndFetch((volatile struct ZennyAtomicInt*)atomic, (int)value);
+}
+
+ZENNY_ATOMICS_IMPL unsigned ZennyAtomicUIntXorFetch(volatile struct ZennyAtomicUInt *atomic, unsigned value)
+{
+    return (unsigned)ZennyAtomicIntXorFetch((volatile struct ZennyAtomicInt*)atomic, (int)value);
+}
+
+ZENNY_ATOMICS_IMPL unsigned ZennyAtomicUIntLoadExplicit(volatile struct ZennyAtomicUInt *atomic, enum ZennyMemoryOrder order)
+{
+    return (unsigned)ZennyAtomicIntLoadExplicit((volatile struct ZennyAtomicInt*)atomic, order);
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicUIntStoreExplicit(volatile struct ZennyAtomicUInt *atomic, unsigned value, enum ZennyMemoryOrder order)
+{
+    ZennyAtomicIntStoreExplicit((volatile struct ZennyAtomicInt*)atomic, (int)value, order);
+}
+
+ZENNY_ATOMICS_IMPL unsigned ZennyAtomicUIntAddExplicit(volatile struct ZennyAtomicUInt *atomic, unsigned value, enum ZennyMemoryOrder order)
+{
+    return (unsigned)ZennyAtomicIntAddExplicit((volatile struct ZennyAtomicInt*)atomic, (int)value, order);
+}
+
+ZENNY_ATOMICS_IMPL unsigned ZennyAtomicUIntSubExplicit(volatile struct ZennyAtomicUInt *atomic, unsigned value, enum ZennyMemoryOrder order)
+{
+    return (unsigned)ZennyAtomicIntSubExplicit((volatile struct ZennyAtomicInt*)atomic, (int)value, order);
+}
+
+ZENNY_ATOMICS_IMPL unsigned ZennyAtomicUIntOrExplicit(volatile struct ZennyAtomicUInt *atomic, unsigned value, enum ZennyMemoryOrder order)
+{
+    return (unsigned)ZennyAtomicIntOrExplicit((volatile struct ZennyAtomicInt*)atomic, (int)value, order);
+}
+
+ZENNY_ATOMICS_IMPL unsigned ZennyAtomicUIntXorExplicit(volatile struct ZennyAtomicUInt *atomic, unsigned value, enum ZennyMemoryOrder order)
+{
+    return (unsigned)ZennyAtomicIntXorExplicit((volatile struct ZennyAtomicInt*)atomic, (int)value, order);
+}
+
+ZENNY_ATOMICS_IMPL unsigned ZennyAtomicUIntAndExplicit(volatile struct ZennyAtomicUInt *atomic, unsigned value, enum ZennyMemoryOrder order)
+{
+    return (unsigned)ZennyAtomicIntAndExplicit((volatile struct ZennyAtomicInt*)atomic, (int)value, order);
+}
+
+ZENNY_ATOMICS_IMPL unsigned ZennyAtomicUIntExchangeExplicit(volatile struct ZennyAtomicUInt *atomic, unsigned value, enum ZennyMemoryOrder order)
+{
+    return (unsigned)ZennyAtomicIntExchangeExplicit((volatile struct ZennyAtomicInt*)atomic, (int)value, order);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicUIntCompareExchangeExplicit(volatile struct ZennyAtomicUInt *atomic, unsigned *expected, unsigned desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure)
+{
+    return ZennyAtomicIntCompareExchangeExplicit((volatile struct ZennyAtomicInt*)atomic, (int*)expected, (int)desired, success, failure);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicUIntCompareExchangeWeakExplicit(volatile struct ZennyAtomicUInt *atomic, unsigned *expected, unsigned desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure)
+{
+    return ZennyAtomicIntCompareExchangeWeakExplicit((volatile struct ZennyAtomicInt*)atomic, (int*)expected, (int)desired, success, failure);
+}
+
+ZENNY_ATOMICS_IMPL unsigned ZennyAtomicUIntMinExplicit(volatile struct ZennyAtomicUInt *atomic, unsigned value, enum ZennyMemoryOrder order)
+{
+    return ZennyAtomicIntMinUnsignedExplicit((volatile struct ZennyAtomicInt*)atomic, value, order);
+}
+
+ZENNY_ATOMICS_IMPL unsigned ZennyAtomicUIntMaxExplicit(volatile struct ZennyAtomicUInt *atomic, unsigned value, enum ZennyMemoryOrder order)
+{
+    return ZennyAtomicIntMaxUnsignedExplicit((volatile struct ZennyAtomicInt*)atomic, value, order);
+}
+
+ZENNY_ATOMICS_IMPL unsigned ZennyAtomicUIntAddFetchExplicit(volatile struct ZennyAtomicUInt *atomic, unsigned value, enum ZennyMemoryOrder order)
+{
+    return (unsigned)ZennyAtomicIntAddFetchExplicit((volatile struct ZennyAtomicInt*)atomic, (int)value, order);
+}
+
+ZENNY_ATOMICS_IMPL unsigned ZennyAtomicUIntSubFetchExplicit(volatile struct ZennyAtomicUInt *atomic, unsigned value, enum ZennyMemoryOrder order)
+{
+    return (unsigned)ZennyAtomicIntSubFetchExplicit((volatile struct ZennyAtomicInt*)atomic, (int)value, order);
+}
+
+ZENNY_ATOMICS_IMPL unsigned ZennyAtomicUIntOrFetchExplicit(volatile struct ZennyAtomicUInt *atomic, unsigned value, enum ZennyMemoryOrder order)
+{
+    return (unsigned)ZennyAtomicIntOrFetchExplicit((volatile struct ZennyAtomicInt*)atomic, (int)value, order);
+}
+
+ZENNY_ATOMICS_IMPL unsigned ZennyAtomicUIntAndFetchExplicit(volatile struct ZennyAtomicUInt *atomic, unsigned value, enum ZennyMemoryOrder order)
+{
+    return (unsigned)ZennyAtomicIntAndFetchExplicit((volatile struct ZennyAtomicInt*)atomic, (int)value, order);
+}
+
+ZENNY_ATOMICS_IMPL unsigned ZennyAtomicUIntXorFetchExplicit(volatile struct ZennyAtomicUInt *atomic, unsigned value, enum ZennyMemoryOrder order)
+{
+    return (unsigned)ZennyAtomicIntXorFetchExplicit((volatile struct ZennyAtomicInt*)atomic, (int)value, order);
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicULongInit(volatile struct ZennyAtomicULong *atomic, uint64_t value)
+{
+    ZennyAtomicLongInit((volatile struct ZennyAtomicLong*)atomic, (int64_t)value);
+}
+
+ZENNY_ATOMICS_IMPL uint64_t ZennyAtomicULongLoad(volatile struct ZennyAtomicULong *atomic)
+{
+    return (uint64_t)ZennyAtomicLongLoad((volatile struct ZennyAtomicLong*)atomic);
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicULongStore(volatile struct ZennyAtomicULong *atomic, uint64_t value)
+{
+    ZennyAtomicLongStore((volatile struct ZennyAtomicLong*)atomic, (int64_t)value);
+}
+
+ZENNY_ATOMICS_IMPL uint64_t ZennyAtomicULongAdd(volatile struct ZennyAtomicULong *atomic, uint64_t value)
+{
+    return (uint64_t)ZennyAtomicLongAdd((volatile struct ZennyAtomicLong*)atomic, (int64_t)value);
+}
+
+ZENNY_ATOMICS_IMPL uint64_t ZennyAtomicULongSub(volatile struct ZennyAtomicULong *atomic, uint64_t value)
+{
+    return (uint64_t)ZennyAtomicLongSub((volatile struct ZennyAtomicLong*)atomic, (int64_t)value);
+}
+
+ZENNY_ATOMICS_IMPL uint64_t ZennyAtomicULongOr(volatile struct ZennyAtomicULong *atomic, uint64_t value)
+{
+    return (uint64_t)ZennyAtomicLongOr((volatile struct ZennyAtomicLong*)atomic, (int64_t)value);
+}
+
+ZENNY_ATOMICS_IMPL uint64_t ZennyAtomicULongXor(volatile struct ZennyAtomicULong *atomic, uint64_t value)
+{
+    return (uint64_t)ZennyAtomicLongXor((volatile struct ZennyAtomicLong*)atomic, (int64_t)value);
+}
+
+ZENNY_ATOMICS_IMPL uint64_t ZennyAtomicULongAnd(volatile struct ZennyAtomicULong *atomic, uint64_t value)
+{
+    return (uint64_t)ZennyAtomicLongAnd((volatile struct ZennyAtomicLong*)atomic, (int64_t)value);
+}
+
+ZENNY_ATOMICS_IMPL uint64_t ZennyAtomicULongExchange(volatile struct ZennyAtomicULong *atomic, uint64_t value)
+{
+    return (uint64_t)ZennyAtomicLongExchange((volatile struct ZennyAtomicLong*)atomic, (int64_t)value);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicULongCompareExchange(volatile struct ZennyAtomicULong *atomic, uint64_t *expected, uint64_t desired)
+{
+    return ZennyAtomicLongCompareExchange((volatile struct ZennyAtomicLong*)atomic, (int64_t*)expected, (int64_t)desired);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicULongCompareExchangeWeak(volatile struct ZennyAtomicULong *atomic, uint64_t *expected, uint64_t desired)
+{
+    return ZennyAtomicLongCompareExchangeWeak((volatile struct ZennyAtomicLong*)atomic, (int64_t*)expected, (int64_t)desired);
+}
+
+ZENNY_ATOMICS_IMPL uint64_t ZennyAtomicULongMin(volatile struct ZennyAtomicULong *atomic, uint64_t value)
+{
+    return ZennyAtomicLongMinUnsigned((volatile struct ZennyAtomicLong*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL uint64_t ZennyAtomicULongMax(volatile struct ZennyAtomicULong *atomic, uint64_t value)
+{
+    return ZennyAtomicLongMaxUnsigned((volatile struct ZennyAtomicLong*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL uint64_t ZennyAtomicULongAddFetch(volatile struct ZennyAtomicULong *atomic, uint64_t value)
+{
+    return (uint64_t)ZennyAtomicLongAddFetch((volatile struct ZennyAtomicLong*)atomic, (int64_t)value);
+}
+
+ZENNY_ATOMICS_IMPL uint64_t ZennyAtomicULongSubFetch(volatile struct ZennyAtomicULong *atomic, uint64_t value)
+{
+    return (uint64_t)ZennyAtomicLongSubFetch((volatile struct ZennyAtomicLong*)atomic, (int64_t)value);
+}
+
+ZENNY_ATOMICS_IMPL uint64_t ZennyAtomicULongOrFetch(volatile struct ZennyAtomicULong *atomic, uint64_t value)
+{
+    return (uint64_t)ZennyAtomicLongOrFetch((volatile struct ZennyAtomicLong*)atomic, (int64_t)value);
+}
+
+ZENNY_ATOMICS_IMPL uint64_t ZennyAtomicULongAndFetch(volatile struct ZennyAtomicULong *atomic, uint64_t value)
+{
+    return (uint64_t)ZennyAtomicLongAndFetch((volatile struct ZennyAtomicLong*)atomic, (int64_t)value);
+}
+
+ZENNY_ATOMICS_IMPL uint64_t ZennyAtomicULongXorFetch(volatile struct ZennyAtomicULong *atomic, uint64_t value)
+{
+    return (uint64_t)ZennyAtomicLongXorFetch((volatile struct ZennyAtomicLong*)atomic, (int64_t)value);
+}
+
+ZENNY_ATOMICS_IMPL uint64_t ZennyAtomicULongLoadExplicit(volatile struct ZennyAtomicULong *atomic, enum ZennyMemoryOrder order)
+{
+    return (uint64_t)ZennyAtomicLongLoadExplicit((volatile struct ZennyAtomicLong*)atomic, order);
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicULongStoreExplicit(volatile struct ZennyAtomicULong *atomic, uint64_t value, enum ZennyMemoryOrder order)
+{
+    ZennyAtomicLongStoreExplicit((volatile struct ZennyAtomicLong*)atomic, (int64_t)value, order);
+}
+
+ZENNY_ATOMICS_IMPL uint64_t ZennyAtomicULongAddExplicit(volatile struct ZennyAtomicULong *atomic, uint64_t value, enum ZennyMemoryOrder order)
+{
+    return (uint64_t)ZennyAtomicLongAddExplicit((volatile struct ZennyAtomicLong*)atomic, (int64_t)value, order);
+}
+
+ZENNY_ATOMICS_IMPL uint64_t ZennyAtomicULongSubExplicit(volatile struct ZennyAtomicULong *atomic, uint64_t value, enum ZennyMemoryOrder order)
+{
+    return (uint64_t)ZennyAtomicLongSubExplicit((volatile struct ZennyAtomicLong*)atomic, (int64_t)value, order);
+}
+
+ZENNY_ATOMICS_IMPL uint64_t ZennyAtomicULongOrExplicit(volatile struct ZennyAtomicULong *atomic, uint64_t value, enum ZennyMemoryOrder order)
+{
+    return (uint64_t)ZennyAtomicLongOrExplicit((volatile struct ZennyAtomicLong*)atomic, (int64_t)value, order);
+}
+
+ZENNY_ATOMICS_IMPL uint64_t ZennyAtomicULongXorExplicit(volatile struct ZennyAtomicULong *atomic, uint64_t value, enum ZennyMemoryOrder order)
+{
+    return (uint64_t)ZennyAtomicLongXorExplicit((volatile struct ZennyAtomicLong*)atomic, (int64_t)value, order);
+}
+
+ZENNY_ATOMICS_IMPL uint64_t ZennyAtomicULongAndExplicit(volatile struct ZennyAtomicULong *atomic, uint64_t value, enum ZennyMemoryOrder order)
+{
+    return (uint64_t)ZennyAtomicLongAndExplicit((volatile struct ZennyAtomicLong*)atomic, (int64_t)value, order);
+}
+
+ZENNY_ATOMICS_IMPL uint64_t ZennyAtomicULongExchangeExplicit(volatile struct ZennyAtomicULong *atomic, uint64_t value, enum ZennyMemoryOrder order)
+{
+    return (uint64_t)ZennyAtomicLongExchangeExplicit((volatile struct ZennyAtomicLong*)atomic, (int64_t)value, order);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicULongCompareExchangeExplicit(volatile struct ZennyAtomicULong *atomic, uint64_t *expected, uint64_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure)
+{
+    return ZennyAtomicLongCompareExchangeExplicit((volatile struct ZennyAtomicLong*)atomic, (int64_t*)expected, (int64_t)desired, success, failure);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicULongCompareExchangeWeakExplicit(volatile struct ZennyAtomicULong *atomic, uint64_t *expected, uint64_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure)
+{
+    return ZennyAtomicLongCompareExchangeWeakExplicit((volatile struct ZennyAtomicLong*)atomic, (int64_t*)expected, (int64_t)desired, success, failure);
+}
+
+ZENNY_ATOMICS_IMPL uint64_t ZennyAtomicULongMinExplicit(volatile struct ZennyAtomicULong *atomic, uint64_t value, enum ZennyMemoryOrder order)
+{
+    return ZennyAtomicLongMinUnsignedExplicit((volatile struct ZennyAtomicLong*)atomic, value, order);
+}
+
+ZENNY_ATOMICS_IMPL uint64_t ZennyAtomicULongMaxExplicit(volatile struct ZennyAtomicULong *atomic, uint64_t value, enum ZennyMemoryOrder order)
+{
+    return ZennyAtomicLongMaxUnsignedExplicit((volatile struct ZennyAtomicLong*)atomic, value, order);
+}
+
+ZENNY_ATOMICS_IMPL uint64_t ZennyAtomicULongAddFetchExplicit(volatile struct ZennyAtomicULong *atomic, uint64_t value, enum ZennyMemoryOrder order)
+{
+    return (uint64_t)ZennyAtomicLongAddFetchExplicit((volatile struct ZennyAtomicLong*)atomic, (int64_t)value, order);
+}
+
+ZENNY_ATOMICS_IMPL uint64_t ZennyAtomicULongSubFetchExplicit(volatile struct ZennyAtomicULong *atomic, uint64_t value, enum ZennyMemoryOrder order)
+{
+    return (uint64_t)ZennyAtomicLongSubFetchExplicit((volatile struct ZennyAtomicLong*)atomic, (int64_t)value, order);
+}
+
+ZENNY_ATOMICS_IMPL uint64_t ZennyAtomicULongOrFetchExplicit(volatile struct ZennyAtomicULong *atomic, uint64_t value, enum ZennyMemoryOrder order)
+{
+    return (uint64_t)ZennyAtomicLongOrFetchExplicit((volatile struct ZennyAtomicLong*)atomic, (int64_t)value, order);
+}
+
+ZENNY_ATOMICS_IMPL uint64_t ZennyAtomicULongAndFetchExplicit(volatile struct ZennyAtomicULong *atomic, uint64_t value, enum ZennyMemoryOrder order)
+{
+    return (uint64_t)ZennyAtomicLongAndFetchExplicit((volatile struct ZennyAtomicLong*)atomic, (int64_t)value, order);
+}
+
+ZENNY_ATOMICS_IMPL uint64_t ZennyAtomicULongXorFetchExplicit(volatile struct ZennyAtomicULong *atomic, uint64_t value, enum ZennyMemoryOrder order)
+{
+    return (uint64_t)ZennyAtomicLongXorFetchExplicit((volatile struct ZennyAtomicLong*)atomic, (int64_t)value, order);
+}
+
+#if SIZE_MAX == UINT64_MAX
+#define ZENNY_ATOMICS_SIZE_AS(op)       ZennyAtomicULong##op
+#define ZENNY_ATOMICS_SIZE_ATOMIC       struct ZennyAtomicULong
+#define ZENNY_ATOMICS_SIZE_VALUE        uint64_t
+#else
+#define ZENNY_ATOMICS_SIZE_AS(op)       ZennyAtomicUInt##op
+#define ZENNY_ATOMICS_SIZE_ATOMIC       struct ZennyAtomicUInt
+#define ZENNY_ATOMICS_SIZE_VALUE        unsigned
+#endif
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicSizeInit(volatile struct ZennyAtomicSize *atomic, size_t value)
+{
+    ZENNY_ATOMICS_SIZE_AS(Init)((volatile ZENNY_ATOMICS_SIZE_ATOMIC*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL size_t ZennyAtomicSizeLoad(volatile struct ZennyAtomicSize *atomic)
+{
+    return (size_t)ZENNY_ATOMICS_SIZE_AS(Load)((volatile ZENNY_ATOMICS_SIZE_ATOMIC*)atomic);
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicSizeStore(volatile struct ZennyAtomicSize *atomic, size_t value)
+{
+    ZENNY_ATOMICS_SIZE_AS(Store)((volatile ZENNY_ATOMICS_SIZE_ATOMIC*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL size_t ZennyAtomicSizeAdd(volatile struct ZennyAtomicSize *atomic, size_t value)
+{
+    return (size_t)ZENNY_ATOMICS_SIZE_AS(Add)((volatile ZENNY_ATOMICS_SIZE_ATOMIC*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL size_t ZennyAtomicSizeSub(volatile struct ZennyAtomicSize *atomic, size_t value)
+{
+    return (size_t)ZENNY_ATOMICS_SIZE_AS(Sub)((volatile ZENNY_ATOMICS_SIZE_ATOMIC*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL size_t ZennyAtomicSizeOr(volatile struct ZennyAtomicSize *atomic, size_t value)
+{
+    return (size_t)ZENNY_ATOMICS_SIZE_AS(Or)((volatile ZENNY_ATOMICS_SIZE_ATOMIC*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL size_t ZennyAtomicSizeXor(volatile struct ZennyAtomicSize *atomic, size_t value)
+{
+    return (size_t)ZENNY_ATOMICS_SIZE_AS(Xor)((volatile ZENNY_ATOMICS_SIZE_ATOMIC*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL size_t ZennyAtomicSizeAnd(volatile struct ZennyAtomicSize *atomic, size_t value)
+{
+    return (size_t)ZENNY_ATOMICS_SIZE_AS(And)((volatile ZENNY_ATOMICS_SIZE_ATOMIC*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL size_t ZennyAtomicSizeExchange(volatile struct ZennyAtomicSize *atomic, size_t value)
+{
+    return (size_t)ZENNY_ATOMICS_SIZE_AS(Exchange)((volatile ZENNY_ATOMICS_SIZE_ATOMIC*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicSizeCompareExchange(volatile struct ZennyAtomicSize *atomic, size_t *expected, size_t desired)
+{
+    return ZENNY_ATOMICS_SIZE_AS(CompareExchange)((volatile ZENNY_ATOMICS_SIZE_ATOMIC*)atomic, (ZENNY_ATOMICS_SIZE_VALUE*)expected, desired);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicSizeCompareExchangeWeak(volatile struct ZennyAtomicSize *atomic, size_t *expected, size_t desired)
+{
+    return ZENNY_ATOMICS_SIZE_AS(CompareExchangeWeak)((volatile ZENNY_ATOMICS_SIZE_ATOMIC*)atomic, (ZENNY_ATOMICS_SIZE_VALUE*)expected, desired);
+}
+
+ZENNY_ATOMICS_IMPL size_t ZennyAtomicSizeMin(volatile struct ZennyAtomicSize *atomic, size_t value)
+{
+    return (size_t)ZENNY_ATOMICS_SIZE_AS(Min)((volatile ZENNY_ATOMICS_SIZE_ATOMIC*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL size_t ZennyAtomicSizeMax(volatile struct ZennyAtomicSize *atomic, size_t value)
+{
+    return (size_t)ZENNY_ATOMICS_SIZE_AS(Max)((volatile ZENNY_ATOMICS_SIZE_ATOMIC*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL size_t ZennyAtomicSizeAddFetch(volatile struct ZennyAtomicSize *atomic, size_t value)
+{
+    return (size_t)ZENNY_ATOMICS_SIZE_AS(AddFetch)((volatile ZENNY_ATOMICS_SIZE_ATOMIC*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL size_t ZennyAtomicSizeSubFetch(volatile struct ZennyAtomicSize *atomic, size_t value)
+{
+    return (size_t)ZENNY_ATOMICS_SIZE_AS(SubFetch)((volatile ZENNY_ATOMICS_SIZE_ATOMIC*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL size_t ZennyAtomicSizeOrFetch(volatile struct ZennyAtomicSize *atomic, size_t value)
+{
+    return (size_t)ZENNY_ATOMICS_SIZE_AS(OrFetch)((volatile ZENNY_ATOMICS_SIZE_ATOMIC*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL size_t ZennyAtomicSizeAndFetch(volatile struct ZennyAtomicSize *atomic, size_t value)
+{
+    return (size_t)ZENNY_ATOMICS_SIZE_AS(AndFetch)((volatile ZENNY_ATOMICS_SIZE_ATOMIC*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL size_t ZennyAtomicSizeXorFetch(volatile struct ZennyAtomicSize *atomic, size_t value)
+{
+    return (size_t)ZENNY_ATOMICS_SIZE_AS(XorFetch)((volatile ZENNY_ATOMICS_SIZE_ATOMIC*)atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL size_t ZennyAtomicSizeLoadExplicit(volatile struct ZennyAtomicSize *atomic, enum ZennyMemoryOrder order)
+{
+    return (size_t)ZENNY_ATOMICS_SIZE_AS(LoadExplicit)((volatile ZENNY_ATOMICS_SIZE_ATOMIC*)atomic, order);
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicSizeStoreExplicit(volatile struct ZennyAtomicSize *atomic, size_t value, enum ZennyMemoryOrder order)
+{
+    ZENNY_ATOMICS_SIZE_AS(StoreExplicit)((volatile ZENNY_ATOMICS_SIZE_ATOMIC*)atomic, value, order);
+}
+
+ZENNY_ATOMICS_IMPL size_t ZennyAtomicSizeAddExplicit(volatile struct ZennyAtomicSize *atomic, size_t value, enum ZennyMemoryOrder order)
+{
+    return (size_t)ZENNY_ATOMICS_SIZE_AS(AddExplicit)((volatile ZENNY_ATOMICS_SIZE_ATOMIC*)atomic, value, order);
+}
+
+ZENNY_ATOMICS_IMPL size_t ZennyAtomicSizeSubExplicit(volatile struct ZennyAtomicSize *atomic, size_t value, enum ZennyMemoryOrder order)
+{
+    return (size_t)ZENNY_ATOMICS_SIZE_AS(SubExplicit)((volatile ZENNY_ATOMICS_SIZE_ATOMIC*)atomic, value, order);
+}
+
+ZENNY_ATOMICS_IMPL size_t ZennyAtomicSizeOrExplicit(volatile struct ZennyAtomicSize *atomic, size_t value, enum ZennyMemoryOrder order)
+{
+    return (size_t)ZENNY_ATOMICS_SIZE_AS(OrExplicit)((volatile ZENNY_ATOMICS_SIZE_ATOMIC*)atomic, value, order);
+}
+
+ZENNY_ATOMICS_IMPL size_t ZennyAtomicSizeXorExplicit(volatile struct ZennyAtomicSize *atomic, size_t value, enum ZennyMemoryOrder order)
+{
+    return (size_t)ZENNY_ATOMICS_SIZE_AS(XorExplicit)((volatile ZENNY_ATOMICS_SIZE_ATOMIC*)atomic, value, order);
+}
+
+ZENNY_ATOMICS_IMPL size_t ZennyAtomicSizeAndExplicit(volatile struct ZennyAtomicSize *atomic, size_t value, enum ZennyMemoryOrder order)
+{
+    return (size_t)ZENNY_ATOMICS_SIZE_AS(AndExplicit)((volatile ZENNY_ATOMICS_SIZE_ATOMIC*)atomic, value, order);
+}
+
+ZENNY_ATOMICS_IMPL size_t ZennyAtomicSizeExchangeExplicit(volatile struct ZennyAtomicSize *atomic, size_t value, enum ZennyMemoryOrder order)
+{
+    return (size_t)ZENNY_ATOMICS_SIZE_AS(ExchangeExplicit)((volatile ZENNY_ATOMICS_SIZE_ATOMIC*)atomic, value, order);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicSizeCompareExchangeExplicit(volatile struct ZennyAtomicSize *atomic, size_t *expected, size_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure)
+{
+    return ZENNY_ATOMICS_SIZE_AS(CompareExchangeExplicit)((volatile ZENNY_ATOMICS_SIZE_ATOMIC*)atomic, (ZENNY_ATOMICS_SIZE_VALUE*)expected, desired, success, failure);
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicSizeCompareExchangeWeakExplicit(volatile struct ZennyAtomicSize *atomic, size_t *expected, size_t desired, enum ZennyMemoryOrder success, enum ZennyMemoryOrder failure)
+{
+    return ZENNY_ATOMICS_SIZE_AS(CompareExchangeWeakExplicit)((volatile ZENNY_ATOMICS_SIZE_ATOMIC*)atomic, (ZENNY_ATOMICS_SIZE_VALUE*)expected, desired, success, failure);
+}
+
+ZENNY_ATOMICS_IMPL size_t ZennyAtomicSizeMinExplicit(volatile struct ZennyAtomicSize *atomic, size_t value, enum ZennyMemoryOrder order)
+{
+    return (size_t)ZENNY_ATOMICS_SIZE_AS(MinExplicit)((volatile ZENNY_ATOMICS_SIZE_ATOMIC*)atomic, value, order);
+}
+
+ZENNY_ATOMICS_IMPL size_t ZennyAtomicSizeMaxExplicit(volatile struct ZennyAtomicSize *atomic, size_t value, enum ZennyMemoryOrder order)
+{
+    return (size_t)ZENNY_ATOMICS_SIZE_AS(MaxExplicit)((volatile ZENNY_ATOMICS_SIZE_ATOMIC*)atomic, value, order);
+}
+
+ZENNY_ATOMICS_IMPL size_t ZennyAtomicSizeAddFetchExplicit(volatile struct ZennyAtomicSize *atomic, size_t value, enum ZennyMemoryOrder order)
+{
+    return (size_t)ZENNY_ATOMICS_SIZE_AS(AddFetchExplicit)((volatile ZENNY_ATOMICS_SIZE_ATOMIC*)atomic, value, order);
+}
+
+ZENNY_ATOMICS_IMPL size_t ZennyAtomicSizeSubFetchExplicit(volatile struct ZennyAtomicSize *atomic, size_t value, enum ZennyMemoryOrder order)
+{
+    return (size_t)ZENNY_ATOMICS_SIZE_AS(SubFetchExplicit)((volatile ZENNY_ATOMICS_SIZE_ATOMIC*)atomic, value, order);
+}
+
+ZENNY_ATOMICS_IMPL size_t ZennyAtomicSizeOrFetchExplicit(volatile struct ZennyAtomicSize *atomic, size_t value, enum ZennyMemoryOrder order)
+{
+    return (size_t)ZENNY_ATOMICS_SIZE_AS(OrFetchExplicit)((volatile ZENNY_ATOMICS_SIZE_ATOMIC*)atomic, value, order);
+}
+
+ZENNY_ATOMICS_IMPL size_t ZennyAtomicSizeAndFetchExplicit(volatile struct ZennyAtomicSize *atomic, size_t value, enum ZennyMemoryOrder order)
+{
+    return (size_t)ZENNY_ATOMICS_SIZE_AS(AndFetchExplicit)((volatile ZENNY_ATOMICS_SIZE_ATOMIC*)atomic, value, order);
+}
+
+ZENNY_ATOMICS_IMPL size_t ZennyAtomicSizeXorFetchExplicit(volatile struct ZennyAtomicSize *atomic, size_t value, enum ZennyMemoryOrder order)
+{
+    return (size_t)ZENNY_ATOMICS_SIZE_AS(XorFetchExplicit)((volatile ZENNY_ATOMICS_SIZE_ATOMIC*)atomic, value, order);
+}
+
+// MARK: Backoff
+
+#ifdef _WIN32
+// Declared here rather than by including <windows.h>, which would leak into every user of the header-only build
+__declspec(dllimport) int __stdcall SwitchToThread(void);
+#else
+#include <sched.h>
+#endif
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicYield(void)
+{
+#ifdef _WIN32
+    SwitchToThread();
+#else
+    sched_yield();
+#endif
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicBackoffInit(struct ZennyAtomicBackoff *backoff, enum ZennyAtomicBackoffPolicy policy,
+                                               unsigned minSpins, unsigned maxSpins, unsigned yieldAfter)
+{
+    backoff->policy = policy;
+    backoff->minSpins = minSpins > 0 ? minSpins : 1;
+    backoff->maxSpins = maxSpins > backoff->minSpins ? maxSpins : backoff->minSpins;
+    backoff->yieldAfter = yieldAfter;
+    backoff->currentSpins = backoff->minSpins;
+    backoff->waits = 0;
+
+    // Threads retrying at the same time have different stacks, which is enough to decorrelate their jitter
+    backoff->seed = (uint32_t)((uintptr_t)backoff >> 4) * 2654435761U | 1U;
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicBackoffSpin(struct ZennyAtomicBackoff *backoff)
+{
+    unsigned spins;
+
+    switch (backoff->policy)
+    {
+        case ZennyAtomicBackoffNone:
+            spins = 0;
+            break;
+
+        case ZennyAtomicBackoffConstant:
+            spins = backoff->minSpins;
+            break;
+
+        case ZennyAtomicBackoffJitter:
+        {
+            // xorshift32
+            uint32_t x = backoff->seed;
+            x ^= x << 13;
+            x ^= x >> 17;
+            x ^= x << 5;
+            backoff->seed = x;
+            spins = 1 + x % backoff->currentSpins;
+            break;
+        }
+
+        default:
+            spins = backoff->currentSpins;
+            break;
+    }
+
+    for (unsigned i = 0; i < spins; i++)
+        ZennyAtomicPause();
+
+    if (backoff->currentSpins < backoff->maxSpins)
+    {
+        backoff->currentSpins <<= 1;
+        if (backoff->currentSpins > backoff->maxSpins)
+            backoff->currentSpins = backoff->maxSpins;
+    }
+
+    if (backoff->yieldAfter > 0 && backoff->waits >= backoff->yieldAfter)
+        ZennyAtomicYield();
+    else
+        backoff->waits++;
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicBackoffReset(struct ZennyAtomicBackoff *backoff)
+{
+    backoff->currentSpins = backoff->minSpins;
+    backoff->waits = 0;
+}
+
+// MARK: Pair (double-width) atomic operations
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicInitPair(volatile struct ZennyAtomicType *atomic, struct ZennyAtomicPair value)
+{
+    atomic->values[0] = value.first;
+    atomic->values[1] = value.second;
+}
+
+ZENNY_ATOMICS_IMPL bool ZennyAtomicCompareExchangePair(volatile struct ZennyAtomicType *atomic, struct ZennyAtomicPair *expected, struct ZennyAtomicPair desired)
+{
+#if ZENNY_ATOMICS_PAIR_LOCK_FREE && defined(_MSC_VER)
+    __declspec(align(16)) __int64 comparand[2] = { expected->first, expected->second };
+    const bool successful = _InterlockedCompareExchange128((volatile __int64*)atomic, desired.second, desired.first, comparand) != 0;
+    if (!successful)
+    {
+        expected->first = comparand[0];
+        expected->second = comparand[1];
+    }
+
+    return successful;
+#elif ZENNY_ATOMICS_PAIR_LOCK_FREE && defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16)
+    __extension__ typedef unsigned __int128 PairBits;
+    union { struct ZennyAtomicPair pair; PairBits bits; } comparand = { *expected }, exchange = { desired }, dstValue;
+    dstValue.bits = __sync_val_compare_and_swap((volatile PairBits*)atomic, comparand.bits, exchange.bits);
+    const bool successful = dstValue.bits == comparand.bits;
+    if (!successful)
+        *expected = dstValue.pair;
+
+    return successful;
+#elif ZENNY_ATOMICS_PAIR_LOCK_FREE
+    // x86-64 without -mcx16: the compiler will not emit cmpxchg16b by itself
+    bool successful;
+    __asm__ __volatile__("lock cmpxchg16b %1\n\tsete %0"
+                         : "=q"(successful), "+m"(*atomic), "+a"(expected->first), "+d"(expected->second)
+                         : "b"(desired.first), "c"(desired.second)
+                         : "memory", "cc");
+    return successful;
+#else
+    ZennyAtomicPairLock(atomic);
+
+    const struct ZennyAtomicPair dstValue = { atomic->values[0], atomic->values[1] };
+    const bool successful = dstValue.first == expected->first && dstValue.second == expected->second;
+    if (successful)
+    {
+        atomic->values[0] = desired.first;
+        atomic->values[1] = desired.second;
+    }
+    else
+        *expected = dstValue;
+
+    ZennyAtomicPairUnlock(atomic);
+
+    return successful;
+#endif
+}
+
+ZENNY_ATOMICS_IMPL struct ZennyAtomicPair ZennyAtomicLoadPair(volatile struct ZennyAtomicType *atomic)
+{
+    // If the object holds the guessed value, it is replaced by the same value; either way we get the current value.
+    struct ZennyAtomicPair value = { 0, 0 };
+    ZennyAtomicCompareExchangePair(atomic, &value, value);
+    return value;
+}
+
+ZENNY_ATOMICS_IMPL void ZennyAtomicStorePair(volatile struct ZennyAtomicType *atomic, struct ZennyAtomicPair value)
+{
+    ZennyAtomicExchangePair(atomic, value);
+}
+
+ZENNY_ATOMICS_IMPL struct ZennyAtomicPair ZennyAtomicExchangePair(volatile struct ZennyAtomicType *atomic, struct ZennyAtomicPair value)
+{
+    // A torn first guess is harmless: a failed compare-exchange reloads the whole pair.
+    struct ZennyAtomicPair comparand = { atomic->values[0], atomic->values[1] };
+    struct ZennyAtomicBackoff backoff;
+    bool backingOff = false;
+
+    while (!ZennyAtomicCompareExchangePair(atomic, &comparand, value))
+        ZennyAtomicRetryBackoff(&backoff, &backingOff);
+
+    return comparand;
+}
+
+#endif /* zenny_atomics_impl_h */
+
@@ -0,0 +1,191 @@
+//
+//  zenny_epoch.c
+//  ZennyAtomics
+//
+//  Copyright © 2019 Zenny Chen. All rights reserved.
+//
+
+#include <stdlib.h>
+#include <string.h>
+#include "zenny_epoch.h"
+
+/** Marks a local epoch taken inside a critical section */
+#define ZENNY_EPOCH_ACTIVE      1
+
+void ZennyEpochDomainInit(struct ZennyEpochDomain *domain)
+{
+    ZennyAtomicULongInit(&domain->globalEpoch, 0);
+    ZennyAtomicPtrInit(&domain->threads, 0);
+}
+
+/** Destroy every object of a bag */
+static void ZennyEpochEmptyBag(struct ZennyEpochThread *thread, struct ZennyEpochBag *bag)
+{
+    for (size_t i = 0; i < bag->count; i++)
+        bag->entries[i].deleter(bag->entries[i].object);
+
+    thread->retiredCount -= bag->count;
+    bag->count = 0;
+}
+
+/** Destroy the objects retired at least two epochs before the current one */
+static void ZennyEpochReclaim(struct ZennyEpochThread *thread)
+{
+    const uint64_t globalEpoch = ZennyAtomicULongLoadExplicit(&thread->domain->globalEpoch, ZennyMemoryOrderAcquire);
+
+    for (int i = 0; i < 3; i++)
+    {
+        struct ZennyEpochBag *bag = &thread->bags[i];
+        if (bag->count > 0 && bag->epoch + 2 <= globalEpoch)
+            ZennyEpochEmptyBag(thread, bag);
+    }
+}
+
+void ZennyEpochDomainDestroy(struct ZennyEpochDomain *domain)
+{
+    struct ZennyEpochThread *thread = (struct ZennyEpochThread*)ZennyAtomicPtrLoad(&domain->threads);
+    while (thread != NULL)
+    {
+        struct ZennyEpochThread *next = thread->next;
+        for (int i = 0; i < 3; i++)
+        {
+            ZennyEpochEmptyBag(thread, &thread->bags[i]);
+            free(thread->bags[i].entries);
+        }
+
+        ZennyAtomicFreeCacheAligned(thread);
+        thread = next;
+    }
+
+    ZennyAtomicPtrStore(&domain->threads, 0);
+}
+
+struct ZennyEpochThread* ZennyEpochRegister(struct ZennyEpochDomain *domain)
+{
+    // Take over a released record first
+    for (struct ZennyEpochThread *thread = (struct ZennyEpochThread*)ZennyAtomicPtrLoad(&domain->threads); thread != NULL; thread = thread->next)
+    {
+        int expected = 0;
+        if (ZennyAtomicIntLoadExplicit(&thread->inUse, ZennyMemoryOrderRelaxed) == 0 &&
+            ZennyAtomicIntCompareExchange(&thread->inUse, &expected, 1))
+            return thread;
+    }
+
+    struct ZennyEpochThread *thread = ZennyAtomicAllocCacheAligned(sizeof(*thread));
+    if (thread == NULL)
+        return NULL;
+
+    memset(thread, 0, sizeof(*thread));
+    ZennyAtomicULongInit(&thread->localEpoch, 0);
+    ZennyAtomicIntInit(&thread->inUse, 1);
+    thread->domain = domain;
+
+    intptr_t head = ZennyAtomicPtrLoadExplicit(&domain->threads, ZennyMemoryOrderRelaxed);
+    do
+        thread->next = (struct ZennyEpochThread*)head;
+    while (!ZennyAtomicPtrCompareExchangeWeak(&domain->threads, &head, (intptr_t)thread));
+
+    return thread;
+}
+
+void ZennyEpochUnregister(struct ZennyEpochThread *thread)
+{
+    ZennyEpochTryAdvance(thread->domain);
+    ZennyEpochReclaim(thread);
+    ZennyAtomicIntStoreExplicit(&thread->inUse, 0, ZennyMemoryOrderRelease);
+}
+
+// MARK: Critical sections
+
+void ZennyEpochEnter(struct ZennyEpochThread *thread)
+{
+    if (thread->nesting++ > 0)
+        return;
+
+    const uint64_t globalEpoch = ZennyAtomicULongLoadExplicit(&thread->domain->globalEpoch, ZennyMemoryOrderRelaxed);
+    ZennyAtomicULongStoreExplicit(&thread->localEpoch, globalEpoch << 1 | ZENNY_EPOCH_ACTIVE, ZennyMemoryOrderRelaxed);
+
+    // Publish the local epoch before any shared pointer is loaded; pairs with the fence in ZennyEpochTryAdvance
+    ZennyAtomicThreadFence(ZennyMemoryOrderSeqCst);
+}
+
+void ZennyEpochExit(struct ZennyEpochThread *thread)
+{
+    if (--thread->nesting > 0)
+        return;
+
+    // Release: the reads of the critical section happen before the nodes are freed
+    ZennyAtomicULongStoreExplicit(&thread->localEpoch, 0, ZennyMemoryOrderRelease);
+}
+
+// MARK: Reclamation
+
+bool ZennyEpochTryAdvance(struct ZennyEpochDomain *domain)
+{
+    uint64_t globalEpoch = ZennyAtomicULongLoad(&domain->globalEpoch);
+    ZennyAtomicThreadFence(ZennyMemoryOrderSeqCst);
+
+    for (struct ZennyEpochThread *thread = (struct ZennyEpochThread*)ZennyAtomicPtrLoadExplicit(&domain->threads, ZennyMemoryOrderAcquire);
+         thread != NULL; thread = thread->next)
+    {
+        const uint64_t localEpoch = ZennyAtomicULongLoadExplicit(&thread->localEpoch, ZennyMemoryOrderAcquire);
+        if ((localEpoch & ZENNY_EPOCH_ACTIVE) != 0 && localEpoch >> 1 != globalEpoch)
+            return false;   // this reader may still hold nodes retired in the previous epoch
+    }
+
+    // A failed exchange means that another thread has advanced the same epoch
+    ZennyAtomicULongCompareExchange(&domain->globalEpoch, &globalEpoch, globalEpoch + 1);
+    return true;
+}
+
+bool ZennyEpochRetire(struct ZennyEpochThread *thread, void *object, ZennyEpochDeleter deleter)
+{
+    // Sequentially consistent, so that the object has been unlinked before the epoch it is filed under
+    const uint64_t globalEpoch = ZennyAtomicULongLoad(&thread->domain->globalEpoch);
+    struct ZennyEpochBag *bag = &thread->bags[globalEpoch % 3];
+
+    // The bag belongs to an epoch at least three behind, so its objects are already safe
+    if (bag->epoch != globalEpoch)
+    {
+        ZennyEpochEmptyBag(thread, bag);
+        bag->epoch = globalEpoch;
+    }
+
+    if (bag->count == bag->capacity)
+    {
+        const size_t capacity = bag->capacity == 0 ? ZENNY_EPOCH_RETIRE_THRESHOLD : bag->capacity * 2;
+        struct ZennyEpochRetired *entries = realloc(bag->entries, capacity * sizeof(*entries));
+        if (entries == NULL)
+            return false;
+
+        bag->entries = entries;
+        bag->capacity = capacity;
+    }
+
+    bag->entries[bag->count].object = object;
+    bag->entries[bag->count].deleter = deleter;
+    bag->count++;
+
+    if (++thread->retiredCount % ZENNY_EPOCH_RETIRE_THRESHOLD == 0)
+    {
+        ZennyEpochTryAdvance(thread->domain);
+        ZennyEpochReclaim(thread);
+    }
+
+    return true;
+}
+
+void ZennyEpochFlush(struct ZennyEpochThread *thread)
+{
+    struct ZennyAtomicBackoff backoff;
+    ZennyAtomicBackoffInit(&backoff, ZennyAtomicBackoffExponential, 1, ZENNY_ATOMICS_BACKOFF_MAX_SPINS, 8);
+
+    while (thread->retiredCount > 0)
+    {
+        if (!ZennyEpochTryAdvance(thread->domain))
+            ZennyAtomicBackoffSpin(&backoff);
+
+        ZennyEpochReclaim(thread);
+    }
+}
+
@@ -0,0 +1,144 @@
+//
+//  zenny_epoch.h
+//  ZennyAtomics
+//
+//  Copyright © 2019 Zenny Chen. All rights reserved.
+//
+
+#ifndef zenny_epoch_h
+#define zenny_epoch_h
+
+#include "zenny_atomics.h"
+
+/** Number of retired objects a thread collects before it tries to advance the epoch and free them */
+#define ZENNY_EPOCH_RETIRE_THRESHOLD    64
+
+/** Destructor of a retired object */
+typedef void (*ZennyEpochDeleter)(void *object);
+
+/** Retired object waiting for its grace period */
+struct ZennyEpochRetired
+{
+    void *object;
+    ZennyEpochDeleter deleter;
+};
+
+/** Objects retired by one thread during one epoch */
+struct ZennyEpochBag
+{
+    uint64_t epoch;
+    size_t count;
+    size_t capacity;
+    struct ZennyEpochRetired *entries;
+};
+
+/**
+ * Per-thread record of an epoch domain, obtained with ZennyEpochRegister.
+ * Records are never freed before the domain, so that the epoch advance can walk them without locking.
+ */
+struct ZennyEpochThread
+{
+    /** (observed global epoch << 1) | 1 while inside a critical section; 0 outside. Written by the owner only. */
+    alignas(ZENNY_ATOMICS_CACHE_LINE_SIZE) struct ZennyAtomicULong localEpoch;
+
+    /** depth of nested critical sections */
+    unsigned nesting;
+
+    /** objects retired during the last three epochs, indexed by epoch % 3 */
+    struct ZennyEpochBag bags[3];
+
+    /** number of objects in all bags */
+    size_t retiredCount;
+
+    /** domain the record belongs to */
+    struct ZennyEpochDomain *domain;
+
+    /** next record in the domain's list */
+    struct ZennyEpochThread *next;
+
+    /** nonzero while a thread owns the record */
+    struct ZennyAtomicInt inUse;
+};
+
+/**
+ * Epoch-based memory reclamation.
+ * Readers bracket their accesses to shared nodes with ZennyEpochEnter and ZennyEpochExit,
+ * which cost a relaxed store and a fence on the reader's own cache line.
+ * Writers unlink a node and hand it to ZennyEpochRetire, which frees it once the global epoch has advanced twice:
+ * by then every thread that could have seen the node has left its critical section.
+ * A reader that stays in a critical section holds back all reclamation, so keep critical sections short
+ * and never block inside one.
+ */
+struct ZennyEpochDomain
+{
+    /** global epoch, advanced when every thread inside a critical section has observed it */
+    alignas(ZENNY_ATOMICS_CACHE_LINE_SIZE) struct ZennyAtomicULong globalEpoch;
+
+    /** list of the thread records, pushed to the front and never shrunk */
+    alignas(ZENNY_ATOMICS_CACHE_LINE_SIZE) struct ZennyAtomicPtr threads;
+};
+
+/**
+ * Initialize an epoch domain
+ * @param domain pointer to the domain object
+ */
+extern void ZennyEpochDomainInit(struct ZennyEpochDomain *domain);
+
+/**
+ * Free every object still retired and every thread record. No thread may use the domain any more.
+ * @param domain pointer to the domain object
+ */
+extern void ZennyEpochDomainDestroy(struct ZennyEpochDomain *domain);
+
+/**
+ * Obtain a thread record for the calling thread, reusing one released by ZennyEpochUnregister if possible
+ * @param domain pointer to the domain object
+ * @return the record, or NULL if it cannot be allocated
+ */
+extern struct ZennyEpochThread* ZennyEpochRegister(struct ZennyEpochDomain *domain);
+
+/**
+ * Release a thread record. Objects it still holds are freed by whichever thread takes the record next,
+ * or by ZennyEpochDomainDestroy.
+ * @param thread the record of the calling thread, outside any critical section
+ */
+extern void ZennyEpochUnregister(struct ZennyEpochThread *thread);
+
+/**
+ * Enter a read-side critical section. Critical sections may be nested.
+ * Nodes loaded from shared pointers after this call stay valid until the matching ZennyEpochExit.
+ * @param thread the record of the calling thread
+ */
+extern void ZennyEpochEnter(struct ZennyEpochThread *thread);
+
+/**
+ * Leave a read-side critical section
+ * @param thread the record of the calling thread
+ */
+extern void ZennyEpochExit(struct ZennyEpochThread *thread);
+
+/**
+ * Defer the destruction of an object that has been unlinked from every shared structure.
+ * Every ZENNY_EPOCH_RETIRE_THRESHOLD calls, the thread tries to advance the epoch and frees what has become safe.
+ * @param thread the record of the calling thread, inside or outside a critical section
+ * @param object the object to be destroyed
+ * @param deleter called with `object` once no reader can hold it
+ * @return true if the object has been retired; false if the retire list cannot grow, in which case it is left untouched
+ */
+extern bool ZennyEpochRetire(struct ZennyEpochThread *thread, void *object, ZennyEpochDeleter deleter);
+
+/**
+ * Advance the global epoch if every thread inside a critical section has observed the current one
+ * @param domain pointer to the domain object
+ * @return true if the epoch has been advanced by this or another thread
+ */
+extern bool ZennyEpochTryAdvance(struct ZennyEpochDomain *domain);
+
+/**
+ * Free every object retired by the calling thread, waiting for the readers that may still hold them
+ * @param thread the record of the calling thread, outside any critical section
+ */
+extern void ZennyEpochFlush(struct ZennyEpochThread *thread);
+
+#endif /* zenny_epoch_h */
+
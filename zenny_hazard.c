@@ -0,0 +1,210 @@
+//
+//  zenny_hazard.c
+//  ZennyAtomics
+//
+//  Copyright © 2019 Zenny Chen. All rights reserved.
+//
+
+#include <stdlib.h>
+#include <string.h>
+#include "zenny_hazard.h"
+
+void ZennyHazardDomainInit(struct ZennyHazardDomain *domain)
+{
+    ZennyAtomicPtrInit(&domain->threads, 0);
+    ZennyAtomicIntInit(&domain->threadCount, 0);
+}
+
+void ZennyHazardDomainDestroy(struct ZennyHazardDomain *domain)
+{
+    struct ZennyHazardThread *thread = (struct ZennyHazardThread*)ZennyAtomicPtrLoad(&domain->threads);
+    while (thread != NULL)
+    {
+        struct ZennyHazardThread *next = thread->next;
+        for (size_t i = 0; i < thread->retiredCount; i++)
+            thread->retired[i].deleter(thread->retired[i].object);
+
+        free(thread->retired);
+        free(thread->hazards);
+        ZennyAtomicFreeCacheAligned(thread);
+        thread = next;
+    }
+
+    ZennyAtomicPtrStore(&domain->threads, 0);
+    ZennyAtomicIntStore(&domain->threadCount, 0);
+}
+
+struct ZennyHazardThread* ZennyHazardRegister(struct ZennyHazardDomain *domain)
+{
+    // Take over a released record first
+    for (struct ZennyHazardThread *thread = (struct ZennyHazardThread*)ZennyAtomicPtrLoad(&domain->threads); thread != NULL; thread = thread->next)
+    {
+        int expected = 0;
+        if (ZennyAtomicIntLoadExplicit(&thread->inUse, ZennyMemoryOrderRelaxed) == 0 &&
+            ZennyAtomicIntCompareExchange(&thread->inUse, &expected, 1))
+            return thread;
+    }
+
+    struct ZennyHazardThread *thread = ZennyAtomicAllocCacheAligned(sizeof(*thread));
+    if (thread == NULL)
+        return NULL;
+
+    memset(thread, 0, sizeof(*thread));
+    for (int i = 0; i < ZENNY_HAZARD_SLOT_COUNT; i++)
+        ZennyAtomicPtrInit(&thread->slots[i], 0);
+    ZennyAtomicIntInit(&thread->inUse, 1);
+    thread->domain = domain;
+
+    intptr_t head = ZennyAtomicPtrLoadExplicit(&domain->threads, ZennyMemoryOrderRelaxed);
+    do
+        thread->next = (struct ZennyHazardThread*)head;
+    while (!ZennyAtomicPtrCompareExchangeWeak(&domain->threads, &head, (intptr_t)thread));
+
+    ZennyAtomicIntAdd(&domain->threadCount, 1);
+    return thread;
+}
+
+void ZennyHazardUnregister(struct ZennyHazardThread *thread)
+{
+    for (int i = 0; i < ZENNY_HAZARD_SLOT_COUNT; i++)
+        ZennyHazardClear(thread, i);
+
+    ZennyHazardScan(thread);
+    ZennyAtomicIntStoreExplicit(&thread->inUse, 0, ZennyMemoryOrderRelease);
+}
+
+// MARK: Protection
+
+void* ZennyHazardProtect(struct ZennyHazardThread *thread, int slot, volatile struct ZennyAtomicPtr *source)
+{
+    intptr_t pointer = ZennyAtomicPtrLoadExplicit(source, ZennyMemoryOrderRelaxed);
+
+    for (;;)
+    {
+        ZennyAtomicPtrStoreExplicit(&thread->slots[slot], pointer, ZennyMemoryOrderRelaxed);
+
+        // Publish the slot before validating; pairs with the fence in ZennyHazardScan
+        ZennyAtomicThreadFence(ZennyMemoryOrderSeqCst);
+
+        const intptr_t validated = ZennyAtomicPtrLoadExplicit(source, ZennyMemoryOrderAcquire);
+        if (validated == pointer)
+            return (void*)pointer;
+
+        pointer = validated;
+    }
+}
+
+void ZennyHazardClear(struct ZennyHazardThread *thread, int slot)
+{
+    // Release: the reads of the node happen before it can be freed
+    ZennyAtomicPtrStoreExplicit(&thread->slots[slot], 0, ZennyMemoryOrderRelease);
+}
+
+// MARK: Reclamation
+
+static int ZennyHazardCompare(const void *a, const void *b)
+{
+    const intptr_t left = *(const intptr_t*)a;
+    const intptr_t right = *(const intptr_t*)b;
+    return left < right ? -1 : left > right;
+}
+
+/** Number of slots of all records */
+static size_t ZennyHazardSlotTotal(struct ZennyHazardDomain *domain)
+{
+    return (size_t)ZennyAtomicIntLoadExplicit(&domain->threadCount, ZennyMemoryOrderRelaxed) * ZENNY_HAZARD_SLOT_COUNT;
+}
+
+/** Copy the non-null slots of every record into the scratch array; false if it cannot grow */
+static bool ZennyHazardCollect(struct ZennyHazardThread *thread, size_t *count)
+{
+    size_t capacity = ZennyHazardSlotTotal(thread->domain);
+
+    for (;;)
+    {
+        if (capacity > thread->hazardCapacity)
+        {
+            intptr_t *hazards = realloc(thread->hazards, capacity * sizeof(*hazards));
+            if (hazards == NULL)
+                return false;
+
+            thread->hazards = hazards;
+            thread->hazardCapacity = capacity;
+        }
+
+        size_t n = 0;
+        struct ZennyHazardThread *record = (struct ZennyHazardThread*)ZennyAtomicPtrLoadExplicit(&thread->domain->threads, ZennyMemoryOrderAcquire);
+        for (; record != NULL && n + ZENNY_HAZARD_SLOT_COUNT <= thread->hazardCapacity; record = record->next)
+        {
+            for (int i = 0; i < ZENNY_HAZARD_SLOT_COUNT; i++)
+            {
+                const intptr_t hazard = ZennyAtomicPtrLoadExplicit(&record->slots[i], ZennyMemoryOrderAcquire);
+                if (hazard != 0)
+                    thread->hazards[n++] = hazard;
+            }
+        }
+
+        if (record == NULL)
+        {
+            *count = n;
+            return true;
+        }
+
+        // Records have been registered since the count was read; grow and start over
+        capacity = thread->hazardCapacity * 2;
+    }
+}
+
+size_t ZennyHazardScan(struct ZennyHazardThread *thread)
+{
+    // Pairs with the fence in ZennyHazardProtect: a reader either sees the node unlinked or has its slot seen here
+    ZennyAtomicThreadFence(ZennyMemoryOrderSeqCst);
+
+    size_t hazardCount;
+    if (!ZennyHazardCollect(thread, &hazardCount))
+        return thread->retiredCount;    // out of memory: keep everything for the next scan
+
+    qsort(thread->hazards, hazardCount, sizeof(*thread->hazards), ZennyHazardCompare);
+
+    size_t kept = 0;
+    for (size_t i = 0; i < thread->retiredCount; i++)
+    {
+        const intptr_t object = (intptr_t)thread->retired[i].object;
+        if (bsearch(&object, thread->hazards, hazardCount, sizeof(*thread->hazards), ZennyHazardCompare) != NULL)
+            thread->retired[kept++] = thread->retired[i];
+        else
+            thread->retired[i].deleter(thread->retired[i].object);
+    }
+
+    thread->retiredCount = kept;
+    return kept;
+}
+
+bool ZennyHazardRetire(struct ZennyHazardThread *thread, void *object, ZennyHazardDeleter deleter)
+{
+    if (thread->retiredCount == thread->retiredCapacity)
+    {
+        const size_t capacity = thread->retiredCapacity == 0 ? ZENNY_HAZARD_MIN_SCAN_THRESHOLD : thread->retiredCapacity * 2;
+        struct ZennyHazardRetired *retired = realloc(thread->retired, capacity * sizeof(*retired));
+        if (retired == NULL)
+            return false;
+
+        thread->retired = retired;
+        thread->retiredCapacity = capacity;
+    }
+
+    thread->retired[thread->retiredCount].object = object;
+    thread->retired[thread->retiredCount].deleter = deleter;
+    thread->retiredCount++;
+
+    // At most H objects survive a scan, so scanning at 2 * H frees at least H objects per scan: amortized O(1) each
+    size_t threshold = 2 * ZennyHazardSlotTotal(thread->domain);
+    if (threshold < ZENNY_HAZARD_MIN_SCAN_THRESHOLD)
+        threshold = ZENNY_HAZARD_MIN_SCAN_THRESHOLD;
+
+    if (thread->retiredCount >= threshold)
+        ZennyHazardScan(thread);
+
+    return true;
+}
+
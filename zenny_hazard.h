@@ -0,0 +1,137 @@
+//
+//  zenny_hazard.h
+//  ZennyAtomics
+//
+//  Copyright © 2019 Zenny Chen. All rights reserved.
+//
+
+#ifndef zenny_hazard_h
+#define zenny_hazard_h
+
+#include "zenny_atomics.h"
+
+/** Number of pointers a thread can protect at the same time */
+#ifndef ZENNY_HAZARD_SLOT_COUNT
+#define ZENNY_HAZARD_SLOT_COUNT         4
+#endif
+
+/** Smallest number of retired objects that triggers a scan, however few threads are registered */
+#define ZENNY_HAZARD_MIN_SCAN_THRESHOLD 32
+
+/** Destructor of a retired object */
+typedef void (*ZennyHazardDeleter)(void *object);
+
+/** Retired object waiting until no hazard pointer refers to it */
+struct ZennyHazardRetired
+{
+    void *object;
+    ZennyHazardDeleter deleter;
+};
+
+/**
+ * Per-thread record of a hazard-pointer domain, obtained with ZennyHazardRegister.
+ * Records are never freed before the domain, so that scans can walk them without locking.
+ */
+struct ZennyHazardThread
+{
+    /** protected pointers, 0 when a slot is unused. Written by the owner only. */
+    alignas(ZENNY_ATOMICS_CACHE_LINE_SIZE) struct ZennyAtomicPtr slots[ZENNY_HAZARD_SLOT_COUNT];
+
+    /** objects retired by the owner and not yet freed */
+    struct ZennyHazardRetired *retired;
+    size_t retiredCount;
+    size_t retiredCapacity;
+
+    /** scratch copy of every slot of the domain, sorted during a scan */
+    intptr_t *hazards;
+    size_t hazardCapacity;
+
+    /** domain the record belongs to */
+    struct ZennyHazardDomain *domain;
+
+    /** next record in the domain's list */
+    struct ZennyHazardThread *next;
+
+    /** nonzero while a thread owns the record */
+    struct ZennyAtomicInt inUse;
+};
+
+/**
+ * Hazard-pointer memory reclamation.
+ * A reader publishes the node it is about to use in one of its slots and validates that the node is still reachable;
+ * a retired node is freed only by a scan that finds it in no slot.
+ * Unlike epochs, a stalled reader holds back only the nodes it protects: each thread keeps fewer than
+ * max(2 * H, ZENNY_HAZARD_MIN_SCAN_THRESHOLD) objects unreclaimed, where H is the number of slots of all records.
+ */
+struct ZennyHazardDomain
+{
+    /** list of the thread records, pushed to the front and never shrunk */
+    alignas(ZENNY_ATOMICS_CACHE_LINE_SIZE) struct ZennyAtomicPtr threads;
+
+    /** number of records in the list */
+    struct ZennyAtomicInt threadCount;
+};
+
+/**
+ * Initialize a hazard-pointer domain
+ * @param domain pointer to the domain object
+ */
+extern void ZennyHazardDomainInit(struct ZennyHazardDomain *domain);
+
+/**
+ * Free every object still retired and every thread record. No thread may use the domain any more.
+ * @param domain pointer to the domain object
+ */
+extern void ZennyHazardDomainDestroy(struct ZennyHazardDomain *domain);
+
+/**
+ * Obtain a thread record for the calling thread, reusing one released by ZennyHazardUnregister if possible
+ * @param domain pointer to the domain object
+ * @return the record with every slot clear, or NULL if it cannot be allocated
+ */
+extern struct ZennyHazardThread* ZennyHazardRegister(struct ZennyHazardDomain *domain);
+
+/**
+ * Clear the slots of a record, free what can be freed and release the record.
+ * Objects still protected elsewhere are freed by whichever thread takes the record next, or by ZennyHazardDomainDestroy.
+ * @param thread the record of the calling thread
+ */
+extern void ZennyHazardUnregister(struct ZennyHazardThread *thread);
+
+/**
+ * Load a shared pointer and protect the node it refers to.
+ * The pointer is published in the slot and reloaded until both loads agree,
+ * so the node cannot have been retired before it became protected.
+ * @param thread the record of the calling thread
+ * @param slot index of the slot, less than ZENNY_HAZARD_SLOT_COUNT; it replaces what the slot protected
+ * @param source the shared pointer
+ * @return the protected node, or NULL if `source` is NULL
+ */
+extern void* ZennyHazardProtect(struct ZennyHazardThread *thread, int slot, volatile struct ZennyAtomicPtr *source);
+
+/**
+ * Stop protecting the node of a slot
+ * @param thread the record of the calling thread
+ * @param slot index of the slot, less than ZENNY_HAZARD_SLOT_COUNT
+ */
+extern void ZennyHazardClear(struct ZennyHazardThread *thread, int slot);
+
+/**
+ * Defer the destruction of an object that has been unlinked from every shared structure.
+ * Once enough objects are retired, the thread scans all slots and frees the objects no slot refers to.
+ * @param thread the record of the calling thread
+ * @param object the object to be destroyed
+ * @param deleter called with `object` once no slot refers to it
+ * @return true if the object has been retired; false if the retire list cannot grow, in which case it is left untouched
+ */
+extern bool ZennyHazardRetire(struct ZennyHazardThread *thread, void *object, ZennyHazardDeleter deleter);
+
+/**
+ * Free every object retired by the calling thread that no slot refers to right now
+ * @param thread the record of the calling thread
+ * @return the number of objects still retired
+ */
+extern size_t ZennyHazardScan(struct ZennyHazardThread *thread);
+
+#endif /* zenny_hazard_h */
+
@@ -0,0 +1,133 @@
+//
+//  zenny_lockfree_stack.c
+//  ZennyAtomics
+//
+//  Copyright © 2019 Zenny Chen. All rights reserved.
+//
+
+#include "zenny_lockfree_stack.h"
+
+static struct ZennyLockFreeStackNode* ZennyLockFreeStackNodeOf(struct ZennyAtomicPair top)
+{
+    return (struct ZennyLockFreeStackNode*)(intptr_t)top.first;
+}
+
+static struct ZennyAtomicPair ZennyLockFreeStackTopOf(struct ZennyLockFreeStackNode *node, intmax_t tag)
+{
+    const struct ZennyAtomicPair top = { (intmax_t)(intptr_t)node, tag };
+    return top;
+}
+
+void ZennyLockFreeStackInit(struct ZennyLockFreeStack *stack)
+{
+    ZennyAtomicInitPair(&stack->top, ZennyLockFreeStackTopOf(NULL, 0));
+}
+
+void ZennyLockFreeStackPush(struct ZennyLockFreeStack *stack, struct ZennyLockFreeStackNode *node)
+{
+    ZennyLockFreeStackPushList(stack, node, node);
+}
+
+void ZennyLockFreeStackPushList(struct ZennyLockFreeStack *stack, struct ZennyLockFreeStackNode *first, struct ZennyLockFreeStackNode *last)
+{
+    struct ZennyAtomicPair top = ZennyAtomicLoadPair(&stack->top);
+
+    // A failed exchange reloads `top`; the links are published by the full barrier of the successful one
+    do
+        last->next = ZennyLockFreeStackNodeOf(top);
+    while (!ZennyAtomicCompareExchangePair(&stack->top, &top, ZennyLockFreeStackTopOf(first, top.second + 1)));
+}
+
+struct ZennyLockFreeStackNode* ZennyLockFreeStackPop(struct ZennyLockFreeStack *stack)
+{
+    struct ZennyAtomicPair top = ZennyAtomicLoadPair(&stack->top);
+
+    for (;;)
+    {
+        struct ZennyLockFreeStackNode *node = ZennyLockFreeStackNodeOf(top);
+        if (node == NULL)
+            return NULL;
+
+        // The node may be popped and relinked by another thread right now, in which case the tag has moved on
+        // and the exchange below fails, so the link read here is discarded
+        struct ZennyLockFreeStackNode *next = *(struct ZennyLockFreeStackNode * volatile*)&node->next;
+        if (ZennyAtomicCompareExchangePair(&stack->top, &top, ZennyLockFreeStackTopOf(next, top.second + 1)))
+            return node;
+    }
+}
+
+struct ZennyLockFreeStackNode* ZennyLockFreeStackPopAll(struct ZennyLockFreeStack *stack)
+{
+    struct ZennyAtomicPair top = ZennyAtomicLoadPair(&stack->top);
+
+    while (ZennyLockFreeStackNodeOf(top) != NULL)
+    {
+        if (ZennyAtomicCompareExchangePair(&stack->top, &top, ZennyLockFreeStackTopOf(NULL, top.second + 1)))
+            return ZennyLockFreeStackNodeOf(top);
+    }
+
+    return NULL;
+}
+
+bool ZennyLockFreeStackIsEmpty(struct ZennyLockFreeStack *stack)
+{
+    return ZennyLockFreeStackNodeOf(ZennyAtomicLoadPair(&stack->top)) == NULL;
+}
+
+// MARK: Free-list
+
+bool ZennyFreeListInit(struct ZennyFreeList *list, size_t objectSize, size_t objectCount)
+{
+    const size_t granularity = sizeof(struct ZennyAtomicType);
+    if (objectSize < sizeof(struct ZennyLockFreeStackNode))
+        objectSize = sizeof(struct ZennyLockFreeStackNode);
+
+    ZennyLockFreeStackInit(&list->stack);
+    list->objects = NULL;
+    list->objectCount = 0;
+    if (objectSize > SIZE_MAX - granularity)
+        return false;
+
+    list->objectSize = (objectSize + granularity - 1) / granularity * granularity;
+
+    // An empty pool needs no storage; every allocation from it fails
+    if (objectCount == 0)
+        return true;
+    if (objectCount > SIZE_MAX / list->objectSize)
+        return false;
+
+    list->objects = ZennyAtomicAllocCacheAligned(objectCount * list->objectSize);
+    if (list->objects == NULL)
+        return false;
+
+    list->objectCount = objectCount;
+
+    // Chain the objects in address order and publish them with one push
+    for (size_t i = 0; i + 1 < objectCount; i++)
+    {
+        struct ZennyLockFreeStackNode *node = (struct ZennyLockFreeStackNode*)(list->objects + i * list->objectSize);
+        node->next = (struct ZennyLockFreeStackNode*)(list->objects + (i + 1) * list->objectSize);
+    }
+
+    ZennyLockFreeStackPushList(&list->stack, (struct ZennyLockFreeStackNode*)list->objects,
+                               (struct ZennyLockFreeStackNode*)(list->objects + (objectCount - 1) * list->objectSize));
+    return true;
+}
+
+void ZennyFreeListDestroy(struct ZennyFreeList *list)
+{
+    ZennyAtomicFreeCacheAligned(list->objects);
+    list->objects = NULL;
+    ZennyLockFreeStackInit(&list->stack);
+}
+
+void* ZennyFreeListAlloc(struct ZennyFreeList *list)
+{
+    return ZennyLockFreeStackPop(&list->stack);
+}
+
+void ZennyFreeListFree(struct ZennyFreeList *list, void *object)
+{
+    ZennyLockFreeStackPush(&list->stack, object);
+}
+
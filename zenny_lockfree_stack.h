@@ -0,0 +1,126 @@
+//
+//  zenny_lockfree_stack.h
+//  ZennyAtomics
+//
+//  Copyright © 2019 Zenny Chen. All rights reserved.
+//
+
+#ifndef zenny_lockfree_stack_h
+#define zenny_lockfree_stack_h
+
+#include "zenny_atomics.h"
+
+/** Link embedded at the start (or anywhere) of an object kept in a lock-free stack */
+struct ZennyLockFreeStackNode
+{
+    struct ZennyLockFreeStackNode *next;
+};
+
+/**
+ * Intrusive lock-free LIFO stack (Treiber stack) that is safe against ABA.
+ * The two words of `top` hold the top node and a generation tag that every successful update increments,
+ * and they are replaced together with the double-width compare-and-swap of the pair operations.
+ * A pop whose top node has been popped and pushed back in the meantime therefore fails and retries
+ * instead of installing a stale `next` pointer.
+ * Nodes may be recycled through the stack at any time without a reclamation scheme,
+ * but their memory must stay readable while the stack is in use, as a stalled pop may still read their link.
+ */
+struct ZennyLockFreeStack
+{
+    /** pair of { top node, generation tag } */
+    alignas(ZENNY_ATOMICS_CACHE_LINE_SIZE) struct ZennyAtomicType top;
+};
+
+/**
+ * Initialize an empty stack
+ * @param stack pointer to the stack object
+ */
+extern void ZennyLockFreeStackInit(struct ZennyLockFreeStack *stack);
+
+/**
+ * Push one node
+ * @param stack pointer to the stack object
+ * @param node the node to be pushed; its link is overwritten
+ */
+extern void ZennyLockFreeStackPush(struct ZennyLockFreeStack *stack, struct ZennyLockFreeStackNode *node);
+
+/**
+ * Push a chain of nodes with a single compare-and-swap. `first` becomes the new top.
+ * @param stack pointer to the stack object
+ * @param first the first node of a chain linked through `next`
+ * @param last the last node of the chain; its link is overwritten
+ */
+extern void ZennyLockFreeStackPushList(struct ZennyLockFreeStack *stack, struct ZennyLockFreeStackNode *first, struct ZennyLockFreeStackNode *last);
+
+/**
+ * Pop the top node
+ * @param stack pointer to the stack object
+ * @return the node popped, or NULL if the stack is empty
+ */
+extern struct ZennyLockFreeStackNode* ZennyLockFreeStackPop(struct ZennyLockFreeStack *stack);
+
+/**
+ * Take every node at once, e.g. to drain a free-list or hand a batch to another thread
+ * @param stack pointer to the stack object
+ * @return the former top node, whose chain ends with NULL; NULL if the stack was empty
+ */
+extern struct ZennyLockFreeStackNode* ZennyLockFreeStackPopAll(struct ZennyLockFreeStack *stack);
+
+/**
+ * Check whether the stack is empty. The result is a snapshot.
+ * @param stack pointer to the stack object
+ * @return true if there was no node in the stack
+ */
+extern bool ZennyLockFreeStackIsEmpty(struct ZennyLockFreeStack *stack);
+
+// MARK: Free-list
+
+/**
+ * Lock-free pool of fixed-size objects carved from one allocation and recycled through a ZennyLockFreeStack.
+ * The first pointer-sized bytes of an object hold the stack link while it is free.
+ */
+struct ZennyFreeList
+{
+    struct ZennyLockFreeStack stack;
+
+    /** storage of all the objects */
+    unsigned char *objects;
+
+    /** distance between two objects in bytes */
+    size_t objectSize;
+
+    /** number of objects */
+    size_t objectCount;
+};
+
+/**
+ * Initialize a pool with every object free
+ * @param list pointer to the free-list object
+ * @param objectSize size of one object in bytes, rounded up to a multiple of sizeof(struct ZennyAtomicType)
+ * @param objectCount number of objects; 0 makes an empty pool
+ * @return true if successful; false if the objects are too large or cannot be allocated.
+ */
+extern bool ZennyFreeListInit(struct ZennyFreeList *list, size_t objectSize, size_t objectCount);
+
+/**
+ * Release the storage of a pool. Every object becomes invalid.
+ * @param list pointer to the free-list object
+ */
+extern void ZennyFreeListDestroy(struct ZennyFreeList *list);
+
+/**
+ * Take a free object
+ * @param list pointer to the free-list object
+ * @return an object aligned to sizeof(struct ZennyAtomicType), or NULL if every object is in use
+ */
+extern void* ZennyFreeListAlloc(struct ZennyFreeList *list);
+
+/**
+ * Give an object back to the pool
+ * @param list pointer to the free-list object
+ * @param object an object returned by ZennyFreeListAlloc of the same pool
+ */
+extern void ZennyFreeListFree(struct ZennyFreeList *list, void *object);
+
+#endif /* zenny_lockfree_stack_h */
+
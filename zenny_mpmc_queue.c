@@ -0,0 +1,216 @@
+//
+//  zenny_mpmc_queue.c
+//  ZennyAtomics
+//
+//  Copyright © 2019 Zenny Chen. All rights reserved.
+//
+
+#include <string.h>
+#include "zenny_mpmc_queue.h"
+
+/** Failed attempts a blocking operation spends backing off before it parks */
+#define ZENNY_MPMC_QUEUE_SPIN_COUNT     64
+
+/** Failed attempts after which each backoff also yields the processor */
+#define ZENNY_MPMC_QUEUE_YIELD_AFTER    16
+
+static volatile struct ZennyAtomicLong* ZennyMpmcQueueSequence(struct ZennyMpmcQueue *queue, int64_t position)
+{
+    return (volatile struct ZennyAtomicLong*)(queue->cells + ((size_t)position & queue->mask) * queue->cellSize);
+}
+
+static unsigned char* ZennyMpmcQueueElement(struct ZennyMpmcQueue *queue, int64_t position)
+{
+    return queue->cells + ((size_t)position & queue->mask) * queue->cellSize + sizeof(struct ZennyAtomicLong);
+}
+
+bool ZennyMpmcQueueInit(struct ZennyMpmcQueue *queue, size_t capacity, size_t elementSize)
+{
+    // At least two cells
+    const size_t roundedCapacity = ZennyAtomicRoundUpPowerOfTwo(capacity < 2 ? 2 : capacity);
+
+    // Keep every sequence number naturally aligned
+    const size_t alignment = sizeof(struct ZennyAtomicLong);
+    queue->cells = NULL;
+    if (roundedCapacity == 0 || elementSize > SIZE_MAX - sizeof(struct ZennyAtomicLong) - alignment)
+        return false;
+
+    queue->cellSize = (sizeof(struct ZennyAtomicLong) + elementSize + alignment - 1) / alignment * alignment;
+    if (roundedCapacity > SIZE_MAX / queue->cellSize)
+        return false;
+
+    queue->cells = ZennyAtomicAllocCacheAligned(roundedCapacity * queue->cellSize);
+    queue->mask = roundedCapacity - 1;
+    queue->elementSize = elementSize;
+    if (queue->cells == NULL)
+        return false;
+
+    // Cell i is ready to be written at position i
+    for (size_t i = 0; i < roundedCapacity; i++)
+        ZennyAtomicLongInit(ZennyMpmcQueueSequence(queue, (int64_t)i), (int64_t)i);
+
+    ZennyAtomicInitLong(&queue->enqueuePosition.atomic, 0);
+    ZennyAtomicInitLong(&queue->dequeuePosition.atomic, 0);
+    ZennyAtomicInitInt(&queue->pushEpoch.atomic, 0);
+    ZennyAtomicInitInt(&queue->parkedConsumers.atomic, 0);
+    ZennyAtomicInitInt(&queue->popEpoch.atomic, 0);
+    ZennyAtomicInitInt(&queue->parkedProducers.atomic, 0);
+
+    return true;
+}
+
+void ZennyMpmcQueueDestroy(struct ZennyMpmcQueue *queue)
+{
+    ZennyAtomicFreeCacheAligned(queue->cells);
+    queue->cells = NULL;
+}
+
+// MARK: Parking
+
+/** Wake one thread parked on the other side of the queue after an element has been published, if there is any */
+static void ZennyMpmcQueueWake(volatile struct ZennyAtomicType *epoch, volatile struct ZennyAtomicType *parked)
+{
+    // Pairs with the fence in ZennyMpmcQueueBlock: either the parking thread sees the new element, or this sees the parking thread
+    ZennyAtomicThreadFence(ZennyMemoryOrderSeqCst);
+    if (ZennyAtomicLoadIntExplicit(parked, ZennyMemoryOrderRelaxed) > 0)
+    {
+        ZennyAtomicAddInt(epoch, 1);
+        ZennyAtomicNotifyOne(epoch);
+    }
+}
+
+/** Retry `attempt` until it succeeds: first with backoff, then parked until the other side bumps `epoch` */
+static void ZennyMpmcQueueBlock(struct ZennyMpmcQueue *queue, void *element, bool (*attempt)(struct ZennyMpmcQueue*, void*),
+                                volatile struct ZennyAtomicType *epoch, volatile struct ZennyAtomicType *parked)
+{
+    struct ZennyAtomicBackoff backoff;
+    ZennyAtomicBackoffInit(&backoff, ZennyAtomicBackoffExponential, 1, ZENNY_ATOMICS_BACKOFF_MAX_SPINS, ZENNY_MPMC_QUEUE_YIELD_AFTER);
+
+    for (unsigned failures = 0; ; failures++)
+    {
+        if (attempt(queue, element))
+            return;
+
+        if (failures < ZENNY_MPMC_QUEUE_SPIN_COUNT)
+        {
+            ZennyAtomicBackoffSpin(&backoff);
+            continue;
+        }
+
+        // Announce the parking before the last attempt, so that a thread publishing after it will bump the epoch
+        const int observedEpoch = ZennyAtomicLoadInt(epoch);
+        ZennyAtomicAddInt(parked, 1);
+        ZennyAtomicThreadFence(ZennyMemoryOrderSeqCst);
+
+        const bool done = attempt(queue, element);
+        if (!done)
+            ZennyAtomicWaitInt(epoch, observedEpoch);
+
+        ZennyAtomicSubInt(parked, 1);
+        if (done)
+            return;
+    }
+}
+
+// MARK: Push
+
+/** Claim and fill a cell without waking anybody */
+static bool ZennyMpmcQueueTryEnqueue(struct ZennyMpmcQueue *queue, const void *element)
+{
+    int64_t position = ZennyAtomicLoadLongExplicit(&queue->enqueuePosition.atomic, ZennyMemoryOrderRelaxed);
+
+    for (;;)
+    {
+        const int64_t sequence = ZennyAtomicLongLoadExplicit(ZennyMpmcQueueSequence(queue, position), ZennyMemoryOrderAcquire);
+        const int64_t difference = sequence - position;
+
+        if (difference == 0)
+        {
+            // The cell is free for this lap; a failed exchange reloads the position
+            if (ZennyAtomicCompareExchangeWeakLongExplicit(&queue->enqueuePosition.atomic, &position, position + 1,
+                                                           ZennyMemoryOrderRelaxed, ZennyMemoryOrderRelaxed))
+                break;
+        }
+        else if (difference < 0)
+            return false;   // the cell still holds the element of the previous lap: full
+        else
+            position = ZennyAtomicLoadLongExplicit(&queue->enqueuePosition.atomic, ZennyMemoryOrderRelaxed);
+    }
+
+    memcpy(ZennyMpmcQueueElement(queue, position), element, queue->elementSize);
+    ZennyAtomicLongStoreExplicit(ZennyMpmcQueueSequence(queue, position), position + 1, ZennyMemoryOrderRelease);
+    return true;
+}
+
+static bool ZennyMpmcQueuePushAttempt(struct ZennyMpmcQueue *queue, void *element)
+{
+    return ZennyMpmcQueueTryEnqueue(queue, element);
+}
+
+bool ZennyMpmcQueueTryPush(struct ZennyMpmcQueue *queue, const void *element)
+{
+    if (!ZennyMpmcQueueTryEnqueue(queue, element))
+        return false;
+
+    ZennyMpmcQueueWake(&queue->pushEpoch.atomic, &queue->parkedConsumers.atomic);
+    return true;
+}
+
+void ZennyMpmcQueuePush(struct ZennyMpmcQueue *queue, const void *element)
+{
+    ZennyMpmcQueueBlock(queue, (void*)element, ZennyMpmcQueuePushAttempt, &queue->popEpoch.atomic, &queue->parkedProducers.atomic);
+    ZennyMpmcQueueWake(&queue->pushEpoch.atomic, &queue->parkedConsumers.atomic);
+}
+
+// MARK: Pop
+
+/** Claim and drain a cell without waking anybody */
+static bool ZennyMpmcQueueTryDequeue(struct ZennyMpmcQueue *queue, void *element)
+{
+    int64_t position = ZennyAtomicLoadLongExplicit(&queue->dequeuePosition.atomic, ZennyMemoryOrderRelaxed);
+
+    for (;;)
+    {
+        const int64_t sequence = ZennyAtomicLongLoadExplicit(ZennyMpmcQueueSequence(queue, position), ZennyMemoryOrderAcquire);
+        const int64_t difference = sequence - (position + 1);
+
+        if (difference == 0)
+        {
+            if (ZennyAtomicCompareExchangeWeakLongExplicit(&queue->dequeuePosition.atomic, &position, position + 1,
+                                                           ZennyMemoryOrderRelaxed, ZennyMemoryOrderRelaxed))
+                break;
+        }
+        else if (difference < 0)
+            return false;   // the cell has not been written in this lap yet: empty
+        else
+            position = ZennyAtomicLoadLongExplicit(&queue->dequeuePosition.atomic, ZennyMemoryOrderRelaxed);
+    }
+
+    memcpy(element, ZennyMpmcQueueElement(queue, position), queue->elementSize);
+
+    // Make the cell free for the next lap
+    ZennyAtomicLongStoreExplicit(ZennyMpmcQueueSequence(queue, position), position + (int64_t)queue->mask + 1, ZennyMemoryOrderRelease);
+    return true;
+}
+
+bool ZennyMpmcQueueTryPop(struct ZennyMpmcQueue *queue, void *element)
+{
+    if (!ZennyMpmcQueueTryDequeue(queue, element))
+        return false;
+
+    ZennyMpmcQueueWake(&queue->popEpoch.atomic, &queue->parkedProducers.atomic);
+    return true;
+}
+
+void ZennyMpmcQueuePop(struct ZennyMpmcQueue *queue, void *element)
+{
+    ZennyMpmcQueueBlock(queue, element, ZennyMpmcQueueTryDequeue, &queue->pushEpoch.atomic, &queue->parkedConsumers.atomic);
+    ZennyMpmcQueueWake(&queue->popEpoch.atomic, &queue->parkedProducers.atomic);
+}
+
+size_t ZennyMpmcQueueSize(struct ZennyMpmcQueue *queue)
+{
+    const int64_t dequeuePosition = ZennyAtomicLoadLong(&queue->dequeuePosition.atomic);
+    const int64_t enqueuePosition = ZennyAtomicLoadLong(&queue->enqueuePosition.atomic);
+    return enqueuePosition > dequeuePosition ? (size_t)(enqueuePosition - dequeuePosition) : 0;
+}
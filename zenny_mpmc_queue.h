@@ -0,0 +1,106 @@
+//
+//  zenny_mpmc_queue.h
+//  ZennyAtomics
+//
+//  Copyright © 2019 Zenny Chen. All rights reserved.
+//
+
+#ifndef zenny_mpmc_queue_h
+#define zenny_mpmc_queue_h
+
+#include "zenny_atomics.h"
+
+/**
+ * Bounded lock-free queue of fixed-size elements for any number of producer and consumer threads.
+ * Every cell carries a sequence number telling whether it is ready to be written or read for a given lap of the array,
+ * so a producer or consumer claims a cell with a single compare-exchange on the enqueue or dequeue position
+ * and then publishes it with a release store of the sequence number.
+ * The blocking variants spin with backoff and yield for a while, then park through the library's wait/notify.
+ */
+struct ZennyMpmcQueue
+{
+    /** cells of `cellSize` bytes: an atomic int64_t sequence number followed by the element */
+    alignas(ZENNY_ATOMICS_CACHE_LINE_SIZE) unsigned char *cells;
+
+    /** number of cells minus one; the number of cells is a power of two */
+    size_t mask;
+
+    /** size of one element in bytes */
+    size_t elementSize;
+
+    /** distance between two cells in bytes */
+    size_t cellSize;
+
+    /** int64_t position of the next cell to be written */
+    struct ZennyAtomicPaddedType enqueuePosition;
+
+    /** int64_t position of the next cell to be read */
+    struct ZennyAtomicPaddedType dequeuePosition;
+
+    /** int bumped when an element is pushed while consumers are parked */
+    struct ZennyAtomicPaddedType pushEpoch;
+
+    /** int number of consumers parked or about to park */
+    struct ZennyAtomicPaddedType parkedConsumers;
+
+    /** int bumped when an element is popped while producers are parked */
+    struct ZennyAtomicPaddedType popEpoch;
+
+    /** int number of producers parked or about to park */
+    struct ZennyAtomicPaddedType parkedProducers;
+};
+
+/**
+ * Initialize an empty queue
+ * @param queue pointer to the queue object
+ * @param capacity number of cells, rounded up to a power of two, at least 2
+ * @param elementSize size of one element in bytes
+ * @return true if successful; false if the cells are too large or cannot be allocated.
+ */
+extern bool ZennyMpmcQueueInit(struct ZennyMpmcQueue *queue, size_t capacity, size_t elementSize);
+
+/**
+ * Release the cells of a queue. No thread may be blocked on it.
+ * @param queue pointer to the queue object
+ */
+extern void ZennyMpmcQueueDestroy(struct ZennyMpmcQueue *queue);
+
+/**
+ * Copy one element into the queue if there is room
+ * @param queue pointer to the queue object
+ * @param element pointer to `elementSize` bytes to be copied
+ * @return true if the element has been pushed; false if the queue is full.
+ */
+extern bool ZennyMpmcQueueTryPush(struct ZennyMpmcQueue *queue, const void *element);
+
+/**
+ * Copy one element into the queue, blocking while it is full
+ * @param queue pointer to the queue object
+ * @param element pointer to `elementSize` bytes to be copied
+ */
+extern void ZennyMpmcQueuePush(struct ZennyMpmcQueue *queue, const void *element);
+
+/**
+ * Copy one element out of the queue if there is one
+ * @param queue pointer to the queue object
+ * @param element pointer to `elementSize` bytes receiving the element
+ * @return true if an element has been popped; false if the queue is empty.
+ */
+extern bool ZennyMpmcQueueTryPop(struct ZennyMpmcQueue *queue, void *element);
+
+/**
+ * Copy one element out of the queue, blocking while it is empty
+ * @param queue pointer to the queue object
+ * @param element pointer to `elementSize` bytes receiving the element
+ */
+extern void ZennyMpmcQueuePop(struct ZennyMpmcQueue *queue, void *element);
+
+/**
+ * Number of elements in the queue; exact only when no thread is pushing or popping
+ * @param queue pointer to the queue object
+ * @return the number of elements pushed and not yet popped
+ */
+extern size_t ZennyMpmcQueueSize(struct ZennyMpmcQueue *queue);
+
+#endif /* zenny_mpmc_queue_h */
+
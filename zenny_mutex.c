@@ -0,0 +1,157 @@
+//
+//  zenny_mutex.c
+//  ZennyAtomics
+//
+//  Copyright © 2019 Zenny Chen. All rights reserved.
+//
+
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
+#include "zenny_mutex.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+/** Values of ZennyMutex.state */
+#define ZENNY_MUTEX_UNLOCKED    0
+#define ZENNY_MUTEX_LOCKED      1
+#define ZENNY_MUTEX_PARKED      2
+
+/** Bounds of the polling budget, in polls; the budget is twice the estimate plus the minimum */
+#define ZENNY_MUTEX_MIN_SPIN    16
+#define ZENNY_MUTEX_MAX_SPIN    4096
+
+/** Inverse weight of the newest observation in the moving average of ZennyMutex.spinEstimate */
+#define ZENNY_MUTEX_ESTIMATE_DIVISOR    8
+
+static uint64_t ZennyMutexNow(void)
+{
+#ifdef _WIN32
+    static LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+    if (frequency.QuadPart == 0)
+        QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return (uint64_t)(counter.QuadPart / frequency.QuadPart * 1000000000ULL +
+                      counter.QuadPart % frequency.QuadPart * 1000000000ULL / frequency.QuadPart);
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+/** Add to a statistics counter; only the holder of the mutex writes the counters, so no read-modify-write is needed */
+static void ZennyMutexCount(volatile struct ZennyAtomicULong *counter, uint64_t value)
+{
+    ZennyAtomicULongStoreExplicit(counter, ZennyAtomicULongLoadExplicit(counter, ZennyMemoryOrderRelaxed) + value,
+                                  ZennyMemoryOrderRelaxed);
+}
+
+static bool ZennyMutexTryAcquire(struct ZennyMutex *mutex)
+{
+    int expected = ZENNY_MUTEX_UNLOCKED;
+    return ZennyAtomicCompareExchangeIntExplicit(&mutex->state, &expected, ZENNY_MUTEX_LOCKED,
+                                                 ZennyMemoryOrderAcquire, ZennyMemoryOrderRelaxed);
+}
+
+/**
+ * Poll the mutex within the budget and update the estimate of the hold time
+ * @return true if the mutex has been acquired; false if the caller should park
+ */
+static bool ZennyMutexSpin(struct ZennyMutex *mutex)
+{
+    int estimate = ZennyAtomicIntLoadExplicit(&mutex->spinEstimate, ZennyMemoryOrderRelaxed);
+    int limit = estimate * 2 + ZENNY_MUTEX_MIN_SPIN;
+    if (limit > ZENNY_MUTEX_MAX_SPIN)
+        limit = ZENNY_MUTEX_MAX_SPIN;
+
+    for (int i = 0; i < limit; i++)
+    {
+        // Only attempt the exchange when the mutex looks free, so that polling stays in the local cache
+        if (ZennyAtomicLoadIntExplicit(&mutex->state, ZennyMemoryOrderRelaxed) == ZENNY_MUTEX_UNLOCKED &&
+            ZennyMutexTryAcquire(mutex))
+        {
+            // Divide rather than shift: the difference is negative when the mutex came free sooner than estimated
+            estimate += (i - estimate) / ZENNY_MUTEX_ESTIMATE_DIVISOR;
+            ZennyAtomicIntStoreExplicit(&mutex->spinEstimate, estimate, ZennyMemoryOrderRelaxed);
+            return true;
+        }
+
+        ZennyAtomicPause();
+    }
+
+    // The holder kept the mutex longer than the budget, or is not running at all: poll less next time
+    ZennyAtomicIntStoreExplicit(&mutex->spinEstimate, estimate / 2, ZennyMemoryOrderRelaxed);
+    return false;
+}
+
+void ZennyMutexInit(struct ZennyMutex *mutex, bool collectStatistics)
+{
+    ZennyAtomicInitInt(&mutex->state, ZENNY_MUTEX_UNLOCKED);
+    ZennyAtomicIntInit(&mutex->spinEstimate, 0);
+    mutex->collectStatistics = collectStatistics;
+    ZennyMutexResetStatistics(mutex);
+}
+
+void ZennyMutexLock(struct ZennyMutex *mutex)
+{
+    if (ZennyMutexTryAcquire(mutex))
+    {
+        if (mutex->collectStatistics)
+            ZennyMutexCount(&mutex->acquisitions, 1);
+        return;
+    }
+
+    const uint64_t start = mutex->collectStatistics ? ZennyMutexNow() : 0;
+
+    if (!ZennyMutexSpin(mutex))
+    {
+        // Mark the mutex as having parked threads before parking, so that the holder wakes one on unlock.
+        // The mark stays after this thread acquires it, as other threads may still be parked.
+        while (ZennyAtomicExchangeIntExplicit(&mutex->state, ZENNY_MUTEX_PARKED, ZennyMemoryOrderAcquire) != ZENNY_MUTEX_UNLOCKED)
+            ZennyAtomicWaitInt(&mutex->state, ZENNY_MUTEX_PARKED);
+    }
+
+    if (mutex->collectStatistics)
+    {
+        ZennyMutexCount(&mutex->acquisitions, 1);
+        ZennyMutexCount(&mutex->contendedAcquisitions, 1);
+        ZennyMutexCount(&mutex->waitNs, ZennyMutexNow() - start);
+    }
+}
+
+bool ZennyMutexTryLock(struct ZennyMutex *mutex)
+{
+    if (!ZennyMutexTryAcquire(mutex))
+        return false;
+
+    if (mutex->collectStatistics)
+        ZennyMutexCount(&mutex->acquisitions, 1);
+    return true;
+}
+
+void ZennyMutexUnlock(struct ZennyMutex *mutex)
+{
+    if (ZennyAtomicExchangeIntExplicit(&mutex->state, ZENNY_MUTEX_UNLOCKED, ZennyMemoryOrderRelease) == ZENNY_MUTEX_PARKED)
+        ZennyAtomicNotifyOne(&mutex->state);
+}
+
+void ZennyMutexGetStatistics(struct ZennyMutex *mutex, struct ZennyMutexStatistics *statistics)
+{
+    statistics->acquisitions = ZennyAtomicULongLoadExplicit(&mutex->acquisitions, ZennyMemoryOrderRelaxed);
+    statistics->contendedAcquisitions = ZennyAtomicULongLoadExplicit(&mutex->contendedAcquisitions, ZennyMemoryOrderRelaxed);
+    statistics->waitNs = ZennyAtomicULongLoadExplicit(&mutex->waitNs, ZennyMemoryOrderRelaxed);
+}
+
+void ZennyMutexResetStatistics(struct ZennyMutex *mutex)
+{
+    ZennyAtomicULongInit(&mutex->acquisitions, 0);
+    ZennyAtomicULongInit(&mutex->contendedAcquisitions, 0);
+    ZennyAtomicULongInit(&mutex->waitNs, 0);
+}
@@ -0,0 +1,95 @@
+//
+//  zenny_mutex.h
+//  ZennyAtomics
+//
+//  Copyright © 2019 Zenny Chen. All rights reserved.
+//
+
+#ifndef zenny_mutex_h
+#define zenny_mutex_h
+
+#include "zenny_atomics.h"
+
+/**
+ * Contention statistics of a mutex, collected when requested at initialization
+ */
+struct ZennyMutexStatistics
+{
+    /** number of times the mutex has been acquired */
+    uint64_t acquisitions;
+
+    /** number of acquisitions that found the mutex held */
+    uint64_t contendedAcquisitions;
+
+    /** nanoseconds spent by contended acquisitions between finding the mutex held and acquiring it */
+    uint64_t waitNs;
+};
+
+/**
+ * Mutex that spins briefly and then parks.
+ * The state is 0 (unlocked), 1 (locked) or 2 (locked, and threads may be parked on it),
+ * so an uncontended lock and unlock cost one compare-exchange and one exchange, and unlocking only
+ * makes a system call when somebody parked.
+ * A waiter first polls for a budget derived from how long the recent holders kept the mutex,
+ * measured in polls by the waiters that did get it while polling; when polling fails,
+ * the budget shrinks, so that oversubscribed threads park instead of burning the time slice of the holder.
+ */
+struct ZennyMutex
+{
+    /** int 0, 1 or 2 as described above */
+    alignas(ZENNY_ATOMICS_CACHE_LINE_SIZE) struct ZennyAtomicType state;
+
+    /** moving average of the polls it took a waiter to acquire the mutex */
+    struct ZennyAtomicInt spinEstimate;
+
+    /** whether the counters below are maintained */
+    bool collectStatistics;
+
+    /** updated by the holder only, so that collecting costs no extra atomic read-modify-write */
+    struct ZennyAtomicULong acquisitions;
+    struct ZennyAtomicULong contendedAcquisitions;
+    struct ZennyAtomicULong waitNs;
+};
+
+/**
+ * Initialize a mutex to the unlocked state
+ * @param mutex pointer to the mutex object
+ * @param collectStatistics whether to count acquisitions, contended acquisitions and wait time.
+ * Counting adds two clock reads to every contended acquisition.
+ */
+extern void ZennyMutexInit(struct ZennyMutex *mutex, bool collectStatistics);
+
+/**
+ * Acquire a mutex, polling and then parking until it is available
+ * @param mutex pointer to the mutex object
+ */
+extern void ZennyMutexLock(struct ZennyMutex *mutex);
+
+/**
+ * Try to acquire a mutex without waiting
+ * @param mutex pointer to the mutex object
+ * @return true if the mutex has been acquired; false if it is held by another thread.
+ */
+extern bool ZennyMutexTryLock(struct ZennyMutex *mutex);
+
+/**
+ * Release a mutex and wake one parked thread, if any
+ * @param mutex pointer to the mutex object held by the calling thread
+ */
+extern void ZennyMutexUnlock(struct ZennyMutex *mutex);
+
+/**
+ * Read the contention statistics of a mutex.
+ * The counters are read one by one, so they are only consistent with each other while the mutex is idle.
+ * @param mutex pointer to the mutex object
+ * @param statistics receives the counters; all zero if the mutex does not collect them
+ */
+extern void ZennyMutexGetStatistics(struct ZennyMutex *mutex, struct ZennyMutexStatistics *statistics);
+
+/**
+ * Reset the contention statistics of a mutex. It must not be called while another thread may acquire it.
+ * @param mutex pointer to the mutex object
+ */
+extern void ZennyMutexResetStatistics(struct ZennyMutex *mutex);
+
+#endif /* zenny_mutex_h */
@@ -0,0 +1,333 @@
+//
+//  zenny_rcu.c
+//  ZennyAtomics
+//
+//  Copyright © 2019 Zenny Chen. All rights reserved.
+//
+
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+#include "zenny_rcu.h"
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <pthread.h>
+#if defined(__linux__)
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/membarrier.h>
+#endif
+#endif
+
+struct ZennyRcuReclaimer
+{
+#ifdef _WIN32
+    HANDLE thread;
+#else
+    pthread_t thread;
+#endif
+    /** nonzero once ZennyRcuDestroy asks the reclaimer to finish */
+    struct ZennyAtomicInt stop;
+
+    /** nonzero while the reclaimer is parked or about to park on `pending` */
+    struct ZennyAtomicInt parked;
+};
+
+// MARK: Process-wide barrier
+
+/** Ask the operating system for a process-wide memory barrier; false if none is available */
+static bool ZennyRcuRegisterHeavyBarrier(void)
+{
+#if defined(_WIN32)
+    return true;
+#elif defined(__linux__) && defined(__NR_membarrier)
+    return syscall(__NR_membarrier, MEMBARRIER_CMD_REGISTER_PRIVATE_EXPEDITED, 0) == 0;
+#else
+    return false;
+#endif
+}
+
+/** Execute a full barrier on every running thread of the process, or just on this one when readers use fences */
+static void ZennyRcuHeavyBarrier(struct ZennyRcuDomain *domain)
+{
+    ZennyAtomicThreadFence(ZennyMemoryOrderSeqCst);
+    if (!domain->heavyBarrier)
+        return;
+
+#if defined(_WIN32)
+    FlushProcessWriteBuffers();
+#elif defined(__linux__) && defined(__NR_membarrier)
+    syscall(__NR_membarrier, MEMBARRIER_CMD_PRIVATE_EXPEDITED, 0);
+#endif
+}
+
+// MARK: Thread records
+
+struct ZennyRcuThread* ZennyRcuRegister(struct ZennyRcuDomain *domain)
+{
+    // Take over a released record first
+    for (struct ZennyRcuThread *thread = (struct ZennyRcuThread*)ZennyAtomicPtrLoad(&domain->threads); thread != NULL; thread = thread->next)
+    {
+        int expected = 0;
+        if (ZennyAtomicIntLoadExplicit(&thread->inUse, ZennyMemoryOrderRelaxed) == 0 &&
+            ZennyAtomicIntCompareExchange(&thread->inUse, &expected, 1))
+            return thread;
+    }
+
+    struct ZennyRcuThread *thread = ZennyAtomicAllocCacheAligned(sizeof(*thread));
+    if (thread == NULL)
+        return NULL;
+
+    memset(thread, 0, sizeof(*thread));
+    ZennyAtomicULongInit(&thread->period, 0);
+    ZennyAtomicIntInit(&thread->inUse, 1);
+    thread->domain = domain;
+
+    intptr_t head = ZennyAtomicPtrLoadExplicit(&domain->threads, ZennyMemoryOrderRelaxed);
+    do
+        thread->next = (struct ZennyRcuThread*)head;
+    while (!ZennyAtomicPtrCompareExchangeWeak(&domain->threads, &head, (intptr_t)thread));
+
+    return thread;
+}
+
+void ZennyRcuUnregister(struct ZennyRcuThread *thread)
+{
+    ZennyAtomicIntStoreExplicit(&thread->inUse, 0, ZennyMemoryOrderRelease);
+}
+
+// MARK: Readers
+
+void ZennyRcuReadLock(struct ZennyRcuThread *thread)
+{
+    if (thread->nesting++ > 0)
+        return;
+
+    const uint64_t period = ZennyAtomicULongLoadExplicit(&thread->domain->period, ZennyMemoryOrderRelaxed);
+    ZennyAtomicULongStoreExplicit(&thread->period, period, ZennyMemoryOrderRelaxed);
+
+    // Publish the record before any shared pointer is loaded. With the process-wide barrier, the grace period
+    // forces this ordering from the writer's side, so only the compiler has to be kept from reordering.
+    if (thread->domain->heavyBarrier)
+        ZennyAtomicSignalFence(ZennyMemoryOrderSeqCst);
+    else
+        ZennyAtomicThreadFence(ZennyMemoryOrderSeqCst);
+}
+
+void ZennyRcuReadUnlock(struct ZennyRcuThread *thread)
+{
+    if (--thread->nesting > 0)
+        return;
+
+    ZennyAtomicULongStoreExplicit(&thread->period, 0, ZennyMemoryOrderRelease);
+}
+
+void ZennyRcuAssign(volatile struct ZennyAtomicPtr *pointer, void *value)
+{
+    ZennyAtomicPtrStoreExplicit(pointer, (intptr_t)value, ZennyMemoryOrderRelease);
+}
+
+void* ZennyRcuDereference(volatile struct ZennyAtomicPtr *pointer)
+{
+    return (void*)ZennyAtomicPtrLoadExplicit(pointer, ZennyMemoryOrderAcquire);
+}
+
+// MARK: Grace periods
+
+void ZennyRcuSynchronize(struct ZennyRcuDomain *domain)
+{
+    // Readers that enter from now on observe at least `target`; the counter is 64-bit, so it never wraps
+    const uint64_t target = ZennyAtomicULongAddFetch(&domain->period, 1);
+    ZennyRcuHeavyBarrier(domain);
+
+    struct ZennyAtomicBackoff backoff;
+    ZennyAtomicBackoffInit(&backoff, ZennyAtomicBackoffExponential, 1, ZENNY_ATOMICS_BACKOFF_MAX_SPINS, 8);
+
+    for (struct ZennyRcuThread *thread = (struct ZennyRcuThread*)ZennyAtomicPtrLoadExplicit(&domain->threads, ZennyMemoryOrderAcquire);
+         thread != NULL; thread = thread->next)
+    {
+        for (;;)
+        {
+            const uint64_t period = ZennyAtomicULongLoadExplicit(&thread->period, ZennyMemoryOrderAcquire);
+            if (period == 0 || period >= target)
+                break;      // outside a section, or in one that started after the grace period did
+
+            ZennyAtomicBackoffSpin(&backoff);
+        }
+    }
+
+    // Order the readers' last accesses before whatever the caller frees next
+    ZennyRcuHeavyBarrier(domain);
+}
+
+// MARK: Callbacks
+
+void ZennyRcuCall(struct ZennyRcuDomain *domain, struct ZennyRcuHead *head, void (*callback)(struct ZennyRcuHead *head))
+{
+    head->callback = callback;
+    ZennyAtomicULongAdd(&domain->queuedCount, 1);
+
+    intptr_t first = ZennyAtomicPtrLoadExplicit(&domain->callbacks, ZennyMemoryOrderRelaxed);
+    do
+        head->next = (struct ZennyRcuHead*)first;
+    while (!ZennyAtomicPtrCompareExchangeWeak(&domain->callbacks, &first, (intptr_t)head));
+
+    // The exchange above is a full barrier, pairing with the one made by the reclaimer before it parks
+    if (ZennyAtomicIntLoad(&domain->reclaimer->parked) != 0)
+    {
+        ZennyAtomicAddInt(&domain->pending, 1);
+        ZennyAtomicNotifyOne(&domain->pending);
+    }
+}
+
+void ZennyRcuBarrier(struct ZennyRcuDomain *domain)
+{
+    const uint64_t target = ZennyAtomicULongLoad(&domain->queuedCount);
+
+    for (;;)
+    {
+        const int observed = ZennyAtomicLoadInt(&domain->invoked);
+        if (ZennyAtomicULongLoad(&domain->invokedCount) >= target)
+            return;
+
+        ZennyAtomicWaitInt(&domain->invoked, observed);
+    }
+}
+
+/** Wait for a grace period, then invoke a batch of callbacks in the order they were queued */
+static void ZennyRcuInvoke(struct ZennyRcuDomain *domain, struct ZennyRcuHead *batch)
+{
+    ZennyRcuSynchronize(domain);
+
+    struct ZennyRcuHead *ordered = NULL;
+    while (batch != NULL)
+    {
+        struct ZennyRcuHead *next = batch->next;
+        batch->next = ordered;
+        ordered = batch;
+        batch = next;
+    }
+
+    uint64_t count = 0;
+    while (ordered != NULL)
+    {
+        struct ZennyRcuHead *next = ordered->next;
+        ordered->callback(ordered);
+        ordered = next;
+        count++;
+    }
+
+    ZennyAtomicULongAdd(&domain->invokedCount, count);
+    ZennyAtomicAddInt(&domain->invoked, 1);
+    ZennyAtomicNotifyAll(&domain->invoked);
+}
+
+static void ZennyRcuReclaimerLoop(struct ZennyRcuDomain *domain)
+{
+    struct ZennyRcuReclaimer *reclaimer = domain->reclaimer;
+
+    for (;;)
+    {
+        struct ZennyRcuHead *batch = (struct ZennyRcuHead*)ZennyAtomicPtrExchange(&domain->callbacks, 0);
+        if (batch != NULL)
+        {
+            ZennyRcuInvoke(domain, batch);
+            continue;
+        }
+
+        if (ZennyAtomicIntLoad(&reclaimer->stop) != 0)
+            return;
+
+        // Announce the parking before the last check, so that a callback queued after it wakes the reclaimer
+        const int observed = ZennyAtomicLoadInt(&domain->pending);
+        ZennyAtomicIntStore(&reclaimer->parked, 1);
+        ZennyAtomicThreadFence(ZennyMemoryOrderSeqCst);
+
+        if (ZennyAtomicPtrLoad(&domain->callbacks) == 0 && ZennyAtomicIntLoad(&reclaimer->stop) == 0)
+            ZennyAtomicWaitInt(&domain->pending, observed);
+
+        ZennyAtomicIntStore(&reclaimer->parked, 0);
+    }
+}
+
+#ifdef _WIN32
+static DWORD WINAPI ZennyRcuReclaimerMain(LPVOID domain)
+{
+    ZennyRcuReclaimerLoop(domain);
+    return 0;
+}
+#else
+static void* ZennyRcuReclaimerMain(void *domain)
+{
+    ZennyRcuReclaimerLoop(domain);
+    return NULL;
+}
+#endif
+
+// MARK: Domain
+
+bool ZennyRcuInit(struct ZennyRcuDomain *domain)
+{
+    ZennyAtomicULongInit(&domain->period, 1);
+    domain->heavyBarrier = ZennyRcuRegisterHeavyBarrier();
+    ZennyAtomicPtrInit(&domain->threads, 0);
+    ZennyAtomicPtrInit(&domain->callbacks, 0);
+    ZennyAtomicULongInit(&domain->queuedCount, 0);
+    ZennyAtomicULongInit(&domain->invokedCount, 0);
+    ZennyAtomicInitInt(&domain->pending, 0);
+    ZennyAtomicInitInt(&domain->invoked, 0);
+
+    domain->reclaimer = malloc(sizeof(*domain->reclaimer));
+    if (domain->reclaimer == NULL)
+        return false;
+
+    ZennyAtomicIntInit(&domain->reclaimer->stop, 0);
+    ZennyAtomicIntInit(&domain->reclaimer->parked, 0);
+
+#ifdef _WIN32
+    domain->reclaimer->thread = CreateThread(NULL, 0, ZennyRcuReclaimerMain, domain, 0, NULL);
+    const bool started = domain->reclaimer->thread != NULL;
+#else
+    const bool started = pthread_create(&domain->reclaimer->thread, NULL, ZennyRcuReclaimerMain, domain) == 0;
+#endif
+    if (!started)
+    {
+        free(domain->reclaimer);
+        domain->reclaimer = NULL;
+    }
+
+    return started;
+}
+
+void ZennyRcuDestroy(struct ZennyRcuDomain *domain)
+{
+    // The reclaimer drains the queue before it checks the stop request
+    ZennyAtomicIntStore(&domain->reclaimer->stop, 1);
+    ZennyAtomicAddInt(&domain->pending, 1);
+    ZennyAtomicNotifyOne(&domain->pending);
+
+#ifdef _WIN32
+    WaitForSingleObject(domain->reclaimer->thread, INFINITE);
+    CloseHandle(domain->reclaimer->thread);
+#else
+    pthread_join(domain->reclaimer->thread, NULL);
+#endif
+    free(domain->reclaimer);
+    domain->reclaimer = NULL;
+
+    struct ZennyRcuThread *thread = (struct ZennyRcuThread*)ZennyAtomicPtrLoad(&domain->threads);
+    while (thread != NULL)
+    {
+        struct ZennyRcuThread *next = thread->next;
+        ZennyAtomicFreeCacheAligned(thread);
+        thread = next;
+    }
+
+    ZennyAtomicPtrStore(&domain->threads, 0);
+}
+
@@ -0,0 +1,155 @@
+//
+//  zenny_rcu.h
+//  ZennyAtomics
+//
+//  Copyright © 2019 Zenny Chen. All rights reserved.
+//
+
+#ifndef zenny_rcu_h
+#define zenny_rcu_h
+
+#include "zenny_atomics.h"
+
+/** Link embedded in an object whose destruction is deferred with ZennyRcuCall */
+struct ZennyRcuHead
+{
+    struct ZennyRcuHead *next;
+    void (*callback)(struct ZennyRcuHead *head);
+};
+
+/**
+ * Per-thread record of an RCU domain, obtained with ZennyRcuRegister.
+ * Records are never freed before the domain, so that grace periods can walk them without locking.
+ */
+struct ZennyRcuThread
+{
+    /** grace-period counter observed by the outermost ZennyRcuReadLock; 0 outside read-side sections. Written by the owner only. */
+    alignas(ZENNY_ATOMICS_CACHE_LINE_SIZE) struct ZennyAtomicULong period;
+
+    /** depth of nested read-side sections */
+    unsigned nesting;
+
+    /** domain the record belongs to */
+    struct ZennyRcuDomain *domain;
+
+    /** next record in the domain's list */
+    struct ZennyRcuThread *next;
+
+    /** nonzero while a thread owns the record */
+    struct ZennyAtomicInt inUse;
+};
+
+/** State of the background reclaimer thread, private to zenny_rcu.c */
+struct ZennyRcuReclaimer;
+
+/**
+ * Userspace read-copy-update.
+ * Readers bracket their accesses with ZennyRcuReadLock and ZennyRcuReadUnlock, which only store to the reader's own record.
+ * Where the operating system offers a process-wide memory barrier (membarrier on Linux, FlushProcessWriteBuffers on Windows),
+ * the writer side issues it during a grace period and readers execute no fence at all; otherwise readers execute one full fence.
+ * Writers publish a new version with ZennyRcuAssign and then either wait for the old one to become unreachable
+ * with ZennyRcuSynchronize, or hand it to ZennyRcuCall, whose callbacks run on a background thread after a grace period.
+ */
+struct ZennyRcuDomain
+{
+    /** grace-period counter, starting at 1 and incremented by every grace period */
+    alignas(ZENNY_ATOMICS_CACHE_LINE_SIZE) struct ZennyAtomicULong period;
+
+    /** whether readers can rely on the process-wide barrier instead of a fence; fixed at initialization */
+    bool heavyBarrier;
+
+    /** list of the thread records, pushed to the front and never shrunk */
+    struct ZennyAtomicPtr threads;
+
+    /** callbacks queued by ZennyRcuCall and not yet taken by the reclaimer, most recent first */
+    alignas(ZENNY_ATOMICS_CACHE_LINE_SIZE) struct ZennyAtomicPtr callbacks;
+
+    /** numbers of callbacks queued and invoked so far */
+    struct ZennyAtomicULong queuedCount;
+    struct ZennyAtomicULong invokedCount;
+
+    /** int bumped to wake the reclaimer when it is parked */
+    struct ZennyAtomicType pending;
+
+    /** int bumped after every batch of callbacks, for ZennyRcuBarrier */
+    struct ZennyAtomicType invoked;
+
+    /** background thread that runs the callbacks */
+    struct ZennyRcuReclaimer *reclaimer;
+};
+
+/**
+ * Initialize an RCU domain and start its reclaimer thread
+ * @param domain pointer to the domain object
+ * @return true if successful; false if the reclaimer cannot be started.
+ */
+extern bool ZennyRcuInit(struct ZennyRcuDomain *domain);
+
+/**
+ * Run every queued callback, stop the reclaimer and free every thread record. No thread may use the domain any more.
+ * @param domain pointer to the domain object
+ */
+extern void ZennyRcuDestroy(struct ZennyRcuDomain *domain);
+
+/**
+ * Obtain a thread record for the calling thread, reusing one released by ZennyRcuUnregister if possible
+ * @param domain pointer to the domain object
+ * @return the record, or NULL if it cannot be allocated
+ */
+extern struct ZennyRcuThread* ZennyRcuRegister(struct ZennyRcuDomain *domain);
+
+/**
+ * Release a thread record
+ * @param thread the record of the calling thread, outside any read-side section
+ */
+extern void ZennyRcuUnregister(struct ZennyRcuThread *thread);
+
+/**
+ * Enter a read-side section. Sections may be nested. Never wait for a grace period inside one.
+ * @param thread the record of the calling thread
+ */
+extern void ZennyRcuReadLock(struct ZennyRcuThread *thread);
+
+/**
+ * Leave a read-side section
+ * @param thread the record of the calling thread
+ */
+extern void ZennyRcuReadUnlock(struct ZennyRcuThread *thread);
+
+/**
+ * Publish a new version: a release store, so that readers see it fully initialized
+ * @param pointer the shared pointer
+ * @param value the new version
+ */
+extern void ZennyRcuAssign(volatile struct ZennyAtomicPtr *pointer, void *value);
+
+/**
+ * Load the current version inside a read-side section: an acquire load
+ * @param pointer the shared pointer
+ * @return the current version, valid until ZennyRcuReadUnlock
+ */
+extern void* ZennyRcuDereference(volatile struct ZennyAtomicPtr *pointer);
+
+/**
+ * Wait for a grace period: every read-side section that was running when this is called has finished,
+ * so versions unlinked before the call are no longer referenced.
+ * @param domain pointer to the domain object
+ */
+extern void ZennyRcuSynchronize(struct ZennyRcuDomain *domain);
+
+/**
+ * Invoke `callback` on the reclaimer thread after a grace period, without waiting
+ * @param domain pointer to the domain object
+ * @param head link embedded in the unlinked object
+ * @param callback typically frees the object containing `head`
+ */
+extern void ZennyRcuCall(struct ZennyRcuDomain *domain, struct ZennyRcuHead *head, void (*callback)(struct ZennyRcuHead *head));
+
+/**
+ * Wait until every callback queued with ZennyRcuCall before this call has been invoked
+ * @param domain pointer to the domain object
+ */
+extern void ZennyRcuBarrier(struct ZennyRcuDomain *domain);
+
+#endif /* zenny_rcu_h */
+
@@ -0,0 +1,197 @@
+//
+//  zenny_rwlock.c
+//  ZennyAtomics
+//
+//  Copyright © 2019 Zenny Chen. All rights reserved.
+//
+
+#include <limits.h>
+#include "zenny_rwlock.h"
+
+/** Upper bound of the number of pause instructions between two attempts to take a reader-writer lock */
+#define ZENNY_RWLOCK_MAX_BACKOFF        1024
+
+/** Failed attempts after which each backoff also yields the processor, as writers may wait for many readers */
+#define ZENNY_RWLOCK_YIELD_AFTER        16
+
+/** Layout of ZennyRWSpinLock.state: the writer bit, the number of waiting writers in bits 1-11, the number of readers above */
+#define ZENNY_RWLOCK_WRITER             0x1
+#define ZENNY_RWLOCK_WRITER_WAITING     0x2
+#define ZENNY_RWLOCK_WAITING_MASK       0xffe
+#define ZENNY_RWLOCK_READER             0x1000
+
+static void ZennyRWLockBackoffInit(struct ZennyAtomicBackoff *backoff)
+{
+    ZennyAtomicBackoffInit(backoff, ZennyAtomicBackoffExponential, 1, ZENNY_RWLOCK_MAX_BACKOFF, ZENNY_RWLOCK_YIELD_AFTER);
+}
+
+// MARK: Reader-writer spin lock
+
+void ZennyRWSpinLockInit(struct ZennyRWSpinLock *lock)
+{
+    ZennyAtomicIntInit(&lock->state, 0);
+}
+
+bool ZennyRWSpinLockTryReadLock(struct ZennyRWSpinLock *lock)
+{
+    int state = ZennyAtomicIntLoadExplicit(&lock->state, ZennyMemoryOrderRelaxed);
+    while ((state & (ZENNY_RWLOCK_WRITER | ZENNY_RWLOCK_WAITING_MASK)) == 0)
+    {
+        // A failed exchange reloads the state, e.g. after another reader came in
+        if (ZennyAtomicIntCompareExchangeWeakExplicit(&lock->state, &state, state + ZENNY_RWLOCK_READER,
+                                                      ZennyMemoryOrderAcquire, ZennyMemoryOrderRelaxed))
+            return true;
+    }
+
+    return false;
+}
+
+void ZennyRWSpinLockReadLock(struct ZennyRWSpinLock *lock)
+{
+    struct ZennyAtomicBackoff backoff;
+    ZennyRWLockBackoffInit(&backoff);
+
+    while (!ZennyRWSpinLockTryReadLock(lock))
+        ZennyAtomicBackoffSpin(&backoff);
+}
+
+void ZennyRWSpinLockReadUnlock(struct ZennyRWSpinLock *lock)
+{
+    ZennyAtomicIntSubExplicit(&lock->state, ZENNY_RWLOCK_READER, ZennyMemoryOrderRelease);
+}
+
+/**
+ * Take the lock for writing if nobody holds it, converting `waiting` announced waiters into the holder
+ * @return true if the lock has been acquired
+ */
+static bool ZennyRWSpinLockAcquireWrite(struct ZennyRWSpinLock *lock, int waiting)
+{
+    int state = ZennyAtomicIntLoadExplicit(&lock->state, ZennyMemoryOrderRelaxed);
+    while ((state & ~ZENNY_RWLOCK_WAITING_MASK) == 0)
+    {
+        // The other waiting writers stay counted, so readers remain held off until all of them are through
+        if (ZennyAtomicIntCompareExchangeWeakExplicit(&lock->state, &state, state - waiting + ZENNY_RWLOCK_WRITER,
+                                                      ZennyMemoryOrderAcquire, ZennyMemoryOrderRelaxed))
+            return true;
+    }
+
+    return false;
+}
+
+bool ZennyRWSpinLockTryWriteLock(struct ZennyRWSpinLock *lock)
+{
+    return ZennyRWSpinLockAcquireWrite(lock, 0);
+}
+
+void ZennyRWSpinLockWriteLock(struct ZennyRWSpinLock *lock)
+{
+    if (ZennyRWSpinLockAcquireWrite(lock, 0))
+        return;
+
+    // Announce this writer before waiting, which keeps new readers out until it has acquired the lock
+    ZennyAtomicIntAddExplicit(&lock->state, ZENNY_RWLOCK_WRITER_WAITING, ZennyMemoryOrderRelaxed);
+
+    struct ZennyAtomicBackoff backoff;
+    ZennyRWLockBackoffInit(&backoff);
+
+    while (!ZennyRWSpinLockAcquireWrite(lock, ZENNY_RWLOCK_WRITER_WAITING))
+        ZennyAtomicBackoffSpin(&backoff);
+}
+
+void ZennyRWSpinLockWriteUnlock(struct ZennyRWSpinLock *lock)
+{
+    // Leave the count of waiting writers as it is
+    ZennyAtomicIntSubExplicit(&lock->state, ZENNY_RWLOCK_WRITER, ZennyMemoryOrderRelease);
+}
+
+// MARK: Big-reader lock
+
+bool ZennyBigReaderLockInit(struct ZennyBigReaderLock *lock, unsigned slotCount)
+{
+    if (slotCount == 0)
+        slotCount = (unsigned)ZennyAtomicProcessorCount();
+
+    // The mask has to fit in unsigned
+    const size_t roundedCount = ZennyAtomicRoundUpPowerOfTwo(slotCount);
+    ZennyAtomicInitInt(&lock->writer.atomic, 0);
+    if (roundedCount == 0 || roundedCount > UINT_MAX)
+    {
+        lock->readers = NULL;
+        return false;
+    }
+
+    lock->readers = ZennyAtomicAllocPaddedArray(roundedCount);
+    lock->slotMask = (unsigned)(roundedCount - 1);
+    if (lock->readers == NULL)
+        return false;
+
+    for (size_t i = 0; i < roundedCount; i++)
+        ZennyAtomicInitInt(&lock->readers[i].atomic, 0);
+
+    return true;
+}
+
+void ZennyBigReaderLockDestroy(struct ZennyBigReaderLock *lock)
+{
+    ZennyAtomicFreePaddedArray(lock->readers);
+    lock->readers = NULL;
+}
+
+static volatile struct ZennyAtomicType* ZennyBigReaderLockSlot(struct ZennyBigReaderLock *lock)
+{
+    return &lock->readers[ZennyAtomicThreadIndex() & lock->slotMask].atomic;
+}
+
+void ZennyBigReaderLockReadLock(struct ZennyBigReaderLock *lock)
+{
+    volatile struct ZennyAtomicType *slot = ZennyBigReaderLockSlot(lock);
+    struct ZennyAtomicBackoff backoff;
+    ZennyRWLockBackoffInit(&backoff);
+
+    for (;;)
+    {
+        // Announce first, then check for a writer; the writer raises its flag first, then checks the slots,
+        // so at least one of them sees the other
+        ZennyAtomicAddInt(slot, 1);
+        if (ZennyAtomicLoadInt(&lock->writer.atomic) == 0)
+            return;
+
+        // Step back so that the writer can drain the slot, and wait until it is done
+        ZennyAtomicSubIntExplicit(slot, 1, ZennyMemoryOrderRelease);
+        while (ZennyAtomicLoadIntExplicit(&lock->writer.atomic, ZennyMemoryOrderRelaxed) != 0)
+            ZennyAtomicBackoffSpin(&backoff);
+    }
+}
+
+void ZennyBigReaderLockReadUnlock(struct ZennyBigReaderLock *lock)
+{
+    ZennyAtomicSubIntExplicit(ZennyBigReaderLockSlot(lock), 1, ZennyMemoryOrderRelease);
+}
+
+void ZennyBigReaderLockWriteLock(struct ZennyBigReaderLock *lock)
+{
+    struct ZennyAtomicBackoff backoff;
+    ZennyRWLockBackoffInit(&backoff);
+
+    int expected = 0;
+    while (!ZennyAtomicCompareExchangeWeakInt(&lock->writer.atomic, &expected, 1))
+    {
+        expected = 0;
+        ZennyAtomicBackoffSpin(&backoff);
+    }
+
+    // Order the raised flag before the loads of the slots, as a reader orders its slot before the load of the flag.
+    // Acquire pairs with the readers' release, so that their reads happen before the writes of this writer.
+    ZennyAtomicThreadFence(ZennyMemoryOrderSeqCst);
+    for (unsigned i = 0; i <= lock->slotMask; i++)
+    {
+        while (ZennyAtomicLoadIntExplicit(&lock->readers[i].atomic, ZennyMemoryOrderAcquire) != 0)
+            ZennyAtomicBackoffSpin(&backoff);
+    }
+}
+
+void ZennyBigReaderLockWriteUnlock(struct ZennyBigReaderLock *lock)
+{
+    ZennyAtomicStoreIntExplicit(&lock->writer.atomic, 0, ZennyMemoryOrderRelease);
+}
+
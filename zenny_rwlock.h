@@ -0,0 +1,131 @@
+//
+//  zenny_rwlock.h
+//  ZennyAtomics
+//
+//  Copyright © 2019 Zenny Chen. All rights reserved.
+//
+
+#ifndef zenny_rwlock_h
+#define zenny_rwlock_h
+
+#include "zenny_atomics.h"
+
+// MARK: Reader-writer spin lock
+
+/**
+ * Single-word reader-writer spin lock with writer preference.
+ * The word holds a writer bit, the number of waiting writers (up to 2047) and the number of readers.
+ * Readers stay out while any writer is waiting, and a waiting writer leaves the count only when it acquires the lock,
+ * so a steady stream of readers cannot starve writers. Every reader still updates the same word.
+ */
+struct ZennyRWSpinLock
+{
+    struct ZennyAtomicInt state;
+};
+
+/**
+ * Initialize a reader-writer spin lock to the unlocked state
+ * @param lock pointer to the lock object
+ */
+extern void ZennyRWSpinLockInit(struct ZennyRWSpinLock *lock);
+
+/**
+ * Acquire a reader-writer spin lock for reading, spinning while any writer holds or waits for it
+ * @param lock pointer to the lock object
+ */
+extern void ZennyRWSpinLockReadLock(struct ZennyRWSpinLock *lock);
+
+/**
+ * Try to acquire a reader-writer spin lock for reading without waiting
+ * @param lock pointer to the lock object
+ * @return true if the lock has been acquired; false if a writer holds or waits for it.
+ */
+extern bool ZennyRWSpinLockTryReadLock(struct ZennyRWSpinLock *lock);
+
+/**
+ * Release a reader-writer spin lock held for reading
+ * @param lock pointer to the lock object
+ */
+extern void ZennyRWSpinLockReadUnlock(struct ZennyRWSpinLock *lock);
+
+/**
+ * Acquire a reader-writer spin lock for writing, spinning until every reader and writer has left
+ * @param lock pointer to the lock object
+ */
+extern void ZennyRWSpinLockWriteLock(struct ZennyRWSpinLock *lock);
+
+/**
+ * Try to acquire a reader-writer spin lock for writing without waiting
+ * @param lock pointer to the lock object
+ * @return true if the lock has been acquired; false if it is held by anybody.
+ */
+extern bool ZennyRWSpinLockTryWriteLock(struct ZennyRWSpinLock *lock);
+
+/**
+ * Release a reader-writer spin lock held for writing
+ * @param lock pointer to the lock object held by the calling thread
+ */
+extern void ZennyRWSpinLockWriteUnlock(struct ZennyRWSpinLock *lock);
+
+// MARK: Big-reader lock
+
+/**
+ * Reader-writer lock for data that is read far more often than it is written.
+ * Each reader announces itself in a cache-line padded slot selected by the calling thread,
+ * like the stripes of ZennyAtomicCounter, so concurrent readers rarely touch the same line.
+ * A writer raises its flag, which keeps new readers out, and then waits for every slot to drain;
+ * writing therefore costs a pass over all slots.
+ */
+struct ZennyBigReaderLock
+{
+    /** int number of readers inside, per slot */
+    struct ZennyAtomicPaddedType *readers;
+
+    /** number of slots minus one; the number of slots is a power of two */
+    unsigned slotMask;
+
+    /** int that is nonzero while a writer holds or waits for the lock */
+    struct ZennyAtomicPaddedType writer;
+};
+
+/**
+ * Initialize a big-reader lock to the unlocked state
+ * @param lock pointer to the lock object
+ * @param slotCount number of reader slots, rounded up to a power of two.
+ * Pass 0 to use one slot per online processor.
+ * @return true if successful; false if there are too many slots or they cannot be allocated.
+ */
+extern bool ZennyBigReaderLockInit(struct ZennyBigReaderLock *lock, unsigned slotCount);
+
+/**
+ * Release the slots of a big-reader lock
+ * @param lock pointer to the lock object
+ */
+extern void ZennyBigReaderLockDestroy(struct ZennyBigReaderLock *lock);
+
+/**
+ * Acquire a big-reader lock for reading, waiting while a writer holds or waits for it
+ * @param lock pointer to the lock object
+ */
+extern void ZennyBigReaderLockReadLock(struct ZennyBigReaderLock *lock);
+
+/**
+ * Release a big-reader lock held for reading. It must be called on the thread that acquired it.
+ * @param lock pointer to the lock object
+ */
+extern void ZennyBigReaderLockReadUnlock(struct ZennyBigReaderLock *lock);
+
+/**
+ * Acquire a big-reader lock for writing, waiting until every reader and writer has left
+ * @param lock pointer to the lock object
+ */
+extern void ZennyBigReaderLockWriteLock(struct ZennyBigReaderLock *lock);
+
+/**
+ * Release a big-reader lock held for writing
+ * @param lock pointer to the lock object held by the calling thread
+ */
+extern void ZennyBigReaderLockWriteUnlock(struct ZennyBigReaderLock *lock);
+
+#endif /* zenny_rwlock_h */
+
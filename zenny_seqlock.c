@@ -0,0 +1,124 @@
+//
+//  zenny_seqlock.c
+//  ZennyAtomics
+//
+//  Copyright © 2019 Zenny Chen. All rights reserved.
+//
+
+#include <string.h>
+#include "zenny_seqlock.h"
+
+void ZennySeqlockInit(struct ZennySeqlock *lock)
+{
+    ZennyAtomicInitLong(&lock->sequence, 0);
+}
+
+// MARK: Writer
+
+void ZennySeqlockWriteBegin(struct ZennySeqlock *lock)
+{
+    struct ZennyAtomicBackoff backoff;
+    ZennyAtomicBackoffInit(&backoff, ZennyAtomicBackoffExponential, 1, ZENNY_ATOMICS_BACKOFF_MAX_SPINS, 16);
+
+    int64_t sequence = ZennyAtomicLoadLongExplicit(&lock->sequence, ZennyMemoryOrderRelaxed);
+    for (;;)
+    {
+        if ((sequence & 1) == 0 &&
+            ZennyAtomicCompareExchangeWeakLongExplicit(&lock->sequence, &sequence, sequence + 1,
+                                                       ZennyMemoryOrderAcquire, ZennyMemoryOrderRelaxed))
+            break;
+
+        ZennyAtomicBackoffSpin(&backoff);
+        sequence = ZennyAtomicLoadLongExplicit(&lock->sequence, ZennyMemoryOrderRelaxed);
+    }
+
+    // Keep the stores to the data after the odd sequence number; pairs with the acquire fence in ZennySeqlockReadRetry
+    ZennyAtomicThreadFence(ZennyMemoryOrderRelease);
+}
+
+void ZennySeqlockWriteEnd(struct ZennySeqlock *lock)
+{
+    const int64_t sequence = ZennyAtomicLoadLongExplicit(&lock->sequence, ZennyMemoryOrderRelaxed);
+    ZennyAtomicStoreLongExplicit(&lock->sequence, sequence + 1, ZennyMemoryOrderRelease);
+}
+
+// MARK: Reader
+
+int64_t ZennySeqlockReadBegin(struct ZennySeqlock *lock)
+{
+    for (;;)
+    {
+        // Acquire: the data loaded next is at least as new as this sequence number
+        const int64_t sequence = ZennyAtomicLoadLongExplicit(&lock->sequence, ZennyMemoryOrderAcquire);
+        if ((sequence & 1) == 0)
+            return sequence;
+
+        ZennyAtomicPause();
+    }
+}
+
+bool ZennySeqlockReadRetry(struct ZennySeqlock *lock, int64_t sequence)
+{
+    // Keep the loads of the data before the second load of the sequence number
+    ZennyAtomicThreadFence(ZennyMemoryOrderAcquire);
+    return ZennyAtomicLoadLongExplicit(&lock->sequence, ZennyMemoryOrderRelaxed) != sequence;
+}
+
+// MARK: Payload
+
+void ZennySeqlockLoadPayload(void *destination, const volatile void *source, size_t size)
+{
+    unsigned char *to = destination;
+    uintptr_t from = (uintptr_t)source;
+
+    // Bytes up to the first aligned word of the shared side; the private side is written with memcpy
+    for (; size > 0 && from % sizeof(size_t) != 0; from++, size--)
+        *to++ = ZennyAtomicUByteLoadExplicit((volatile struct ZennyAtomicUByte*)from, ZennyMemoryOrderRelaxed);
+
+    for (; size >= sizeof(size_t); from += sizeof(size_t), to += sizeof(size_t), size -= sizeof(size_t))
+    {
+        const size_t word = ZennyAtomicSizeLoadExplicit((volatile struct ZennyAtomicSize*)from, ZennyMemoryOrderRelaxed);
+        memcpy(to, &word, sizeof(word));
+    }
+
+    for (; size > 0; from++, size--)
+        *to++ = ZennyAtomicUByteLoadExplicit((volatile struct ZennyAtomicUByte*)from, ZennyMemoryOrderRelaxed);
+}
+
+void ZennySeqlockStorePayload(volatile void *destination, const void *source, size_t size)
+{
+    uintptr_t to = (uintptr_t)destination;
+    const unsigned char *from = source;
+
+    for (; size > 0 && to % sizeof(size_t) != 0; to++, size--)
+        ZennyAtomicUByteStoreExplicit((volatile struct ZennyAtomicUByte*)to, *from++, ZennyMemoryOrderRelaxed);
+
+    for (; size >= sizeof(size_t); to += sizeof(size_t), from += sizeof(size_t), size -= sizeof(size_t))
+    {
+        size_t word;
+        memcpy(&word, from, sizeof(word));
+        ZennyAtomicSizeStoreExplicit((volatile struct ZennyAtomicSize*)to, word, ZennyMemoryOrderRelaxed);
+    }
+
+    for (; size > 0; to++, size--)
+        ZennyAtomicUByteStoreExplicit((volatile struct ZennyAtomicUByte*)to, *from++, ZennyMemoryOrderRelaxed);
+}
+
+void ZennySeqlockRead(struct ZennySeqlock *lock, void *destination, const volatile void *source, size_t size)
+{
+    int64_t sequence;
+    do
+    {
+        sequence = ZennySeqlockReadBegin(lock);
+        ZennySeqlockLoadPayload(destination, source, size);
+    }
+    while (ZennySeqlockReadRetry(lock, sequence));
+}
+
+void ZennySeqlockWrite(struct ZennySeqlock *lock, volatile void *destination, const void *source, size_t size)
+{
+    ZennySeqlockWriteBegin(lock);
+    ZennySeqlockStorePayload(destination, source, size);
+    ZennySeqlockWriteEnd(lock);
+}
+
@@ -0,0 +1,95 @@
+//
+//  zenny_seqlock.h
+//  ZennyAtomics
+//
+//  Copyright © 2019 Zenny Chen. All rights reserved.
+//
+
+#ifndef zenny_seqlock_h
+#define zenny_seqlock_h
+
+#include "zenny_atomics.h"
+
+/**
+ * Sequence lock for read-mostly data larger than one atomic word.
+ * A writer makes the sequence number odd, updates the data and makes it even again;
+ * a reader copies the data between two loads of the sequence number and retries if they differ or are odd.
+ * Readers never write shared memory, so any number of them scale without contention, but they may retry while a writer runs.
+ * The protected data must be accessed through ZennySeqlockLoadPayload and ZennySeqlockStorePayload
+ * (or other relaxed atomics), since readers and the writer touch it concurrently.
+ */
+struct ZennySeqlock
+{
+    /** int64_t sequence number, odd while a writer is active */
+    alignas(ZENNY_ATOMICS_CACHE_LINE_SIZE) struct ZennyAtomicType sequence;
+};
+
+/**
+ * Initialize a sequence lock with no writer active
+ * @param lock pointer to the sequence lock object
+ */
+extern void ZennySeqlockInit(struct ZennySeqlock *lock);
+
+/**
+ * Start a write. Concurrent writers are serialized: each waits until the sequence number is even and makes it odd.
+ * @param lock pointer to the sequence lock object
+ */
+extern void ZennySeqlockWriteBegin(struct ZennySeqlock *lock);
+
+/**
+ * Finish a write started with ZennySeqlockWriteBegin, publishing the data to readers
+ * @param lock pointer to the sequence lock object
+ */
+extern void ZennySeqlockWriteEnd(struct ZennySeqlock *lock);
+
+/**
+ * Start a read attempt, waiting while a writer is active
+ * @param lock pointer to the sequence lock object
+ * @return the even sequence number to be passed to ZennySeqlockReadRetry
+ */
+extern int64_t ZennySeqlockReadBegin(struct ZennySeqlock *lock);
+
+/**
+ * Check whether the data read since ZennySeqlockReadBegin may be torn
+ * @param lock pointer to the sequence lock object
+ * @param sequence the value returned by ZennySeqlockReadBegin
+ * @return true if a writer has run in the meantime and the read must be repeated
+ */
+extern bool ZennySeqlockReadRetry(struct ZennySeqlock *lock, int64_t sequence);
+
+/**
+ * Copy shared data with relaxed atomic loads, a size_t word at a time where alignment allows
+ * @param destination private buffer of `size` bytes
+ * @param source shared data protected by a sequence lock
+ * @param size number of bytes
+ */
+extern void ZennySeqlockLoadPayload(void *destination, const volatile void *source, size_t size);
+
+/**
+ * Copy data to shared memory with relaxed atomic stores, a size_t word at a time where alignment allows
+ * @param destination shared data protected by a sequence lock
+ * @param source private buffer of `size` bytes
+ * @param size number of bytes
+ */
+extern void ZennySeqlockStorePayload(volatile void *destination, const void *source, size_t size);
+
+/**
+ * Take a consistent snapshot of shared data: read it repeatedly until no writer has interfered
+ * @param lock pointer to the sequence lock object
+ * @param destination private buffer of `size` bytes
+ * @param source shared data protected by `lock`
+ * @param size number of bytes
+ */
+extern void ZennySeqlockRead(struct ZennySeqlock *lock, void *destination, const volatile void *source, size_t size);
+
+/**
+ * Replace shared data as one write
+ * @param lock pointer to the sequence lock object
+ * @param destination shared data protected by `lock`
+ * @param source private buffer of `size` bytes
+ * @param size number of bytes
+ */
+extern void ZennySeqlockWrite(struct ZennySeqlock *lock, volatile void *destination, const void *source, size_t size);
+
+#endif /* zenny_seqlock_h */
+
@@ -0,0 +1,141 @@
+//
+//  zenny_spinlock.c
+//  ZennyAtomics
+//
+//  Copyright © 2019 Zenny Chen. All rights reserved.
+//
+
+#include "zenny_spinlock.h"
+
+/** Upper bound of the number of pause instructions between two attempts to take a test-and-test-and-set lock */
+#define ZENNY_SPINLOCK_MAX_BACKOFF      1024
+
+/** Number of pause instructions a ticket lock waiter spends per ticket ahead of it */
+#define ZENNY_TICKET_LOCK_BACKOFF_UNIT  32
+
+// MARK: Test-and-test-and-set lock
+
+void ZennySpinLockInit(struct ZennySpinLock *lock)
+{
+    ZennyAtomicFlagInit(&lock->locked);
+}
+
+void ZennySpinLockLock(struct ZennySpinLock *lock)
+{
+    struct ZennyAtomicBackoff backoff;
+    ZennyAtomicBackoffInit(&backoff, ZennyAtomicBackoffExponential, 1, ZENNY_SPINLOCK_MAX_BACKOFF, 0);
+
+    while (ZennyAtomicFlagTestAndSetExplicit(&lock->locked, ZennyMemoryOrderAcquire))
+    {
+        // Wait with plain loads until the lock looks free, so that waiters do not steal the line from the owner
+        do
+        {
+            ZennyAtomicBackoffSpin(&backoff);
+        } while (ZennyAtomicFlagLoadExplicit(&lock->locked, ZennyMemoryOrderRelaxed));
+    }
+}
+
+bool ZennySpinLockTryLock(struct ZennySpinLock *lock)
+{
+    return !ZennyAtomicFlagLoadExplicit(&lock->locked, ZennyMemoryOrderRelaxed) &&
+           !ZennyAtomicFlagTestAndSetExplicit(&lock->locked, ZennyMemoryOrderAcquire);
+}
+
+void ZennySpinLockUnlock(struct ZennySpinLock *lock)
+{
+    ZennyAtomicFlagClearExplicit(&lock->locked, ZennyMemoryOrderRelease);
+}
+
+// MARK: Ticket lock
+
+void ZennyTicketLockInit(struct ZennyTicketLock *lock)
+{
+    ZennyAtomicInitInt(&lock->next, 0);
+    ZennyAtomicInitInt(&lock->serving, 0);
+}
+
+void ZennyTicketLockLock(struct ZennyTicketLock *lock)
+{
+    const int ticket = ZennyAtomicAddIntExplicit(&lock->next, 1, ZennyMemoryOrderRelaxed);
+
+    for (;;)
+    {
+        const int serving = ZennyAtomicLoadIntExplicit(&lock->serving, ZennyMemoryOrderAcquire);
+        if (serving == ticket)
+            break;
+
+        // Tickets wrap around, so the distance is computed in unsigned arithmetic
+        const unsigned distance = (unsigned)ticket - (unsigned)serving;
+        for (unsigned i = 0; i < distance * ZENNY_TICKET_LOCK_BACKOFF_UNIT; i++)
+            ZennyAtomicPause();
+    }
+}
+
+bool ZennyTicketLockTryLock(struct ZennyTicketLock *lock)
+{
+    int ticket = ZennyAtomicLoadIntExplicit(&lock->serving, ZennyMemoryOrderRelaxed);
+
+    // Draw a ticket only if it is the one being served
+    return ZennyAtomicCompareExchangeIntExplicit(&lock->next, &ticket, (int)((unsigned)ticket + 1),
+                                                 ZennyMemoryOrderAcquire, ZennyMemoryOrderRelaxed);
+}
+
+void ZennyTicketLockUnlock(struct ZennyTicketLock *lock)
+{
+    // Only the owner writes `serving`, so a load and a store suffice
+    const int serving = ZennyAtomicLoadIntExplicit(&lock->serving, ZennyMemoryOrderRelaxed);
+    ZennyAtomicStoreIntExplicit(&lock->serving, (int)((unsigned)serving + 1), ZennyMemoryOrderRelease);
+}
+
+// MARK: MCS queue lock
+
+void ZennyMCSLockInit(struct ZennyMCSLock *lock)
+{
+    ZennyAtomicInitPtr(&lock->tail, 0);
+}
+
+void ZennyMCSLockLock(struct ZennyMCSLock *lock, struct ZennyMCSLockNode *node)
+{
+    ZennyAtomicInitPtr(&node->next, 0);
+    ZennyAtomicInitInt(&node->waiting, 1);
+
+    struct ZennyMCSLockNode *predecessor =
+        (struct ZennyMCSLockNode*)ZennyAtomicExchangePtrExplicit(&lock->tail, (intptr_t)node, ZennyMemoryOrderAcqRel);
+    if (predecessor == NULL)
+        return;
+
+    ZennyAtomicStorePtrExplicit(&predecessor->next, (intptr_t)node, ZennyMemoryOrderRelease);
+
+    while (ZennyAtomicLoadIntExplicit(&node->waiting, ZennyMemoryOrderAcquire) != 0)
+        ZennyAtomicPause();
+}
+
+bool ZennyMCSLockTryLock(struct ZennyMCSLock *lock, struct ZennyMCSLockNode *node)
+{
+    ZennyAtomicInitPtr(&node->next, 0);
+    ZennyAtomicInitInt(&node->waiting, 0);
+
+    intptr_t expected = 0;
+    return ZennyAtomicCompareExchangePtrExplicit(&lock->tail, &expected, (intptr_t)node,
+                                                 ZennyMemoryOrderAcquire, ZennyMemoryOrderRelaxed);
+}
+
+void ZennyMCSLockUnlock(struct ZennyMCSLock *lock, struct ZennyMCSLockNode *node)
+{
+    struct ZennyMCSLockNode *successor = (struct ZennyMCSLockNode*)ZennyAtomicLoadPtrExplicit(&node->next, ZennyMemoryOrderAcquire);
+
+    if (successor == NULL)
+    {
+        // No known successor: try to mark the lock free
+        intptr_t expected = (intptr_t)node;
+        if (ZennyAtomicCompareExchangePtrExplicit(&lock->tail, &expected, 0, ZennyMemoryOrderRelease, ZennyMemoryOrderRelaxed))
+            return;
+
+        // A thread has swapped itself into the tail but not yet linked itself behind this node
+        while ((successor = (struct ZennyMCSLockNode*)ZennyAtomicLoadPtrExplicit(&node->next, ZennyMemoryOrderAcquire)) == NULL)
+            ZennyAtomicPause();
+    }
+
+    ZennyAtomicStoreIntExplicit(&successor->waiting, 0, ZennyMemoryOrderRelease);
+}
+
@@ -0,0 +1,149 @@
+//
+//  zenny_spinlock.h
+//  ZennyAtomics
+//
+//  Copyright © 2019 Zenny Chen. All rights reserved.
+//
+
+#ifndef zenny_spinlock_h
+#define zenny_spinlock_h
+
+#include "zenny_atomics.h"
+
+// MARK: Test-and-test-and-set lock
+
+/**
+ * Test-and-test-and-set spin lock.
+ * Waiters spin on plain loads, which stay in their own caches, and only attempt the test-and-set
+ * once the lock looks free. Between failed attempts they back off exponentially.
+ * It is small and fast when uncontended, but not fair.
+ */
+struct ZennySpinLock
+{
+    struct ZennyAtomicFlag locked;
+};
+
+/**
+ * Initialize a spin lock to the unlocked state
+ * @param lock pointer to the lock object
+ */
+extern void ZennySpinLockInit(struct ZennySpinLock *lock);
+
+/**
+ * Acquire a spin lock, spinning until it is available
+ * @param lock pointer to the lock object
+ */
+extern void ZennySpinLockLock(struct ZennySpinLock *lock);
+
+/**
+ * Try to acquire a spin lock without waiting
+ * @param lock pointer to the lock object
+ * @return true if the lock has been acquired; false if it is held by another thread.
+ */
+extern bool ZennySpinLockTryLock(struct ZennySpinLock *lock);
+
+/**
+ * Release a spin lock
+ * @param lock pointer to the lock object held by the calling thread
+ */
+extern void ZennySpinLockUnlock(struct ZennySpinLock *lock);
+
+// MARK: Ticket lock
+
+/**
+ * Fair ticket lock.
+ * Each thread draws a ticket with a single atomic add and waits until it is served,
+ * so the lock is granted in first-come, first-served order.
+ * Waiters back off in proportion to their distance from the head of the queue.
+ */
+struct ZennyTicketLock
+{
+    /** next ticket to be handed out */
+    struct ZennyAtomicType next;
+
+    /** ticket currently holding the lock */
+    struct ZennyAtomicType serving;
+};
+
+/**
+ * Initialize a ticket lock to the unlocked state
+ * @param lock pointer to the lock object
+ */
+extern void ZennyTicketLockInit(struct ZennyTicketLock *lock);
+
+/**
+ * Acquire a ticket lock, waiting for the turn of the calling thread
+ * @param lock pointer to the lock object
+ */
+extern void ZennyTicketLockLock(struct ZennyTicketLock *lock);
+
+/**
+ * Try to acquire a ticket lock without waiting.
+ * A ticket is only drawn if it would be served immediately.
+ * @param lock pointer to the lock object
+ * @return true if the lock has been acquired; false if it is held or waited for by another thread.
+ */
+extern bool ZennyTicketLockTryLock(struct ZennyTicketLock *lock);
+
+/**
+ * Release a ticket lock and pass it to the next ticket
+ * @param lock pointer to the lock object held by the calling thread
+ */
+extern void ZennyTicketLockUnlock(struct ZennyTicketLock *lock);
+
+// MARK: MCS queue lock
+
+/**
+ * Queue node of an MCS lock.
+ * Each thread acquiring the lock provides its own node, which must stay valid until the lock is released.
+ */
+struct ZennyMCSLockNode
+{
+    /** the node of the thread queued behind this one */
+    struct ZennyAtomicType next;
+
+    /** int that is nonzero while the owner of this node has to wait */
+    struct ZennyAtomicType waiting;
+};
+
+/**
+ * MCS queue lock.
+ * Waiters form a linked queue and each one spins on the flag of its own node,
+ * so a release only touches the cache line of the next waiter. The lock is granted in FIFO order.
+ */
+struct ZennyMCSLock
+{
+    /** the node of the last thread in the queue, or 0 if the lock is free */
+    struct ZennyAtomicType tail;
+};
+
+/**
+ * Initialize an MCS lock to the unlocked state
+ * @param lock pointer to the lock object
+ */
+extern void ZennyMCSLockInit(struct ZennyMCSLock *lock);
+
+/**
+ * Acquire an MCS lock, queuing behind the current waiters
+ * @param lock pointer to the lock object
+ * @param node queue node of the calling thread
+ */
+extern void ZennyMCSLockLock(struct ZennyMCSLock *lock, struct ZennyMCSLockNode *node);
+
+/**
+ * Try to acquire an MCS lock without waiting
+ * @param lock pointer to the lock object
+ * @param node queue node of the calling thread
+ * @return true if the lock has been acquired; false if it is held by another thread.
+ */
+extern bool ZennyMCSLockTryLock(struct ZennyMCSLock *lock, struct ZennyMCSLockNode *node);
+
+/**
+ * Release an MCS lock and hand it to the next waiter, if any
+ * @param lock pointer to the lock object held by the calling thread
+ * @param node the queue node passed to the lock operation
+ */
+extern void ZennyMCSLockUnlock(struct ZennyMCSLock *lock, struct ZennyMCSLockNode *node);
+
+#endif /* zenny_spinlock_h */
+
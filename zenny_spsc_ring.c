@@ -0,0 +1,178 @@
+//
+//  zenny_spsc_ring.c
+//  ZennyAtomics
+//
+//  Copyright © 2019 Zenny Chen. All rights reserved.
+//
+
+#include <string.h>
+#include "zenny_spsc_ring.h"
+
+bool ZennySpscRingInit(struct ZennySpscRing *ring, size_t capacity, size_t elementSize)
+{
+    const size_t roundedCapacity = ZennyAtomicRoundUpPowerOfTwo(capacity);
+    if (roundedCapacity == 0 || elementSize == 0 || roundedCapacity > SIZE_MAX / elementSize)
+    {
+        ring->buffer = NULL;
+        return false;
+    }
+
+    ring->buffer = ZennyAtomicAllocCacheAligned(roundedCapacity * elementSize);
+    ring->mask = roundedCapacity - 1;
+    ring->elementSize = elementSize;
+    ZennyAtomicSizeInit(&ring->tail, 0);
+    ring->cachedHead = 0;
+    ZennyAtomicSizeInit(&ring->head, 0);
+    ring->cachedTail = 0;
+
+    return ring->buffer != NULL;
+}
+
+void ZennySpscRingDestroy(struct ZennySpscRing *ring)
+{
+    ZennyAtomicFreeCacheAligned(ring->buffer);
+    ring->buffer = NULL;
+}
+
+// MARK: Producer
+
+/** Number of free slots, at least `wanted` if possible; reloads the head only when the cached one is not enough */
+static size_t ZennySpscRingFreeSlots(struct ZennySpscRing *ring, size_t tail, size_t wanted)
+{
+    const size_t capacity = ring->mask + 1;
+    size_t freeSlots = capacity - (tail - ring->cachedHead);
+    if (freeSlots < wanted)
+    {
+        // Acquire pairs with the consumer's release, so that it has finished reading the slots before they are overwritten
+        ring->cachedHead = ZennyAtomicSizeLoadExplicit(&ring->head, ZennyMemoryOrderAcquire);
+        freeSlots = capacity - (tail - ring->cachedHead);
+    }
+
+    return freeSlots;
+}
+
+bool ZennySpscRingPush(struct ZennySpscRing *ring, const void *element)
+{
+    const size_t tail = ZennyAtomicSizeLoadExplicit(&ring->tail, ZennyMemoryOrderRelaxed);
+    if (ZennySpscRingFreeSlots(ring, tail, 1) == 0)
+        return false;
+
+    memcpy(ring->buffer + (tail & ring->mask) * ring->elementSize, element, ring->elementSize);
+    ZennyAtomicSizeStoreExplicit(&ring->tail, tail + 1, ZennyMemoryOrderRelease);
+    return true;
+}
+
+size_t ZennySpscRingPushBatch(struct ZennySpscRing *ring, const void *elements, size_t count)
+{
+    const size_t tail = ZennyAtomicSizeLoadExplicit(&ring->tail, ZennyMemoryOrderRelaxed);
+    const size_t freeSlots = ZennySpscRingFreeSlots(ring, tail, count);
+    if (count > freeSlots)
+        count = freeSlots;
+    if (count == 0)
+        return 0;
+
+    // Copy in at most two pieces, split where the storage wraps around
+    const size_t position = tail & ring->mask;
+    const size_t firstCount = count < ring->mask + 1 - position ? count : ring->mask + 1 - position;
+    memcpy(ring->buffer + position * ring->elementSize, elements, firstCount * ring->elementSize);
+    memcpy(ring->buffer, (const unsigned char*)elements + firstCount * ring->elementSize, (count - firstCount) * ring->elementSize);
+
+    ZennyAtomicSizeStoreExplicit(&ring->tail, tail + count, ZennyMemoryOrderRelease);
+    return count;
+}
+
+size_t ZennySpscRingReserve(struct ZennySpscRing *ring, size_t count, void **region)
+{
+    const size_t tail = ZennyAtomicSizeLoadExplicit(&ring->tail, ZennyMemoryOrderRelaxed);
+    const size_t freeSlots = ZennySpscRingFreeSlots(ring, tail, count);
+    const size_t position = tail & ring->mask;
+    const size_t contiguous = ring->mask + 1 - position;
+
+    if (count > freeSlots)
+        count = freeSlots;
+    if (count > contiguous)
+        count = contiguous;
+
+    *region = ring->buffer + position * ring->elementSize;
+    return count;
+}
+
+void ZennySpscRingCommit(struct ZennySpscRing *ring, size_t count)
+{
+    const size_t tail = ZennyAtomicSizeLoadExplicit(&ring->tail, ZennyMemoryOrderRelaxed);
+    ZennyAtomicSizeStoreExplicit(&ring->tail, tail + count, ZennyMemoryOrderRelease);
+}
+
+// MARK: Consumer
+
+/** Number of published elements, at least `wanted` if possible; reloads the tail only when the cached one is not enough */
+static size_t ZennySpscRingAvailable(struct ZennySpscRing *ring, size_t head, size_t wanted)
+{
+    size_t available = ring->cachedTail - head;
+    if (available < wanted)
+    {
+        // Acquire pairs with the producer's release, so that the elements are visible before they are read
+        ring->cachedTail = ZennyAtomicSizeLoadExplicit(&ring->tail, ZennyMemoryOrderAcquire);
+        available = ring->cachedTail - head;
+    }
+
+    return available;
+}
+
+bool ZennySpscRingPop(struct ZennySpscRing *ring, void *element)
+{
+    const size_t head = ZennyAtomicSizeLoadExplicit(&ring->head, ZennyMemoryOrderRelaxed);
+    if (ZennySpscRingAvailable(ring, head, 1) == 0)
+        return false;
+
+    memcpy(element, ring->buffer + (head & ring->mask) * ring->elementSize, ring->elementSize);
+    ZennyAtomicSizeStoreExplicit(&ring->head, head + 1, ZennyMemoryOrderRelease);
+    return true;
+}
+
+size_t ZennySpscRingPopBatch(struct ZennySpscRing *ring, void *elements, size_t count)
+{
+    const size_t head = ZennyAtomicSizeLoadExplicit(&ring->head, ZennyMemoryOrderRelaxed);
+    const size_t available = ZennySpscRingAvailable(ring, head, count);
+    if (count > available)
+        count = available;
+    if (count == 0)
+        return 0;
+
+    const size_t position = head & ring->mask;
+    const size_t firstCount = count < ring->mask + 1 - position ? count : ring->mask + 1 - position;
+    memcpy(elements, ring->buffer + position * ring->elementSize, firstCount * ring->elementSize);
+    memcpy((unsigned char*)elements + firstCount * ring->elementSize, ring->buffer, (count - firstCount) * ring->elementSize);
+
+    ZennyAtomicSizeStoreExplicit(&ring->head, head + count, ZennyMemoryOrderRelease);
+    return count;
+}
+
+size_t ZennySpscRingPeek(struct ZennySpscRing *ring, size_t count, const void **region)
+{
+    const size_t head = ZennyAtomicSizeLoadExplicit(&ring->head, ZennyMemoryOrderRelaxed);
+    const size_t available = ZennySpscRingAvailable(ring, head, count);
+    const size_t position = head & ring->mask;
+    const size_t contiguous = ring->mask + 1 - position;
+
+    if (count > available)
+        count = available;
+    if (count > contiguous)
+        count = contiguous;
+
+    *region = ring->buffer + position * ring->elementSize;
+    return count;
+}
+
+void ZennySpscRingRelease(struct ZennySpscRing *ring, size_t count)
+{
+    const size_t head = ZennyAtomicSizeLoadExplicit(&ring->head, ZennyMemoryOrderRelaxed);
+    ZennyAtomicSizeStoreExplicit(&ring->head, head + count, ZennyMemoryOrderRelease);
+}
+
+size_t ZennySpscRingSize(struct ZennySpscRing *ring)
+{
+    const size_t head = ZennyAtomicSizeLoadExplicit(&ring->head, ZennyMemoryOrderAcquire);
+    const size_t tail = ZennyAtomicSizeLoadExplicit(&ring->tail, ZennyMemoryOrderAcquire);
+    return tail - head;
+}
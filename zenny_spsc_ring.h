@@ -0,0 +1,136 @@
+//
+//  zenny_spsc_ring.h
+//  ZennyAtomics
+//
+//  Copyright © 2019 Zenny Chen. All rights reserved.
+//
+
+#ifndef zenny_spsc_ring_h
+#define zenny_spsc_ring_h
+
+#include "zenny_atomics.h"
+
+/**
+ * Lock-free ring buffer of fixed-size elements between exactly one producer thread and one consumer thread.
+ * The producer publishes elements by storing the tail with release order, and the consumer frees slots by storing the head
+ * with release order. Each side keeps a private copy of the other side's index, and it reloads the shared index
+ * only when the copy says the ring is full (or empty). Most operations therefore touch no cache line written by the other core.
+ */
+struct ZennySpscRing
+{
+    /** element storage, capacity * elementSize bytes */
+    alignas(ZENNY_ATOMICS_CACHE_LINE_SIZE) unsigned char *buffer;
+
+    /** number of slots minus one; the number of slots is a power of two */
+    size_t mask;
+
+    /** size of one element in bytes */
+    size_t elementSize;
+
+    /** total number of elements ever pushed; written by the producer only */
+    alignas(ZENNY_ATOMICS_CACHE_LINE_SIZE) struct ZennyAtomicSize tail;
+
+    /** the producer's last view of `head` */
+    size_t cachedHead;
+
+    /** total number of elements ever popped; written by the consumer only */
+    alignas(ZENNY_ATOMICS_CACHE_LINE_SIZE) struct ZennyAtomicSize head;
+
+    /** the consumer's last view of `tail` */
+    size_t cachedTail;
+};
+
+/**
+ * Initialize an empty ring
+ * @param ring pointer to the ring object
+ * @param capacity number of slots, rounded up to a power of two
+ * @param elementSize size of one element in bytes
+ * @return true if successful; false if the storage is too large or cannot be allocated.
+ */
+extern bool ZennySpscRingInit(struct ZennySpscRing *ring, size_t capacity, size_t elementSize);
+
+/**
+ * Release the storage of a ring
+ * @param ring pointer to the ring object
+ */
+extern void ZennySpscRingDestroy(struct ZennySpscRing *ring);
+
+/**
+ * Copy one element into the ring. Producer only.
+ * @param ring pointer to the ring object
+ * @param element pointer to `elementSize` bytes to be copied
+ * @return true if the element has been pushed; false if the ring is full.
+ */
+extern bool ZennySpscRingPush(struct ZennySpscRing *ring, const void *element);
+
+/**
+ * Copy up to `count` elements into the ring and publish them together. Producer only.
+ * @param ring pointer to the ring object
+ * @param elements pointer to `count` contiguous elements
+ * @param count number of elements to push
+ * @return the number of elements pushed, less than `count` if the ring fills up
+ */
+extern size_t ZennySpscRingPushBatch(struct ZennySpscRing *ring, const void *elements, size_t count);
+
+/**
+ * Reserve free slots to be filled in place. Producer only.
+ * The slots are contiguous, so fewer than `count` may be returned where the storage wraps around.
+ * Publish them with ZennySpscRingCommit.
+ * @param ring pointer to the ring object
+ * @param count number of slots wanted
+ * @param region receives the address of the first reserved slot
+ * @return the number of slots reserved; 0 if the ring is full
+ */
+extern size_t ZennySpscRingReserve(struct ZennySpscRing *ring, size_t count, void **region);
+
+/**
+ * Publish slots filled after ZennySpscRingReserve. Producer only.
+ * @param ring pointer to the ring object
+ * @param count number of slots to publish, at most the number reserved
+ */
+extern void ZennySpscRingCommit(struct ZennySpscRing *ring, size_t count);
+
+/**
+ * Copy one element out of the ring. Consumer only.
+ * @param ring pointer to the ring object
+ * @param element pointer to `elementSize` bytes receiving the element
+ * @return true if an element has been popped; false if the ring is empty.
+ */
+extern bool ZennySpscRingPop(struct ZennySpscRing *ring, void *element);
+
+/**
+ * Copy up to `count` elements out of the ring and free their slots together. Consumer only.
+ * @param ring pointer to the ring object
+ * @param elements pointer to room for `count` contiguous elements
+ * @param count maximum number of elements to pop
+ * @return the number of elements popped
+ */
+extern size_t ZennySpscRingPopBatch(struct ZennySpscRing *ring, void *elements, size_t count);
+
+/**
+ * Look at published elements in place. Consumer only.
+ * The elements are contiguous, so fewer than `count` may be returned where the storage wraps around.
+ * Free them with ZennySpscRingRelease.
+ * @param ring pointer to the ring object
+ * @param count number of elements wanted
+ * @param region receives the address of the first element
+ * @return the number of elements available; 0 if the ring is empty
+ */
+extern size_t ZennySpscRingPeek(struct ZennySpscRing *ring, size_t count, const void **region);
+
+/**
+ * Free slots looked at with ZennySpscRingPeek. Consumer only.
+ * @param ring pointer to the ring object
+ * @param count number of elements to free, at most the number returned by ZennySpscRingPeek
+ */
+extern void ZennySpscRingRelease(struct ZennySpscRing *ring, size_t count);
+
+/**
+ * Number of elements in the ring; exact only when neither side is running
+ * @param ring pointer to the ring object
+ * @return the number of elements pushed and not yet popped
+ */
+extern size_t ZennySpscRingSize(struct ZennySpscRing *ring);
+
+#endif /* zenny_spsc_ring_h */
+
@@ -0,0 +1,153 @@
+//
+//  zenny_sync.c
+//  ZennyAtomics
+//
+//  Copyright © 2019 Zenny Chen. All rights reserved.
+//
+
+#include "zenny_sync.h"
+
+/** Bounds and initial value of the adaptive polling budget, in pause instructions */
+#define ZENNY_SYNC_MIN_SPIN     16
+#define ZENNY_SYNC_MAX_SPIN     16384
+#define ZENNY_SYNC_INITIAL_SPIN 1024
+
+/**
+ * Poll `word` while it holds `old`, within the budget of the object, and adapt the budget to the outcome
+ * @return true if the value has changed; false if the caller should park
+ */
+static bool ZennySyncSpinWhile(volatile struct ZennyAtomicType *word, int old, volatile struct ZennyAtomicInt *budget)
+{
+    const int limit = ZennyAtomicIntLoadExplicit(budget, ZennyMemoryOrderRelaxed);
+
+    for (int i = 0; i < limit; i++)
+    {
+        if (ZennyAtomicLoadIntExplicit(word, ZennyMemoryOrderRelaxed) != old)
+        {
+            if (limit < ZENNY_SYNC_MAX_SPIN)
+                ZennyAtomicIntStoreExplicit(budget, limit * 2, ZennyMemoryOrderRelaxed);
+            return true;
+        }
+
+        ZennyAtomicPause();
+    }
+
+    if (limit > ZENNY_SYNC_MIN_SPIN)
+        ZennyAtomicIntStoreExplicit(budget, limit / 2, ZennyMemoryOrderRelaxed);
+    return false;
+}
+
+/** Return once `word` no longer holds `old`: poll first, then park */
+static void ZennySyncWaitWhile(volatile struct ZennyAtomicType *word, int old, volatile struct ZennyAtomicInt *budget)
+{
+    if (!ZennySyncSpinWhile(word, old, budget))
+        ZennyAtomicWaitInt(word, old);
+}
+
+// MARK: Barrier
+
+void ZennyBarrierInit(struct ZennyBarrier *barrier, int threadCount)
+{
+    ZennyAtomicInitInt(&barrier->remaining, threadCount);
+    ZennyAtomicInitInt(&barrier->phase, 0);
+    barrier->threadCount = threadCount;
+    ZennyAtomicIntInit(&barrier->spinBudget, ZENNY_SYNC_INITIAL_SPIN);
+}
+
+bool ZennyBarrierWait(struct ZennyBarrier *barrier)
+{
+    // Read the sense before arriving: once this thread has arrived, the last one may flip it at any time
+    const int phase = ZennyAtomicLoadIntExplicit(&barrier->phase, ZennyMemoryOrderAcquire);
+
+    // Acquire-release, so that the last thread to arrive sees what every other thread wrote before arriving
+    if (ZennyAtomicSubIntExplicit(&barrier->remaining, 1, ZennyMemoryOrderAcqRel) == 1)
+    {
+        // Nobody can arrive for the next phase before the flip, so the count is reset first
+        ZennyAtomicStoreIntExplicit(&barrier->remaining, barrier->threadCount, ZennyMemoryOrderRelaxed);
+        ZennyAtomicAddIntExplicit(&barrier->phase, 1, ZennyMemoryOrderRelease);
+        ZennyAtomicNotifyAll(&barrier->phase);
+        return true;
+    }
+
+    while (ZennyAtomicLoadIntExplicit(&barrier->phase, ZennyMemoryOrderAcquire) == phase)
+        ZennySyncWaitWhile(&barrier->phase, phase, &barrier->spinBudget);
+
+    return false;
+}
+
+// MARK: Latch
+
+void ZennyLatchInit(struct ZennyLatch *latch, int count)
+{
+    ZennyAtomicInitInt(&latch->count, count);
+    ZennyAtomicIntInit(&latch->spinBudget, ZENNY_SYNC_INITIAL_SPIN);
+}
+
+void ZennyLatchCountDown(struct ZennyLatch *latch, int n)
+{
+    if (ZennyAtomicSubIntExplicit(&latch->count, n, ZennyMemoryOrderRelease) == n)
+        ZennyAtomicNotifyAll(&latch->count);
+}
+
+bool ZennyLatchTryWait(struct ZennyLatch *latch)
+{
+    return ZennyAtomicLoadIntExplicit(&latch->count, ZennyMemoryOrderAcquire) == 0;
+}
+
+void ZennyLatchWait(struct ZennyLatch *latch)
+{
+    for (;;)
+    {
+        // Acquire: the count-downs form a release sequence, so every one of them is visible once zero is read
+        const int count = ZennyAtomicLoadIntExplicit(&latch->count, ZennyMemoryOrderAcquire);
+        if (count == 0)
+            return;
+
+        ZennySyncWaitWhile(&latch->count, count, &latch->spinBudget);
+    }
+}
+
+void ZennyLatchArriveAndWait(struct ZennyLatch *latch)
+{
+    ZennyLatchCountDown(latch, 1);
+    ZennyLatchWait(latch);
+}
+
+// MARK: Semaphore
+
+void ZennySemaphoreInit(struct ZennySemaphore *semaphore, int count)
+{
+    ZennyAtomicInitInt(&semaphore->count, count);
+    ZennyAtomicIntInit(&semaphore->spinBudget, ZENNY_SYNC_INITIAL_SPIN);
+}
+
+bool ZennySemaphoreTryWait(struct ZennySemaphore *semaphore)
+{
+    int count = ZennyAtomicLoadIntExplicit(&semaphore->count, ZennyMemoryOrderRelaxed);
+    while (count > 0)
+    {
+        // A failed exchange reloads the count
+        if (ZennyAtomicCompareExchangeWeakIntExplicit(&semaphore->count, &count, count - 1,
+                                                      ZennyMemoryOrderAcquire, ZennyMemoryOrderRelaxed))
+            return true;
+    }
+
+    return false;
+}
+
+void ZennySemaphoreWait(struct ZennySemaphore *semaphore)
+{
+    while (!ZennySemaphoreTryWait(semaphore))
+        ZennySyncWaitWhile(&semaphore->count, 0, &semaphore->spinBudget);
+}
+
+void ZennySemaphorePost(struct ZennySemaphore *semaphore, int n)
+{
+    ZennyAtomicAddIntExplicit(&semaphore->count, n, ZennyMemoryOrderRelease);
+
+    if (n == 1)
+        ZennyAtomicNotifyOne(&semaphore->count);
+    else
+        ZennyAtomicNotifyAll(&semaphore->count);
+}
+
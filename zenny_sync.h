@@ -0,0 +1,147 @@
+//
+//  zenny_sync.h
+//  ZennyAtomics
+//
+//  Copyright © 2019 Zenny Chen. All rights reserved.
+//
+
+#ifndef zenny_sync_h
+#define zenny_sync_h
+
+#include "zenny_atomics.h"
+
+/*
+ * Each primitive below polls for a while before it parks through ZennyAtomicWaitInt.
+ * The polling budget adapts per object: it doubles when the awaited change arrives while polling,
+ * and halves when the thread has to park anyway, so short waits stay in user space
+ * and long or oversubscribed waits stop burning processor time.
+ */
+
+// MARK: Barrier
+
+/**
+ * Reusable sense-reversing barrier for a fixed number of threads.
+ * The parity of `phase` is the sense: the last thread to arrive resets the count and flips it,
+ * which releases the others, and the barrier is immediately ready for the next phase.
+ */
+struct ZennyBarrier
+{
+    /** number of threads taking part */
+    int threadCount;
+
+    /** current polling budget in pause instructions; kept off the polled line, as waiters update it */
+    struct ZennyAtomicInt spinBudget;
+
+    /** int number of threads yet to arrive in the current phase */
+    alignas(ZENNY_ATOMICS_CACHE_LINE_SIZE) struct ZennyAtomicType remaining;
+
+    /** int incremented by the last thread of every phase; waiters poll it */
+    alignas(ZENNY_ATOMICS_CACHE_LINE_SIZE) struct ZennyAtomicType phase;
+};
+
+/**
+ * Initialize a barrier
+ * @param barrier pointer to the barrier object
+ * @param threadCount number of threads that have to arrive in each phase, at least 1
+ */
+extern void ZennyBarrierInit(struct ZennyBarrier *barrier, int threadCount);
+
+/**
+ * Arrive at the barrier and wait until every thread has arrived.
+ * Memory accesses made by any thread before it arrives are visible to every thread after it leaves.
+ * @param barrier pointer to the barrier object
+ * @return true on exactly one thread per phase, the last to arrive, like PTHREAD_BARRIER_SERIAL_THREAD
+ */
+extern bool ZennyBarrierWait(struct ZennyBarrier *barrier);
+
+// MARK: Latch
+
+/**
+ * One-shot countdown latch: threads wait until the count has reached zero, after which the latch stays open
+ */
+struct ZennyLatch
+{
+    /** current polling budget in pause instructions; kept off the polled line, as waiters update it */
+    struct ZennyAtomicInt spinBudget;
+
+    /** int remaining count */
+    alignas(ZENNY_ATOMICS_CACHE_LINE_SIZE) struct ZennyAtomicType count;
+};
+
+/**
+ * Initialize a latch
+ * @param latch pointer to the latch object
+ * @param count number of count-downs needed to open the latch
+ */
+extern void ZennyLatchInit(struct ZennyLatch *latch, int count);
+
+/**
+ * Decrease the count, opening the latch when it reaches zero.
+ * Memory accesses made before the count-down are visible to the threads that return from ZennyLatchWait.
+ * @param latch pointer to the latch object
+ * @param n amount to subtract; the count must not drop below zero
+ */
+extern void ZennyLatchCountDown(struct ZennyLatch *latch, int n);
+
+/**
+ * Check whether the latch is open
+ * @param latch pointer to the latch object
+ * @return true if the count has reached zero
+ */
+extern bool ZennyLatchTryWait(struct ZennyLatch *latch);
+
+/**
+ * Wait until the latch is open
+ * @param latch pointer to the latch object
+ */
+extern void ZennyLatchWait(struct ZennyLatch *latch);
+
+/**
+ * Count down by one and wait until the latch is open
+ * @param latch pointer to the latch object
+ */
+extern void ZennyLatchArriveAndWait(struct ZennyLatch *latch);
+
+// MARK: Semaphore
+
+/**
+ * Counting semaphore
+ */
+struct ZennySemaphore
+{
+    /** current polling budget in pause instructions; kept off the polled line, as waiters update it */
+    struct ZennyAtomicInt spinBudget;
+
+    /** int number of available permits */
+    alignas(ZENNY_ATOMICS_CACHE_LINE_SIZE) struct ZennyAtomicType count;
+};
+
+/**
+ * Initialize a semaphore
+ * @param semaphore pointer to the semaphore object
+ * @param count initial number of permits, at least 0
+ */
+extern void ZennySemaphoreInit(struct ZennySemaphore *semaphore, int count);
+
+/**
+ * Take a permit if one is available
+ * @param semaphore pointer to the semaphore object
+ * @return true if a permit has been taken; false if there was none.
+ */
+extern bool ZennySemaphoreTryWait(struct ZennySemaphore *semaphore);
+
+/**
+ * Take a permit, waiting until one is available
+ * @param semaphore pointer to the semaphore object
+ */
+extern void ZennySemaphoreWait(struct ZennySemaphore *semaphore);
+
+/**
+ * Release permits and wake as many waiters
+ * @param semaphore pointer to the semaphore object
+ * @param n number of permits to release, at least 1
+ */
+extern void ZennySemaphorePost(struct ZennySemaphore *semaphore, int n);
+
+#endif /* zenny_sync_h */
+